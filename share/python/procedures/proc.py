@@ -1913,8 +1913,12 @@ def run_ccenergy(name, **kwargs):
     if ref_wfn is None:
         ref_wfn = scf_helper(name, **kwargs)  # C1 certified
 
-    # Ensure IWL files have been written
-    proc_util.check_iwl_file_from_scf_type(psi4.get_option('SCF', 'SCF_TYPE'), ref_wfn)
+    # Ensure IWL files have been written; cctransort can compute the SO integrals itself
+    direct_presort = psi4.get_global_option('RUN_CCTRANSORT') and \
+        (psi4.get_option('CCENERGY', 'AO_BASIS') == 'NONE') and \
+        (psi4.get_option('CCTRANSORT', 'AO_BASIS') == 'NONE')
+    proc_util.check_iwl_file_from_scf_type(psi4.get_option('SCF', 'SCF_TYPE'), ref_wfn,
+                                           direct_presort=direct_presort)
 
     # Obtain semicanonical orbitals
     if (psi4.get_option('SCF', 'REFERENCE') == 'ROHF') and \
@@ -2016,8 +2020,12 @@ def run_bccd(name, **kwargs):
     if (psi4.get_option('SCF', 'REFERENCE') == 'ROHF'):
         ref_wfn.semicanonicalize()
 
-    # Ensure IWL files have been written
-    proc_util.check_iwl_file_from_scf_type(psi4.get_option('SCF', 'SCF_TYPE'), ref_wfn)
+    # Ensure IWL files have been written; cctransort can compute the SO integrals itself
+    direct_presort = psi4.get_global_option('RUN_CCTRANSORT') and \
+        (psi4.get_option('CCENERGY', 'AO_BASIS') == 'NONE') and \
+        (psi4.get_option('CCTRANSORT', 'AO_BASIS') == 'NONE')
+    proc_util.check_iwl_file_from_scf_type(psi4.get_option('SCF', 'SCF_TYPE'), ref_wfn,
+                                           direct_presort=direct_presort)
 
     psi4.set_local_option('TRANSQT2', 'DELETE_TEI', 'false')
     psi4.set_local_option('CCTRANSORT', 'DELETE_TEI', 'false')
@@ -2478,7 +2486,8 @@ def run_adc(name, **kwargs):
         ref_wfn = scf_helper(name, **kwargs)
 
     # Ensure IWL files have been written
-    proc_util.check_iwl_file_from_scf_type(psi4.get_option('SCF', 'SCF_TYPE'), ref_wfn)
+    proc_util.check_iwl_file_from_scf_type(psi4.get_option('SCF', 'SCF_TYPE'), ref_wfn,
+                                           direct_presort=True)
 
     return psi4.adc(ref_wfn)
 
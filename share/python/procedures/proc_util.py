@@ -122,15 +122,21 @@ def oeprop_validator(prop_list):
             raise ValidationError("OEProp: Feature '%s' is not recognized. %s" % (prop, alternatives))
     
 
-def check_iwl_file_from_scf_type(scf_type, wfn):
+def check_iwl_file_from_scf_type(scf_type, wfn, direct_presort=False):
     """
     Ensures that a IWL file has been written based on input SCF type.
+    Callers that only see the SO integrals through libtrans pass
+    *direct_presort*, in which case DIRECT_TEI_PRESORT leaves just the
+    one-electron integrals to be written.
     """
 
     if scf_type in ['DF', 'CD', 'PK', 'DIRECT']:
         mints = psi4.MintsHelper(wfn.basisset())
         mints.set_print(1)
-        mints.integrals()
+        if direct_presort and psi4.get_global_option('DIRECT_TEI_PRESORT'):
+            mints.one_electron_integrals()
+        else:
+            mints.integrals()
 
 def check_non_symmetric_jk_density(name):
     """
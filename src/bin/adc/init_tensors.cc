@@ -48,6 +48,8 @@ ADCWfn::rhf_init_tensors()
     _ints = new IntegralTransform(reference_wavefunction_, spaces, IntegralTransform::Restricted);//printf("madeok\n");
     _ints->set_keep_iwl_so_ints(true);
     _ints->set_keep_dpd_so_ints(true);
+    // The driver skips the SO integral file when asked to presort directly
+    _ints->set_direct_tei(options_.get_global("DIRECT_TEI_PRESORT").to_integer());
     dpd_set_default(_ints->get_dpd_id());
     // Make (OV|OV) integrals
     outfile->Printf( "\n\t==> Transforming (OV|OV) Integrals <==\n");
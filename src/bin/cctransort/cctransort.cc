@@ -370,6 +370,8 @@ PsiReturnType cctransort(SharedWavefunction ref, Options& options)
     outfile->Printf("\tIWL integrals will be deleted.\n");
     ints->set_keep_iwl_so_ints(false);
   }
+  // The driver skips the SO integral file under the same conditions
+  ints->set_direct_tei(options.get_global("DIRECT_TEI_PRESORT").to_integer() && options.get_str("AO_BASIS") == "NONE");
 
   // On the second and later passes of Brueckner, the presort is already done
   // TDC: Always re-compute the presorted integrals until the frozen-core operator is included
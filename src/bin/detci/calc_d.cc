@@ -52,9 +52,9 @@ namespace psi { namespace detci {
 **
 ** Returns: sum of squares of coefficients
 */
-double calc_d2(double *target, double lambda, double *Hd, int size, int precon)
+double calc_d2(double *target, double lambda, double *Hd, unsigned long int size, int precon)
 {
-   int i;
+   unsigned long int i;
    double norm = 0.0, tval, tval2;
 
    for (i=0; i<size; i++) {
@@ -87,10 +87,10 @@ double calc_d2(double *target, double lambda, double *Hd, int size, int precon)
 **
 ** Returns: sum of squares of coefficients
 */
-double calc_mpn_vec(double *target, double energy, double *Hd, int size, double
+double calc_mpn_vec(double *target, double energy, double *Hd, unsigned long int size, double
         sign1, double sign2, int precon)
 {
-   int i;
+   unsigned long int i;
    double norm = 0.0, tval, tval2;
 
    for (i=0; i<size; i++) {
@@ -49,12 +49,15 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cmath>
+#include <cstring>
 #include <boost/python.hpp>
 #include <boost/python/dict.hpp>
 #include <boost/python/tuple.hpp>
 #include <libciomr/libciomr.h>
 #include <libqt/qt.h>
 #include <libpsio/psio.h>
+#include <libpsio/psio.hpp>
+#include <libpsio/aiohandler.h>
 #include <libmints/mints.h>
 #include "structs.h"
 #include "ci_tol.h"
@@ -63,20 +66,27 @@
 
 namespace psi { namespace detci {
 
+namespace {
+
+/* One AIOHandler serves the read-aheads of all CI vectors */
+boost::shared_ptr<AIOHandler> civect_aio;
+
+}
+
 extern void transp_sigma(double **a, int rows, int cols, int phase);
-extern void xey(double *x, double *y, int size);
-extern void xeay(double *x, double a, double *y, int size);
-extern void xpeay(double *x, double a, double *y, int size);
-extern void xpey(double *x, double *y, int size);
-extern void xeax(double *x, double a, int size);
-extern void xexmy(double *x, double *y, int size);
+extern void xey(double *x, double *y, unsigned long int size);
+extern void xeay(double *x, double a, double *y, unsigned long int size);
+extern void xpeay(double *x, double a, double *y, unsigned long int size);
+extern void xpey(double *x, double *y, unsigned long int size);
+extern void xeax(double *x, double a, unsigned long int size);
+extern void xexmy(double *x, double *y, unsigned long int size);
 extern double calc_d2(double *target, double lambda, double *Hd,
-   int size, int precon);
+   unsigned long int size, int precon);
 extern double calc_mpn_vec(double *target, double energy, double *Hd,
-   int size, double sign1, double sign2, int precon);
-extern void xeaxmy(double *x, double *y, double a, int size);
-extern void xeaxpby(double *x, double *y, double a, double b, int size);
-extern void xexy(double *x, double *y, int size);
+   unsigned long int size, double sign1, double sign2, int precon);
+extern void xeaxmy(double *x, double *y, double a, unsigned long int size);
+extern void xeaxpby(double *x, double *y, double a, double b, unsigned long int size);
+extern void xexy(double *x, double *y, unsigned long int size);
 extern double ssq(struct stringwr *alplist, struct stringwr *betlist,
   double **CL, double **CR, int nas, int nbs, int Ja_list, int Jb_list,
   int num_ci_orbs, int print_lvl);
@@ -174,6 +184,12 @@ void CIvect::common_init(void) {
     cur_unit_ = 0;
     cur_size_ = 0;
     first_unit_ = 0;
+    locked_buffer_ = NULL;
+    spare_ = NULL;
+    spare_owned_ = NULL;
+    read_ahead_job_ = 0;
+    read_ahead_vect_ = -1;
+    read_ahead_buf_ = -1;
 }
 
 void CIvect::set(int incor, int maxvect, int nunits, int funit,
@@ -446,6 +462,8 @@ void CIvect::set(BIGINT vl, int nb, int incor, int ms0, int *iac, int *ibc,
 }
 
 CIvect::~CIvect() {
+    stream_end();
+    if (spare_owned_) free(spare_owned_);
     if (num_blocks_) {
         if (buf_locked_) free(buffer_);
         for (int i = 0; i < num_blocks_; i++) {
@@ -650,7 +668,7 @@ void CIvect::symnormalize(double a, int tvec) {
 
             if (ac > bc) { /* off-diagonal block */
                 // xeax(blocks_[blk][0], a, Ia_size_[blk] * Ib_size_[blk]);
-                C_DSCAL(Ia_size_[blk] * Ib_size_[blk], a, blocks_[blk][0], 1);
+                C_DSCAL((unsigned long) Ia_size_[blk] * Ib_size_[blk], a, blocks_[blk][0], 1);
                 upper = decode_[bc][ac];
                 if (upper >= 0) {
                     zero_blocks_[upper] = zero_blocks_[blk];
@@ -713,7 +731,7 @@ double CIvect::operator*(CIvect &b)
       for (buf=0; buf<buf_per_vect_; buf++) {
          read(cur_vect_, buf);
          b.read(b.cur_vect_, buf);
-         dot_arr(buffer_, b.buffer_, buf_size_[buf], &tval);
+         tval = C_DDOT(buf_size_[buf], buffer_, 1, b.buffer_, 1);
          if (buf_offdiag_[buf]) tval *= 2.0;
          dotprod += tval;
          }
@@ -723,7 +741,7 @@ double CIvect::operator*(CIvect &b)
       for (buf=0; buf<buf_per_vect_; buf++) {
          read(cur_vect_, buf);
          b.read(b.cur_vect_, buf);
-         dot_arr(buffer_, b.buffer_, buf_size_[buf], &tval);
+         tval = C_DDOT(buf_size_[buf], buffer_, 1, b.buffer_, 1);
          dotprod += tval;
          }
       }
@@ -1458,7 +1476,7 @@ void CIvect::symnorm(double a, int vecode, int gather_vec)
                }
             }
          if (ac > bc) { /* off-diagonal block */
-            xeax(blocks_[blk][0], a, Ia_size_[blk] * Ib_size_[blk]);
+            xeax(blocks_[blk][0], a, (unsigned long) Ia_size_[blk] * Ib_size_[blk]);
             upper = decode_[bc][ac];
             if (upper >= 0) {
                zero_blocks_[upper] = zero_blocks_[blk];
@@ -1484,7 +1502,7 @@ void CIvect::symnorm(double a, int vecode, int gather_vec)
          irrep = buf2blk_[buf];
          if (buf_offdiag_[buf]) { /* normalize only. other part never stored */
             for (blk=first_ablk_[irrep]; blk<=last_ablk_[irrep]; blk++) {
-                  xeax(blocks_[blk][0], a, Ia_size_[blk] * Ib_size_[blk]);
+                  xeax(blocks_[blk][0], a, (unsigned long) Ia_size_[blk] * Ib_size_[blk]);
                }
             }
          else { /* diagonal irrep, symmetrize and normalize */
@@ -1502,7 +1520,7 @@ void CIvect::symnorm(double a, int vecode, int gather_vec)
                      }
                   }
                if (ac > bc) { /* off-diagonal block in lower triangle */
-                  xeax(blocks_[blk][0], a, Ia_size_[blk] * Ib_size_[blk]);
+                  xeax(blocks_[blk][0], a, (unsigned long) Ia_size_[blk] * Ib_size_[blk]);
                   upper = decode_[bc][ac];
                   if (upper >= 0) {
                      zero_blocks_[upper] = zero_blocks_[blk];
@@ -1537,7 +1555,7 @@ void CIvect::symnorm(double a, int vecode, int gather_vec)
                }
             }
          else { /* off-diagonal block in lower triangle */
-            xeax(blocks_[blk][0], a, Ia_size_[blk] * Ib_size_[blk]);
+            xeax(blocks_[blk][0], a, (unsigned long) Ia_size_[blk] * Ib_size_[blk]);
             }
 
          if (gather_vec) h0block_gather_vec(vecode);
@@ -1629,21 +1647,37 @@ void CIvect::scale(double a, int vecode, int gather_vec)
 */
 void CIvect::buf_lock(double *a)
 {
-   int i,j,k;
-
    if (buf_locked_) {
       printf("Warning (CIvect::buf_lock): CIvector is already locked!\n");
       }
 
+   stream_end();
+   set_block_ptrs(a);
+   locked_buffer_ = a;
+   buf_locked_ = 1;
+   /* zero(); * commented out 3/13/96: need to eliminate */
+}
+
+
+/*
+** CIvect::set_block_ptrs()
+**
+** Points buffer_ and the rows of every block at the memory a, laid out
+** according to icore.
+*/
+void CIvect::set_block_ptrs(double *a)
+{
+   int i,j,k;
+
    if (icore_ == 1) { /* whole vector in-core */
       blocks_[0][0] = a;
       for (j=1; j<Ia_size_[0]; j++) {
-         blocks_[0][j] = blocks_[0][0] + Ib_size_[0] * j;
+         blocks_[0][j] = blocks_[0][0] + (size_t) Ib_size_[0] * j;
          }
       for (i=1; i<num_blocks_; i++) {
-         blocks_[i][0] = blocks_[i-1][0] + Ia_size_[i-1] * Ib_size_[i-1];
+         blocks_[i][0] = blocks_[i-1][0] + (size_t) Ia_size_[i-1] * Ib_size_[i-1];
          for (j=1; j<Ia_size_[i]; j++) {
-            blocks_[i][j] = blocks_[i][0] + Ib_size_[i] * j;
+            blocks_[i][j] = blocks_[i][0] + (size_t) Ib_size_[i] * j;
             }
          }
       } /* end icore==1 option */
@@ -1655,9 +1689,9 @@ void CIvect::buf_lock(double *a)
             if (j==first_ablk_[i])
                blocks_[j][0] = a;
             else
-               blocks_[j][0] = blocks_[j-1][0] + Ia_size_[j-1] * Ib_size_[j-1];
+               blocks_[j][0] = blocks_[j-1][0] + (size_t) Ia_size_[j-1] * Ib_size_[j-1];
             for (k=1; k<Ia_size_[j]; k++)
-               blocks_[j][k] = blocks_[j][0] + Ib_size_[j] * k;
+               blocks_[j][k] = blocks_[j][0] + (size_t) Ib_size_[j] * k;
             }
          }
       } /* end icore==2 option */
@@ -1666,14 +1700,12 @@ void CIvect::buf_lock(double *a)
       for (i=0; i<num_blocks_; i++) {
          blocks_[i][0] = a;
          for (j=1; j<Ia_size_[i]; j++) {
-            blocks_[i][j] = blocks_[i][0] + Ib_size_[i] * j;
+            blocks_[i][j] = blocks_[i][0] + (size_t) Ib_size_[i] * j;
             }
          }
       } /* end icore==0 option */
 
    buffer_ = a;
-   buf_locked_ = 1;
-   /* zero(); * commented out 3/13/96: need to eliminate */
 }
 
 
@@ -1687,7 +1719,9 @@ void CIvect::buf_lock(double *a)
 */
 void CIvect::buf_unlock(void)
 {
+   stream_end();
    buf_locked_ = 0;
+   locked_buffer_ = NULL;
    blocks_[0][0] = NULL;
    buffer_ = NULL;
    cur_vect_ = -1;
@@ -1883,6 +1917,22 @@ int CIvect::read(int ivect, int ibuf)
       }
 
    if (icore_ == 1) ibuf = 0;
+
+   /* a buffer read ahead only needs to be swapped in */
+   if (read_ahead_job_) {
+      civect_aio->wait_for_job(read_ahead_job_);
+      read_ahead_job_ = 0;
+      if (ivect == read_ahead_vect_ && ibuf == read_ahead_buf_) {
+         double *tmp = buffer_;
+         set_block_ptrs(spare_);
+         spare_ = tmp;
+         cur_vect_ = ivect;
+         cur_buf_ = ibuf;
+         timer_off("CIWave: CIvect read");
+         return(1);
+         }
+      }
+
    buf = ivect * buf_per_vect_ + ibuf;
 
    size = buf_size_[ibuf] * (unsigned long int) sizeof(double);
@@ -1936,6 +1986,12 @@ int CIvect::write(int ivect, int ibuf)
    //    }
 
 
+   /* the unit may have a read-ahead in flight */
+   if (read_ahead_job_) {
+      civect_aio->wait_for_job(read_ahead_job_);
+      read_ahead_job_ = 0;
+      }
+
    if (icore_ == 1) ibuf = 0;
    buf = ivect * buf_per_vect_ + ibuf;
    size = buf_size_[ibuf] * (unsigned long int) sizeof(double);
@@ -1958,6 +2014,79 @@ int CIvect::write(int ivect, int ibuf)
 }
 
 
+/*
+** CIvect::read_ahead(): Start reading a section of a CI vector into a
+**    spare buffer in the background.  The next read() of the same
+**    section swaps the spare in instead of going to disk, so the read
+**    overlaps whatever the caller does in between.  No other I/O on the
+**    vector's units may be done until then, and stream_end() must be
+**    called before the caller touches the locked buffer directly.
+**    Does nothing unless the vector is locked and held a piece at a time
+**    (icore = 0 or 2) and CI_READ_AHEAD is set.
+**
+** Parameters:
+**    ivect  = vector number
+**    ibuf   = buffer number
+*/
+void CIvect::read_ahead(int ivect, int ibuf)
+{
+   int unit, buf;
+   unsigned long int size;
+   char key[20];
+
+   if (nunits_ < 1 || icore_ == 1 || !buf_locked_) return;
+   if (CI_Params_ == NULL || !CI_Params_->read_ahead) return;
+   if (ivect < 0 || ibuf < 0) return;
+
+   if (read_ahead_job_) {
+      civect_aio->wait_for_job(read_ahead_job_);
+      read_ahead_job_ = 0;
+      }
+
+   if (spare_ == NULL) {
+      spare_owned_ = init_array(buffer_size_);
+      spare_ = spare_owned_;
+      }
+
+   buf = ivect * buf_per_vect_ + ibuf;
+   size = buf_size_[ibuf] * (unsigned long int) sizeof(double);
+
+   /* translate buffer number in case we renumbered after collapse * */
+   buf += new_first_buf_;
+   if (buf >= buf_total_) buf -= buf_total_;
+   sprintf(key, "buffer_ %d", buf);
+   unit = file_number_[buf];
+
+   if (!civect_aio)
+      civect_aio = boost::shared_ptr<AIOHandler>(new AIOHandler(_default_psio_lib_));
+   read_ahead_job_ = civect_aio->read_entry((ULI) unit, key, (char *) spare_, size);
+   read_ahead_vect_ = ivect;
+   read_ahead_buf_ = ibuf;
+}
+
+
+/*
+** CIvect::stream_end(): Finish streaming with read_ahead().  Waits for
+**    any read still in flight and moves the current section back into
+**    the buffer handed to buf_lock(), if it was swapped out.
+*/
+void CIvect::stream_end(void)
+{
+   if (read_ahead_job_) {
+      civect_aio->wait_for_job(read_ahead_job_);
+      read_ahead_job_ = 0;
+      }
+
+   if (buf_locked_ && buffer_ != locked_buffer_) {
+      double *tmp = buffer_;
+      if (cur_buf_ >= 0)
+         memcpy(locked_buffer_, tmp, buf_size_[cur_buf_] * sizeof(double));
+      set_block_ptrs(locked_buffer_);
+      spare_ = tmp;
+      }
+}
+
+
 /*
 ** CIvect::schmidt_add()
 **
@@ -1986,7 +2115,7 @@ int CIvect::schmidt_add(CIvect &c, int L)
       read(cur_vect_, buf);
       for (cvect=0; cvect<L; cvect++) {
          c.read(cvect, buf);
-         dot_arr(buffer_, c.buffer_, buf_size_[buf], &tval);
+         tval = C_DDOT(buf_size_[buf], buffer_, 1, c.buffer_, 1);
          if (buf_offdiag_[buf]) tval *= 2.0;
          dotval[cvect] += tval;
          }
@@ -2001,7 +2130,7 @@ int CIvect::schmidt_add(CIvect &c, int L)
        */
          xpeay(buffer_, -dotval[cvect], c.buffer_, buf_size_[buf]);
          }
-      dot_arr(buffer_, buffer_, buf_size_[buf], &tval);
+      tval = C_DDOT(buf_size_[buf], buffer_, 1, buffer_, 1);
       if (buf_offdiag_[buf]) tval *= 2.0;
       norm += tval;
       write(cur_vect_, buf);
@@ -2073,7 +2202,7 @@ int CIvect::schmidt_add2(CIvect &c, int first_vec, int last_vec,
       read(source_vec, buf);
       for (cvect=first_vec; cvect<=last_vec; cvect++) {
          c.read(cvect, buf);
-         dot_arr(buffer_, c.buffer_, buf_size_[buf], &tval);
+         tval = C_DDOT(buf_size_[buf], buffer_, 1, c.buffer_, 1);
          if (buf_offdiag_[buf]) tval *= 2.0;
          dotval[cvect] += tval;
          }
@@ -2091,7 +2220,7 @@ int CIvect::schmidt_add2(CIvect &c, int first_vec, int last_vec,
          c.read(cvect, buf);
          xpeay(buffer_, -dotval[cvect], c.buffer_, buf_size_[buf]);
          }
-      dot_arr(buffer_, buffer_, buf_size_[buf], &tval);
+      tval = C_DDOT(buf_size_[buf], buffer_, 1, buffer_, 1);
       if (buf_offdiag_[buf]) tval *= 2.0;
       norm += tval;
       write(cur_vect_, buf);
@@ -2144,7 +2273,7 @@ int CIvect::schmidt_add2(CIvect &c, int first_vec, int last_vec,
            read(source_vec, buf);
            for (cvect=first_vec; cvect<=last_vec; cvect++) {
               c.read(cvect, buf);
-              dot_arr(buffer_, c.buffer_, buf_size_[buf], &tval);
+              tval = C_DDOT(buf_size_[buf], buffer_, 1, c.buffer_, 1);
               if (buf_offdiag_[buf]) tval *= 2.0;
               dotchk[cvect] += tval;
               }
@@ -2169,7 +2298,7 @@ int CIvect::schmidt_add2(CIvect &c, int first_vec, int last_vec,
 **/
 void CIvect::zero(void)
 {
-   zero_arr(buffer_, (int) buffer_size_);
+   memset(buffer_, 0, buffer_size_ * sizeof(double));
 }
 
 
@@ -2281,7 +2410,7 @@ void CIvect::dcalc(int nr, int L, double **alpha, double *lambda,
             xpeay(buffer_, alpha[ivect][root], S.buffer_, buf_size_[buf]);
             S.buf_unlock();
             } /* end loop over ivect */
-         dot_arr(buffer_, buffer_, buf_size_[buf], &tval);
+         tval = C_DDOT(buf_size_[buf], buffer_, 1, buffer_, 1);
          if (buf_offdiag_[buf]) tval *= 2.0;
          norm_arr[root] += tval;
          write(root, buf);
@@ -2488,7 +2617,7 @@ void CIvect::wigner_E2k_formula(CIvect &Hd, CIvect &S, CIvect &C,
            read(i, buf);
            for (j=i; j<=(k-kvec_offset); j++) {
               C.read(j,buf);
-              dot_arr(buffer_, C.buffer_, C.buf_size_[buf], &tval);
+              tval = C_DDOT(C.buf_size_[buf], buffer_, 1, C.buffer_, 1);
               if (buf_offdiag_[buf]) tval *= 2.0;
               wfn_overlap[i+kvec_offset][j+kvec_offset] += tval;
               if (i!=j) wfn_overlap[j+kvec_offset][i+kvec_offset] += tval;
@@ -2498,7 +2627,7 @@ void CIvect::wigner_E2k_formula(CIvect &Hd, CIvect &S, CIvect &C,
         read(k-1, buf);
         for (i=1; i<=k-1; i++) {
            C.read(i, buf);
-           dot_arr(buffer_, C.buffer_, C.buf_size_[buf], &tval);
+           tval = C_DDOT(C.buf_size_[buf], buffer_, 1, C.buffer_, 1);
            if (buf_offdiag_[buf]) tval *= 2.0;
            wfn_overlap[k-1][i] += tval;
            if (i!=(k-1)) wfn_overlap[i][k-1] += tval;
@@ -2509,7 +2638,7 @@ void CIvect::wigner_E2k_formula(CIvect &Hd, CIvect &S, CIvect &C,
         read(k, buf);
         for (i=(1-kvec_offset); i<=(k-kvec_offset); i++) {
            C.read(i, buf);
-           dot_arr(buffer_, C.buffer_, C.buf_size_[buf], &tval);
+           tval = C_DDOT(C.buf_size_[buf], buffer_, 1, C.buffer_, 1);
            if (buf_offdiag_[buf]) tval *= 2.0;
            wfn_overlap[k][i+kvec_offset] += tval;
            if ((i+kvec_offset)!=k) wfn_overlap[i+kvec_offset][k] += tval;
@@ -2531,11 +2660,11 @@ void CIvect::wigner_E2k_formula(CIvect &Hd, CIvect &S, CIvect &C,
       S.buf_lock(buf2);
       S.read(0, buf);
       read(k-1-kvec_offset, buf);
-      dot_arr(buffer_, S.buffer_, buf_size_[buf], &tval);
+      tval = C_DDOT(buf_size_[buf], buffer_, 1, S.buffer_, 1);
       if (buf_offdiag_[buf]) tval *= 2.0;
       E2k += tval;
       read(k-kvec_offset, buf);
-      dot_arr(buffer_, S.buffer_, buf_size_[buf], &tval);
+      tval = C_DDOT(buf_size_[buf], buffer_, 1, S.buffer_, 1);
       if (buf_offdiag_[buf]) tval *= 2.0;
       E2kp1 += tval;
       S.buf_unlock();
@@ -2544,11 +2673,11 @@ void CIvect::wigner_E2k_formula(CIvect &Hd, CIvect &S, CIvect &C,
            CI_CalcInfo_->twoel_ints->pointer(), CI_CalcInfo_->e0_drc, CI_CalcInfo_->num_alp_expl,
            CI_CalcInfo_->num_bet_expl, CI_CalcInfo_->nmo, buf, CI_Params_->hd_ave);
       xexy(Hd.buffer_, buffer_, buf_size_[buf]);
-      dot_arr(buffer_, Hd.buffer_, buf_size_[buf], &tval);
+      tval = C_DDOT(buf_size_[buf], buffer_, 1, Hd.buffer_, 1);
       if (buf_offdiag_[buf]) tval *= 2.0;
       E2kp1 -= tval;
       read(k-1-kvec_offset, buf);
-      dot_arr(buffer_, Hd.buffer_, buf_size_[buf], &tval);
+      tval = C_DDOT(buf_size_[buf], buffer_, 1, Hd.buffer_, 1);
       if (buf_offdiag_[buf]) tval *= 2.0;
       E2k -= tval;
       Hd.buf_unlock();
@@ -2558,7 +2687,7 @@ void CIvect::wigner_E2k_formula(CIvect &Hd, CIvect &S, CIvect &C,
    /*
      C.buf_lock(buf2);
      for (i=1; i<=k-2; i++) {
-        zero_arr(buffer_, buf_size_[0]);
+        memset(buffer_, 0, buf_size_[0] * sizeof(double));
         for (I=1; I<=k-2; I++) {
            C.read(I,0);
            outfile->Printf( " prescaled Bvec %d = \n", I);
@@ -2854,7 +2983,7 @@ double CIvect::checknorm(void)
 
    for (buf=0; buf<buf_per_vect_; buf++) {
       read(cur_vect_, buf);
-      dot_arr(buffer_, buffer_, buf_size_[buf], &tval);
+      tval = C_DDOT(buf_size_[buf], buffer_, 1, buffer_, 1);
       if (buf_offdiag_[buf]) tval *= 2.0;
       dotprod += tval;
       }
@@ -2899,7 +3028,7 @@ void CIvect::restart_gather(int ivec, int nvec, int nroot, double **alpha,
    int buf, oldvec;
 
    for (buf=0; buf<buf_per_vect_; buf++) {
-      zero_arr(buffer_2, buf_size_[buf]);
+      memset(buffer_2, 0, buf_size_[buf] * sizeof(double));
       buf_lock(buffer_1);
       for (oldvec=0; oldvec<nvec; oldvec++) {
          read(oldvec, buf);
@@ -2932,7 +3061,7 @@ void CIvect::gather(int ivec, int nvec, int nroot, double **alpha,
 
    /* outfile->Printf("In CIvect::gather\n"); */
    for (buf=0; buf<buf_per_vect_; buf++) {
-      zero_arr(buffer_, buf_size_[buf]);
+      memset(buffer_, 0, buf_size_[buf] * sizeof(double));
       for (oldvec=0; oldvec<nvec; oldvec++) {
          C.read(oldvec, buf);
          xpeay(buffer_, alpha[oldvec][nroot], C.buffer_, buf_size_[buf]);
@@ -3441,7 +3570,7 @@ double CIvect::dcalc_evangelisti(int rootnum, int num_vecs, double lambda,
       Hd.buf_unlock();
 
       buf_unlock();
-      zero_arr(buf1, buf_size_[buf]);
+      memset(buf1, 0, buf_size_[buf] * sizeof(double));
       C.buf_lock(buf2);
       for (i=0; i<L; i++) {
          C.read(i, buf);
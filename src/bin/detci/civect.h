@@ -117,10 +117,17 @@ class CIvect {
     int cur_unit_;              /* current unit file */
     int cur_size_;              /* current size of buffer */
     int first_unit_;            /* first file unit number (if > 1) */
+    double *locked_buffer_;     /* the buffer handed to buf_lock() */
+    double *spare_;             /* buffer the next read-ahead lands in */
+    double *spare_owned_;       /* read-ahead memory owned by this CIvect */
+    unsigned long read_ahead_job_; /* AIO job of the read in flight, or 0 */
+    int read_ahead_vect_;       /* vector being read ahead */
+    int read_ahead_buf_;        /* buffer being read ahead */
     int subgr_per_irrep_;       /* possible number of Olsen subgraphs per irrep */
 
     double ssq(struct stringwr *alplist, struct stringwr *betlist, double **CL,
                double **CR, int nas, int nbs, int Ja_list, int Jb_list);
+    void set_block_ptrs(double *a);
 
    public:
     CIvect();
@@ -156,6 +163,8 @@ class CIvect {
     void close_io_files(int keep);
     int read(int tvec, int ibuf);
     int write(int tvec, int ibuf);
+    void read_ahead(int tvec, int ibuf);
+    void stream_end(void);
     void buf_lock(double *a);
     void buf_unlock(void);
     double *buf_malloc(void);
@@ -366,8 +366,13 @@ private:
 
     /// => Sigma Calculations <= //
     struct sigma_data *SigmaData_;
+    /// Scratch for threads 1..n-1 of the block-parallel sigma_b/sigma_c
+    std::vector<struct sigma_data *> SigmaThread_;
     void sigma_init(CIvect& C, CIvect &S);
     void sigma_free(void);
+    void sigma_scratch_init(struct sigma_data *sd, int max_dim);
+    void sigma_scratch_free(struct sigma_data *sd);
+    struct sigma_data *sigma_thread_data(void);
     void sigma(CIvect& C, CIvect& S, double *oei, double *tei, int ivec);
 
     void sigma_a(struct stringwr **alplist, struct stringwr **betlist,
@@ -381,7 +386,7 @@ private:
           double **cmat, double **smat, double *oei, double *tei, int fci,
           int cblock, int sblock, int nas, int nbs, int sac, int sbc,
           int cac, int cbc, int cnas, int cnbs, int cnac, int cnbc,
-          int sbirr, int cbirr, int Ms0);
+          int sbirr, int cbirr, int Ms0, struct sigma_data *sd);
     void sigma_get_contrib(struct stringwr **alplist, struct stringwr **betlist,
           CIvect &C, CIvect &S, int **s1_contrib, int **s2_contrib,
           int **s3_contrib);
@@ -54,9 +54,9 @@
 
 namespace psi { namespace detci {
 
-extern void xeaxmy(double *x, double *y, double a, int size);
-extern void xeaxpby(double *x, double *y, double a, double b, int size);
-extern void xexy(double *x, double *y, int size);
+extern void xeaxmy(double *x, double *y, double a, unsigned long int size);
+extern void xeaxpby(double *x, double *y, double a, double b, unsigned long int size);
+extern void xexy(double *x, double *y, unsigned long int size);
 extern void buf_ols_denom(double *a, double *hd, double E, int len);
 extern void buf_ols_updt(double *a, double *c, double *norm, double *ovrlap,
    double *c1norm, int len);
@@ -511,6 +511,7 @@ void CIWavefunction::get_parameters(Options &options)
      Parameters_->nthreads = options.get_int("CI_NUM_THREADS");
   }
   if (Parameters_->nthreads < 1) Parameters_->nthreads = 1;
+  Parameters_->read_ahead = options["CI_READ_AHEAD"].to_integer();
 
   Parameters_->sf_restrict = options["SF_RESTRICT"].to_integer();
   Parameters_->print_sigma_overlap = options["SIGMA_OVERLAP"].to_integer();
@@ -31,10 +31,14 @@
 */
 #include <cstdio>
 #include <cstdlib>
+#include <vector>
 #include <libciomr/libciomr.h>
 #include <libqt/qt.h>
 #include <libmints/mints.h>
 #include "structs.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace psi {
 namespace detci {
@@ -59,16 +63,14 @@ void s3_block_vdiag(struct stringwr *alplist, struct stringwr *betlist,
                     double **C, double **S, double *tei, int nas, int nbs,
                     int cnas, int Ib_list, int Ja_list, int Jb_list, int Ib_sym,
                     int Jb_sym, double **Cprime, double *F, double *V,
-                    double *Sgn, int *L, int *R, int norbs, int *orbsym) {
-  struct stringwr *Ia;
-  unsigned int Ia_ex;
-  int ij, i, j, t, kl, I, J, RJ;
-  double tval, VS, *CprimeI0, *CI0;
-  int jlen, Jacnt, *Iaij, Ia_idx;
-  unsigned int *Iaridx;
-  signed char *Iasgn;
+                    double *Sgn, int *L, int *R, int norbs, int *orbsym,
+                    int nthreads) {
+  int ij, i, j, jlen;
   double *Tptr;
-  int npthreads, rc, status;
+  std::vector<double> Vthread;
+
+  /* every thread past the first needs its own V */
+  if (nthreads > 1) Vthread.resize((size_t)(nthreads - 1) * nbs);
 
   /* loop over i, j */
   for (i = 0; i < norbs; i++) {
@@ -82,47 +84,61 @@ void s3_block_vdiag(struct stringwr *alplist, struct stringwr *betlist,
        */
       Tptr = tei + ioff[ij];
 
-      /* gather operation */
-      for (I = 0; I < cnas; I++) {
-        CprimeI0 = Cprime[I];
-        CI0 = C[I];
-        for (J = 0; J < jlen; J++) {
-          tval = Sgn[J];
-          CprimeI0[J] = CI0[L[J]] * tval;
-        }
-      }
+#pragma omp parallel num_threads(nthreads)
+      {
+        double *Vt = V;
+#ifdef _OPENMP
+        int thread = omp_get_thread_num();
+        if (thread) Vt = &(Vthread[(size_t)(thread - 1) * nbs]);
+#endif
 
-      for (Ia = alplist, Ia_idx = 0; Ia_idx < nas; Ia_idx++, Ia++) {
-        /* loop over excitations E^a_{kl} from |A(I_a)> */
-        Jacnt = Ia->cnt[Ja_list];
-        Iaridx = Ia->ridx[Ja_list];
-        Iasgn = Ia->sgn[Ja_list];
-        Iaij = Ia->ij[Ja_list];
+        /* gather operation */
+#pragma omp for schedule(static)
+        for (int I = 0; I < cnas; I++) {
+          double *CprimeI0 = Cprime[I];
+          double *CI0 = C[I];
+          for (int J = 0; J < jlen; J++) {
+            CprimeI0[J] = CI0[L[J]] * Sgn[J];
+          }
+        }
 
-        zero_arr(V, jlen);
-        for (Ia_ex = 0; Ia_ex < Jacnt && (kl = *Iaij++) <= ij; Ia_ex++) {
-          I = *Iaridx++;
-          tval = *Iasgn++;
-          if (ij == kl) tval *= 0.5;
-          VS = Tptr[kl] * tval;
-          CprimeI0 = Cprime[I];
+        /* each Ia owns its row of S, so the scatters do not collide */
+#pragma omp for schedule(dynamic, 16)
+        for (int Ia_idx = 0; Ia_idx < nas; Ia_idx++) {
+          struct stringwr *Ia = alplist + Ia_idx;
+          /* loop over excitations E^a_{kl} from |A(I_a)> */
+          int Jacnt = Ia->cnt[Ja_list];
+          unsigned int *Iaridx = Ia->ridx[Ja_list];
+          signed char *Iasgn = Ia->sgn[Ja_list];
+          int *Iaij = Ia->ij[Ja_list];
+          int Ia_ex;
+          int kl;
+
+          zero_arr(Vt, jlen);
+          for (Ia_ex = 0; Ia_ex < Jacnt && (kl = *Iaij++) <= ij; Ia_ex++) {
+            int I = *Iaridx++;
+            double tval = *Iasgn++;
+            if (ij == kl) tval *= 0.5;
+            double VS = Tptr[kl] * tval;
+            double *CprimeI0 = Cprime[I];
 
 #ifdef USE_BS
-          C_DAXPY(jlen, VS, CprimeI0, 1, V, 1);
+            C_DAXPY(jlen, VS, CprimeI0, 1, Vt, 1);
 #else
-          for (J = 0; J < jlen; J++) {
-            V[J] += VS * CprimeI0[J];
-          }
+            for (int J = 0; J < jlen; J++) {
+              Vt[J] += VS * CprimeI0[J];
+            }
 #endif
-        }
+          }
 
-        /* scatter */
-        for (J = 0; J < jlen; J++) {
-          RJ = R[J];
-          S[Ia_idx][RJ] += V[J];
-        }
+          /* scatter */
+          double *SIa = S[Ia_idx];
+          for (int J = 0; J < jlen; J++) {
+            SIa[R[J]] += Vt[J];
+          }
 
-      } /* end loop over Ia */
+        } /* end loop over Ia */
+      }
 
     } /* end loop over j */
   }   /* end loop over i */
@@ -139,15 +155,12 @@ void s3_block_v(struct stringwr *alplist, struct stringwr *betlist, double **C,
                 double **S, double *tei, int nas, int nbs, int cnas,
                 int Ib_list, int Ja_list, int Jb_list, int Ib_sym, int Jb_sym,
                 double **Cprime, double *F, double *V, double *Sgn, int *L,
-                int *R, int norbs, int *orbsym) {
-  struct stringwr *Ia;
-  unsigned int Ia_ex;
-  int ij, i, j, kl, ijkl, I, J, RJ;
-  double tval, VS, *CprimeI0, *CI0;
-  int jlen, Ia_idx, Jacnt, *Iaij;
-  unsigned int *Iaridx;
-  signed char *Iasgn;
-  double *Tptr;
+                int *R, int norbs, int *orbsym, int nthreads) {
+  int ij, i, j, jlen;
+  std::vector<double> Vthread;
+
+  /* every thread past the first needs its own V */
+  if (nthreads > 1) Vthread.resize((size_t)(nthreads - 1) * nbs);
 
   /* loop over i, j */
   for (i = 0; i < norbs; i++) {
@@ -158,53 +171,61 @@ void s3_block_v(struct stringwr *alplist, struct stringwr *betlist, double **C,
 
       if (!jlen) continue;
 
-      Tptr = tei + ioff[ij];
+#pragma omp parallel num_threads(nthreads)
+      {
+        double *Vt = V;
+#ifdef _OPENMP
+        int thread = omp_get_thread_num();
+        if (thread) Vt = &(Vthread[(size_t)(thread - 1) * nbs]);
+#endif
 
-      /* gather operation */
-      for (I = 0; I < cnas; I++) {
-        CprimeI0 = Cprime[I];
-        CI0 = C[I];
-        for (J = 0; J < jlen; J++) {
-          tval = Sgn[J];
-          CprimeI0[J] = CI0[L[J]] * tval;
+        /* gather operation */
+#pragma omp for schedule(static)
+        for (int I = 0; I < cnas; I++) {
+          double *CprimeI0 = Cprime[I];
+          double *CI0 = C[I];
+          for (int J = 0; J < jlen; J++) {
+            CprimeI0[J] = CI0[L[J]] * Sgn[J];
+          }
         }
-      }
 
-      timer_on("CIWave: s3_mt");
-      for (Ia = alplist, Ia_idx = 0; Ia_idx < nas; Ia_idx++, Ia++) {
-        /* loop over excitations E^a_{kl} from |A(I_a)> */
-        Jacnt = Ia->cnt[Ja_list];
-        Iaridx = Ia->ridx[Ja_list];
-        Iasgn = Ia->sgn[Ja_list];
-        Iaij = Ia->ij[Ja_list];
-
-        zero_arr(V, jlen);
-
-        for (Ia_ex = 0; Ia_ex < Jacnt; Ia_ex++) {
-          kl = *Iaij++;
-          I = *Iaridx++;
-          tval = *Iasgn++;
-          ijkl = INDEX(ij, kl);
-          VS = tval * tei[ijkl];
-          CprimeI0 = Cprime[I];
+        /* each Ia owns its row of S, so the scatters do not collide */
+#pragma omp for schedule(dynamic, 16)
+        for (int Ia_idx = 0; Ia_idx < nas; Ia_idx++) {
+          struct stringwr *Ia = alplist + Ia_idx;
+          /* loop over excitations E^a_{kl} from |A(I_a)> */
+          int Jacnt = Ia->cnt[Ja_list];
+          unsigned int *Iaridx = Ia->ridx[Ja_list];
+          signed char *Iasgn = Ia->sgn[Ja_list];
+          int *Iaij = Ia->ij[Ja_list];
+
+          zero_arr(Vt, jlen);
+
+          for (int Ia_ex = 0; Ia_ex < Jacnt; Ia_ex++) {
+            int kl = *Iaij++;
+            int I = *Iaridx++;
+            double tval = *Iasgn++;
+            int ijkl = INDEX(ij, kl);
+            double VS = tval * tei[ijkl];
+            double *CprimeI0 = Cprime[I];
 
 #ifdef UBLAS
-          C_DAXPY(jlen, VS, CprimeI0, 1, V, 1);
+            C_DAXPY(jlen, VS, CprimeI0, 1, Vt, 1);
 #else
-          for (J = 0; J < jlen; J++) {
-            V[J] += VS * CprimeI0[J];
-          }
+            for (int J = 0; J < jlen; J++) {
+              Vt[J] += VS * CprimeI0[J];
+            }
 #endif
-        }
+          }
 
-        /* scatter */
-        for (J = 0; J < jlen; J++) {
-          RJ = R[J];
-          S[Ia_idx][RJ] += V[J];
-        }
+          /* scatter */
+          double *SIa = S[Ia_idx];
+          for (int J = 0; J < jlen; J++) {
+            SIa[R[J]] += Vt[J];
+          }
 
-      } /* end loop over Ia */
-      timer_off("CIWave: s3_mt");
+        } /* end loop over Ia */
+      }
 
     } /* end loop over j */
   }   /* end loop over i */
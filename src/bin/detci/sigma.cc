@@ -45,12 +45,16 @@
 #include <cstdlib>
 #include <cmath>
 #include <cstring>
+#include <vector>
 #include <libciomr/libciomr.h>
 #include <libqt/qt.h>
 #include <libmints/mints.h>
 #include "structs.h"
 #include "civect.h"
 #include "ciwave.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace psi { namespace detci {
 
@@ -104,12 +108,12 @@ extern void s3_block_vdiag(struct stringwr *alplist,
    double **C, double **S, double *tei, int nas, int nbs, int cnas,
    int Ib_list, int Ja_list, int Jb_list, int Ib_sym, int Jb_sym,
    double **Cprime, double *F, double *V, double *Sgn, int *L, int *R,
-   int norbs, int *orbsym);
+   int norbs, int *orbsym, int nthreads);
 extern void s3_block_v(struct stringwr *alplist,struct stringwr *betlist,
    double **C, double **S, double *tei, int nas, int nbs, int cnas,
    int Ib_list, int Ja_list, int Jb_list, int Ib_sym, int Jb_sym,
    double **Cprime, double *F, double *V, double *Sgn, int *L, int *R,
-   int norbs, int *orbsym);
+   int norbs, int *orbsym, int nthreads);
 extern void s3_block_vrotf(int *Cnt[2], int **Ij[2], int **Ridx[2],
    signed char **Sn[2], double **C, double **S,
    double *tei, int nas, int nbs, int cnas,
@@ -125,6 +129,22 @@ extern void s3_block_vdiag_rotf(int *Cnt[2], int **Ij[2], int **Ridx[2],
 
 
 
+/*
+** sigma_serial()
+**
+** libqt timers are not thread-safe, so sigma_block() only times itself,
+** and only threads the s3 string loops, when it is called outside of a
+** parallel region.
+*/
+static bool sigma_serial()
+{
+#ifdef _OPENMP
+   return !omp_in_parallel();
+#else
+   return true;
+#endif
+}
+
 /*
 ** sigma_init()
 **
@@ -134,9 +154,9 @@ extern void s3_block_vdiag_rotf(int *Cnt[2], int **Ij[2], int **Ridx[2],
 */
 void CIWavefunction::sigma_init(CIvect& C, CIvect &S)
 {
-   int i,j;
+   int i;
    int maxcols=0, maxrows=0;
-   int nsingles, max_dim=0;
+   int max_dim=0;
    unsigned long int bufsz=0;
 
    SigmaData_->transp_tmp = NULL;
@@ -152,37 +172,7 @@ void CIWavefunction::sigma_init(CIvect& C, CIvect &S)
       if (C.Ib_size_[i] > max_dim) max_dim = C.Ib_size_[i];
       if (C.Ia_size_[i] > max_dim) max_dim = C.Ia_size_[i];
       }
-   SigmaData_->max_dim = max_dim;
-   SigmaData_->F = init_array(max_dim);
-
-   SigmaData_->Sgn = init_array(max_dim);
-   SigmaData_->V = init_array(max_dim);
-   SigmaData_->L = init_int_array(max_dim);
-   SigmaData_->R = init_int_array(max_dim);
-
-   if (Parameters_->repl_otf) {
-      max_dim += AlphaG_->num_el_expl;
-      nsingles = AlphaG_->num_el_expl * AlphaG_->num_orb;
-      for (i=0; i<2; i++) {
-         SigmaData_->Jcnt[i] = init_int_array(max_dim);
-         SigmaData_->Jij[i] = init_int_matrix(max_dim, nsingles);
-         SigmaData_->Joij[i] = init_int_matrix(max_dim, nsingles);
-         SigmaData_->Jridx[i] = init_int_matrix(max_dim, nsingles);
-         SigmaData_->Jsgn[i] = (signed char **) malloc (max_dim * sizeof(signed char *));
-         for (j=0; j<max_dim; j++) {
-            SigmaData_->Jsgn[i][j] = (signed char *) malloc (nsingles *
-               sizeof(signed char));
-            }
-         }
-
-      SigmaData_->Toccs = (unsigned char **) malloc (sizeof(unsigned char *) * nsingles);
-
-      /* test out the on-the-fly replacement routines */
-      /*
-      b2brepl_test(Occs_,SigmaData_->Jcnt[0],SigmaData_->Jij[0],
-                   SigmaData_->Joij[0],SigmaData_->Jridx[0],SigmaData_->Jsgn[0],AlphaG);
-      */
-      }
+   sigma_scratch_init(SigmaData_, max_dim);
 
    /* figure out which C blocks contribute to s */
    s1_contrib_ = init_int_matrix(S.num_blocks_, C.num_blocks_);
@@ -249,34 +239,122 @@ void CIWavefunction::sigma_init(CIvect& C, CIvect &S)
      }
    }
 
+   /* sigma_b() and sigma_c() hand whole sigma blocks to threads, each of
+      which needs its own scratch (thread 0 uses SigmaData_ itself).  The
+      Bendazzoli s3 and the debug printing in sigma_block() stay serial. */
+   if (C.icore_ != 0 && !Parameters_->bendazzoli && Parameters_->print_lvl <= 3) {
+     if (maxcols > maxrows) maxrows = maxcols;
+     for (i=1; i<Parameters_->nthreads; i++) {
+       struct sigma_data *sd = new sigma_data();
+       sigma_scratch_init(sd, max_dim);
+       sd->transp_tmp = NULL;
+       sd->sprime = NULL;
+       sd->cprime = (double **) malloc (maxrows * sizeof(double *));
+       sd->cprime[0] = init_array(bufsz);
+       SigmaThread_.push_back(sd);
+     }
+   }
+
    CalcInfo_->sigma_initialized = 1;
 }
 
-void CIWavefunction::sigma_free()
+/*
+** sigma_scratch_init()
+**
+** Allocates the per-block work arrays of a sigma_data: F, Sgn, V, L, R,
+** and the on-the-fly replacement lists if they are in use.
+*/
+void CIWavefunction::sigma_scratch_init(struct sigma_data *sd, int max_dim)
+{
+   int i, j, nsingles;
+
+   sd->max_dim = max_dim;
+   sd->F = init_array(max_dim);
+
+   sd->Sgn = init_array(max_dim);
+   sd->V = init_array(max_dim);
+   sd->L = init_int_array(max_dim);
+   sd->R = init_int_array(max_dim);
+
+   if (Parameters_->repl_otf) {
+      max_dim += AlphaG_->num_el_expl;
+      nsingles = AlphaG_->num_el_expl * AlphaG_->num_orb;
+      for (i=0; i<2; i++) {
+         sd->Jcnt[i] = init_int_array(max_dim);
+         sd->Jij[i] = init_int_matrix(max_dim, nsingles);
+         sd->Joij[i] = init_int_matrix(max_dim, nsingles);
+         sd->Jridx[i] = init_int_matrix(max_dim, nsingles);
+         sd->Jsgn[i] = (signed char **) malloc (max_dim * sizeof(signed char *));
+         for (j=0; j<max_dim; j++) {
+            sd->Jsgn[i][j] = (signed char *) malloc (nsingles *
+               sizeof(signed char));
+            }
+         }
+
+      sd->Toccs = (unsigned char **) malloc (sizeof(unsigned char *) * nsingles);
+
+      /* test out the on-the-fly replacement routines */
+      /*
+      b2brepl_test(Occs_,sd->Jcnt[0],sd->Jij[0],
+                   sd->Joij[0],sd->Jridx[0],sd->Jsgn[0],AlphaG);
+      */
+      }
+}
+
+void CIWavefunction::sigma_scratch_free(struct sigma_data *sd)
 {
-   free(SigmaData_->F);
-   free(SigmaData_->Sgn);
-   free(SigmaData_->V);
-   free(SigmaData_->L);
-   free(SigmaData_->R);
+   free(sd->F);
+   free(sd->Sgn);
+   free(sd->V);
+   free(sd->L);
+   free(sd->R);
    if (Parameters_->repl_otf) {
       for (int i=0; i<2; i++) {
-         free(SigmaData_->Jcnt[i]);
-         free_int_matrix(SigmaData_->Jij[i]);
-         free_int_matrix(SigmaData_->Joij[i]);
-         free_int_matrix(SigmaData_->Jridx[i]);
-         for (int j=0; j<SigmaData_->max_dim; j++) {
-            free(SigmaData_->Jsgn[i][j]);
+         free(sd->Jcnt[i]);
+         free_int_matrix(sd->Jij[i]);
+         free_int_matrix(sd->Joij[i]);
+         free_int_matrix(sd->Jridx[i]);
+         for (int j=0; j<sd->max_dim; j++) {
+            free(sd->Jsgn[i][j]);
          }
-         free(SigmaData_->Jsgn[i]);
+         free(sd->Jsgn[i]);
       }
    }
+}
+
+void CIWavefunction::sigma_free()
+{
+   sigma_scratch_free(SigmaData_);
+   for (size_t t=0; t<SigmaThread_.size(); t++) {
+      struct sigma_data *sd = SigmaThread_[t];
+      sigma_scratch_free(sd);
+      if (Parameters_->repl_otf) free(sd->Toccs);
+      free(sd->cprime[0]);
+      free(sd->cprime);
+      delete sd;
+   }
+   SigmaThread_.clear();
 // DGAS: Not sure how to free these yet
 //      SigmaData_->Toccs = (unsigned char **) malloc (sizeof(unsigned char *) * nsingles);
 //unsigned char **SigmaData_->Toccs;
 //double **SigmaData_->transp_tmp, **SigmaData_->cprime, **SigmaData_->sprime;
 }
 
+/*
+** sigma_thread_data()
+**
+** Returns the sigma scratch of the calling thread
+*/
+struct sigma_data *CIWavefunction::sigma_thread_data()
+{
+#ifdef _OPENMP
+   int thread = omp_get_thread_num();
+   if (thread > 0 && thread <= (int) SigmaThread_.size())
+      return SigmaThread_[thread-1];
+#endif
+   return SigmaData_;
+}
+
 /*
 ** sigma()
 **
@@ -353,6 +431,9 @@ void CIWavefunction::sigma_a(struct stringwr **alplist, struct stringwr **betlis
    int cairr, cbirr, sbirr;
    int did_sblock = 0;
    int phase;
+   int ncbuf;
+   std::vector<int> cbufs(C.buf_per_vect_), do_cblocks(C.buf_per_vect_),
+      do_cblocks2(C.buf_per_vect_);
 
    if (!Parameters_->Ms0) phase = 1;
    else phase = ((int) Parameters_->S % 2) ? -1 : 1;
@@ -369,17 +450,14 @@ void CIWavefunction::sigma_a(struct stringwr **alplist, struct stringwr **betlis
       sbirr = sbc / BetaG_->subgr_per_irrep;
       if (SigmaData_->sprime != NULL) set_row_ptrs(nas, nbs, SigmaData_->sprime);
 
+      /* find the C buffers that contribute, so that the next one can be
+         read while this one is used */
+      ncbuf = 0;
       for (cbuf=0; cbuf<C.buf_per_vect_; cbuf++) {
-         do_cblock=0; do_cblock2=0;
          cblock=C.buf2blk_[cbuf];
          cblock2 = -1;
-         cac = C.Ia_code_[cblock];
-         cbc = C.Ib_code_[cblock];
-         cbirr = cbc / BetaG_->subgr_per_irrep;
-         cairr = cac / AlphaG_->subgr_per_irrep;
-         if (C.Ms0_) cblock2 = C.decode_[cbc][cac];
-         cnas = C.Ia_size_[cblock];
-         cnbs = C.Ib_size_[cblock];
+         if (C.Ms0_) cblock2 = C.decode_[C.Ib_code_[cblock]][C.Ia_code_[cblock]];
+         do_cblock=0; do_cblock2=0;
          if (s1_contrib_[sblock][cblock] || s2_contrib_[sblock][cblock] ||
              s3_contrib_[sblock][cblock]) do_cblock = 1;
          if (C.buf_offdiag_[cbuf] && (s1_contrib_[sblock][cblock2] ||
@@ -388,15 +466,35 @@ void CIWavefunction::sigma_a(struct stringwr **alplist, struct stringwr **betlis
          if (C.check_zero_block(cblock)) do_cblock = 0;
          if (cblock2 >= 0 && C.check_zero_block(cblock2)) do_cblock2 = 0;
          if (!do_cblock && !do_cblock2) continue;
+         cbufs[ncbuf] = cbuf;
+         do_cblocks[ncbuf] = do_cblock;
+         do_cblocks2[ncbuf] = do_cblock2;
+         ncbuf++;
+         }
+
+      for (k=0; k<ncbuf; k++) {
+         cbuf = cbufs[k];
+         do_cblock = do_cblocks[k];
+         do_cblock2 = do_cblocks2[k];
+         cblock=C.buf2blk_[cbuf];
+         cblock2 = -1;
+         cac = C.Ia_code_[cblock];
+         cbc = C.Ib_code_[cblock];
+         cbirr = cbc / BetaG_->subgr_per_irrep;
+         cairr = cac / AlphaG_->subgr_per_irrep;
+         if (C.Ms0_) cblock2 = C.decode_[cbc][cac];
+         cnas = C.Ia_size_[cblock];
+         cnbs = C.Ib_size_[cblock];
 
          C.read(C.cur_vect_, cbuf);
+         if (k+1 < ncbuf) C.read_ahead(C.cur_vect_, cbufs[k+1]);
 
          if (do_cblock) {
             if (SigmaData_->cprime != NULL) set_row_ptrs(cnas, cnbs, SigmaData_->cprime);
             sigma_block(alplist, betlist, C.blocks_[cblock], S.blocks_[sblock],
                oei, tei, fci, cblock, sblock, nas, nbs, sac, sbc, cac, cbc,
                cnas, cnbs, C.num_alpcodes_, C.num_betcodes_, sbirr, cbirr,
-               S.Ms0_);
+               S.Ms0_, SigmaData_);
             did_sblock = 1;
             }
 
@@ -408,13 +506,13 @@ void CIWavefunction::sigma_a(struct stringwr **alplist, struct stringwr **betlis
 //            cnas * cnbs * sizeof(double));
 //          bcopy is non-ANSI.  memcpy reverses the arguments.
             memcpy((void *) C.blocks_[cblock][0], (void *) SigmaData_->transp_tmp[0],
-              cnas * cnbs * sizeof(double));
+              (size_t) cnas * cnbs * sizeof(double));
             /* set_row_ptrs(cnbs, cnas, C.blocks_[cblock]); */
             if (SigmaData_->cprime != NULL) set_row_ptrs(cnbs, cnas, SigmaData_->cprime);
             sigma_block(alplist, betlist, C.blocks_[cblock2], S.blocks_[sblock],
                oei, tei, fci, cblock2, sblock, nas, nbs, sac, sbc,
                cbc, cac, cnbs, cnas, C.num_alpcodes_, C.num_betcodes_, sbirr,
-               cairr, S.Ms0_);
+               cairr, S.Ms0_, SigmaData_);
             did_sblock = 1;
             }
 
@@ -438,6 +536,7 @@ void CIWavefunction::sigma_a(struct stringwr **alplist, struct stringwr **betlis
 
       } /* end loop over sigma buffers */
 
+   C.stream_end();
 }
 
 
@@ -464,12 +563,11 @@ void CIWavefunction::sigma_b(struct stringwr **alplist, struct stringwr **betlis
       CIvect& C, CIvect& S, double *oei, double *tei, int fci, int ivec)
 {
 
-   int sblock, cblock;  /* id of sigma and C blocks */
+   int sblock;  /* id of sigma block */
    int sac, sbc, nas, nbs;
-   int cac, cbc, cnas, cnbs;
-   int sbirr, cbirr;
-   int did_sblock = 0;
    int phase;
+   int nthreads = SigmaThread_.size() + 1;
+   std::vector<int> did_sblock(S.num_blocks_, 0);
 
    if (!Parameters_->Ms0) phase = 1;
    else phase = ((int) Parameters_->S % 2) ? -1 : 1;
@@ -477,38 +575,49 @@ void CIWavefunction::sigma_b(struct stringwr **alplist, struct stringwr **betlis
    S.zero();
    C.read(C.cur_vect_, 0);
 
-   /* loop over unique sigma subblocks */
-   for (sblock=0; sblock<S.num_blocks_; sblock++) {
+   /* loop over unique sigma subblocks; each one is built by a single
+      thread, so no two threads ever write the same block of S */
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+   for (int sblock=0; sblock<S.num_blocks_; sblock++) {
       //if (Parameters_->cc && !cc_reqd_sblocks[sblock]) continue;
-      did_sblock = 0;
-      sac = S.Ia_code_[sblock];
-      sbc = S.Ib_code_[sblock];
-      nas = S.Ia_size_[sblock];
-      nbs = S.Ib_size_[sblock];
+      struct sigma_data *sd = sigma_thread_data();
+      int sac = S.Ia_code_[sblock];
+      int sbc = S.Ib_code_[sblock];
+      int nas = S.Ia_size_[sblock];
+      int nbs = S.Ib_size_[sblock];
       if (nas==0 || nbs==0) continue;
       if (S.Ms0_ && sbc > sac) continue;
-      sbirr = sbc / BetaG_->subgr_per_irrep;
-      if (SigmaData_->sprime != NULL) set_row_ptrs(nas, nbs, SigmaData_->sprime);
+      int sbirr = sbc / BetaG_->subgr_per_irrep;
+      if (sd->sprime != NULL) set_row_ptrs(nas, nbs, sd->sprime);
 
-      for (cblock=0; cblock<C.num_blocks_; cblock++) {
+      for (int cblock=0; cblock<C.num_blocks_; cblock++) {
          if (C.check_zero_block(cblock)) continue;
-         cac = C.Ia_code_[cblock];
-         cbc = C.Ib_code_[cblock];
-         cnas = C.Ia_size_[cblock];
-         cnbs = C.Ib_size_[cblock];
-         cbirr = cbc / BetaG_->subgr_per_irrep;
+         int cac = C.Ia_code_[cblock];
+         int cbc = C.Ib_code_[cblock];
+         int cnas = C.Ia_size_[cblock];
+         int cnbs = C.Ib_size_[cblock];
+         int cbirr = cbc / BetaG_->subgr_per_irrep;
          if (s1_contrib_[sblock][cblock] || s2_contrib_[sblock][cblock] ||
              s3_contrib_[sblock][cblock]) {
-            if (SigmaData_->cprime != NULL) set_row_ptrs(cnas, cnbs, SigmaData_->cprime);
+            if (sd->cprime != NULL) set_row_ptrs(cnas, cnbs, sd->cprime);
             sigma_block(alplist, betlist, C.blocks_[cblock], S.blocks_[sblock],
                oei, tei, fci, cblock, sblock, nas, nbs, sac, sbc,
                cac, cbc, cnas, cnbs, C.num_alpcodes_, C.num_betcodes_, sbirr,
-               cbirr, S.Ms0_);
-            did_sblock = 1;
+               cbirr, S.Ms0_, sd);
+            did_sblock[sblock] = 1;
             }
          } /* end loop over c blocks */
+      } /* end loop over sigma blocks */
+
+   for (sblock=0; sblock<S.num_blocks_; sblock++) {
+      sac = S.Ia_code_[sblock];
+      sbc = S.Ib_code_[sblock];
+      nas = S.Ia_size_[sblock];
+      nbs = S.Ib_size_[sblock];
+      if (nas==0 || nbs==0) continue;
+      if (S.Ms0_ && sbc > sac) continue;
 
-      if (did_sblock) S.set_zero_block(sblock, 0);
+      if (did_sblock[sblock]) S.set_zero_block(sblock, 0);
 
       if (S.Ms0_ && (sac==sbc))
          transp_sigma(S.blocks_[sblock], nas, nbs, phase);
@@ -553,11 +662,11 @@ void CIWavefunction::sigma_c(struct stringwr **alplist, struct stringwr **betlis
    int sairr;                    /* irrep of alpha string for sigma block */
    int cairr;                    /* irrep of alpha string for C block */
    int sbirr, cbirr;
-   int i,j,k;
    int sac, sbc, nas, nbs;
    int cac, cbc, cnas, cnbs;
-   int did_sblock = 0;
    int phase;
+   int nthreads = SigmaThread_.size() + 1;
+   std::vector<int> did_sblock(S.num_blocks_, 0);
 
    if (!Parameters_->Ms0) phase = 1;
    else phase = ((int) Parameters_->S % 2) ? -1 : 1;
@@ -567,60 +676,99 @@ void CIWavefunction::sigma_c(struct stringwr **alplist, struct stringwr **betlis
       sairr = S.buf2blk_[buf];
       sbirr = sairr ^ CalcInfo_->ref_sym;
       S.zero();
+      for (sblock=S.first_ablk_[sairr];sblock<=S.last_ablk_[sairr];sblock++)
+         did_sblock[sblock] = 0;
+
       for (cbuf=0; cbuf<C.buf_per_vect_; cbuf++) {
          C.read(C.cur_vect_, cbuf); /* go ahead and assume it will contrib */
+         if (cbuf+1 < C.buf_per_vect_) C.read_ahead(C.cur_vect_, cbuf+1);
          cairr = C.buf2blk_[cbuf];
          cbirr = cairr ^ CalcInfo_->ref_sym;
 
-         for (sblock=S.first_ablk_[sairr];sblock<=S.last_ablk_[sairr];sblock++){
-            sac = S.Ia_code_[sblock];
-            sbc = S.Ib_code_[sblock];
-            nas = S.Ia_size_[sblock];
-            nbs = S.Ib_size_[sblock];
-            did_sblock = 0;
+         /* contributions of the C blocks as stored; threads take whole
+            sigma blocks, so their updates to S never overlap */
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+         for (int sblock=S.first_ablk_[sairr];sblock<=S.last_ablk_[sairr];sblock++){
+            struct sigma_data *sd = sigma_thread_data();
+            int sac = S.Ia_code_[sblock];
+            int sbc = S.Ib_code_[sblock];
+            int nas = S.Ia_size_[sblock];
+            int nbs = S.Ib_size_[sblock];
 
             if (S.Ms0_ && (sac < sbc)) continue;
-            if (SigmaData_->sprime != NULL) set_row_ptrs(nas, nbs, SigmaData_->sprime);
+            if (sd->sprime != NULL) set_row_ptrs(nas, nbs, sd->sprime);
 
-            for (cblock=C.first_ablk_[cairr]; cblock <= C.last_ablk_[cairr];
+            for (int cblock=C.first_ablk_[cairr]; cblock <= C.last_ablk_[cairr];
                   cblock++) {
 
-               cac = C.Ia_code_[cblock];
-               cbc = C.Ib_code_[cblock];
-               cnas = C.Ia_size_[cblock];
-               cnbs = C.Ib_size_[cblock];
+               int cac = C.Ia_code_[cblock];
+               int cbc = C.Ib_code_[cblock];
+               int cnas = C.Ia_size_[cblock];
+               int cnbs = C.Ib_size_[cblock];
 
                if ((s1_contrib_[sblock][cblock] || s2_contrib_[sblock][cblock] ||
                     s3_contrib_[sblock][cblock]) &&
                     !C.check_zero_block(cblock)) {
-      if (SigmaData_->cprime != NULL) set_row_ptrs(cnas, cnbs, SigmaData_->cprime);
+                  if (sd->cprime != NULL) set_row_ptrs(cnas, cnbs, sd->cprime);
                   sigma_block(alplist, betlist, C.blocks_[cblock],
                      S.blocks_[sblock], oei, tei, fci, cblock,
                      sblock, nas, nbs, sac, sbc, cac, cbc, cnas, cnbs,
-                     C.num_alpcodes_, C.num_betcodes_, sbirr, cbirr, S.Ms0_);
-                  did_sblock = 1;
-                  }
-
-               if (C.buf_offdiag_[cbuf]) {
-                  cblock2 = C.decode_[cbc][cac];
-                  if ((s1_contrib_[sblock][cblock2] ||
-                       s2_contrib_[sblock][cblock2] ||
-                       s3_contrib_[sblock][cblock2]) &&
-                      !C.check_zero_block(cblock2)) {
-                     C.transp_block(cblock, SigmaData_->transp_tmp);
-         if (SigmaData_->cprime != NULL) set_row_ptrs(cnbs, cnas, SigmaData_->cprime);
-                     sigma_block(alplist, betlist, SigmaData_->transp_tmp,S.blocks_[sblock],
-                        oei, tei, fci, cblock2, sblock, nas, nbs, sac, sbc,
-                        cbc, cac, cnbs, cnas, C.num_alpcodes_, C.num_betcodes_,
-                        sbirr, cairr, S.Ms0_);
-                     did_sblock = 1;
-                     }
+                     C.num_alpcodes_, C.num_betcodes_, sbirr, cbirr, S.Ms0_, sd);
+                  did_sblock[sblock] = 1;
                   }
                } /* end loop over C blocks in this irrep */
-
-            if (did_sblock) S.set_zero_block(sblock, 0);
             } /* end loop over sblock */
 
+         /* contributions of the transposed blocks: transpose each C block
+            once and let every sigma block that needs it use the copy */
+         if (C.buf_offdiag_[cbuf]) {
+            for (cblock=C.first_ablk_[cairr]; cblock <= C.last_ablk_[cairr];
+                  cblock++) {
+               cac = C.Ia_code_[cblock];
+               cbc = C.Ib_code_[cblock];
+               cnas = C.Ia_size_[cblock];
+               cnbs = C.Ib_size_[cblock];
+               cblock2 = C.decode_[cbc][cac];
+               if (C.check_zero_block(cblock2)) continue;
+
+               int needed = 0;
+               for (sblock=S.first_ablk_[sairr];sblock<=S.last_ablk_[sairr];
+                     sblock++) {
+                  if (S.Ms0_ && (S.Ia_code_[sblock] < S.Ib_code_[sblock]))
+                     continue;
+                  if (s1_contrib_[sblock][cblock2] ||
+                      s2_contrib_[sblock][cblock2] ||
+                      s3_contrib_[sblock][cblock2]) needed = 1;
+                  }
+               if (!needed) continue;
+
+               C.transp_block(cblock, SigmaData_->transp_tmp);
+
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+               for (int sblock=S.first_ablk_[sairr];sblock<=S.last_ablk_[sairr];
+                     sblock++){
+                  int sac = S.Ia_code_[sblock];
+                  int sbc = S.Ib_code_[sblock];
+                  int nas = S.Ia_size_[sblock];
+                  int nbs = S.Ib_size_[sblock];
+
+                  if (S.Ms0_ && (sac < sbc)) continue;
+                  if (!(s1_contrib_[sblock][cblock2] ||
+                        s2_contrib_[sblock][cblock2] ||
+                        s3_contrib_[sblock][cblock2])) continue;
+
+                  struct sigma_data *sd = sigma_thread_data();
+                  if (sd->sprime != NULL) set_row_ptrs(nas, nbs, sd->sprime);
+                  if (sd->cprime != NULL) set_row_ptrs(cnbs, cnas, sd->cprime);
+                  sigma_block(alplist, betlist, SigmaData_->transp_tmp,S.blocks_[sblock],
+                     oei, tei, fci, cblock2, sblock, nas, nbs, sac, sbc,
+                     cbc, cac, cnbs, cnas, C.num_alpcodes_, C.num_betcodes_,
+                     sbirr, cairr, S.Ms0_, sd);
+                  did_sblock[sblock] = 1;
+                  }
+               } /* end loop over C blocks to transpose */
+            }
+
          } /* end loop over cbuf */
 
       /* transpose the diagonal sigma subblocks in this irrep */
@@ -629,6 +777,7 @@ void CIWavefunction::sigma_c(struct stringwr **alplist, struct stringwr **betlis
          sbc = S.Ib_code_[sblock];
          nas = S.Ia_size_[sblock];
          nbs = S.Ib_size_[sblock];
+         if (did_sblock[sblock]) S.set_zero_block(sblock, 0);
          if (S.Ms0_ && (sac==sbc)) transp_sigma(S.blocks_[sblock], nas, nbs,
             phase);
 
@@ -646,6 +795,8 @@ void CIWavefunction::sigma_c(struct stringwr **alplist, struct stringwr **betlis
      S.write(ivec, buf);
 
      } /* end loop over sigma irrep */
+
+   C.stream_end();
 }
 
 
@@ -659,31 +810,33 @@ void CIWavefunction::sigma_block(struct stringwr **alplist, struct stringwr **be
       double **cmat, double **smat, double *oei, double *tei, int fci,
       int cblock, int sblock, int nas, int nbs, int sac, int sbc,
       int cac, int cbc, int cnas, int cnbs, int cnac, int cnbc,
-      int sbirr, int cbirr, int Ms0)
+      int sbirr, int cbirr, int Ms0, struct sigma_data *sd)
 {
+   bool serial = sigma_serial();
+   int nthreads = serial ? Parameters_->nthreads : 1;
 
    /* SIGMA2 CONTRIBUTION */
   if (s2_contrib_[sblock][cblock]) {
 
-    timer_on("CIWave: s2");
+    if (serial) timer_on("CIWave: s2");
 
       if (fci) {
-          s2_block_vfci(alplist, betlist, cmat, smat, oei, tei, SigmaData_->F, cnac,
+          s2_block_vfci(alplist, betlist, cmat, smat, oei, tei, sd->F, cnac,
                             nas, nbs, sac, cac, cnas);
         }
       else {
           if (Parameters_->repl_otf) {
-              s2_block_vras_rotf(SigmaData_->Jcnt, SigmaData_->Jij, SigmaData_->Joij,
-                                 SigmaData_->Jridx, SigmaData_->Jsgn,
-                                 SigmaData_->Toccs, cmat, smat, oei, tei, SigmaData_->F, cnac,
+              s2_block_vras_rotf(sd->Jcnt, sd->Jij, sd->Joij,
+                                 sd->Jridx, sd->Jsgn,
+                                 sd->Toccs, cmat, smat, oei, tei, sd->F, cnac,
                                  nas, nbs, sac, cac, cnas, AlphaG_, BetaG_, CalcInfo_, Occs_);
             }
           else {
               s2_block_vras(alplist, betlist, cmat, smat,
-                            oei, tei, SigmaData_->F, cnac, nas, nbs, sac, cac, cnas);
+                            oei, tei, sd->F, cnac, nas, nbs, sac, cac, cnas);
             }
         }
-    timer_off("CIWave: s2");
+    if (serial) timer_off("CIWave: s2");
 
     } /* end sigma2 */
 
@@ -696,28 +849,28 @@ void CIWavefunction::sigma_block(struct stringwr **alplist, struct stringwr **be
 
    /* SIGMA1 CONTRIBUTION */
    if (!Ms0 || (sac != sbc)) {
-    timer_on("CIWave: s1");
+    if (serial) timer_on("CIWave: s1");
 
       if (s1_contrib_[sblock][cblock]) {
           if (fci) {
-             s1_block_vfci(alplist, betlist, cmat, smat, oei, tei, SigmaData_->F, cnbc,
+             s1_block_vfci(alplist, betlist, cmat, smat, oei, tei, sd->F, cnbc,
                                 nas, nbs, sbc, cbc, cnbs);
             }
          else {
             if (Parameters_->repl_otf) {
-               s1_block_vras_rotf(SigmaData_->Jcnt, SigmaData_->Jij, SigmaData_->Joij,
-                  SigmaData_->Jridx, SigmaData_->Jsgn,
-                  SigmaData_->Toccs, cmat, smat, oei, tei, SigmaData_->F, cnbc, nas, nbs,
+               s1_block_vras_rotf(sd->Jcnt, sd->Jij, sd->Joij,
+                  sd->Jridx, sd->Jsgn,
+                  sd->Toccs, cmat, smat, oei, tei, sd->F, cnbc, nas, nbs,
                   sbc, cbc, cnbs, BetaG_, CalcInfo_, Occs_);
                }
             else {
-               s1_block_vras(alplist, betlist, cmat, smat, oei, tei, SigmaData_->F, cnbc,
+               s1_block_vras(alplist, betlist, cmat, smat, oei, tei, sd->F, cnbc,
                   nas, nbs, sbc, cbc, cnbs);
                }
             }
          }
 
-      timer_off("CIWave: s1");
+      if (serial) timer_off("CIWave: s1");
    } /* end sigma1 */
 
    if (Parameters_->print_lvl > 3) {
@@ -728,60 +881,61 @@ void CIWavefunction::sigma_block(struct stringwr **alplist, struct stringwr **be
 
    /* SIGMA3 CONTRIBUTION */
    if (s3_contrib_[sblock][cblock]) {
-      timer_on("CIWave: s3");
+      if (serial) timer_on("CIWave: s3");
 
       /* zero_mat(smat, nas, nbs); */
 
       if (!Ms0 || (sac != sbc)) {
          if (Parameters_->repl_otf) {
-            b2brepl(Occs_[sac], SigmaData_->Jcnt[0], SigmaData_->Jij[0],
-               SigmaData_->Joij[0], SigmaData_->Jridx[0],
-               SigmaData_->Jsgn[0], AlphaG_, sac, cac, nas, CalcInfo_);
-            b2brepl(Occs_[sbc], SigmaData_->Jcnt[1], SigmaData_->Jij[1],
-                    SigmaData_->Joij[1], SigmaData_->Jridx[1],
-                    SigmaData_->Jsgn[1], BetaG_, sbc, cbc, nbs, CalcInfo_);
-            s3_block_vrotf(SigmaData_->Jcnt, SigmaData_->Jij, SigmaData_->Jridx,
-                           SigmaData_->Jsgn, cmat, smat, tei, nas, nbs,
-                           cnas, sbc, cac, cbc, sbirr, cbirr, SigmaData_->cprime,
-                           SigmaData_->F, SigmaData_->V, SigmaData_->Sgn, SigmaData_->L,
-                           SigmaData_->R, CalcInfo_->num_ci_orbs,
+            b2brepl(Occs_[sac], sd->Jcnt[0], sd->Jij[0],
+               sd->Joij[0], sd->Jridx[0],
+               sd->Jsgn[0], AlphaG_, sac, cac, nas, CalcInfo_);
+            b2brepl(Occs_[sbc], sd->Jcnt[1], sd->Jij[1],
+                    sd->Joij[1], sd->Jridx[1],
+                    sd->Jsgn[1], BetaG_, sbc, cbc, nbs, CalcInfo_);
+            s3_block_vrotf(sd->Jcnt, sd->Jij, sd->Jridx,
+                           sd->Jsgn, cmat, smat, tei, nas, nbs,
+                           cnas, sbc, cac, cbc, sbirr, cbirr, sd->cprime,
+                           sd->F, sd->V, sd->Sgn, sd->L,
+                           sd->R, CalcInfo_->num_ci_orbs,
                            CalcInfo_->orbsym + CalcInfo_->num_drc_orbs);
             }
          else {
             s3_block_v(alplist[sac], betlist[sbc], cmat, smat, tei,
                nas, nbs, cnas, sbc, cac, cbc, sbirr, cbirr,
-               SigmaData_->cprime, SigmaData_->F, SigmaData_->V,
-               SigmaData_->Sgn, SigmaData_->L, SigmaData_->R,
-               CalcInfo_->num_ci_orbs, CalcInfo_->orbsym + CalcInfo_->num_drc_orbs);
+               sd->cprime, sd->F, sd->V,
+               sd->Sgn, sd->L, sd->R,
+               CalcInfo_->num_ci_orbs, CalcInfo_->orbsym + CalcInfo_->num_drc_orbs,
+               nthreads);
             }
          }
 
       else if (Parameters_->bendazzoli) {
          s3_block_bz(sac, sbc, cac, cbc, nas, nbs, cnas, tei, cmat, smat,
-            SigmaData_->cprime, SigmaData_->sprime, CalcInfo_, OV_);
+            sd->cprime, sd->sprime, CalcInfo_, OV_);
          }
 
       else {
          if (Parameters_->repl_otf) {
-            b2brepl(Occs_[sac], SigmaData_->Jcnt[0], SigmaData_->Jij[0],
-                    SigmaData_->Joij[0], SigmaData_->Jridx[0],
-                    SigmaData_->Jsgn[0], AlphaG_, sac, cac, nas, CalcInfo_);
-            b2brepl(Occs_[sbc], SigmaData_->Jcnt[1], SigmaData_->Jij[1],
-                    SigmaData_->Joij[1], SigmaData_->Jridx[1],
-                    SigmaData_->Jsgn[1], BetaG_, sbc, cbc, nbs, CalcInfo_);
-            s3_block_vdiag_rotf(SigmaData_->Jcnt, SigmaData_->Jij, SigmaData_->Jridx,
-                                SigmaData_->Jsgn, cmat, smat, tei, nas, nbs, cnas, sbc,
-                                cac, cbc, sbirr, cbirr, SigmaData_->cprime, SigmaData_->F,
-                                SigmaData_->V, SigmaData_->Sgn, SigmaData_->L,
-                                SigmaData_->R, CalcInfo_->num_ci_orbs,
+            b2brepl(Occs_[sac], sd->Jcnt[0], sd->Jij[0],
+                    sd->Joij[0], sd->Jridx[0],
+                    sd->Jsgn[0], AlphaG_, sac, cac, nas, CalcInfo_);
+            b2brepl(Occs_[sbc], sd->Jcnt[1], sd->Jij[1],
+                    sd->Joij[1], sd->Jridx[1],
+                    sd->Jsgn[1], BetaG_, sbc, cbc, nbs, CalcInfo_);
+            s3_block_vdiag_rotf(sd->Jcnt, sd->Jij, sd->Jridx,
+                                sd->Jsgn, cmat, smat, tei, nas, nbs, cnas, sbc,
+                                cac, cbc, sbirr, cbirr, sd->cprime, sd->F,
+                                sd->V, sd->Sgn, sd->L,
+                                sd->R, CalcInfo_->num_ci_orbs,
                                 CalcInfo_->orbsym + CalcInfo_->num_drc_orbs);
             }
          else {
             s3_block_vdiag(alplist[sac], betlist[sbc], cmat, smat, tei, nas, nbs,
-                           cnas, sbc, cac, cbc, sbirr, cbirr, SigmaData_->cprime,
-                           SigmaData_->F, SigmaData_->V, SigmaData_->Sgn,
-                           SigmaData_->L, SigmaData_->R, CalcInfo_->num_ci_orbs,
-                           CalcInfo_->orbsym + CalcInfo_->num_drc_orbs);
+                           cnas, sbc, cac, cbc, sbirr, cbirr, sd->cprime,
+                           sd->F, sd->V, sd->Sgn,
+                           sd->L, sd->R, CalcInfo_->num_ci_orbs,
+                           CalcInfo_->orbsym + CalcInfo_->num_drc_orbs, nthreads);
             }
          }
 
@@ -791,7 +945,7 @@ void CIWavefunction::sigma_block(struct stringwr **alplist, struct stringwr **be
         print_mat(smat, nas, nbs, "outfile");
       }
 
-      timer_off("CIWave: s3");
+      if (serial) timer_off("CIWave: s3");
 
       } /* end sigma3 */
 }
@@ -505,6 +505,7 @@ struct params {
                               command line or the DETCASMAN driver? */
    double special_conv;    /* special convergence value */
    int nthreads;           /* number of threads to use in sigma routines */
+   int read_ahead;         /* read next C buffer while sigma uses this one? */
    int sf_restrict;        /* 1 if restrict CI space (CI blocks) to
                               do only determinants (or their
                               spin-complements) in RASCI versions of
@@ -46,8 +46,8 @@ namespace psi { namespace detci {
 ** of length 'size'
 **
 */
-void xey(double *x, double *y, int size) {
-   int i;
+void xey(double *x, double *y, unsigned long int size) {
+   unsigned long int i;
 
    for (i=0; i<size; i++) {
       x[i] = y[i];
@@ -62,9 +62,9 @@ void xey(double *x, double *y, int size) {
 **
 ** David Sherrill, November 1995
 */
-void xeay(double *x, double a, double *y, int size)
+void xeay(double *x, double a, double *y, unsigned long int size)
 {
-   int i;
+   unsigned long int i;
 
    for (i=0; i<size; i++) {
       x[i] = a * y[i];
@@ -81,9 +81,9 @@ void xeay(double *x, double a, double *y, int size)
 **
 ** David Sherrill, November 1995
 */
-void xpeay(double *x, double a, double *y, int size)
+void xpeay(double *x, double a, double *y, unsigned long int size)
 {
-   int i;
+   unsigned long int i;
 
    for (i=0; i<size; i++) {
       x[i] += a * y[i];
@@ -98,9 +98,9 @@ void xpeay(double *x, double a, double *y, int size)
 ** David Sherrill, February 1996
 **
 */
-void xeax(double *x, double a, int size)
+void xeax(double *x, double a, unsigned long int size)
 {
-   int i;
+   unsigned long int i;
 
    for (i=0; i<size; i++) {
       x[i] *= a;
@@ -116,9 +116,9 @@ void xeax(double *x, double a, int size)
 ** David Sherrill, February 1996
 **
 */
-void xeaxmy(double *x, double *y, double a, int size)
+void xeaxmy(double *x, double *y, double a, unsigned long int size)
 {
-   int i;
+   unsigned long int i;
 
    for (i=0; i<size; i++) {
       x[i] = x[i] * a - y[i];
@@ -133,9 +133,9 @@ void xeaxmy(double *x, double *y, double a, int size)
 ** David Sherrill, March 1996
 **
 */
-void xeaxpby(double *x, double *y, double a, double b, int size)
+void xeaxpby(double *x, double *y, double a, double b, unsigned long int size)
 {
-   int i;
+   unsigned long int i;
 
    for (i=0; i<size; i++) {
       x[i] = a * x[i] + b * y[i];
@@ -149,9 +149,9 @@ void xeaxpby(double *x, double *y, double a, double b, int size)
 ** Matt Leininger, September 1998
 **
 */
-void xexy(double *x, double *y, int size)
+void xexy(double *x, double *y, unsigned long int size)
 {
-  int i;
+  unsigned long int i;
   
   for (i=0; i<size; i++) {
      x[i] *= y[i];
@@ -166,9 +166,9 @@ void xexy(double *x, double *y, int size)
 ** Matt Leininger and Nick Petraco, February 1999
 **
 */
-void xexmy(double *x, double *y, int size)
+void xexmy(double *x, double *y, unsigned long int size)
 {
-   int i;
+   unsigned long int i;
 
    for (i=0; i<size; i++) {
       x[i] -= y[i];
@@ -183,9 +183,9 @@ void xexmy(double *x, double *y, int size)
 ** Matt Leininger February 1999
 **
 */
-void xpey(double *x, double *y, int size)
+void xpey(double *x, double *y, unsigned long int size)
 {
-   int i;
+   unsigned long int i;
 
    for (i=0; i<size; i++) {
       x[i] += y[i];
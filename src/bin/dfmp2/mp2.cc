@@ -436,35 +436,52 @@ void DFMP2::apply_fitting(SharedMatrix Jm12, unsigned int file, ULI naux, ULI ni
     }
     //block_status(ia_starts, __FILE__,__LINE__);
 
+    // Loop through blocks
+    psio_->open(file, PSIO_OPEN_OLD);
+    psio_address next_AIA = PSIO_ZERO;
+    psio_address next_QIA = PSIO_ZERO;
+
+    // A memory-mapped (A|ia) is strided over in place instead of being
+    // gathered column block by column block
+    char* Aia_map = psio_->mapped_pointer(file,"(A|ia)",PSIO_ZERO,0);
+    bool Aia_mapped = (Aia_map != NULL && ((size_t) Aia_map) % sizeof(double) == 0);
+
     // Tensor blocks
-    SharedMatrix Aia(new Matrix("Aia", naux, max_nia));
+    SharedMatrix Aia;
+    if (!Aia_mapped)
+        Aia = SharedMatrix(new Matrix("Aia", naux, max_nia));
     SharedMatrix Qia(new Matrix("Qia", max_nia, naux));
-    double** Aiap = Aia->pointer();
     double** Qiap = Qia->pointer();
     double** Jp   = Jm12->pointer();
 
-    // Loop through blocks
-    psio_->open(file, PSIO_OPEN_OLD);
-    psio_address next_AIA = PSIO_ZERO;
-    psio_address next_QIA = PSIO_ZERO;
     for (int block = 0; block < ia_starts.size() - 1; block++) {
 
         // Sizing
         ULI ia_start = ia_starts[block];
         ULI ia_stop  = ia_starts[block+1];
         ULI ncols = ia_stop - ia_start;
+        double* Aiap;
+        ULI lda;
 
         // Read Aia
         timer_on("DFMP2 Aia Read");
-        for (ULI Q = 0; Q < naux; Q++) {
-            next_AIA = psio_get_address(PSIO_ZERO,sizeof(double)*(Q*nia+ia_start));
-            psio_->read(file,"(A|ia)",(char*)Aiap[Q],sizeof(double)*ncols,next_AIA,&next_AIA);
+        if (Aia_mapped) {
+            // Refetched every block: the (Q|ia) writes below may remap the file
+            Aiap = (double*) psio_->mapped_pointer(file,"(A|ia)",PSIO_ZERO,sizeof(double)*naux*nia) + ia_start;
+            lda = nia;
+        } else {
+            for (ULI Q = 0; Q < naux; Q++) {
+                next_AIA = psio_get_address(PSIO_ZERO,sizeof(double)*(Q*nia+ia_start));
+                psio_->read(file,"(A|ia)",(char*)Aia->pointer()[Q],sizeof(double)*ncols,next_AIA,&next_AIA);
+            }
+            Aiap = Aia->pointer()[0];
+            lda = max_nia;
         }
         timer_off("DFMP2 Aia Read");
 
         // Apply Fitting
         timer_on("DFMP2 (Q|A)(A|ia)");
-        C_DGEMM('T','N',ncols,naux,naux,1.0,Aiap[0],max_nia,Jp[0],naux,0.0,Qiap[0],naux);
+        C_DGEMM('T','N',ncols,naux,naux,1.0,Aiap,lda,Jp[0],naux,0.0,Qiap[0],naux);
         timer_off("DFMP2 (Q|A)(A|ia)");
 
         // Write Qia
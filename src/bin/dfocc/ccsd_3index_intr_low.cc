@@ -85,6 +85,33 @@ void DFOCC::ccsd_3index_intr_low()
     T->write(psio_, PSIF_DFOCC_AMPS);
     T.reset();
 
+    // DISK B(Q|AB): t(Q,ab) is formed slab by slab where it is needed
+    if (do_bqab_disk) {
+        K.reset();
+
+        // t(Q,ia) = \sum_{f} t_i^f b_fa^Q 
+        T = SharedTensor2d(new Tensor2d("T1 (Q|IA)", nQ, naoccA, navirA));
+        {
+            BlockStream bs(psio_, PSIF_DFOCC_INTS, "DF_BASIS_CC B (Q|AB)", ntri_abAA);
+            bs.add_rows(nQ, nQ_batch);
+            int Q0 = 0;
+            for (SharedTensor2d P = bs.next(); P; P = bs.next()) {
+                 int nQs = P->dim1();
+                 K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|AB)", nQs, navirA, navirA));
+                 b_ab_unpack(K, P);
+                 for (int Q = 0; Q < nQs; Q++) {
+                      T->contract(false, false, naoccA, navirA, navirA, t1A, K, 0, (ULI)Q * navirA * navirA,
+                                  (ULI)(Q0 + Q) * naoccA * navirA, 1.0, 0.0);
+                 }
+                 K.reset();
+                 Q0 += nQs;
+            }
+        }
+        T->write(psio_, PSIF_DFOCC_AMPS);
+        T.reset();
+    }
+
+    else {
     // t(Q,ab) = \sum_{m} t_m^a b_mb^Q 
     T = SharedTensor2d(new Tensor2d("T1 (Q|AB)", nQ, navirA, navirA));
     T->contract233(true, false, navirA, navirA, t1A, K, 1.0, 0.0);
@@ -100,6 +127,7 @@ void DFOCC::ccsd_3index_intr_low()
     T->write(psio_, PSIF_DFOCC_AMPS);
     T.reset();
     K.reset();
+    }
 
     // t(Q,ai) = \sum_{m} t_m^a b_mi^Q 
     K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|IJ)", nQ, naoccA, naoccA));
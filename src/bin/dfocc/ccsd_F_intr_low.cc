@@ -60,10 +60,28 @@ void DFOCC::ccsd_F_intr_low()
 
     // VV block
     // F_ae =  \sum_{Q} t_Q b_ae^Q
-    K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|AB)", nQ, navirA, navirA));
-    K->read(psio_, PSIF_DFOCC_INTS, true, true);
-    FabA->gemv(true, K, T1c, 1.0, 0.0);
-    K.reset();
+    if (do_bqab_disk) {
+        FabA->zero();
+        BlockStream bs(psio_, PSIF_DFOCC_INTS, "DF_BASIS_CC B (Q|AB)", ntri_abAA);
+        bs.add_rows(nQ, nQ_batch);
+        int Q0 = 0;
+        for (SharedTensor2d P = bs.next(); P; P = bs.next()) {
+             int nQs = P->dim1();
+             K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|AB)", nQs, navirA, navirA));
+             b_ab_unpack(K, P);
+             SharedTensor1d Ts = SharedTensor1d(new Tensor1d("DF_BASIS_CC T1_Q Slab", nQs));
+             for (int Q = 0; Q < nQs; Q++) Ts->set(Q, T1c->get(Q0 + Q));
+             FabA->gemv(true, K, Ts, 1.0, 1.0);
+             K.reset();
+             Q0 += nQs;
+        }
+    }
+    else {
+        K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|AB)", nQ, navirA, navirA));
+        K->read(psio_, PSIF_DFOCC_INTS, true, true);
+        FabA->gemv(true, K, T1c, 1.0, 0.0);
+        K.reset();
+    }
 
     // F_ae -=  \sum_{Q,m} Tau'_ma^Q b_me^Q
     K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|IA)", nQ, naoccA, navirA));
@@ -352,7 +352,7 @@ void DFOCC::ccsd_WijamT2()
     for(int m = 0 ; m < naoccA; ++m){
 
             // Form V[m](ae,f) = \sum_{Q} b(Q,ae) B(mfQ)
-            I->contract(true, true, navirA * navirA, navirA, nQ, bQabA, L, 0, m*navirA*nQ, 1.0, 0.0);
+            I->contract(true, true, navirA * navirA, navirA, nQ, bQabA, L, 0, (ULI)m*navirA*nQ, 1.0, 0.0);
 
             // Form (+)V[m](a, e>=f)
             #pragma omp parallel for
@@ -628,7 +628,7 @@ void DFOCC::ccsd_WabefT2()
             int nb = a+1;
 
             // Form V[a](bf,e) = \sum_{Q} B(bfQ)*B(aeQ) cost = V^4N/2
-            I->contract(false, true, navirA*nb, navirA, nQ, K, K, 0, a*navirA*nQ, 1.0, 0.0);
+            I->contract(false, true, navirA*nb, navirA, nQ, K, K, 0, (ULI)a*navirA*nQ, 1.0, 0.0);
 
             // Form (+)V[a](b, e>=f) 
             #pragma omp parallel for
@@ -786,10 +786,10 @@ void DFOCC::ccsd_Wabef2T2()
         int nb = a+1;
 
         // Form J[a](bf,e) = \sum_{Q} B(bfQ)*[B(aeQ)-T(aeQ)] cost = V^4N/2
-        I->contract(false, true, navirA*nb, navirA, nQ, K, X, 0, a*navirA*nQ, 1.0, 0.0);
+        I->contract(false, true, navirA*nb, navirA, nQ, K, X, 0, (ULI)a*navirA*nQ, 1.0, 0.0);
 
         // Form J[a](mf,e) = \sum_{Q} B(mfQ)*B(aeQ) cost = OV^3N
-        J->contract(false, true, navirA*naoccA, navirA, nQ, L, K, 0, a*navirA*nQ, 1.0, 0.0);
+        J->contract(false, true, navirA*naoccA, navirA, nQ, L, K, 0, (ULI)a*navirA*nQ, 1.0, 0.0);
 
         // J[a](b,fe) -= \sum_{m} t(b,m) * J[a](m,fe)
         I->contract(false, false, nb, navirA*navirA, naoccA, T1, J, -1.0, 1.0);
@@ -1079,7 +1079,7 @@ void DFOCC::ccsd_WabefT2_cd()
             int nb = a+1;
 
             // Form V[a](bf,e) = \sum_{Q} B(bfQ)*B(aeQ) cost = V^4N/2
-            I->contract(false, true, navirA*nb, navirA, nQ_cd, K, K, 0, a*navirA*nQ_cd, 1.0, 0.0);
+            I->contract(false, true, navirA*nb, navirA, nQ_cd, K, K, 0, (ULI)a*navirA*nQ_cd, 1.0, 0.0);
 
             // Form (+)V[a](b, e>=f) 
             #pragma omp parallel for
@@ -1300,7 +1300,7 @@ void DFOCC::ccsd_WabefT2_ao_basis()
 			double Gaebf = tau_max * G->get(a,e) * G->get(b,f);
 			if (fabs(Gaebf) > int_cutoff_) {
 			      ndf_nz++;
-                              J->contract(false, true, 1, 1, nQ, K, K, ae*nQ, bf*nQ, 1.0, 0.0);
+                              J->contract(false, true, 1, 1, nQ, K, K, (ULI)ae*nQ, (ULI)bf*nQ, 1.0, 0.0);
 			      I->set(bf, e, J->get(0,0));
 			}// end if
 			else I->set(bf, e, 0.0);
@@ -1476,7 +1476,7 @@ void DFOCC::ccsd_WabefT2_ao_basis()
 			//double Gmlns = Sso->get(m,l) * Sso->get(n,s) / tau_max;
 			if (fabs(Gmlns) > int_cutoff_) {
 			    ndf_nz++;
-                            J->contract(false, true, 1, 1, nQ, K, K, ml*nQ, ns*nQ, 1.0, 0.0);
+                            J->contract(false, true, 1, 1, nQ, K, K, (ULI)ml*nQ, (ULI)ns*nQ, 1.0, 0.0);
 		            Jmlns = J->get(0,0);
 
 			    // adressing
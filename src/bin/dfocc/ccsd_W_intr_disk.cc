@@ -0,0 +1,259 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2016 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+#include <libqt/qt.h>
+#include "defines.h"
+#include "dfocc.h"
+
+using namespace psi;
+using namespace std;
+
+
+namespace psi{ namespace dfoccwave{
+  
+//======================================================================
+//    Wabef2T2: B(Q|AB) streamed from the disk
+//======================================================================             
+void DFOCC::ccsd_Wabef2T2_disk()
+{
+    // defs
+    SharedTensor2d K, M, I, T, Tnew, U, Tau, Y, S, A;
+    SharedTensor2d Ka, Xa, Kb, Tb, Vs, Ts, Va, Ta, T1;
+
+    timer_on("WabefT2");
+
+    // t_ij^ab <= \sum_{ef} Tau_ij^ef <ab|ef>
+    Tau = SharedTensor2d(new Tensor2d("Tau (IA|JB)", naoccA, navirA, naoccA, navirA));
+    Tau->read_symm(psio_, PSIF_DFOCC_AMPS);
+    // (+)Tau(ij, ab) = 1/2 (Tau_ij^ab + Tau_ji^ab) * (2 - \delta_{ab})
+    // (-)Tau(ij, ab) = 1/2 (Tau_ij^ab - Tau_ji^ab) * (2 - \delta_{ab}) 
+    U = SharedTensor2d(new Tensor2d("(+)Tau [I>=J|A>=B]", ntri_ijAA, ntri_abAA));
+    T = SharedTensor2d(new Tensor2d("(-)Tau [I>=J|A>=B]", ntri_ijAA, ntri_abAA));
+    #pragma omp parallel for
+    for(int i = 0 ; i < naoccA; ++i){
+        for(int j = 0 ; j <= i; ++j){
+            int ij = index2(i,j); 
+            for(int a = 0 ; a < navirA; ++a){
+                int ia = ia_idxAA->get(i,a);
+                int ja = ia_idxAA->get(j,a);
+                for(int b = 0 ; b <= a; ++b){
+                    double perm = (a == b ? 1.0 : 2.0);
+                    int ab = index2(a,b); 
+                    int jb = ia_idxAA->get(j,b);
+                    int ib = ia_idxAA->get(i,b);
+                    double value1 = 0.5 * perm * ( Tau->get(ia,jb) + Tau->get(ja,ib) ); 
+                    double value2 = 0.5 * perm * ( Tau->get(ia,jb) - Tau->get(ja,ib) ); 
+                    U->set(ij,ab,value1);
+                    T->set(ij,ab,value2);
+                }
+            }
+        }
+    }
+    Tau.reset();
+
+    // B(m,Qe): t(Q,ae) = \sum_{m} t_m^a b_me^Q is formed for a batch of a at once
+    M = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|IA)", nQ, naoccA, navirA));
+    M->read(psio_, PSIF_DFOCC_INTS);
+    Y = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (I|QA)", naoccA, nQ * navirA));
+    #pragma omp parallel for
+    for(int m = 0 ; m < naoccA; ++m){
+        for(int Q = 0 ; Q < nQ; ++Q){
+            for(int e = 0 ; e < navirA; ++e){
+                Y->set(m, Q * navirA + e, M->get(Q, m * navirA + e));
+            }
+        }
+    }
+    M = Y;
+    Y.reset();
+    // T(a,i)
+    T1 = SharedTensor2d(new Tensor2d("T1 (A|I)", navirA, naoccA));
+    T1 = t1A->transpose();
+
+    // malloc
+    I = SharedTensor2d(new Tensor2d("I[A] <BF|E>", nvir_batch * navirA, navirA));
+    Vs = SharedTensor2d(new Tensor2d("(+)V[A] (B, E>=F)", nvir_batch, ntri_abAA));
+    Va = SharedTensor2d(new Tensor2d("(-)V[A] (B, E>=F)", nvir_batch, ntri_abAA));
+    Ts = SharedTensor2d(new Tensor2d("(+)T[A] (B, I>=J)", nvir_batch, ntri_ijAA));
+    Ta = SharedTensor2d(new Tensor2d("(-)T[B] (B, I>=J)", nvir_batch, ntri_ijAA));
+
+    // Symmetric & Anti-symmetric contributions
+    S = SharedTensor2d(new Tensor2d("S (A>=B, I>=J)", ntri_abAA, ntri_ijAA));
+    A = SharedTensor2d(new Tensor2d("A (A>=B, I>=J)", ntri_abAA, ntri_ijAA));
+
+    // Column blocks of B(Q,ab): for the a batch k, the batch itself and then the b batches before it
+    int nbatch = (navirA + nvir_batch - 1) / nvir_batch;
+    BlockStream bs(psio_, PSIF_DFOCC_INTS, "DF_BASIS_CC B (Q|AB) Square", (ULI)navirA * navirA);
+    for(int k = 0 ; k < nbatch; ++k){
+        int a0 = k * nvir_batch;
+        bs.add(0, nQ, (ULI)a0 * navirA, MIN0(nvir_batch, navirA - a0) * navirA);
+        for(int j = 0 ; j < k; ++j){
+            bs.add(0, nQ, (ULI)j * nvir_batch * navirA, nvir_batch * navirA);
+        }
+    }
+
+    // Main loop
+    for(int k = 0 ; k < nbatch; ++k){
+        int a0 = k * nvir_batch;
+        int na = MIN0(nvir_batch, navirA - a0);
+
+        // Ka(aQ,e) = b_ae^Q and Xa(aQ,e) = b_ae^Q - t_ae^Q for the a of the batch
+        K = bs.next();
+        Ka = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (AQ|E)", na * nQ, navirA));
+        #pragma omp parallel for
+        for(int a = 0 ; a < na; ++a){
+            for(int Q = 0 ; Q < nQ; ++Q){
+                for(int e = 0 ; e < navirA; ++e){
+                    Ka->set(a * nQ + Q, e, K->get(Q, a * navirA + e));
+                }
+            }
+        }
+        Xa = SharedTensor2d(new Tensor2d("B-T1 (AQ|E)", na * nQ, navirA));
+        Xa->contract(false, false, na, nQ * navirA, naoccA, T1, M, (ULI)a0 * naoccA, 0, -1.0, 0.0);
+        Xa->add(Ka);
+
+        for(int l = 0 ; l <= k; ++l){
+            int kb = (l == 0) ? k : l - 1;
+            int b0 = kb * nvir_batch;
+            int nb = (kb == k) ? na : nvir_batch;
+
+            // Kb(Q,bf) = b_bf^Q and Tb(Q,bf) = t_bf^Q for the b of the block
+            if (l > 0) K = bs.next();
+            Kb = K;
+            K.reset();
+            Tb = SharedTensor2d(new Tensor2d("T1 (Q|AB)", nQ, nb * navirA));
+            if (kb == k) {
+                #pragma omp parallel for
+                for(int Q = 0 ; Q < nQ; ++Q){
+                    for(int b = 0 ; b < nb; ++b){
+                        for(int f = 0 ; f < navirA; ++f){
+                            Tb->set(Q, b * navirA + f, Ka->get(b * nQ + Q, f) - Xa->get(b * nQ + Q, f));
+                        }
+                    }
+                }
+            }
+            else {
+                Y = SharedTensor2d(new Tensor2d("T1 (B|QF)", nb, nQ * navirA));
+                Y->contract(false, false, nb, nQ * navirA, naoccA, T1, M, (ULI)b0 * naoccA, 0, 1.0, 0.0);
+                #pragma omp parallel for
+                for(int Q = 0 ; Q < nQ; ++Q){
+                    for(int b = 0 ; b < nb; ++b){
+                        for(int f = 0 ; f < navirA; ++f){
+                            Tb->set(Q, b * navirA + f, Y->get(b, Q * navirA + f));
+                        }
+                    }
+                }
+                Y.reset();
+            }
+
+            for(int a_loc = 0 ; a_loc < na; ++a_loc){
+                int a = a0 + a_loc;
+                int nbl = MIN0(b0 + nb, a + 1) - b0;
+
+                // I[a](bf,e) = \sum_{Q} b_bf^Q (b_ae^Q - t_ae^Q) - \sum_{Q} t_bf^Q b_ae^Q 
+                I->contract(true, false, nb * navirA, navirA, nQ, Kb, Xa, 0, (ULI)a_loc * nQ * navirA, 1.0, 0.0);
+                I->contract(true, false, nb * navirA, navirA, nQ, Tb, Ka, 0, (ULI)a_loc * nQ * navirA, -1.0, 1.0);
+
+                // Form (+)V[a](b, e>=f) 
+                #pragma omp parallel for
+                for(int b = 0 ; b < nbl; ++b){
+                    for(int e = 0 ; e < navirA; ++e){
+                        int be = e + (b * navirA);
+                        for(int f = 0 ; f <= e; ++f){
+                            int ef = index2(e,f); 
+                            int bf = f + (b * navirA);
+                            double value1 = 0.5 * ( I->get(bf, e) + I->get(be, f) );
+                            double value2 = 0.5 * ( I->get(bf, e) - I->get(be, f) );
+                            Vs->set(b, ef, value1);
+                            Va->set(b, ef, value2);
+                        }
+                    }
+                }
+
+                // Form T[a](b, i>=j) = \sum_{e>=f} Tau(i>=j,e>=f) V[a](b, e>=f) 
+                Ts->contract(false, true, nbl, ntri_ijAA, ntri_abAA, Vs, U, 1.0, 0.0);
+                Ta->contract(false, true, nbl, ntri_ijAA, ntri_abAA, Va, T, 1.0, 0.0);
+
+                // Form S(ij,ab) & A(ij,ab)
+                #pragma omp parallel for
+                for(int b = 0 ; b < nbl; ++b){
+                    int ab = index2(a,b0 + b); 
+                    for(int i = 0 ; i < naoccA; ++i){
+                        for(int j = 0 ; j <= i; ++j){
+                            int ij = index2(i,j); 
+                            S->add(ab, ij, Ts->get(b,ij));
+                            A->add(ab, ij, Ta->get(b,ij));
+                        }
+                    }
+                }
+            }
+            Kb.reset();
+            Tb.reset();
+        }
+        Ka.reset();
+        Xa.reset();
+    }
+    I.reset();
+    Vs.reset();
+    Va.reset();
+    Ts.reset();
+    Ta.reset();
+    U.reset();
+    T.reset();
+    M.reset();
+    T1.reset();
+
+    // T(ia,jb) <-- S(a>=b,i>=j) + A(a>=b,i>=j)
+    Tnew = SharedTensor2d(new Tensor2d("New T2 (IA|JB)", naoccA, navirA, naoccA, navirA));
+    Tnew->read_symm(psio_, PSIF_DFOCC_AMPS);
+    #pragma omp parallel for
+    for(int a = 0 ; a < navirA; ++a){
+        for(int b = 0 ; b < navirA; ++b){
+            int ab = index2(a,b); 
+            for(int i = 0 ; i < naoccA; ++i){
+                int ia = ia_idxAA->get(i,a);
+                for(int j = 0 ; j < naoccA; ++j){
+                    int jb = ia_idxAA->get(j,b);
+                    int ij = index2(i,j); 
+                    int perm1 = ( i > j ) ? 1 : -1;
+                    int perm2 = ( a > b ) ? 1 : -1;
+                    double value = S->get(ab,ij) + (perm1 * perm2 * A->get(ab,ij));
+                    Tnew->add(ia, jb, value);
+                }
+            }
+        }
+    }
+    S.reset();
+    A.reset();
+    Tnew->write_symm(psio_, PSIF_DFOCC_AMPS);
+    Tnew.reset();
+
+    timer_off("WabefT2");
+
+}// end ccsd_Wabef2T2_disk
+
+}} // End Namespaces
+
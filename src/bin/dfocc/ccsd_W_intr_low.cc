@@ -279,9 +279,33 @@ void DFOCC::ccsd_WmbejT2_low()
     K->read(psio_, PSIF_DFOCC_INTS);
     K->add(T);
     T.reset();
+    X = SharedTensor2d(new Tensor2d("X (IJ|AB)", naoccA, naoccA, navirA, navirA));
+    if (do_bqab_disk) {
+        // Both terms over the slabs of B(Q|AB), t(Q,ab) from B(Q|IA) slab by slab
+        T1 = SharedTensor2d(new Tensor2d("T1 (Q|IJ)", nQ, naoccA, naoccA));
+        T1->read(psio_, PSIF_DFOCC_AMPS);
+        U = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|IA)", nQ, naoccA, navirA));
+        U->read(psio_, PSIF_DFOCC_INTS);
+        BlockStream bs(psio_, PSIF_DFOCC_INTS, "DF_BASIS_CC B (Q|AB)", ntri_abAA);
+        bs.add_rows(nQ, nQ_batch);
+        int Q0 = 0;
+        for (SharedTensor2d P = bs.next(); P; P = bs.next()) {
+             int nQs = P->dim1();
+             T = SharedTensor2d(new Tensor2d("T1 (Q|AB)", nQs, navirA, navirA));
+             b_ab_t1_slab(T, U, Q0);
+             X->contract(true, false, naoccA * naoccA, navirA * navirA, nQs, K, T, (ULI)Q0 * naoccA * naoccA, 0, -1.0, 1.0);
+             b_ab_unpack(T, P);
+             X->contract(true, false, naoccA * naoccA, navirA * navirA, nQs, T1, T, (ULI)Q0 * naoccA * naoccA, 0, 1.0, 1.0);
+             T.reset();
+             Q0 += nQs;
+        }
+        U.reset();
+        T1.reset();
+        K.reset();
+    }
+    else {
     T = SharedTensor2d(new Tensor2d("T1 (Q|AB)", nQ, navirA, navirA));
     T->read(psio_, PSIF_DFOCC_AMPS);
-    X = SharedTensor2d(new Tensor2d("X (IJ|AB)", naoccA, naoccA, navirA, navirA));
     X->gemm(true, false, K, T, -1.0, 0.0);
     T.reset();
     K.reset();
@@ -291,6 +315,7 @@ void DFOCC::ccsd_WmbejT2_low()
     K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|AB)", nQ, navirA, navirA));
     K->read(psio_, PSIF_DFOCC_INTS, true, true);
     X->gemm(true, false, T, K, 1.0, 1.0);
+    }
     // W'(me,jb) <= X(jm,be)
     W->sort(2413, X, 1.0, 1.0);
     X.reset();
@@ -409,7 +434,7 @@ void DFOCC::ccsd_WijamT2_low()
     for(int m = 0 ; m < naoccA; ++m){
 
             // Form V[m](ae,f) = \sum_{Q} b(Q,ae) B(mfQ)
-            I->contract(true, true, navirA * navirA, navirA, nQ, K, L, 0, m*navirA*nQ, 1.0, 0.0);
+            I->contract(true, true, navirA * navirA, navirA, nQ, K, L, 0, (ULI)m*navirA*nQ, 1.0, 0.0);
 
             // Form (+)V[m](a, e>=f)
             #pragma omp parallel for
@@ -540,7 +565,7 @@ void DFOCC::ccsd_WabefT2_low()
             int nb = a+1;
 
             // Form V[a](bf,e) = \sum_{Q} B(bfQ)*B(aeQ) cost = V^4N/2
-            I->contract(false, true, navirA*nb, navirA, nQ, K, K, 0, a*navirA*nQ, 1.0, 0.0);
+            I->contract(false, true, navirA*nb, navirA, nQ, K, K, 0, (ULI)a*navirA*nQ, 1.0, 0.0);
 
             // Form (+)V[a](b, e>=f) 
             #pragma omp parallel for
@@ -696,10 +721,10 @@ void DFOCC::ccsd_Wabef2T2_low()
         int nb = a+1;
 
         // Form J[a](bf,e) = \sum_{Q} B(bfQ)*[B(aeQ)-T(aeQ)] cost = V^4N/2
-        I->contract(false, true, navirA*nb, navirA, nQ, K, X, 0, a*navirA*nQ, 1.0, 0.0);
+        I->contract(false, true, navirA*nb, navirA, nQ, K, X, 0, (ULI)a*navirA*nQ, 1.0, 0.0);
 
         // Form J[a](mf,e) = \sum_{Q} B(mfQ)*B(aeQ) cost = OV^3N
-        J->contract(false, true, navirA*naoccA, navirA, nQ, L, K, 0, a*navirA*nQ, 1.0, 0.0);
+        J->contract(false, true, navirA*naoccA, navirA, nQ, L, K, 0, (ULI)a*navirA*nQ, 1.0, 0.0);
 
         // J[a](b,fe) -= \sum_{m} t(m,b) * J[a](mf,e)
         I->contract(false, false, nb, navirA*navirA, naoccA, T1, J, -1.0, 1.0);
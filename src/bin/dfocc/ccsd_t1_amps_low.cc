@@ -81,10 +81,25 @@ void DFOCC::ccsd_t1_amps_low()
     Tau = SharedTensor2d(new Tensor2d("Temp (Q|AI)", nQ, navirA, naoccA));
     Tau->swap_3index_col(T);
     T.reset();
-    K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|AB)", nQ, navirA, navirA));
-    K->read(psio_, PSIF_DFOCC_INTS, true, true);
-    t1newA->contract(true, false, naoccA, navirA, nQ * navirA, Tau, K, 1.0, 1.0);
-    K.reset();
+    if (do_bqab_disk) {
+        BlockStream bs(psio_, PSIF_DFOCC_INTS, "DF_BASIS_CC B (Q|AB)", ntri_abAA);
+        bs.add_rows(nQ, nQ_batch);
+        int Q0 = 0;
+        for (SharedTensor2d P = bs.next(); P; P = bs.next()) {
+             int nQs = P->dim1();
+             K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|AB)", nQs, navirA, navirA));
+             b_ab_unpack(K, P);
+             t1newA->contract(true, false, naoccA, navirA, nQs * navirA, Tau, K, (ULI)Q0 * navirA * naoccA, 0, 1.0, 1.0);
+             K.reset();
+             Q0 += nQs;
+        }
+    }
+    else {
+        K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|AB)", nQ, navirA, navirA));
+        K->read(psio_, PSIF_DFOCC_INTS, true, true);
+        t1newA->contract(true, false, naoccA, navirA, nQ * navirA, Tau, K, 1.0, 1.0);
+        K.reset();
+    }
     Tau.reset();
 
     // Denom
@@ -101,7 +101,8 @@ void DFOCC::ccsd_t2_amps_low()
 
     // WabefT2
     //ccsd_WabefT2_low();
-    ccsd_Wabef2T2_low();
+    if (do_bqab_disk) ccsd_Wabef2T2_disk();
+    else ccsd_Wabef2T2_low();
 
     // Denom
     Tnew = SharedTensor2d(new Tensor2d("New T2 (IA|JB)", naoccA, navirA, naoccA, navirA));
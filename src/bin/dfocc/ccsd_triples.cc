@@ -110,36 +110,36 @@ void DFOCC::ccsd_canonic_triples()
         double Di = FockA->get(i + nfrzc, i + nfrzc);
 
 	// Compute J[i](a,bc) = (ia|bc) = \sum(Q) B[i](aQ) * B(Q,bc)
-        Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, i*navirA*nQ, 0, 1.0, 0.0);
+        Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, (ULI)i*navirA*nQ, 0, 1.0, 0.0);
 	J1->expand23(navirA, navirA, navirA, Jt);
 
         for(int j = 0 ; j <= i; ++j){
 	    double Dij = Di + FockA->get(j + nfrzc, j + nfrzc);
 
 	    // Compute J[j](a,bc) = (ja|bc) = \sum(Q) B[j](aQ) * B(Q,bc)
-            Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, j*navirA*nQ, 0, 1.0, 0.0);
+            Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, (ULI)j*navirA*nQ, 0, 1.0, 0.0);
 	    J2->expand23(navirA, navirA, navirA, Jt);
 
             for(int k = 0 ; k <= j; ++k){
 	        // Compute J[k](a,bc) = (ka|bc) = \sum(Q) B[k](aQ) * B(Q,bc)
-                Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, k*navirA*nQ, 0, 1.0, 0.0);
+                Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, (ULI)k*navirA*nQ, 0, 1.0, 0.0);
 	        J3->expand23(navirA, navirA, navirA, Jt);
 
                 // W[ijk](ab,c) = \sum(e) t_jk^ec (ia|be) (1+)
                 // W[ijk](ab,c) = \sum(e) J[i](ab,e) T[jk](ec)
-                W->contract(false, false, navirA*navirA, navirA, navirA, J1, T, 0, (j*naoccA*navirA*navirA) + (k*navirA*navirA), 1.0, 0.0);
+                W->contract(false, false, navirA*navirA, navirA, navirA, J1, T, 0, ((ULI)j*naoccA*navirA*navirA) + ((ULI)k*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ab,c) -= \sum(m) t_im^ab <jk|mc> (1-)
                 // W[ijk](ab,c) -= \sum(m) T[i](m,ab) I[jk](mc)
-                W->contract(true, false, navirA*navirA, navirA, naoccA, T, I, i*naoccA*navirA*navirA, (j*naoccA*naoccA*navirA) + (k*naoccA*navirA), -1.0, 1.0);
+                W->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)i*naoccA*navirA*navirA, ((ULI)j*naoccA*naoccA*navirA) + ((ULI)k*naoccA*navirA), -1.0, 1.0);
 
                 // W[ijk](ac,b) = \sum(e) t_kj^eb (ia|ce) (2+)
                 // W[ijk](ac,b) = \sum(e) J[i](ac,e) T[kj](eb)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, 0, (k*naoccA*navirA*navirA) + (j*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, 0, ((ULI)k*naoccA*navirA*navirA) + ((ULI)j*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ac,b) -= \sum(m) t_im^ac <kj|mb> (2-)
                 // W[ijk](ac,b) -= \sum(m) T[i](m,ac) I[kj](mb)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, i*naoccA*navirA*navirA, (k*naoccA*naoccA*navirA) + (j*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)i*naoccA*navirA*navirA, ((ULI)k*naoccA*naoccA*navirA) + ((ULI)j*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -149,11 +149,11 @@ void DFOCC::ccsd_canonic_triples()
 
                 // W[ijk](ba,c) = \sum(e) t_ik^ec (jb|ae) (3+)
                 // W[ijk](ba,c) = \sum(e) J[j](ba,e) T[ik](ec)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J2, T, 0, (i*naoccA*navirA*navirA) + (k*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J2, T, 0, ((ULI)i*naoccA*navirA*navirA) + ((ULI)k*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ba,c) -= \sum(m) t_jm^ba <ik|mc> (3-)
                 // W[ijk](ba,c) -= \sum(m) T[j](m,ba) I[ik](mc)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, j*naoccA*navirA*navirA, (i*naoccA*naoccA*navirA) + (k*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)j*naoccA*navirA*navirA, ((ULI)i*naoccA*naoccA*navirA) + ((ULI)k*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -163,11 +163,11 @@ void DFOCC::ccsd_canonic_triples()
 
                 // W[ijk](bc,a) = \sum(e) t_ki^ea (jb|ce) (4+)
                 // W[ijk](bc,a) = \sum(e) J[j](bc,e) T[ki](ea)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J2, T, 0, (k*naoccA*navirA*navirA) + (i*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J2, T, 0, ((ULI)k*naoccA*navirA*navirA) + ((ULI)i*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](bc,a) -= \sum(m) t_jm^bc <ki|ma> (4-)
                 // W[ijk](bc,a) -= \sum(m) T[j](m,bc) I[ki](ma)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, j*naoccA*navirA*navirA, (k*naoccA*naoccA*navirA) + (i*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)j*naoccA*navirA*navirA, ((ULI)k*naoccA*naoccA*navirA) + ((ULI)i*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -177,11 +177,11 @@ void DFOCC::ccsd_canonic_triples()
 
                 // W[ijk](ca,b) = \sum(e) t_ij^eb (kc|ae) (5+)
                 // W[ijk](ca,b) = \sum(e) J[k](ca,e) T[ij](eb)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J3, T, 0, (i*naoccA*navirA*navirA) + (j*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J3, T, 0, ((ULI)i*naoccA*navirA*navirA) + ((ULI)j*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ca,b) -= \sum(m) t_km^ca <ij|mb> (5-)
                 // W[ijk](ca,b) -= \sum(m) T[k](m,ca) I[ij](mb)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, k*naoccA*navirA*navirA, (i*naoccA*naoccA*navirA) + (j*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)k*naoccA*navirA*navirA, ((ULI)i*naoccA*naoccA*navirA) + ((ULI)j*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -191,11 +191,11 @@ void DFOCC::ccsd_canonic_triples()
 
                 // W[ijk](cb,a) = \sum(e) t_ji^ea (kc|be) (6+)
                 // W[ijk](cb,a) = \sum(e) J[k](cb,e) T[ji](ea)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J3, T, 0, (j*naoccA*navirA*navirA) + (i*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J3, T, 0, ((ULI)j*naoccA*navirA*navirA) + ((ULI)i*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](cb,a) -= \sum(m) t_km^cb <ji|ma> (6-)
                 // W[ijk](cb,a) -= \sum(m) T[k](m,cb) I[ji](ma)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, k*naoccA*navirA*navirA, (j*naoccA*naoccA*navirA) + (i*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)k*naoccA*navirA*navirA, ((ULI)j*naoccA*naoccA*navirA) + ((ULI)i*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -359,19 +359,19 @@ void DFOCC::ccsd_canonic_triples_hm()
 
                 // W[ijk](ab,c) = \sum(e) t_jk^ec (ia|be) (1+)
                 // W[ijk](ab,c) = \sum(e) J[i](ab,e) T[jk](ec)
-                W->contract(false, false, navirA*navirA, navirA, navirA, J1, T, i*navirA*navirA*navirA, (j*naoccA*navirA*navirA) + (k*navirA*navirA), 1.0, 0.0);
+                W->contract(false, false, navirA*navirA, navirA, navirA, J1, T, (ULI)i*navirA*navirA*navirA, ((ULI)j*naoccA*navirA*navirA) + ((ULI)k*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ab,c) -= \sum(m) t_im^ab <jk|mc> (1-)
                 // W[ijk](ab,c) -= \sum(m) T[i](m,ab) I[jk](mc)
-                W->contract(true, false, navirA*navirA, navirA, naoccA, T, I, i*naoccA*navirA*navirA, (j*naoccA*naoccA*navirA) + (k*naoccA*navirA), -1.0, 1.0);
+                W->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)i*naoccA*navirA*navirA, ((ULI)j*naoccA*naoccA*navirA) + ((ULI)k*naoccA*navirA), -1.0, 1.0);
 
                 // W[ijk](ac,b) = \sum(e) t_kj^eb (ia|ce) (2+)
                 // W[ijk](ac,b) = \sum(e) J[i](ac,e) T[kj](eb)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, i*navirA*navirA*navirA, (k*naoccA*navirA*navirA) + (j*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, (ULI)i*navirA*navirA*navirA, ((ULI)k*naoccA*navirA*navirA) + ((ULI)j*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ac,b) -= \sum(m) t_im^ac <kj|mb> (2-)
                 // W[ijk](ac,b) -= \sum(m) T[i](m,ac) I[kj](mb)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, i*naoccA*navirA*navirA, (k*naoccA*naoccA*navirA) + (j*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)i*naoccA*navirA*navirA, ((ULI)k*naoccA*naoccA*navirA) + ((ULI)j*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -381,11 +381,11 @@ void DFOCC::ccsd_canonic_triples_hm()
 
                 // W[ijk](ba,c) = \sum(e) t_ik^ec (jb|ae) (3+)
                 // W[ijk](ba,c) = \sum(e) J[j](ba,e) T[ik](ec)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, j*navirA*navirA*navirA, (i*naoccA*navirA*navirA) + (k*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, (ULI)j*navirA*navirA*navirA, ((ULI)i*naoccA*navirA*navirA) + ((ULI)k*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ba,c) -= \sum(m) t_jm^ba <ik|mc> (3-)
                 // W[ijk](ba,c) -= \sum(m) T[j](m,ba) I[ik](mc)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, j*naoccA*navirA*navirA, (i*naoccA*naoccA*navirA) + (k*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)j*naoccA*navirA*navirA, ((ULI)i*naoccA*naoccA*navirA) + ((ULI)k*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -395,11 +395,11 @@ void DFOCC::ccsd_canonic_triples_hm()
 
                 // W[ijk](bc,a) = \sum(e) t_ki^ea (jb|ce) (4+)
                 // W[ijk](bc,a) = \sum(e) J[j](bc,e) T[ki](ea)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, j*navirA*navirA*navirA, (k*naoccA*navirA*navirA) + (i*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, (ULI)j*navirA*navirA*navirA, ((ULI)k*naoccA*navirA*navirA) + ((ULI)i*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](bc,a) -= \sum(m) t_jm^bc <ki|ma> (4-)
                 // W[ijk](bc,a) -= \sum(m) T[j](m,bc) I[ki](ma)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, j*naoccA*navirA*navirA, (k*naoccA*naoccA*navirA) + (i*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)j*naoccA*navirA*navirA, ((ULI)k*naoccA*naoccA*navirA) + ((ULI)i*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -409,11 +409,11 @@ void DFOCC::ccsd_canonic_triples_hm()
 
                 // W[ijk](ca,b) = \sum(e) t_ij^eb (kc|ae) (5+)
                 // W[ijk](ca,b) = \sum(e) J[k](ca,e) T[ij](eb)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, k*navirA*navirA*navirA, (i*naoccA*navirA*navirA) + (j*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, (ULI)k*navirA*navirA*navirA, ((ULI)i*naoccA*navirA*navirA) + ((ULI)j*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ca,b) -= \sum(m) t_km^ca <ij|mb> (5-)
                 // W[ijk](ca,b) -= \sum(m) T[k](m,ca) I[ij](mb)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, k*naoccA*navirA*navirA, (i*naoccA*naoccA*navirA) + (j*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)k*naoccA*navirA*navirA, ((ULI)i*naoccA*naoccA*navirA) + ((ULI)j*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -423,11 +423,11 @@ void DFOCC::ccsd_canonic_triples_hm()
 
                 // W[ijk](cb,a) = \sum(e) t_ji^ea (kc|be) (6+)
                 // W[ijk](cb,a) = \sum(e) J[k](cb,e) T[ji](ea)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, k*navirA*navirA*navirA, (j*naoccA*navirA*navirA) + (i*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, (ULI)k*navirA*navirA*navirA, ((ULI)j*naoccA*navirA*navirA) + ((ULI)i*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](cb,a) -= \sum(m) t_km^cb <ji|ma> (6-)
                 // W[ijk](cb,a) -= \sum(m) T[k](m,cb) I[ji](ma)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, k*naoccA*navirA*navirA, (j*naoccA*naoccA*navirA) + (i*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)k*naoccA*navirA*navirA, ((ULI)j*naoccA*naoccA*navirA) + ((ULI)i*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -566,21 +566,72 @@ void DFOCC::ccsd_canonic_triples_disk()
     J2 = SharedTensor2d(new Tensor2d("J[I] (A|BC)", navirA * navirA, navirA));
     J3 = SharedTensor2d(new Tensor2d("J[I] (A|BC)", navirA * navirA, navirA));
 
+    // Form (ia|bc)
+    Jt = SharedTensor2d(new Tensor2d("J[I] <A|B>=C", navirA, ntri_abAA));
+
+    // B(Q,ab) is not held in core: (ia|bc) for batches of i, over the slabs of B(Q,ab)
+    if (do_bqab_disk) {
+        double mem = (double)Process::environment.get_memory() / sizeof(double);
+        double fixed = 2.0 * naoccA * naoccA * navirA * navirA + (double)naoccA * naoccA * naoccA * navirA;
+        fixed += (double)naoccA * navirA * nQ + 5.0 * navirA * navirA * navirA;
+        fixed += (double)navirA * ntri_abAA + 3.0 * nQ_batch * ntri_abAA;
+        double per_occ = (double)navirA * ntri_abAA;
+        if (mem - fixed < per_occ) {
+            outfile->Printf("\tWarning: There is NOT enough memory for the (ia|bc) batches of (T)!\n");
+            outfile->Printf("\tIncrease memory by                    : %9.2lf MB \n",
+                            (fixed + per_occ - mem) * sizeof(double) / (1024.0 * 1024.0));
+            throw PSIEXCEPTION("There is NOT enough memory for the (ia|bc) batches of (T)!");
+        }
+        int nocc_batch = (int)MIN0((mem - fixed) / per_occ, (double)naoccA);
+        if (bqab_batch_max_ > 0) nocc_batch = MIN0(nocc_batch, bqab_batch_max_);
+        int npass = (naoccA + nocc_batch - 1) / nocc_batch;
+        outfile->Printf("\tNumber of occupieds per (ia|bc) batch : %9d \n", nocc_batch);
+        outfile->Printf("\tNumber of passes over B(Q|AB)         : %9d \n", npass);
+
+        J = SharedTensor2d(new Tensor2d("J[I] <A|B>=C Batch", nocc_batch * navirA, ntri_abAA));
+        for (int i0 = 0; i0 < naoccA; i0 += nocc_batch) {
+             int nis = MIN0(nocc_batch, naoccA - i0);
+             BlockStream bs(psio_, PSIF_DFOCC_INTS, "DF_BASIS_CC B (Q|AB)", ntri_abAA);
+             bs.add_rows(nQ, nQ_batch);
+             int Q0 = 0;
+             for (K = bs.next(); K; K = bs.next()) {
+                  int nQs = K->dim1();
+                  // B[i](aQ) for the rows of the batch and the columns of the slab
+                  X = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (IA|Q) Slab", nis * navirA, nQs));
+                  #pragma omp parallel for
+                  for (int ia = 0; ia < nis * navirA; ia++) {
+                       for (int Q = 0; Q < nQs; Q++) {
+                            X->set(ia, Q, L->get(i0 * navirA + ia, Q0 + Q));
+                       }
+                  }
+                  J->contract(false, false, nis * navirA, ntri_abAA, nQs, X, K, 0, 0, 1.0, Q0 == 0 ? 0.0 : 1.0);
+                  X.reset();
+                  Q0 += nQs;
+             }
+
+             for (int i = i0; i < i0 + nis; ++i) {
+                  Jt->copy(J, (ULI)(i - i0) * navirA * ntri_abAA);
+                  J1->expand23(navirA, navirA, navirA, Jt);
+                  J1->mywrite(PSIF_DFOCC_IABC, i > 0);
+             }
+        }
+        J.reset();
+    }
+
+    else {
     // B(Q,ab)
     K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|AB)", nQ, ntri_abAA));
     K->read(psio_, PSIF_DFOCC_INTS);
 
-    // Form (ia|bc)
-    Jt = SharedTensor2d(new Tensor2d("J[I] <A|B>=C", navirA, ntri_abAA));
     /*
     //psio_address addr = PSIO_ZERO;
     for(int i = 0 ; i < naoccA; ++i){
 	// Compute J[i](a,bc) = (ia|bc) = \sum(Q) B[i](aQ) * B(Q,bc)
-        Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, i*navirA*nQ, 0, 1.0, 0.0);
+        Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, (ULI)i*navirA*nQ, 0, 1.0, 0.0);
 	J1->expand23(navirA, navirA, navirA, Jt);
 
 	// write
-	psio_address addr = psio_get_address(PSIO_ZERO,(ULI)(i*navirA*navirA*navirA)*sizeof(double));
+	psio_address addr = psio_get_address(PSIO_ZERO,(ULI)i*navirA*navirA*navirA*sizeof(double));
 	J1->write(psio_, PSIF_DFOCC_INTS, addr, &addr);
     }
     */
@@ -589,13 +640,14 @@ void DFOCC::ccsd_canonic_triples_disk()
     J1->mywrite(PSIF_DFOCC_IABC, false);
     for(int i = 1 ; i < naoccA; ++i){
 	// Compute J[i](a,bc) = (ia|bc) = \sum(Q) B[i](aQ) * B(Q,bc)
-        Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, i*navirA*nQ, 0, 1.0, 0.0);
+        Jt->contract(false, false, navirA, ntri_abAA, nQ, L, K, (ULI)i*navirA*nQ, 0, 1.0, 0.0);
 	J1->expand23(navirA, navirA, navirA, Jt);
 
 	// write
 	J1->mywrite(PSIF_DFOCC_IABC, true);
     }
     K.reset();
+    }// else if (!do_bqab_disk)
     Jt.reset();
     L.reset();
 
@@ -606,39 +658,39 @@ void DFOCC::ccsd_canonic_triples_disk()
         double Di = FockA->get(i + nfrzc, i + nfrzc);
 
 	// Read J[i](a,bc) 
-	//psio_address addr1 = psio_get_address(PSIO_ZERO,(ULI)(i*navirA*navirA*navirA)*sizeof(double));
+	//psio_address addr1 = psio_get_address(PSIO_ZERO,(ULI)i*navirA*navirA*navirA*sizeof(double));
 	//J1->read(psio_, PSIF_DFOCC_INTS, addr1, &addr1);
-	J1->myread(PSIF_DFOCC_IABC, (ULI)(i*navirA*navirA*navirA)*sizeof(double));
+	J1->myread(PSIF_DFOCC_IABC, (ULI)i*navirA*navirA*navirA*sizeof(double));
 
         for(int j = 0 ; j <= i; ++j){
 	    double Dij = Di + FockA->get(j + nfrzc, j + nfrzc);
 
 	    // Read J[j](a,bc) 
-	    //psio_address addr2 = psio_get_address(PSIO_ZERO,(ULI)(j*navirA*navirA*navirA)*sizeof(double));
+	    //psio_address addr2 = psio_get_address(PSIO_ZERO,(ULI)j*navirA*navirA*navirA*sizeof(double));
 	    //J2->read(psio_, PSIF_DFOCC_INTS, addr2, &addr2);
-	    J2->myread(PSIF_DFOCC_IABC, (ULI)(j*navirA*navirA*navirA)*sizeof(double));
+	    J2->myread(PSIF_DFOCC_IABC, (ULI)j*navirA*navirA*navirA*sizeof(double));
 
             for(int k = 0 ; k <= j; ++k){
 	        // Read J[k](a,bc) 
-	        //psio_address addr3 = psio_get_address(PSIO_ZERO,(ULI)(k*navirA*navirA*navirA)*sizeof(double));
+	        //psio_address addr3 = psio_get_address(PSIO_ZERO,(ULI)k*navirA*navirA*navirA*sizeof(double));
 	        //J3->read(psio_, PSIF_DFOCC_INTS, addr3, &addr3);
-	        J3->myread(PSIF_DFOCC_IABC, (ULI)(k*navirA*navirA*navirA)*sizeof(double));
+	        J3->myread(PSIF_DFOCC_IABC, (ULI)k*navirA*navirA*navirA*sizeof(double));
 
                 // W[ijk](ab,c) = \sum(e) t_jk^ec (ia|be) (1+)
                 // W[ijk](ab,c) = \sum(e) J[i](ab,e) T[jk](ec)
-                W->contract(false, false, navirA*navirA, navirA, navirA, J1, T, 0, (j*naoccA*navirA*navirA) + (k*navirA*navirA), 1.0, 0.0);
+                W->contract(false, false, navirA*navirA, navirA, navirA, J1, T, 0, ((ULI)j*naoccA*navirA*navirA) + ((ULI)k*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ab,c) -= \sum(m) t_im^ab <jk|mc> (1-)
                 // W[ijk](ab,c) -= \sum(m) T[i](m,ab) I[jk](mc)
-                W->contract(true, false, navirA*navirA, navirA, naoccA, T, I, i*naoccA*navirA*navirA, (j*naoccA*naoccA*navirA) + (k*naoccA*navirA), -1.0, 1.0);
+                W->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)i*naoccA*navirA*navirA, ((ULI)j*naoccA*naoccA*navirA) + ((ULI)k*naoccA*navirA), -1.0, 1.0);
 
                 // W[ijk](ac,b) = \sum(e) t_kj^eb (ia|ce) (2+)
                 // W[ijk](ac,b) = \sum(e) J[i](ac,e) T[kj](eb)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, 0, (k*naoccA*navirA*navirA) + (j*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, 0, ((ULI)k*naoccA*navirA*navirA) + ((ULI)j*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ac,b) -= \sum(m) t_im^ac <kj|mb> (2-)
                 // W[ijk](ac,b) -= \sum(m) T[i](m,ac) I[kj](mb)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, i*naoccA*navirA*navirA, (k*naoccA*naoccA*navirA) + (j*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)i*naoccA*navirA*navirA, ((ULI)k*naoccA*naoccA*navirA) + ((ULI)j*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -648,11 +700,11 @@ void DFOCC::ccsd_canonic_triples_disk()
 
                 // W[ijk](ba,c) = \sum(e) t_ik^ec (jb|ae) (3+)
                 // W[ijk](ba,c) = \sum(e) J[j](ba,e) T[ik](ec)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J2, T, 0, (i*naoccA*navirA*navirA) + (k*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J2, T, 0, ((ULI)i*naoccA*navirA*navirA) + ((ULI)k*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ba,c) -= \sum(m) t_jm^ba <ik|mc> (3-)
                 // W[ijk](ba,c) -= \sum(m) T[j](m,ba) I[ik](mc)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, j*naoccA*navirA*navirA, (i*naoccA*naoccA*navirA) + (k*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)j*naoccA*navirA*navirA, ((ULI)i*naoccA*naoccA*navirA) + ((ULI)k*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -662,11 +714,11 @@ void DFOCC::ccsd_canonic_triples_disk()
 
                 // W[ijk](bc,a) = \sum(e) t_ki^ea (jb|ce) (4+)
                 // W[ijk](bc,a) = \sum(e) J[j](bc,e) T[ki](ea)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J2, T, 0, (k*naoccA*navirA*navirA) + (i*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J2, T, 0, ((ULI)k*naoccA*navirA*navirA) + ((ULI)i*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](bc,a) -= \sum(m) t_jm^bc <ki|ma> (4-)
                 // W[ijk](bc,a) -= \sum(m) T[j](m,bc) I[ki](ma)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, j*naoccA*navirA*navirA, (k*naoccA*naoccA*navirA) + (i*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)j*naoccA*navirA*navirA, ((ULI)k*naoccA*naoccA*navirA) + ((ULI)i*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -676,11 +728,11 @@ void DFOCC::ccsd_canonic_triples_disk()
 
                 // W[ijk](ca,b) = \sum(e) t_ij^eb (kc|ae) (5+)
                 // W[ijk](ca,b) = \sum(e) J[k](ca,e) T[ij](eb)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J3, T, 0, (i*naoccA*navirA*navirA) + (j*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J3, T, 0, ((ULI)i*naoccA*navirA*navirA) + ((ULI)j*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ca,b) -= \sum(m) t_km^ca <ij|mb> (5-)
                 // W[ijk](ca,b) -= \sum(m) T[k](m,ca) I[ij](mb)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, k*naoccA*navirA*navirA, (i*naoccA*naoccA*navirA) + (j*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)k*naoccA*navirA*navirA, ((ULI)i*naoccA*naoccA*navirA) + ((ULI)j*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -690,11 +742,11 @@ void DFOCC::ccsd_canonic_triples_disk()
 
                 // W[ijk](cb,a) = \sum(e) t_ji^ea (kc|be) (6+)
                 // W[ijk](cb,a) = \sum(e) J[k](cb,e) T[ji](ea)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J3, T, 0, (j*naoccA*navirA*navirA) + (i*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J3, T, 0, ((ULI)j*naoccA*navirA*navirA) + ((ULI)i*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](cb,a) -= \sum(m) t_km^cb <ji|ma> (6-)
                 // W[ijk](cb,a) -= \sum(m) T[k](m,cb) I[ji](ma)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, k*naoccA*navirA*navirA, (j*naoccA*naoccA*navirA) + (i*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)k*naoccA*navirA*navirA, ((ULI)j*naoccA*naoccA*navirA) + ((ULI)i*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -856,11 +908,11 @@ void DFOCC::ccsdl_canonic_triples_disk()
     //psio_address addr = PSIO_ZERO;
     for(int i = 0 ; i < naoccA; ++i){
 	// Compute J[i](a,bc) = (ia|bc) = \sum(Q) B[i](aQ) * B(Q,bc)
-        Jt->contract(false, false, navirA, ntri_abAA, nQ, U, K, i*navirA*nQ, 0, 1.0, 0.0);
+        Jt->contract(false, false, navirA, ntri_abAA, nQ, U, K, (ULI)i*navirA*nQ, 0, 1.0, 0.0);
 	J1->expand23(navirA, navirA, navirA, Jt);
 
 	// write
-	psio_address addr = psio_get_address(PSIO_ZERO,(ULI)(i*navirA*navirA*navirA)*sizeof(double));
+	psio_address addr = psio_get_address(PSIO_ZERO,(ULI)i*navirA*navirA*navirA*sizeof(double));
 	J1->write(psio_, PSIF_DFOCC_INTS, addr, &addr);
     }
     */
@@ -869,7 +921,7 @@ void DFOCC::ccsdl_canonic_triples_disk()
     J1->mywrite(PSIF_DFOCC_IABC, false);
     for(int i = 1 ; i < naoccA; ++i){
 	// Compute J[i](a,bc) = (ia|bc) = \sum(Q) B[i](aQ) * B(Q,bc)
-        Jt->contract(false, false, navirA, ntri_abAA, nQ, U, K, i*navirA*nQ, 0, 1.0, 0.0);
+        Jt->contract(false, false, navirA, ntri_abAA, nQ, U, K, (ULI)i*navirA*nQ, 0, 1.0, 0.0);
 	J1->expand23(navirA, navirA, navirA, Jt);
 
 	// write
@@ -887,39 +939,39 @@ void DFOCC::ccsdl_canonic_triples_disk()
         double Di = FockA->get(i + nfrzc, i + nfrzc);
 
 	// Read J[i](a,bc) 
-	//psio_address addr1 = psio_get_address(PSIO_ZERO,(ULI)(i*navirA*navirA*navirA)*sizeof(double));
+	//psio_address addr1 = psio_get_address(PSIO_ZERO,(ULI)i*navirA*navirA*navirA*sizeof(double));
 	//J1->read(psio_, PSIF_DFOCC_INTS, addr1, &addr1);
-	J1->myread(PSIF_DFOCC_IABC, (ULI)(i*navirA*navirA*navirA)*sizeof(double));
+	J1->myread(PSIF_DFOCC_IABC, (ULI)i*navirA*navirA*navirA*sizeof(double));
 
         for(int j = 0 ; j <= i; ++j){
 	    double Dij = Di + FockA->get(j + nfrzc, j + nfrzc);
 
 	    // Read J[j](a,bc) 
-	    //psio_address addr2 = psio_get_address(PSIO_ZERO,(ULI)(j*navirA*navirA*navirA)*sizeof(double));
+	    //psio_address addr2 = psio_get_address(PSIO_ZERO,(ULI)j*navirA*navirA*navirA*sizeof(double));
 	    //J2->read(psio_, PSIF_DFOCC_INTS, addr2, &addr2);
-	    J2->myread(PSIF_DFOCC_IABC, (ULI)(j*navirA*navirA*navirA)*sizeof(double));
+	    J2->myread(PSIF_DFOCC_IABC, (ULI)j*navirA*navirA*navirA*sizeof(double));
 
             for(int k = 0 ; k <= j; ++k){
 	        // Read J[k](a,bc) 
-	        //psio_address addr3 = psio_get_address(PSIO_ZERO,(ULI)(k*navirA*navirA*navirA)*sizeof(double));
+	        //psio_address addr3 = psio_get_address(PSIO_ZERO,(ULI)k*navirA*navirA*navirA*sizeof(double));
 	        //J3->read(psio_, PSIF_DFOCC_INTS, addr3, &addr3);
-	        J3->myread(PSIF_DFOCC_IABC, (ULI)(k*navirA*navirA*navirA)*sizeof(double));
+	        J3->myread(PSIF_DFOCC_IABC, (ULI)k*navirA*navirA*navirA*sizeof(double));
 
                 // W[ijk](ab,c) = \sum(e) t_jk^ec (ia|be) (1+)
                 // W[ijk](ab,c) = \sum(e) J[i](ab,e) T[jk](ec)
-                W->contract(false, false, navirA*navirA, navirA, navirA, J1, T, 0, (j*naoccA*navirA*navirA) + (k*navirA*navirA), 1.0, 0.0);
+                W->contract(false, false, navirA*navirA, navirA, navirA, J1, T, 0, ((ULI)j*naoccA*navirA*navirA) + ((ULI)k*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ab,c) -= \sum(m) t_im^ab <jk|mc> (1-)
                 // W[ijk](ab,c) -= \sum(m) T[i](m,ab) I[jk](mc)
-                W->contract(true, false, navirA*navirA, navirA, naoccA, T, I, i*naoccA*navirA*navirA, (j*naoccA*naoccA*navirA) + (k*naoccA*navirA), -1.0, 1.0);
+                W->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)i*naoccA*navirA*navirA, ((ULI)j*naoccA*naoccA*navirA) + ((ULI)k*naoccA*navirA), -1.0, 1.0);
 
                 // W[ijk](ac,b) = \sum(e) t_kj^eb (ia|ce) (2+)
                 // W[ijk](ac,b) = \sum(e) J[i](ac,e) T[kj](eb)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, 0, (k*naoccA*navirA*navirA) + (j*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J1, T, 0, ((ULI)k*naoccA*navirA*navirA) + ((ULI)j*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ac,b) -= \sum(m) t_im^ac <kj|mb> (2-)
                 // W[ijk](ac,b) -= \sum(m) T[i](m,ac) I[kj](mb)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, i*naoccA*navirA*navirA, (k*naoccA*naoccA*navirA) + (j*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)i*naoccA*navirA*navirA, ((ULI)k*naoccA*naoccA*navirA) + ((ULI)j*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -929,11 +981,11 @@ void DFOCC::ccsdl_canonic_triples_disk()
 
                 // W[ijk](ba,c) = \sum(e) t_ik^ec (jb|ae) (3+)
                 // W[ijk](ba,c) = \sum(e) J[j](ba,e) T[ik](ec)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J2, T, 0, (i*naoccA*navirA*navirA) + (k*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J2, T, 0, ((ULI)i*naoccA*navirA*navirA) + ((ULI)k*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ba,c) -= \sum(m) t_jm^ba <ik|mc> (3-)
                 // W[ijk](ba,c) -= \sum(m) T[j](m,ba) I[ik](mc)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, j*naoccA*navirA*navirA, (i*naoccA*naoccA*navirA) + (k*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)j*naoccA*navirA*navirA, ((ULI)i*naoccA*naoccA*navirA) + ((ULI)k*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -943,11 +995,11 @@ void DFOCC::ccsdl_canonic_triples_disk()
 
                 // W[ijk](bc,a) = \sum(e) t_ki^ea (jb|ce) (4+)
                 // W[ijk](bc,a) = \sum(e) J[j](bc,e) T[ki](ea)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J2, T, 0, (k*naoccA*navirA*navirA) + (i*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J2, T, 0, ((ULI)k*naoccA*navirA*navirA) + ((ULI)i*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](bc,a) -= \sum(m) t_jm^bc <ki|ma> (4-)
                 // W[ijk](bc,a) -= \sum(m) T[j](m,bc) I[ki](ma)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, j*naoccA*navirA*navirA, (k*naoccA*naoccA*navirA) + (i*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)j*naoccA*navirA*navirA, ((ULI)k*naoccA*naoccA*navirA) + ((ULI)i*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -957,11 +1009,11 @@ void DFOCC::ccsdl_canonic_triples_disk()
 
                 // W[ijk](ca,b) = \sum(e) t_ij^eb (kc|ae) (5+)
                 // W[ijk](ca,b) = \sum(e) J[k](ca,e) T[ij](eb)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J3, T, 0, (i*naoccA*navirA*navirA) + (j*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J3, T, 0, ((ULI)i*naoccA*navirA*navirA) + ((ULI)j*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ca,b) -= \sum(m) t_km^ca <ij|mb> (5-)
                 // W[ijk](ca,b) -= \sum(m) T[k](m,ca) I[ij](mb)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, k*naoccA*navirA*navirA, (i*naoccA*naoccA*navirA) + (j*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)k*naoccA*navirA*navirA, ((ULI)i*naoccA*naoccA*navirA) + ((ULI)j*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -971,11 +1023,11 @@ void DFOCC::ccsdl_canonic_triples_disk()
 
                 // W[ijk](cb,a) = \sum(e) t_ji^ea (kc|be) (6+)
                 // W[ijk](cb,a) = \sum(e) J[k](cb,e) T[ji](ea)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J3, T, 0, (j*naoccA*navirA*navirA) + (i*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J3, T, 0, ((ULI)j*naoccA*navirA*navirA) + ((ULI)i*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](cb,a) -= \sum(m) t_km^cb <ji|ma> (6-)
                 // W[ijk](cb,a) -= \sum(m) T[k](m,cb) I[ji](ma)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, k*naoccA*navirA*navirA, (j*naoccA*naoccA*navirA) + (i*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, T, I, (ULI)k*naoccA*navirA*navirA, ((ULI)j*naoccA*naoccA*navirA) + ((ULI)i*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -990,19 +1042,19 @@ void DFOCC::ccsdl_canonic_triples_disk()
 	
 	        // W[ijk](ab,c) = \sum(e) l_jk^ec (ia|be) (1+)
                 // W[ijk](ab,c) = \sum(e) J[i](ab,e) L[jk](ec)
-                WL->contract(false, false, navirA*navirA, navirA, navirA, J1, L, 0, (j*naoccA*navirA*navirA) + (k*navirA*navirA), 1.0, 0.0);
+                WL->contract(false, false, navirA*navirA, navirA, navirA, J1, L, 0, ((ULI)j*naoccA*navirA*navirA) + ((ULI)k*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ab,c) -= \sum(m) l_im^ab <jk|mc> (1-)
                 // W[ijk](ab,c) -= \sum(m) L[i](m,ab) I[jk](mc)
-                WL->contract(true, false, navirA*navirA, navirA, naoccA, L, I, i*naoccA*navirA*navirA, (j*naoccA*naoccA*navirA) + (k*naoccA*navirA), -1.0, 1.0);
+                WL->contract(true, false, navirA*navirA, navirA, naoccA, L, I, (ULI)i*naoccA*navirA*navirA, ((ULI)j*naoccA*naoccA*navirA) + ((ULI)k*naoccA*navirA), -1.0, 1.0);
 
                 // W[ijk](ac,b) = \sum(e) l_kj^eb (ia|ce) (2+)
                 // W[ijk](ac,b) = \sum(e) J[i](ac,e) L[kj](eb)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J1, L, 0, (k*naoccA*navirA*navirA) + (j*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J1, L, 0, ((ULI)k*naoccA*navirA*navirA) + ((ULI)j*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ac,b) -= \sum(m) l_im^ac <kj|mb> (2-)
                 // W[ijk](ac,b) -= \sum(m) L[i](m,ac) I[kj](mb)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, L, I, i*naoccA*navirA*navirA, (k*naoccA*naoccA*navirA) + (j*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, L, I, (ULI)i*naoccA*navirA*navirA, ((ULI)k*naoccA*naoccA*navirA) + ((ULI)j*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -1012,11 +1064,11 @@ void DFOCC::ccsdl_canonic_triples_disk()
 
                 // W[ijk](ba,c) = \sum(e) l_ik^ec (jb|ae) (3+)
                 // W[ijk](ba,c) = \sum(e) J[j](ba,e) L[ik](ec)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J2, L, 0, (i*naoccA*navirA*navirA) + (k*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J2, L, 0, ((ULI)i*naoccA*navirA*navirA) + ((ULI)k*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ba,c) -= \sum(m) l_jm^ba <ik|mc> (3-)
                 // W[ijk](ba,c) -= \sum(m) L[j](m,ba) I[ik](mc)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, L, I, j*naoccA*navirA*navirA, (i*naoccA*naoccA*navirA) + (k*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, L, I, (ULI)j*naoccA*navirA*navirA, ((ULI)i*naoccA*naoccA*navirA) + ((ULI)k*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -1026,11 +1078,11 @@ void DFOCC::ccsdl_canonic_triples_disk()
 
                 // W[ijk](bc,a) = \sum(e) l_ki^ea (jb|ce) (4+)
                 // W[ijk](bc,a) = \sum(e) J[j](bc,e) L[ki](ea)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J2, L, 0, (k*naoccA*navirA*navirA) + (i*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J2, L, 0, ((ULI)k*naoccA*navirA*navirA) + ((ULI)i*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](bc,a) -= \sum(m) l_jm^bc <ki|ma> (4-)
                 // W[ijk](bc,a) -= \sum(m) L[j](m,bc) I[ki](ma)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, L, I, j*naoccA*navirA*navirA, (k*naoccA*naoccA*navirA) + (i*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, L, I, (ULI)j*naoccA*navirA*navirA, ((ULI)k*naoccA*naoccA*navirA) + ((ULI)i*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -1040,11 +1092,11 @@ void DFOCC::ccsdl_canonic_triples_disk()
 
                 // W[ijk](ca,b) = \sum(e) l_ij^eb (kc|ae) (5+)
                 // W[ijk](ca,b) = \sum(e) J[k](ca,e) L[ij](eb)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J3, L, 0, (i*naoccA*navirA*navirA) + (j*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J3, L, 0, ((ULI)i*naoccA*navirA*navirA) + ((ULI)j*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](ca,b) -= \sum(m) l_km^ca <ij|mb> (5-)
                 // W[ijk](ca,b) -= \sum(m) L[k](m,ca) I[ij](mb)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, L, I, k*naoccA*navirA*navirA, (i*naoccA*naoccA*navirA) + (j*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, L, I, (ULI)k*naoccA*navirA*navirA, ((ULI)i*naoccA*naoccA*navirA) + ((ULI)j*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
@@ -1054,11 +1106,11 @@ void DFOCC::ccsdl_canonic_triples_disk()
 
                 // W[ijk](cb,a) = \sum(e) l_ji^ea (kc|be) (6+)
                 // W[ijk](cb,a) = \sum(e) J[k](cb,e) L[ji](ea)
-                V->contract(false, false, navirA*navirA, navirA, navirA, J3, L, 0, (j*naoccA*navirA*navirA) + (i*navirA*navirA), 1.0, 0.0);
+                V->contract(false, false, navirA*navirA, navirA, navirA, J3, L, 0, ((ULI)j*naoccA*navirA*navirA) + ((ULI)i*navirA*navirA), 1.0, 0.0);
 
                 // W[ijk](cb,a) -= \sum(m) l_km^cb <ji|ma> (6-)
                 // W[ijk](cb,a) -= \sum(m) L[k](m,cb) I[ji](ma)
-                V->contract(true, false, navirA*navirA, navirA, naoccA, L, I, k*naoccA*navirA*navirA, (j*naoccA*naoccA*navirA) + (i*naoccA*navirA), -1.0, 1.0);
+                V->contract(true, false, navirA*navirA, navirA, naoccA, L, I, (ULI)k*naoccA*navirA*navirA, ((ULI)j*naoccA*naoccA*navirA) + ((ULI)i*naoccA*navirA), -1.0, 1.0);
                 #pragma omp parallel for
                 for(int a = 0 ; a < navirA; ++a){
                     for(int b = 0 ; b < navirA; ++b){
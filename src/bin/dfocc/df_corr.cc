@@ -47,6 +47,12 @@ namespace psi{ namespace dfoccwave{
 
 void DFOCC::trans_corr()
 {   
+    // DISK B(Q|AB): never hold the three-index integrals as a whole
+    if (do_bqab_disk) {
+        trans_corr_disk();
+        return;
+    }
+
     // Read SO integrals
     bQso = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|mn)", nQ, nso_, nso_));
     bQso->read(psio_, PSIF_DFOCC_INTS, true, true);
@@ -571,6 +577,168 @@ void DFOCC::b_ab()
 
 } // end b_ab
 
+//=======================================================
+//          DISK B(Q|AB) : setup
+//=======================================================          
+void DFOCC::bqab_disk_init()
+{
+    // All sizes in doubles
+    double mem = (double)Process::environment.get_memory() / sizeof(double);
+    double vv = (double)navirA * navirA;
+    double amps = (double)naoccA * naoccA * vv;
+
+    // Peak of the low-memory algorithm with B(Q|AB) in core: 3 amplitudes,
+    // B(Q|AB) and the copies of it in the Wabef term
+    double cost_incore = 3.0 * amps + 4.0 * nQ * vv;
+
+    do_bqab_disk = false;
+    if (bqab_type_ == "DISK") do_bqab_disk = true;
+    else if (bqab_type_ == "AUTO" && cost_incore > mem) do_bqab_disk = true;
+
+    // Energies of closed shells only
+    if (do_bqab_disk && (reference_ != "RESTRICTED" || orb_opt_ == "TRUE" || dertype == "FIRST" ||
+        oeprop_ == "TRUE" || ekt_ip_ == "TRUE" || qchf_ == "TRUE" || cc_lambda_ == "TRUE" || Wabef_type_ == "CD")) {
+        outfile->Printf("\n\tWarning: The DISK algorithm for B(Q|AB) is only available for RHF energies!\n");
+        do_bqab_disk = false;
+    }
+    if (!do_bqab_disk) return;
+
+    // Memory held throughout the iterations: 3 amplitudes and two B(Q|IA)-sized tensors
+    double fixed = 3.0 * amps + 2.0 * nQ * naoccA * navirA;
+
+    // Wabef: per virtual of a batch, 7 B(Q|A) blocks and the (B|EF) intermediates
+    double per_vir = 7.0 * nQ * navirA + 2.0 * vv + 2.0 * ntri_abAA + 2.0 * ntri_ijAA;
+    if (mem - fixed < per_vir) {
+        outfile->Printf("\tWarning: There is NOT enough memory for the DISK algorithm of B(Q|AB)!\n");
+        outfile->Printf("\tIncrease memory by                    : %9.2lf MB \n",
+                        (fixed + per_vir - mem) * sizeof(double) / (1024.0 * 1024.0));
+        throw PSIEXCEPTION("There is NOT enough memory for the DISK algorithm of B(Q|AB)!");
+    }
+    nvir_batch = (int)MIN0((mem - fixed) / per_vir, (double)navirA);
+
+    // Q slabs: the SO transformation (square and packed (Q|mn), (Q|mA), (Q|AB)),
+    // and the slabs of the iterations (packed in flight, square, dressed)
+    double per_Q = (double)nso2_ + ntri_so + (double)nso_ * (naoccA + navirA) + 2.0 * vv + ntri_abAA;
+    per_Q = MAX0(per_Q, 3.0 * ntri_abAA + 2.0 * vv);
+    nQ_batch = (int)MAX0(1.0, MIN0((mem - fixed) / per_Q, (double)nQ));
+    if (bqab_batch_max_ > 0) {
+        nvir_batch = MIN0(nvir_batch, bqab_batch_max_);
+        nQ_batch = MIN0(nQ_batch, bqab_batch_max_);
+    }
+
+    int nbatch = (navirA + nvir_batch - 1) / nvir_batch;
+    outfile->Printf("\n\tI will use the DISK algorithm for B(Q|AB)! \n");
+    outfile->Printf("\tNumber of virtual batches             : %9d \n", nbatch);
+    outfile->Printf("\tNumber of virtuals per batch          : %9d \n", nvir_batch);
+    outfile->Printf("\tNumber of aux functions per slab      : %9d \n", nQ_batch);
+
+}// end bqab_disk_init
+
+//=======================================================
+//          DISK B(Q|AB) : unpack a slab
+//=======================================================          
+void DFOCC::b_ab_unpack(const SharedTensor2d &K, const SharedTensor2d &P)
+{
+    #pragma omp parallel for
+    for (int Q = 0; Q < P->dim1(); Q++) {
+         for (int a = 0; a < navirA; a++) {
+              for (int b = 0; b <= a; b++) {
+                   double value = P->get(Q, index2(a,b));
+                   K->set(Q, a * navirA + b, value);
+                   K->set(Q, b * navirA + a, value);
+              }
+         }
+    }
+}// end b_ab_unpack
+
+//=======================================================
+//          DISK B(Q|AB) : T1-dressed slab
+//=======================================================          
+void DFOCC::b_ab_t1_slab(const SharedTensor2d &T, const SharedTensor2d &M, int Q0)
+{
+    // t(Q,ab) = \sum_{m} t_m^a b_mb^Q, for the rows Q0.. of B(Q|IA)
+    SharedTensor2d Ms = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|IA)", T->dim1(), naoccA, navirA));
+    Ms->copy(M, (ULI)Q0 * naoccA * navirA);
+    T->contract233(true, false, navirA, navirA, t1A, Ms, 1.0, 0.0);
+}// end b_ab_t1_slab
+
+//=======================================================
+//          DISK B(Q|AB) : transformation
+//=======================================================          
+void DFOCC::trans_corr_disk()
+{
+    SharedTensor2d P, S, N, K, L;
+    psio_address addr_so = PSIO_ZERO;
+    psio_address addr_ij = PSIO_ZERO;
+    psio_address addr_ia = PSIO_ZERO;
+    psio_address addr_ab = PSIO_ZERO;
+    psio_address addr_sq = PSIO_ZERO;
+
+    // B(Q|IJ), B(Q|IA) and B(Q|AB) slab by slab of the SO integrals. Besides the packed
+    // B(Q|AB), its square form is written for the column blocks of the Wabef term.
+    for (int Q0 = 0; Q0 < nQ; Q0 += nQ_batch) {
+         int nQs = MIN0(nQ_batch, nQ - Q0);
+
+         // Read and unpack the SO slab
+         P = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|mn)", nQs, ntri_so));
+         P->read(psio_, PSIF_DFOCC_INTS, addr_so, &addr_so);
+         S = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|mn)", nQs, nso_, nso_));
+         #pragma omp parallel for
+         for (int Q = 0; Q < nQs; Q++) {
+              for (int m = 0; m < nso_; m++) {
+                   for (int n = 0; n <= m; n++) {
+                        double value = P->get(Q, index2(m,n));
+                        S->set(Q, m * nso_ + n, value);
+                        S->set(Q, n * nso_ + m, value);
+                   }
+              }
+         }
+         P.reset();
+
+         // B(Q,ij)
+         N = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|mI)", nQs, nso_ * naoccA));
+         N->contract(false, false, nQs * nso_, naoccA, nso_, S, CaoccA, 1.0, 0.0);
+         K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|IJ)", nQs, naoccA * naoccA));
+         K->contract233(true, false, naoccA, naoccA, CaoccA, N, 1.0, 0.0);
+         N.reset();
+         K->write(psio_, PSIF_DFOCC_INTS, addr_ij, &addr_ij);
+         K.reset();
+
+         // B(Q,ia)
+         N = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|mA)", nQs, nso_ * navirA));
+         N->contract(false, false, nQs * nso_, navirA, nso_, S, CavirA, 1.0, 0.0);
+         S.reset();
+         K = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|IA)", nQs, naoccA * navirA));
+         K->contract233(true, false, naoccA, navirA, CaoccA, N, 1.0, 0.0);
+         K->write(psio_, PSIF_DFOCC_INTS, addr_ia, &addr_ia);
+         K.reset();
+
+         // B(Q,ab)
+         L = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|AB) Square", nQs, navirA * navirA));
+         L->contract233(true, false, navirA, navirA, CavirA, N, 1.0, 0.0);
+         N.reset();
+         L->write(psio_, PSIF_DFOCC_INTS, addr_sq, &addr_sq);
+         P = SharedTensor2d(new Tensor2d("DF_BASIS_CC B (Q|AB)", nQs, ntri_abAA));
+         #pragma omp parallel for
+         for (int Q = 0; Q < nQs; Q++) {
+              for (int a = 0; a < navirA; a++) {
+                   for (int b = 0; b <= a; b++) {
+                        P->set(Q, index2(a,b), L->get(Q, a * navirA + b));
+                   }
+              }
+         }
+         L.reset();
+         P->write(psio_, PSIF_DFOCC_INTS, addr_ab, &addr_ab);
+         P.reset();
+    }
+
+    // Trans OEI
+    timer_on("Trans OEI");
+    trans_oei();
+    timer_off("Trans OEI");
+
+}// end trans_corr_disk
+
 //=======================================================
 //          form b(Q,vv) : all
 //=======================================================          
@@ -108,6 +108,9 @@ void DFOCC::common_init()
     cc_lambda_=options_.get_str("CC_LAMBDA");
     Wabef_type_=options_.get_str("PPL_TYPE");
     triples_iabc_type_=options_.get_str("TRIPLES_IABC_TYPE");
+    bqab_type_=options_.get_str("BQAB_TYPE");
+    bqab_batch_max_=options_.get_int("BQAB_BATCH_MAX");
+    do_bqab_disk = false;
     do_cd=options_.get_str("CHOLESKY");
 
     //title
@@ -333,6 +333,7 @@ protected:
     void df_corr();
     void df_ref();
     void trans_corr();
+    void trans_corr_disk();
     void trans_ref();
     void trans_mp2();
     void formJ(boost::shared_ptr<BasisSet> auxiliary_, boost::shared_ptr<BasisSet> zero);
@@ -345,6 +346,11 @@ protected:
     void b_ij();
     void b_ia();
     void b_ab();
+    // DISK B(Q|AB): decide and size the batches, unpack a slab of the packed entry,
+    // and dress a slab with T1: T(Q,ab) = \sum_{m} t_m^a b_mb^Q
+    void bqab_disk_init();
+    void b_ab_unpack(const SharedTensor2d &K, const SharedTensor2d &P);
+    void b_ab_t1_slab(const SharedTensor2d &T, const SharedTensor2d &M, int Q0);
     void c_oo();
     void c_ov();
     void c_vv();
@@ -483,6 +489,7 @@ protected:
     void ccsd_Wabef2T2_low();     
     void ccsd_t1_amps_low();
     void ccsd_t2_amps_low();
+    void ccsd_Wabef2T2_disk();     
 
     // CCSDL
     void ccsdl_l1_amps();
@@ -848,11 +855,17 @@ protected:
      string cc_lambda_; 
      string Wabef_type_; 
      string triples_iabc_type_; 
+     string bqab_type_; 
 
      bool df_ints_incore;
      bool t2_incore;
      bool do_ppl_hm;
      bool do_triples_hm;
+     bool do_bqab_disk;	// stream B(Q|AB) from disk in batches
+
+     int nvir_batch;	// virtuals per batch of the DISK B(Q|AB) algorithm
+     int nQ_batch;	// aux functions per batch of the DISK B(Q|AB) algorithm
+     int bqab_batch_max_;	// cap on the batches of the DISK B(Q|AB) algorithm, 0 for none
 
      double **C_pitzerA;     
      double **C_pitzerB;     
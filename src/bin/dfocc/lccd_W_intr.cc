@@ -655,7 +655,7 @@ void DFOCC::lccd_WabefT2()
             int nb = a+1;
 
             // Form V[a](bf,e) = \sum_{Q} B(bfQ)*B(aeQ) cost = V^4N/2
-            I->contract(false, true, navirA*nb, navirA, nQ, K, K, 0, a*navirA*nQ, 1.0, 0.0);
+            I->contract(false, true, navirA*nb, navirA, nQ, K, K, 0, (ULI)a*navirA*nQ, 1.0, 0.0);
 
             // Form (+)V[a](b, e>=f) 
             #pragma omp parallel for
@@ -764,7 +764,7 @@ void DFOCC::lccd_WabefT2AA()
             int nb = a+1;
 
             // Form V[a](bf,e) = \sum_{Q} B(bfQ)*B(aeQ) cost = V^4N/2
-            I->contract(false, true, navirA*nb, navirA, nQ, K, K, 0, a*navirA*nQ, 1.0, 0.0);
+            I->contract(false, true, navirA*nb, navirA, nQ, K, K, 0, (ULI)a*navirA*nQ, 1.0, 0.0);
 
             // Form (+)V[a](b, e>=f) 
             #pragma omp parallel for
@@ -865,7 +865,7 @@ void DFOCC::lccd_WabefT2BB()
             int nb = a+1;
 
             // Form V[a](bf,e) = \sum_{Q} B(bfQ)*B(aeQ) cost = V^4N/2
-            I->contract(false, true, navirB*nb, navirB, nQ, K, K, 0, a*navirB*nQ, 1.0, 0.0);
+            I->contract(false, true, navirB*nb, navirB, nQ, K, K, 0, (ULI)a*navirB*nQ, 1.0, 0.0);
 
             // Form (+)V[a](b, e>=f) 
             #pragma omp parallel for
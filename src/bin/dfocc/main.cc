@@ -35,10 +35,16 @@ SharedWavefunction dfoccwave(SharedWavefunction ref_wfn, Options &options)
 {
     // Start the timers
     tstart();
+
+    // Recycle tensor storage across iterations within the memory setting
+    TensorPool::start(Process::environment.get_memory());
    
     SharedWavefunction dfocc_wfn = SharedWavefunction(new DFOCC(ref_wfn, options));
     dfocc_wfn->compute_energy();
 
+    if (options.get_int("PRINT") > 1) TensorPool::print_stats();
+    TensorPool::stop();
+
     // Shut down the timers
     tstop();
 
@@ -538,6 +538,7 @@ void DFOCC::ccsd_manager()
 
         timer_on("DF CC Integrals");
         df_corr();
+        bqab_disk_init();
         trans_corr();
         timer_off("DF CC Integrals");
         outfile->Printf("\n\tNumber of basis functions in the DF-CC basis: %3d\n", nQ);
@@ -578,16 +579,16 @@ void DFOCC::ccsd_manager()
 
         // Cost of Integral transform for B(Q,ab)
         cost_ampAA = 0.0;
-        cost_ampAA = nQ * nso2_;
-        cost_ampAA += nQ * navirA * navirA;
-        cost_ampAA += nQ * nso_ * navirA;
+        cost_ampAA = (double)nQ * nso2_;
+        cost_ampAA += (double)nQ * navirA * navirA;
+        cost_ampAA += (double)nQ * nso_ * navirA;
         cost_ampAA /= 1024.0 * 1024.0;
         cost_ampAA *= sizeof(double);
         outfile->Printf("\tMemory requirement for DF-CC int trans: %9.2lf MB \n", cost_ampAA);
 
         // Mem for amplitudes
         cost_ampAA = 0.0;
-        cost_ampAA = nocc2AA * nvir2AA;
+        cost_ampAA = (double)nocc2AA * nvir2AA;
         cost_ampAA /= 1024.0 * 1024.0;
         cost_ampAA *= sizeof(double);
         cost_3amp = 3.0 * cost_ampAA;
@@ -602,7 +603,14 @@ void DFOCC::ccsd_manager()
              df_ints_incore = true;
         }
         */
-        if ((cost_4amp+cost_df) <= memory_mb) { 
+        if (do_bqab_disk) { 
+             outfile->Printf("\tMemory requirement for CC contractions: %9.2lf MB \n", cost_3amp);
+             outfile->Printf("\tWarning: T2 amplitudes will be stored on the disk!\n");
+             nincore_amp = 3;
+             t2_incore = false;
+             df_ints_incore = false;
+        }
+        else if ((cost_4amp+cost_df) <= memory_mb) { 
              outfile->Printf("\tMemory requirement for CC contractions: %9.2lf MB \n", cost_4amp);
              outfile->Printf("\tTotal memory requirement for DF+CC int: %9.2lf MB \n", cost_4amp+cost_df);
              nincore_amp = 4;
@@ -704,7 +712,7 @@ void DFOCC::ccsd_manager()
 
         // memory requirements
         cost_ampAA = 0.0;
-        cost_ampAA = nocc2AA * nvir2AA;
+        cost_ampAA = (double)nocc2AA * nvir2AA;
         cost_ampAA /= 1024.0 * 1024.0;
         cost_ampAA *= sizeof(double);
         cost_ampBB = nocc2BB * nvir2BB;
@@ -853,6 +861,7 @@ void DFOCC::ccsd_t_manager()
 
         timer_on("DF CC Integrals");
         df_corr();
+        bqab_disk_init();
         trans_corr();
         timer_off("DF CC Integrals");
         outfile->Printf("\n\tNumber of basis functions in the DF-CC basis: %3d\n", nQ);
@@ -893,23 +902,30 @@ void DFOCC::ccsd_t_manager()
 
         // Cost of Integral transform for B(Q,ab)
         cost_ampAA = 0.0;
-        cost_ampAA = nQ * nso2_;
-        cost_ampAA += nQ * navirA * navirA;
-        cost_ampAA += nQ * nso_ * navirA;
+        cost_ampAA = (double)nQ * nso2_;
+        cost_ampAA += (double)nQ * navirA * navirA;
+        cost_ampAA += (double)nQ * nso_ * navirA;
         cost_ampAA /= 1024.0 * 1024.0;
         cost_ampAA *= sizeof(double);
         outfile->Printf("\tMemory requirement for DF-CC int trans: %9.2lf MB \n", cost_ampAA);
 
         // Mem for amplitudes
         cost_ampAA = 0.0;
-        cost_ampAA = nocc2AA * nvir2AA;
+        cost_ampAA = (double)nocc2AA * nvir2AA;
         cost_ampAA /= 1024.0 * 1024.0;
         cost_ampAA *= sizeof(double);
         cost_3amp = 3.0 * cost_ampAA;
         cost_4amp = 4.0 * cost_ampAA;
         cost_5amp = 5.0 * cost_ampAA;
 
-        if ((cost_4amp+cost_df) <= memory_mb) { 
+        if (do_bqab_disk) { 
+             outfile->Printf("\tMemory requirement for CC contractions: %9.2lf MB \n", cost_3amp);
+             outfile->Printf("\tWarning: T2 amplitudes will be stored on the disk!\n");
+             nincore_amp = 3;
+             t2_incore = false;
+             df_ints_incore = false;
+        }
+        else if ((cost_4amp+cost_df) <= memory_mb) { 
              outfile->Printf("\tMemory requirement for CC contractions: %9.2lf MB \n", cost_4amp);
              outfile->Printf("\tTotal memory requirement for DF+CC int: %9.2lf MB \n", cost_4amp+cost_df);
              nincore_amp = 4;
@@ -1002,7 +1018,7 @@ void DFOCC::ccsd_t_manager()
         cost_triples_iabc += cost_amp2;
         cost_triples_iabc *= sizeof(double);
 
-	if (triples_iabc_type_ == "DISK") {
+	if (triples_iabc_type_ == "DISK" || do_bqab_disk) {
 	    do_triples_hm = false;
             //outfile->Printf("\n\tI will use a DISK algorithm for (ia|bc) in (T)! \n");
             outfile->Printf("\tMemory requirement for (T) correction : %9.2lf MB \n", cost_amp1);
@@ -1052,7 +1068,7 @@ void DFOCC::ccsd_t_manager()
 
         // memory requirements
         cost_ampAA = 0.0;
-        cost_ampAA = nocc2AA * nvir2AA;
+        cost_ampAA = (double)nocc2AA * nvir2AA;
         cost_ampAA /= 1024.0 * 1024.0;
         cost_ampAA *= sizeof(double);
         cost_ampBB = nocc2BB * nvir2BB;
@@ -1148,7 +1164,7 @@ void DFOCC::ccsd_t_manager()
 	pt_title();
         outfile->Printf("\tComputing (T) correction...\n");
         timer_on("(T)");
-        if (triples_iabc_type_ == "DISK") ccsd_canonic_triples_disk();
+        if (triples_iabc_type_ == "DISK" || do_bqab_disk) ccsd_canonic_triples_disk();
 	else if (triples_iabc_type_ == "AUTO") {
 	    if (do_triples_hm) ccsd_canonic_triples_hm();
 	    else ccsd_canonic_triples();
@@ -31,7 +31,10 @@
 #include <libciomr/libciomr.h>
 #include <libpsio/psio.hpp>
 #include <libpsio/psio.h>
+#include <libpsio/aiohandler.h>
 #include <libiwl/iwl.hpp>
+#include <map>
+#include <boost/thread/mutex.hpp>
 #include "tensors.h"
 #include "libparallel/ParallelPrinter.h"
 using namespace boost;
@@ -40,6 +43,129 @@ using namespace std;
 
 namespace psi{ namespace dfoccwave{
 
+/********************************************************************************************/
+/************************** tensor pool *****************************************************/
+/********************************************************************************************/
+namespace {
+
+// Buffers smaller than this are not worth keeping
+const ULI pool_min_size = 4096;
+// Each buffer carries its length in front of the elements
+const ULI pool_header = 2;
+
+boost::mutex pool_lock;
+bool pool_on = false;
+// Limit in doubles
+ULI pool_limit = 0;
+// Kept buffers, keyed on their length in doubles
+std::multimap<ULI, double*> pool_free;
+ULI pool_live = 0;
+ULI pool_kept = 0;
+ULI pool_peak = 0;
+ULI pool_nalloc = 0;
+ULI pool_nreuse = 0;
+
+inline ULI pool_length(double *A)
+{
+    return (ULI)A[-(int)pool_header];
+}
+
+// Frees the largest kept buffers until live + kept + extra fits the limit
+void pool_trim(ULI extra)
+{
+    while (!pool_free.empty() && pool_live + pool_kept + extra > pool_limit) {
+         std::multimap<ULI, double*>::iterator it = pool_free.end();
+         --it;
+         pool_kept -= it->first;
+         delete[] (it->second - pool_header);
+         pool_free.erase(it);
+    }
+}
+
+}
+
+double *TensorPool::allocate(ULI n)
+{
+    if (n == 0) return NULL;
+    boost::mutex::scoped_lock lock(pool_lock);
+    pool_nalloc++;
+    double *A = NULL;
+    if (pool_on && n >= pool_min_size) {
+        std::multimap<ULI, double*>::iterator it = pool_free.find(n);
+        if (it != pool_free.end()) {
+            A = it->second;
+            pool_free.erase(it);
+            pool_kept -= n;
+            pool_nreuse++;
+        }
+        else pool_trim(n);
+    }
+    if (A == NULL) {
+        A = new double[n + pool_header] + pool_header;
+        A[-(int)pool_header] = (double)n;
+    }
+    pool_live += n;
+    if (pool_live + pool_kept > pool_peak) pool_peak = pool_live + pool_kept;
+    lock.unlock();
+    memset(A, 0, n * sizeof(double));
+    return A;
+}//
+
+void TensorPool::release(double *A)
+{
+    if (A == NULL) return;
+    boost::mutex::scoped_lock lock(pool_lock);
+    ULI n = pool_length(A);
+    pool_live -= n;
+    if (pool_on && n >= pool_min_size && pool_live + pool_kept + n <= pool_limit) {
+        pool_free.insert(std::make_pair(n, A));
+        pool_kept += n;
+    }
+    else delete[] (A - pool_header);
+}//
+
+double **TensorPool::block_matrix(ULI n, ULI m)
+{
+    if (n == 0 || m == 0) return NULL;
+    double *block = allocate(n * m);
+    double **A = new double*[n];
+    for (ULI i = 0; i < n; i++) A[i] = block + i * m;
+    return A;
+}//
+
+void TensorPool::free_block(double **A)
+{
+    if (A == NULL) return;
+    release(A[0]);
+    delete[] A;
+}//
+
+void TensorPool::start(ULI limit)
+{
+    boost::mutex::scoped_lock lock(pool_lock);
+    pool_on = true;
+    pool_limit = limit / sizeof(double);
+    pool_peak = pool_live;
+    pool_nalloc = 0;
+    pool_nreuse = 0;
+}//
+
+void TensorPool::stop()
+{
+    boost::mutex::scoped_lock lock(pool_lock);
+    pool_on = false;
+    pool_limit = 0;
+    pool_trim(0);
+}//
+
+void TensorPool::print_stats()
+{
+    boost::mutex::scoped_lock lock(pool_lock);
+    outfile->Printf("\n\tTensor pool: peak %9.2lf MB, %lu of %lu buffers recycled.\n",
+                    (double)pool_peak * sizeof(double) / (1024.0 * 1024.0),
+                    pool_nreuse, pool_nalloc);
+}//
+
 
 /********************************************************************************************/
 /************************** 1d array ********************************************************/
@@ -308,7 +434,7 @@ void Tensor1d::gemv(bool transa, const SharedTensor2d& a, const SharedTensor2d&
     }
 }//
 
-void Tensor1d::gemv(bool transa, int m, int n, const SharedTensor2d& a, const SharedTensor2d& b, int start_a, int start_b, double alpha, double beta)
+void Tensor1d::gemv(bool transa, int m, int n, const SharedTensor2d& a, const SharedTensor2d& b, ULI start_a, ULI start_b, double alpha, double beta)
 {
     char ta = transa ? 't' : 'n';
     int incx, incy, lda;
@@ -323,7 +449,7 @@ void Tensor1d::gemv(bool transa, int m, int n, const SharedTensor2d& a, const Sh
     }
 }//
 
-void Tensor1d::gemv(bool transa, int m, int n, const SharedTensor2d& a, const SharedTensor2d& b, int start_a, int start_b, int start_c, double alpha, double beta)
+void Tensor1d::gemv(bool transa, int m, int n, const SharedTensor2d& a, const SharedTensor2d& b, ULI start_a, ULI start_b, ULI start_c, double alpha, double beta)
 {
     char ta = transa ? 't' : 'n';
     int incx, incy, lda;
@@ -553,7 +679,7 @@ Tensor2d::Tensor2d(string name, int d1, int d2, int d3, int d4)
 
   // memalloc
   if (A2d_) release();
-  A2d_ = block_matrix(dim1_, dim2_);
+  A2d_ = TensorPool::block_matrix(dim1_, dim2_);
   zero();
 
   // row idx
@@ -609,7 +735,7 @@ Tensor2d::Tensor2d(string name, int d1, int d2, int d3)
 
   // memalloc
   if (A2d_) release();
-  A2d_ = block_matrix(dim1_, dim2_);
+  A2d_ = TensorPool::block_matrix(dim1_, dim2_);
   zero();
 
   // col idx
@@ -638,7 +764,7 @@ Tensor2d::~Tensor2d()
 void Tensor2d::memalloc()
 {
     if (A2d_) release();
-    A2d_ = block_matrix(dim1_, dim2_);
+    A2d_ = TensorPool::block_matrix(dim1_, dim2_);
     zero();
 }//
 
@@ -646,7 +772,7 @@ void Tensor2d::release()
 {
    //if (!A2d_) return;
    //free_block(A2d_);
-   if (A2d_) free_block(A2d_);
+   if (A2d_) TensorPool::free_block(A2d_);
    if (row_idx_) free_int_matrix(row_idx_);
    if (col_idx_) free_int_matrix(col_idx_);
    if (row2d1_) delete [] row2d1_;
@@ -668,7 +794,7 @@ void Tensor2d::init(int d1,int d2)
     dim1_=d1;
     dim2_=d2;
     if (A2d_) release();
-    A2d_ = block_matrix(dim1_, dim2_);
+    A2d_ = TensorPool::block_matrix(dim1_, dim2_);
 }//
 
 void Tensor2d::init(string name, int d1,int d2)
@@ -677,7 +803,7 @@ void Tensor2d::init(string name, int d1,int d2)
     dim2_=d2;
     name_=name;
     if (A2d_) release();
-    A2d_ = block_matrix(dim1_, dim2_);
+    A2d_ = TensorPool::block_matrix(dim1_, dim2_);
 }//
 
 void Tensor2d::zero()
@@ -774,7 +900,7 @@ void Tensor2d::set(double *A)
       #pragma omp parallel for
       for (int i=0; i<dim1_; i++) {
         for (int j=0; j<dim2_; j++) {
-             int ij = j + (i*dim2_);
+             ULI ij = j + ((ULI)i*dim2_);
              A2d_[i][j] = A[ij];
         }
       }
@@ -818,7 +944,7 @@ void Tensor2d::contract(bool transa, bool transb, int m, int n, int k, const Sha
     }
 }//
 
-void Tensor2d::contract(bool transa, bool transb, int m, int n, int k, const SharedTensor2d& a, const SharedTensor2d& b, int start_a, int start_b, double alpha, double beta)
+void Tensor2d::contract(bool transa, bool transb, int m, int n, int k, const SharedTensor2d& a, const SharedTensor2d& b, ULI start_a, ULI start_b, double alpha, double beta)
 {
     char ta = transa ? 't' : 'n';
     char tb = transb ? 't' : 'n';
@@ -834,7 +960,7 @@ void Tensor2d::contract(bool transa, bool transb, int m, int n, int k, const Sha
 }//
 
 void Tensor2d::contract(bool transa, bool transb, int m, int n, int k, const SharedTensor2d& a, const SharedTensor2d& b, 
-                        int start_a, int start_b, int start_c, double alpha, double beta)
+                        ULI start_a, ULI start_b, ULI start_c, double alpha, double beta)
 {
     char ta = transa ? 't' : 'n';
     char tb = transb ? 't' : 'n';
@@ -1524,7 +1650,7 @@ void Tensor2d::axpy(ULI length, int inc_a, const SharedTensor2d &a, int inc_2d,
     C_DAXPY(length, alpha, a->A2d_[0], inc_a, A2d_[0], inc_2d);
 }//
 
-void Tensor2d::axpy(ULI length, int start_a, int inc_a, const SharedTensor2d &A, int start_2d, int inc_2d, double alpha)
+void Tensor2d::axpy(ULI length, ULI start_a, int inc_a, const SharedTensor2d &A, ULI start_2d, int inc_2d, double alpha)
 {
     C_DAXPY(length, alpha, A->A2d_[0]+start_a, inc_a, A2d_[0]+start_2d, inc_2d);
 }//
@@ -1622,18 +1748,18 @@ void Tensor2d::copy(ULI length, const SharedTensor2d &A, int inc_a, int inc_2d)
     C_DCOPY(length, A->A2d_[0], inc_a, A2d_[0], inc_2d);
 }//
 
-void Tensor2d::copy(const SharedTensor2d &A, int start)
+void Tensor2d::copy(const SharedTensor2d &A, ULI start)
 {
-    memcpy(A2d_[0], A->A2d_[0]+start, dim1_ * dim2_ * sizeof(double));
+    memcpy(A2d_[0], A->A2d_[0]+start, (ULI)dim1_ * (ULI)dim2_ * sizeof(double));
 }//
 
 void Tensor2d::pcopy(const SharedTensor2d &A, int dim_copy, int dim_skip)
 {
     double *temp = new double[dim_copy];
-    int syc = 0;
+    ULI syc = 0;
     // A[m] is getting the pointer to the m-th row of A.
     // A[0]+m is getting the pointer to the m-th element of A.
-    for (int i = 0; i < dim1_*dim2_; i+=dim_copy) {
+    for (ULI i = 0; i < (ULI)dim1_*(ULI)dim2_; i+=dim_copy) {
          memcpy(temp, A->A2d_[0]+syc, dim_copy * sizeof(double));
          memcpy(A2d_[0]+i, temp, dim_copy * sizeof(double));
          syc += dim_copy + dim_skip;
@@ -1642,13 +1768,13 @@ void Tensor2d::pcopy(const SharedTensor2d &A, int dim_copy, int dim_skip)
 
 }//
 
-void Tensor2d::pcopy(const SharedTensor2d &A, int dim_copy, int dim_skip, int start)
+void Tensor2d::pcopy(const SharedTensor2d &A, int dim_copy, int dim_skip, ULI start)
 {
     double *temp = new double[dim_copy];
-    int syc = 0;
+    ULI syc = 0;
     // A[m] is getting the pointer to the m-th row of A.
     // A[0]+m is getting the pointer to the m-th element of A.
-    for (int i = 0; i < dim1_*dim2_; i+=dim_copy) {
+    for (ULI i = 0; i < (ULI)dim1_*(ULI)dim2_; i+=dim_copy) {
          memcpy(temp, A->A2d_[0]+start+syc, dim_copy * sizeof(double));
          memcpy(A2d_[0]+i, temp, dim_copy * sizeof(double));
          syc += dim_copy + dim_skip;
@@ -2306,7 +2432,7 @@ void Tensor2d::mywrite(const string& filename)
       // write binary data
       ofstream OutFile;
       OutFile.open(const_cast<char*>(filename.c_str()), ios::out | ios::binary);
-      OutFile.write((char*)A2d_[0], dim1_*dim2_*sizeof(double));
+      OutFile.write((char*)A2d_[0], (ULI)dim1_*dim2_*sizeof(double));
       OutFile.close();
 }//
 
@@ -2322,7 +2448,7 @@ void Tensor2d::mywrite(int fileno)
       // write binary data
       ofstream OutFile;
       OutFile.open(const_cast<char*>(fname.c_str()), ios::out | ios::binary);
-      OutFile.write((char*)A2d_[0], dim1_*dim2_*sizeof(double));
+      OutFile.write((char*)A2d_[0], (ULI)dim1_*dim2_*sizeof(double));
       OutFile.close();
 }//
 
@@ -2339,7 +2465,7 @@ void Tensor2d::mywrite(int fileno, bool append)
       ofstream OutFile;
       if (append) OutFile.open(const_cast<char*>(fname.c_str()), ios::out | ios::binary | ios::app);
       else OutFile.open(const_cast<char*>(fname.c_str()), ios::out | ios::binary);
-      OutFile.write((char*)A2d_[0], dim1_*dim2_*sizeof(double));
+      OutFile.write((char*)A2d_[0], (ULI)dim1_*dim2_*sizeof(double));
       OutFile.close();
 }//
 
@@ -2348,7 +2474,7 @@ void Tensor2d::myread(const string& filename)
       // read binary data
       ifstream InFile;
       InFile.open(const_cast<char*>(filename.c_str()), ios::in | ios::binary);
-      InFile.read((char*)A2d_[0], dim1_*dim2_*sizeof(double));
+      InFile.read((char*)A2d_[0], (ULI)dim1_*dim2_*sizeof(double));
       InFile.close();
 
 }//
@@ -2365,7 +2491,7 @@ void Tensor2d::myread(int fileno)
       // read binary data
       ifstream InFile;
       InFile.open(const_cast<char*>(fname.c_str()), ios::in | ios::binary);
-      InFile.read((char*)A2d_[0], dim1_*dim2_*sizeof(double));
+      InFile.read((char*)A2d_[0], (ULI)dim1_*dim2_*sizeof(double));
       InFile.close();
 
 }//
@@ -2383,7 +2509,7 @@ void Tensor2d::myread(int fileno, bool append)
       ifstream InFile;
       if (append) InFile.open(const_cast<char*>(fname.c_str()), ios::in | ios::binary | ios::app);
       else InFile.open(const_cast<char*>(fname.c_str()), ios::in | ios::binary);
-      InFile.read((char*)A2d_[0], dim1_*dim2_*sizeof(double));
+      InFile.read((char*)A2d_[0], (ULI)dim1_*dim2_*sizeof(double));
       InFile.close();
 
 }//
@@ -2401,7 +2527,7 @@ void Tensor2d::myread(int fileno, ULI start)
       ifstream InFile;
       InFile.open(const_cast<char*>(fname.c_str()), ios::in | ios::binary);
       InFile.seekg(start, ios::beg);
-      InFile.read((char*)A2d_[0], dim1_*dim2_*sizeof(double));
+      InFile.read((char*)A2d_[0], (ULI)dim1_*dim2_*sizeof(double));
       InFile.close();
 
 }//
@@ -2452,7 +2578,7 @@ void Tensor2d::to_pointer(double *A)
       #pragma omp parallel for
       for (int i=0; i<dim1_; ++i) {
         for (int j=0; j<dim2_; ++j) {
-             int ij = j + (i*dim2_); 
+             ULI ij = j + ((ULI)i*dim2_);
              A[ij] = A2d_[i][j];
         }
       }
@@ -3271,7 +3397,7 @@ void Tensor2d::dirprd224(const SharedTensor2d &a, const SharedTensor2d &b, doubl
 
 double* Tensor2d::to_vector(const SharedTensor2i &pair_idx)
 {
-     double* temp = new double[dim1_ * dim2_];
+     double* temp = new double[(ULI)dim1_ * (ULI)dim2_];
      #pragma omp parallel for
      for (int i=0; i<dim1_; i++) {
           for (int j=0; j<dim2_; j++) {
@@ -3284,11 +3410,11 @@ double* Tensor2d::to_vector(const SharedTensor2i &pair_idx)
 
 double* Tensor2d::to_vector()
 {
-     double* temp = new double[dim1_ * dim2_];
+     double* temp = new double[(ULI)dim1_ * (ULI)dim2_];
      #pragma omp parallel for
      for (int i=0; i<dim1_; i++) {
           for (int j=0; j<dim2_; j++) {
-               int ij = (i * dim2_) + j;
+               ULI ij = ((ULI)i * dim2_) + j;
                temp[ij] = A2d_[i][j];
           }
      }
@@ -3304,7 +3430,7 @@ double Tensor2d::rms()
             summ += A2d_[i][j] * A2d_[i][j];
        }
   }
-  summ=sqrt(summ/(dim1_*dim2_));
+  summ=sqrt(summ/((double)dim1_*dim2_));
 
   return summ;
 }//
@@ -3318,7 +3444,7 @@ double Tensor2d::rms(const SharedTensor2d& a)
             summ += (A2d_[i][j] - a->A2d_[i][j]) * (A2d_[i][j] - a->A2d_[i][j]);
        }
   }
-  summ=sqrt(summ/(dim1_*dim2_));
+  summ=sqrt(summ/((double)dim1_*dim2_));
 
   return summ;
 }//
@@ -5931,6 +6057,63 @@ double Tensor2d::get_max_element()
 }//
 
 
+/********************************************************************************************/
+/************************** block stream ****************************************************/
+/********************************************************************************************/
+BlockStream::BlockStream(boost::shared_ptr<psi::PSIO> psio, unsigned int fileno, const string& label, ULI ncol)
+    : psio_(psio), fileno_(fileno), label_(label), ncol_(ncol), next_(0), job_(0)
+{
+    close_ = !psio_->open_check(fileno_);
+    if (close_) psio_->open(fileno_, PSIO_OPEN_OLD);
+    aio_ = boost::shared_ptr<AIOHandler>(new AIOHandler(psio_, 1));
+}//
+
+BlockStream::~BlockStream()
+{
+    // The pending read writes into buf_, so it has to finish first
+    aio_->synchronize();
+    aio_.reset();
+    buf_.reset();
+    if (close_) psio_->close(fileno_, 1);
+}//
+
+void BlockStream::add(ULI row, int nrow, ULI col, int ncol)
+{
+    Block block;
+    block.row = row;
+    block.col = col;
+    block.nrow = nrow;
+    block.ncol = ncol;
+    blocks_.push_back(block);
+}//
+
+void BlockStream::add_rows(ULI nrow, int height)
+{
+    for (ULI row = 0; row < nrow; row += height) {
+         add(row, (int)MIN0((ULI)height, nrow - row), 0, (int)ncol_);
+    }
+}//
+
+void BlockStream::start(size_t n)
+{
+    const Block &block = blocks_[n];
+    buf_ = SharedTensor2d(new Tensor2d(label_, block.nrow, block.ncol));
+    psio_address start = psio_get_address(PSIO_ZERO, (block.row * ncol_ + block.col) * sizeof(double));
+    job_ = aio_->read_discont(fileno_, label_.c_str(), buf_->A2d_, block.nrow, block.ncol, ncol_ - block.ncol, start);
+}//
+
+SharedTensor2d BlockStream::next()
+{
+    if (next_ >= blocks_.size()) return SharedTensor2d();
+    if (next_ == 0) start(0);
+    aio_->wait_for_job(job_);
+    SharedTensor2d block = buf_;
+    buf_.reset();
+    next_++;
+    if (next_ < blocks_.size()) start(next_);
+    return block;
+}//
+
 
 /********************************************************************************************/
 /************************** 3d array ********************************************************/
@@ -5971,7 +6154,16 @@ Tensor3d::~Tensor3d()
 void Tensor3d::memalloc()
 {
     if (A3d_) release();
-    A3d_ = init_3d_array(dim1_, dim2_, dim3_);
+    ULI d12 = (ULI)dim1_ * (ULI)dim2_;
+    double *block = TensorPool::allocate(d12 * (ULI)dim3_);
+    if (block == NULL) return;
+    // Row pointers over one contiguous, pooled block
+    A3d_ = new double**[dim1_];
+    A3d_[0] = new double*[d12];
+    for (int h=0; h<dim1_; h++) {
+         A3d_[h] = A3d_[0] + (ULI)h * dim2_;
+         for (int i=0; i<dim2_; i++) A3d_[h][i] = block + ((ULI)h * dim2_ + i) * dim3_;
+    }
     zero();
 }//
 
@@ -5994,6 +6186,7 @@ void Tensor3d::init(string name, int d1,int d2, int d3)
 
 void Tensor3d::zero()
 {
+  if (!A3d_) return;
   memset(&(A3d_[0][0][0]), 0, sizeof(double)*dim1_*dim2_*dim3_);
 }//
 
@@ -6010,7 +6203,9 @@ void Tensor3d::print()
 void Tensor3d::release()
 {
    if (!A3d_) return;
-   free_3d_array(A3d_, dim1_, dim2_);
+   TensorPool::release(A3d_[0][0]);
+   delete [] A3d_[0];
+   delete [] A3d_;
    A3d_ = NULL;
 }//
 
@@ -6269,7 +6464,7 @@ void Tensor2i::add(const SharedTensor2i& a)
 {
     /*
     int *lhs, *rhs;
-    size_t size = dim1_ * dim2_;
+    size_t size = (size_t)dim1_ * dim2_;
     if (size) {
         lhs = A2i_[0];
         rhs = Adum->A2i_[0];
@@ -6296,7 +6491,7 @@ void Tensor2i::subtract(const SharedTensor2i& a)
 {
     /*
     int *lhs, *rhs;
-    size_t size = dim1_ * dim2_;
+    size_t size = (size_t)dim1_ * dim2_;
     if (size) {
         lhs = A2i_[0];
         rhs = Adum->A2i_[0];
@@ -6350,13 +6545,13 @@ void Tensor2i::copy(const SharedTensor2i& Adum)
     ULI length;
     length = (ULI)dim1_ * (ULI)dim2_;
       if (dim1_ != 0 && dim2_ != 0) {
-	memcpy(A2i_[0], Adum->A2i_[0], dim1_ * dim2_ * sizeof(int));
+	memcpy(A2i_[0], Adum->A2i_[0], (size_t)dim1_ * dim2_ * sizeof(int));
       }
 }//
 
 void Tensor2i::copy(int **a)
 {
-    size_t size = dim1_ * dim2_ * sizeof(int);
+    size_t size = (size_t)dim1_ * dim2_ * sizeof(int);
     if (size) memcpy(&(A2i_[0][0]), &(a[0][0]), size);
 }
 
@@ -6376,7 +6571,7 @@ int Tensor2i::trace()
 int **Tensor2i::to_int_matrix()
 {
     int **temp = init_int_matrix(dim1_, dim2_);
-    memcpy(&(temp[0][0]), &(A2i_[0][0]), dim1_ * dim2_ * sizeof(int));
+    memcpy(&(temp[0][0]), &(A2i_[0][0]), (size_t)dim1_ * dim2_ * sizeof(int));
     return temp;
 }//
 
@@ -33,6 +33,7 @@
 #include <libmints/mints.h>
 #include <libpsio/psio.hpp>
 #include <libpsio/psio.h>
+#include <vector>
 
 #define index2(i,j) ((i>j) ? ((i*(i+1)/2)+j) : ((j*(j+1)/2)+i))
 #define index4(i,j,k,l) index2(index2(i,j),index2(k,l))
@@ -44,7 +45,9 @@ using namespace boost;
 using namespace psi;
 using namespace std;
 
-namespace psi{ namespace dfoccwave{
+namespace psi{
+class AIOHandler;
+namespace dfoccwave{
 
 class Tensor1d;
 class Tensor2d;
@@ -60,6 +63,27 @@ typedef boost::shared_ptr<Tensor1i> SharedTensor1i;
 typedef boost::shared_ptr<Tensor2i> SharedTensor2i;
 typedef boost::shared_ptr<Tensor3i> SharedTensor3i;
 
+// Storage of the Tensor2d and Tensor3d elements.  While the pool is started, the
+// buffers of released tensors are kept and handed to the next tensor of the same
+// size, instead of going back to the system, as long as the tensors in use and the
+// kept buffers together fit in the memory limit.  This saves the page faults of
+// allocating the same large temporaries in every iteration.
+class TensorPool
+{
+  public:
+  // Contiguous, zeroed storage for n doubles; NULL if n is 0
+  static double *allocate(ULI n);
+  static void release(double *A);
+  // n x m matrix with row pointers on pooled storage; NULL if n or m is 0
+  static double **block_matrix(ULI n, ULI m);
+  static void free_block(double **A);
+  // Start recycling buffers, keeping at most limit bytes in use and kept
+  static void start(ULI limit);
+  // Stop recycling buffers and free the kept ones
+  static void stop();
+  static void print_stats();
+};
+
 class Tensor1d
 {
 
@@ -102,8 +126,8 @@ class Tensor1d
   // gemv: C(m) = \sum_{n} A(m,n) b(n)
   void gemv(bool transa, int m, int n, const SharedTensor2d& a, const SharedTensor2d& b, double alpha, double beta);
   void gemv(bool transa, const SharedTensor2d& a, const SharedTensor2d& b, double alpha, double beta);
-  void gemv(bool transa, int m, int n, const SharedTensor2d& a, const SharedTensor2d& b, int start_a, int start_b, double alpha, double beta);
-  void gemv(bool transa, int m, int n, const SharedTensor2d& a, const SharedTensor2d& b, int start_a, int start_b, int start_c, double alpha, double beta);
+  void gemv(bool transa, int m, int n, const SharedTensor2d& a, const SharedTensor2d& b, ULI start_a, ULI start_b, double alpha, double beta);
+  void gemv(bool transa, int m, int n, const SharedTensor2d& a, const SharedTensor2d& b, ULI start_a, ULI start_b, ULI start_c, double alpha, double beta);
   // gbmv: This function may NOT working correctly!!!!
   void gbmv(bool transa, const SharedTensor2d& a, const SharedTensor1d& b, double alpha, double beta);
   // xay: return result of A1d_' * A * y
@@ -190,7 +214,7 @@ class Tensor2d
   void axpy(double **a, double alpha);
   void axpy(const SharedTensor2d &a, double alpha);
   void axpy(ULI length, int inc_a, const SharedTensor2d &a, int inc_2d, double alpha);
-  void axpy(ULI length, int start_a, int inc_a, const SharedTensor2d &A, int start_2d, int inc_2d, double alpha);
+  void axpy(ULI length, ULI start_a, int inc_a, const SharedTensor2d &A, ULI start_2d, int inc_2d, double alpha);
   double **transpose2();
   SharedTensor2d transpose();
   void trans(const SharedTensor2d &A);
@@ -198,10 +222,10 @@ class Tensor2d
   void copy(double **a);
   void copy(const SharedTensor2d &Adum);
   void copy(ULI length, const SharedTensor2d &A, int inc_a, int inc_2d);
-  void copy(const SharedTensor2d &A, int start);
+  void copy(const SharedTensor2d &A, ULI start);
   // partial copy
   void pcopy(const SharedTensor2d &A, int dim_copy, int dim_skip);
-  void pcopy(const SharedTensor2d &A, int dim_copy, int dim_skip, int start);
+  void pcopy(const SharedTensor2d &A, int dim_copy, int dim_skip, ULI start);
   double get_max_element();
   // diagonalize: diagonalize via rsp
   void diagonalize(const SharedTensor2d &eigvectors, const SharedTensor1d &eigvalues, double cutoff);
@@ -225,9 +249,9 @@ class Tensor2d
   void gemm(bool transa, bool transb, const SharedTensor2d& a, const SharedTensor2d& b, double alpha, double beta);
   // contract: general contraction C(m,n) = \sum_{k} A(m,k) * B(k,n)
   void contract(bool transa, bool transb, int m, int n, int k, const SharedTensor2d& a, const SharedTensor2d& b, double alpha, double beta);
-  void contract(bool transa, bool transb, int m, int n, int k, const SharedTensor2d& a, const SharedTensor2d& b, int start_a, int start_b, double alpha, double beta);
+  void contract(bool transa, bool transb, int m, int n, int k, const SharedTensor2d& a, const SharedTensor2d& b, ULI start_a, ULI start_b, double alpha, double beta);
   void contract(bool transa, bool transb, int m, int n, int k, const SharedTensor2d& a, const SharedTensor2d& b, 
-                int start_a, int start_b, int start_c, double alpha, double beta);
+                ULI start_a, ULI start_b, ULI start_c, double alpha, double beta);
   // contract323: C[Q](m,n) = \sum_{k} A[Q](m,k) * B(k,n). Note: contract332 should be called with beta=1.0
   void contract323(bool transa, bool transb, int m, int n, const SharedTensor2d& a, const SharedTensor2d& b, double alpha, double beta);
   // contract233: C[Q](m,n) = \sum_{k} A(m,k) * B[Q](k,n)
@@ -488,6 +512,46 @@ class Tensor2d
   friend class Tensor3d;
   friend class Tensor1i;
   friend class Tensor2i;
+  friend class BlockStream;
+};
+
+// Reads blocks of a two-index disk entry, one after the other.  While the caller
+// works on one block, the next one is read in the background, so that the I/O
+// of out-of-core algorithms overlaps their contractions.  At most three blocks
+// are alive at once: the one being read, the one returned last and the one before,
+// unless the caller has released it.
+class BlockStream
+{
+  private:
+  struct Block {
+      ULI row, col;
+      int nrow, ncol;
+  };
+  boost::shared_ptr<psi::PSIO> psio_;
+  boost::shared_ptr<psi::AIOHandler> aio_;
+  unsigned int fileno_;
+  string label_;
+  ULI ncol_;
+  bool close_;
+  std::vector<Block> blocks_;
+  size_t next_;
+  SharedTensor2d buf_;
+  unsigned long job_;
+
+  void start(size_t n);
+
+  public:
+  // Stream from the entry label of fileno, which has ncol columns per row
+  BlockStream(boost::shared_ptr<psi::PSIO> psio, unsigned int fileno, const string& label, ULI ncol);
+  ~BlockStream();
+
+  // Queue the block of rows [row, row+nrow) and columns [col, col+ncol)
+  void add(ULI row, int nrow, ULI col, int ncol);
+  // Queue the row blocks [0, nrow) of the given height, all columns
+  void add_rows(ULI nrow, int height);
+  int nblocks() const { return blocks_.size(); }
+  // The next queued block as a contiguous nrow x ncol tensor, or NULL when done
+  SharedTensor2d next();
 };
 
 class Tensor3d
@@ -25,6 +25,8 @@
  * @END LICENSE
  */
 
+#include <string>
+#include <vector>
 #include <boost/python.hpp>
 #include <libpsio/psio.hpp>
 
@@ -32,6 +34,25 @@ using namespace boost;
 using namespace boost::python;
 using namespace psi;
 
+namespace {
+
+void py_psio_write_entry(PSIO& psio, unsigned int unit, const std::string& key,
+                         const std::string& data)
+{
+    std::vector<char> buffer(data.begin(), data.end());
+    psio.write_entry(unit, key.c_str(), buffer.data(), buffer.size());
+}
+
+std::string py_psio_read_entry(PSIO& psio, unsigned int unit, const std::string& key,
+                               ULI size)
+{
+    std::vector<char> buffer(size);
+    psio.read_entry(unit, key.c_str(), buffer.data(), size);
+    return std::string(buffer.begin(), buffer.end());
+}
+
+}
+
 void export_psio()
 {
     class_<PSIO, boost::shared_ptr<PSIO> >( "IO", "docstring" ).
@@ -43,6 +64,9 @@ void export_psio()
         def( "tocclean", &PSIO::tocclean, "docstring" ).
         def( "tocprint", &PSIO::tocprint, "docstring" ).
         def( "tocwrite", &PSIO::tocwrite, "docstring" ).
+        def( "tocentry_exists", &PSIO::tocentry_exists, "Does the TOC of unit arg1 hold an entry labeled arg2?" ).
+        def( "write_entry", py_psio_write_entry, "Writes the bytes of string arg3 to TOC entry arg2 of unit arg1" ).
+        def( "read_entry", py_psio_read_entry, "Reads arg3 bytes of TOC entry arg2 of unit arg1 into a string" ).
         def( "shared_object", &PSIO::shared_object).
         def( "set_pid", &PSIO::set_pid, "docstring" ).
         staticmethod("shared_object").
@@ -65,5 +89,7 @@ void export_psio()
         def( "set_specific_path", &PSIOManager::set_specific_path, "docstring" ).
         def( "get_file_path", &PSIOManager::get_file_path, "docstring" ).
         def( "set_specific_retention", &PSIOManager::set_specific_retention, "docstring" ).
+        def( "set_specific_mmap", &PSIOManager::set_specific_mmap, "Access the given file number through a memory mapping when it is next opened" ).
+        def( "get_specific_mmap", &PSIOManager::get_specific_mmap, "Is the given file number accessed through a memory mapping?" ).
         def( "get_default_path", &PSIOManager::get_default_path, "docstring" );
 }
\ No newline at end of file
@@ -51,6 +51,8 @@
 #include <liboptions/liboptions.h>
 #include <liboptions/liboptions_python.h>
 #include <libpsi4util/libpsi4util.h>
+#include <libfock/cubature.h>
+#include <libqt/qt.h>
 #include <psiconfig.h>
 
 #include <psi4-dec.h>
@@ -62,7 +64,6 @@
 #include "../cclambda/cclambda.h"
 
 #if defined(MAKE_PYTHON_MODULE)
-#include <libqt/qt.h>
 #include <libpsio/psio.h>
 #include <libmints/wavefunction.h>
 #include <psifiles.h>
@@ -655,6 +656,7 @@ char const *py_psi_git_version()
 void py_psi_clean()
 {
     PSIOManager::shared_object()->psiclean();
+    DFTGrid::clear_cache();
 }
 
 void py_psi_print_options()
@@ -682,6 +684,27 @@ void py_psi_print_out(std::string s)
     (*outfile) << s;
 }
 
+void py_psi_timer_on(std::string key)
+{
+    timer_on(key.c_str());
+}
+
+void py_psi_timer_off(std::string key)
+{
+    timer_off(key.c_str());
+}
+
+void py_psi_timer_trace(std::string filename)
+{
+    timer_trace(filename.c_str());
+}
+
+void py_psi_timer_done()
+{
+    timer_done();
+    timer_init();
+}
+
 /**
  * @return whether key describes a convergence threshold or not
  */
@@ -1396,6 +1419,10 @@ BOOST_PYTHON_MODULE (psi4)
         py_psi_print_global_options,
         "Prints the currently set global (all modules) options to the output file.");
     def("print_out", py_psi_print_out, "Prints a string (using sprintf-like notation) to the output file.");
+    def("timer_on", py_psi_timer_on, "Starts the timer *arg1* in the calling thread.");
+    def("timer_off", py_psi_timer_off, "Stops the timer *arg1* in the calling thread.");
+    def("timer_trace", py_psi_timer_trace, "Records every timer interval from now on, to be written to the JSON file *arg1* by timer_done.");
+    def("timer_done", py_psi_timer_done, "Writes the timings so far to timer.dat (and the trace file, if any) and restarts the timers.");
 
     // Set the different local option types
     def("set_local_option",
@@ -136,6 +136,12 @@ int read_options(const std::string &name, Options & options, bool suppress_print
   /*- Either :ref:`a set of 3 coordinates or a string <table:oe_origin>`
   describing the origin about which one-electron properties are computed. -*/
   options.add("PROPERTIES_ORIGIN", new ArrayType());
+  /*- Tolerance for evaluating the GRID_ESP and GRID_FIELD properties from
+  atom-pair multipoles instead of exact integrals: atom pairs far from a grid
+  point are expanded through their quadrupoles while the estimated total error
+  of the potential (or of each field component) at that point stays below
+  this. Zero uses exact integrals throughout. !expert -*/
+  options.add_double("ESP_FARFIELD_TOLERANCE", 0.0);
 
   /*- Psi4 dies if energy does not converge. !expert -*/
   options.add_bool("DIE_IF_NOT_CONVERGED", true);
@@ -201,6 +207,16 @@ int read_options(const std::string &name, Options & options, bool suppress_print
   /*- Order of Douglas-Kroll-Hess !expert -*/
   options.add_int("DKH_ORDER", 2);
 
+  /*- Primitive pairs whose contribution to any potential energy integral is
+  bounded below this are skipped. Zero computes every pair. !expert -*/
+  options.add_double("POTENTIAL_INTS_TOLERANCE", 1.0E-15);
+
+  /*- Do compute the SO-basis two-electron integrals directly into the
+  presort buckets of the integral transformation, skipping the IWL integral
+  file? With this set, ADC and CC energies (including Brueckner, but without
+  AO-basis algorithms) no longer write the SO integral file at all. -*/
+  options.add_bool("DIRECT_TEI_PRESORT", false);
+
   /*- Directory to which to write cube files. Default is the input file
   directory. -*/
   options.add_str_i("CUBEPROP_FILEPATH", ".");
@@ -220,6 +236,11 @@ int read_options(const std::string &name, Options & options, bool suppress_print
   /*- List of basis function indices for which cube files are generated
   (1-based). All basis functions computed if empty.-*/
   options.add("CUBEPROP_BASIS_FUNCTIONS", new ArrayType());
+  /*- Format of the files written by cubeprop. ``CUBE`` writes Gaussian cube
+  text files (name.cube); ``BINARY`` writes the same header and grid with
+  single-precision data in a raw binary file (name.bcube), about a quarter
+  of the size and much faster to write. -*/
+  options.add_str("CUBEPROP_FORMAT", "CUBE", "CUBE BINARY");
   /*- CubicScalarGrid basis cutoff. !expert -*/
   options.add_double("CUBIC_BASIS_TOLERANCE", 1.0E-12);
   /*- CubicScalarGrid maximum number of grid points per evaluation block. !expert -*/
@@ -310,6 +331,11 @@ int read_options(const std::string &name, Options & options, bool suppress_print
     /*- Number of threads for DETCI. -*/
     options.add_int("CI_NUM_THREADS", 1);
 
+    /*- Do read the next buffer of the C vector while the sigma vector is
+    built from the current one?  Only matters for |detci__icore| = 0 or 2,
+    and costs one more C vector buffer of core memory. -*/
+    options.add_bool("CI_READ_AHEAD", true);
+
     /*- Do print the sigma overlap matrix?  Not generally useful.  !expert -*/
     options.add_bool("SIGMA_OVERLAP", false);
 
@@ -1166,7 +1192,7 @@ int read_options(const std::string &name, Options & options, bool suppress_print
     /*- What algorithm to use for the SCF computation. See Table :ref:`SCF
     Convergence & Algorithm <table:conv_scf>` for default algorithm for
     different calculation types. -*/
-    options.add_str("SCF_TYPE", "PK", "DIRECT DF PK OUT_OF_CORE FAST_DF CD INDEPENDENT");
+    options.add_str("SCF_TYPE", "PK", "DIRECT DF PK OUT_OF_CORE FAST_DF CD INDEPENDENT COSX");
     /*- Maximum numbers of batches to read PK supermatrix. !expert -*/
     options.add_int("PK_MAX_BUCKETS", 500);
     /*- Select the PK algorithm to use. For debug purposes, selection will be automated later. !expert -*/
@@ -1181,6 +1207,17 @@ int read_options(const std::string &name, Options & options, bool suppress_print
      -*/
     options.add_str("INDEPENDENT_J_TYPE", "DIRECT_SCREENING", "DIRECT_SCREENING");
     options.add_str("INDEPENDENT_K_TYPE", "DIRECT_SCREENING", "DIRECT_SCREENING LINK");
+    /*- Number of radial points per atom in the seminumerical exchange grid
+    of |scf__scf_type| ``COSX``. The remaining grid options follow the DFT grid. -*/
+    options.add_int("COSX_RADIAL_POINTS", 35);
+    /*- Number of spherical points per radial shell in the seminumerical
+    exchange grid of |scf__scf_type| ``COSX``. Must be a Lebedev number. -*/
+    options.add_int("COSX_SPHERICAL_POINTS", 110);
+    /*- Cutoff for the seminumerical exchange of |scf__scf_type| ``COSX``. A
+    shell pair is skipped at a grid point when its estimated potential
+    integral there, times the largest density-weighted basis value it
+    touches, is below this value. -*/
+    options.add_double("COSX_INTS_TOLERANCE", 1.0E-12);
     /*- Tolerance for Cholesky decomposition of the ERI tensor -*/
     options.add_double("CHOLESKY_TOLERANCE",1e-4);
     /*- Use DF integrals tech to converge the SCF before switching to a conventional tech
@@ -1375,6 +1412,24 @@ int read_options(const std::string &name, Options & options, bool suppress_print
     /*- Bump function max radius -*/
     options.add_double("DF_BUMP_R1", 0.0);
 
+    /*- SUBSECTION DirectJK Algorithm -*/
+
+    /*- Shell quartet screening in |scf__scf_type| ``DIRECT``. ``SCHWARZ``
+    uses the Cauchy-Schwarz bound alone, ``DENSITY`` also weights it by the
+    largest density element the quartet contributes to. -*/
+    options.add_str("SCREENING", "SCHWARZ", "SCHWARZ DENSITY");
+
+    /*- Do build the Fock matrix incrementally in |scf__scf_type| ``DIRECT``?
+    Only the change in the density since the previous iteration is contracted
+    with the integrals, and quartets are screened by their Schwarz bound times
+    the largest density change they touch. The number of incremental and of
+    full builds in the last SCF are kept in the variables ``DIRECTJK
+    INCREMENTAL BUILDS`` and ``DIRECTJK FULL BUILDS``. -*/
+    options.add_bool("INCFOCK", false);
+    /*- Frequency with which to rebuild the Fock matrix from the full density
+    when |scf__incfock| is on. -*/
+    options.add_int("INCFOCK_FULL_FOCK_EVERY", 10);
+
     /*- SUBSECTION SAD Guess Algorithm -*/
 
     /*- The amount of SAD information to print to the output !expert -*/
@@ -1423,6 +1478,17 @@ int read_options(const std::string &name, Options & options, bool suppress_print
     options.add_double("DFT_BS_RADIUS_ALPHA",1.0);
     /*- DFT basis cutoff. -*/
     options.add_double("DFT_BASIS_TOLERANCE", 1.0E-12);
+    /*- Reuse a DFT grid built earlier in this process for the same geometry,
+    basis, and grid options (up to the last four grids, within a tenth of
+    the memory), instead of rebuilding it. The cache is emptied by clean(). !expert -*/
+    options.add_bool("DFT_GRID_CACHE", false);
+    /*- Also save DFT grids to, and look them up in, scratch file 65, so
+    that a retained file lets later runs skip grid construction. !expert -*/
+    options.add_bool("DFT_GRID_FILE", false);
+    /*- DFT shell-pair cutoff for the density and potential contractions of each
+    block of points. Shell pairs whose bound on their contribution is below it
+    are skipped; 0.0 keeps the contractions dense. !expert -*/
+    options.add_double("DFT_SHELL_PAIR_TOLERANCE", 1.0E-14);
     /*- The DFT grid specification, such as SG1.!expert -*/
     options.add_str("DFT_GRID_NAME","","SG0 SG1");
     /*- Pruning Scheme. !expert -*/
@@ -2785,6 +2851,12 @@ int read_options(const std::string &name, Options & options, bool suppress_print
     options.add_str("PPL_TYPE","AUTO","LOW_MEM HIGH_MEM CD AUTO");
     /*- The algorithm to handle (ia|bc) type integrals that used for (T) correction. -*/
     options.add_str("TRIPLES_IABC_TYPE","DISK","INCORE AUTO DIRECT DISK");
+    /*- The algorithm to handle (Q|ab) type integrals in DF-CCSD and DF-CCSD(T) energies. The DISK option streams
+    batches of them from disk, so that the memory does not have to hold them. -*/
+    options.add_str("BQAB_TYPE","AUTO","INCORE AUTO DISK");
+    /*- Caps the number of virtuals, auxiliary functions and occupieds per batch of the DISK algorithm for
+    (Q|ab) integrals. Zero leaves the batches as large as the memory allows. !expert -*/
+    options.add_int("BQAB_BATCH_MAX",0);
 
     /*- Do compute natural orbitals? -*/
     options.add_bool("NAT_ORBS",false);
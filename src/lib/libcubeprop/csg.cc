@@ -26,6 +26,7 @@
  */
 
 #include <boost/filesystem.hpp>
+#include <cstring>
 
 #include <psi4-dec.h>
 #include <libmints/mints.h>
@@ -169,7 +170,9 @@ void CubicScalarGrid::populate_grid()
     double xyz = pow((double) max_points, 1.0/3.0);
     nxyz_ = (size_t) pow((double) max_points, 1.0/3.0);
 
-    blocks_.clear();
+    // Tile starts and offsets, in the order the tiles are stored
+    std::vector<int> starts;
+    block_offsets_.clear();
     size_t offset = 0L;
     for (int istart = 0L; istart <= N_[0]; istart+=nxyz_) {
         int ni = (istart + nxyz_ > N_[0] ? (N_[0] + 1) - istart : nxyz_);
@@ -177,28 +180,48 @@ void CubicScalarGrid::populate_grid()
             int nj = (jstart + nxyz_ > N_[1] ? (N_[1] + 1) - jstart : nxyz_);
             for (int kstart = 0L; kstart <= N_[2]; kstart+=nxyz_) {
                 int nk = (kstart + nxyz_ > N_[2] ? (N_[2] + 1) - kstart : nxyz_);
+                starts.push_back(istart);
+                starts.push_back(jstart);
+                starts.push_back(kstart);
+                block_offsets_.push_back(offset);
+                offset += ni * (size_t) nj * nk;
+            }
+        }
+    }
 
-                double* xp = &x_[offset];
-                double* yp = &y_[offset];
-                double* zp = &z_[offset];
-                double* wp = &w_[offset];
-                
-                size_t block_size = 0L;
-                for (int i = istart; i < istart + ni; i++) {
-                    for (int j = jstart; j < jstart + nj; j++) {
-                        for (int k = kstart; k < kstart + nk; k++) {
-                            x_[offset] = O_[0] + i * D_[0];
-                            y_[offset] = O_[1] + j * D_[1];
-                            z_[offset] = O_[2] + k * D_[2];
-                            w_[offset] = D_[0] * D_[1] * D_[2];
-                            offset++;
-                            block_size++;
-                        }
-                    }
+    // Tiles are independent: fill the points and screen the shells of each in parallel
+    blocks_.clear();
+    blocks_.resize(block_offsets_.size());
+
+    #pragma omp parallel for schedule(dynamic)
+    for (int ind = 0; ind < blocks_.size(); ind++) {
+        int istart = starts[3 * ind + 0];
+        int jstart = starts[3 * ind + 1];
+        int kstart = starts[3 * ind + 2];
+        int ni = (istart + nxyz_ > N_[0] ? (N_[0] + 1) - istart : nxyz_);
+        int nj = (jstart + nxyz_ > N_[1] ? (N_[1] + 1) - jstart : nxyz_);
+        int nk = (kstart + nxyz_ > N_[2] ? (N_[2] + 1) - kstart : nxyz_);
+
+        size_t offset = block_offsets_[ind];
+        double* xp = &x_[offset];
+        double* yp = &y_[offset];
+        double* zp = &z_[offset];
+        double* wp = &w_[offset];
+
+        size_t block_size = 0L;
+        for (int i = istart; i < istart + ni; i++) {
+            for (int j = jstart; j < jstart + nj; j++) {
+                for (int k = kstart; k < kstart + nk; k++) {
+                    x_[offset] = O_[0] + i * D_[0];
+                    y_[offset] = O_[1] + j * D_[1];
+                    z_[offset] = O_[2] + k * D_[2];
+                    w_[offset] = D_[0] * D_[1] * D_[2];
+                    offset++;
+                    block_size++;
                 }
-                blocks_.push_back(boost::shared_ptr<BlockOPoints>(new BlockOPoints(block_size,xp,yp,zp,wp,extents_)));
             }
         }
+        blocks_[ind] = boost::shared_ptr<BlockOPoints>(new BlockOPoints(block_size,xp,yp,zp,wp,extents_));
     }
             
     int max_functions = 0L;
@@ -206,9 +229,45 @@ void CubicScalarGrid::populate_grid()
         max_functions = (max_functions >= blocks_[ind]->functions_local_to_global().size() ? 
             max_functions : blocks_[ind]->functions_local_to_global().size());
     }
- 
-    points_ = boost::shared_ptr<RKSFunctions>(new RKSFunctions(primary_,max_points,max_functions));
-    points_->set_ansatz(0);
+
+    int nthreads = 1;
+    #ifdef _OPENMP
+        nthreads = omp_get_max_threads();
+    #endif
+
+    points_.clear();
+    for (int thread = 0; thread < nthreads; thread++) {
+        points_.push_back(boost::shared_ptr<RKSFunctions>(new RKSFunctions(primary_,max_points,max_functions)));
+        points_[thread]->set_ansatz(0);
+    }
+}
+size_t CubicScalarGrid::fast_index(int i, int j, int k) const
+{
+    // Tiles are stored x-slab by x-slab, so everything before tile (I,J,K)
+    // is the full planes below istart, then the columns below jstart
+    // within the slab, then the rows below kstart within the column
+    size_t ny = N_[1] + 1L;
+    size_t nz = N_[2] + 1L;
+    int istart = (i / nxyz_) * nxyz_;
+    int jstart = (j / nxyz_) * nxyz_;
+    int kstart = (k / nxyz_) * nxyz_;
+    int ni = (istart + nxyz_ > N_[0] ? (N_[0] + 1) - istart : nxyz_);
+    int nj = (jstart + nxyz_ > N_[1] ? (N_[1] + 1) - jstart : nxyz_);
+    int nk = (kstart + nxyz_ > N_[2] ? (N_[2] + 1) - kstart : nxyz_);
+
+    return istart * ny * nz + ni * jstart * nz + ni * (size_t) nj * kstart +
+        (i - istart) * (size_t) nj * nk + (j - jstart) * (size_t) nk + (k - kstart);
+}
+void CubicScalarGrid::gather_plane(double* v, int i, double* plane) const
+{
+    size_t nz = N_[2] + 1L;
+    for (int j = 0; j <= N_[1]; j++) {
+        for (int kstart = 0; kstart <= N_[2]; kstart+=nxyz_) {
+            int nk = (kstart + nxyz_ > N_[2] ? (N_[2] + 1) - kstart : nxyz_);
+            // Each z run of a tile is contiguous in the fast ordering
+            ::memcpy(&plane[j * nz + kstart], &v[fast_index(i,j,kstart)], nk * sizeof(double));
+        }
+    }
 }
 void CubicScalarGrid::print_header()
 {
@@ -238,39 +297,16 @@ void CubicScalarGrid::write_gen_file(double* v, const std::string& name, const s
 {
     if (type == "CUBE") {
         write_cube_file(v, name);
+    } else if (type == "BINARY") {
+        write_binary_file(v, name);
     } else {
         throw PSIEXCEPTION("CubicScalarGrid: Unrecognized output file type");
     }
 }
-void CubicScalarGrid::write_cube_file(double* v, const std::string& name)
+FILE* CubicScalarGrid::open_file(const std::string& name, const std::string& ext, const char* mode)
 {
-    // => Reorder the grid <= //
-
-    double* v2 = new double[npoints_];
-    size_t offset = 0L;
-    for (int istart = 0L; istart <= N_[0]; istart+=nxyz_) {
-        int ni = (istart + nxyz_ > N_[0] ? (N_[0] + 1) - istart : nxyz_);
-        for (int jstart = 0L; jstart <= N_[1]; jstart+=nxyz_) {
-            int nj = (jstart + nxyz_ > N_[1] ? (N_[1] + 1) - jstart : nxyz_);
-            for (int kstart = 0L; kstart <= N_[2]; kstart+=nxyz_) {
-                int nk = (kstart + nxyz_ > N_[2] ? (N_[2] + 1) - kstart : nxyz_);
-                for (int i = istart; i < istart + ni; i++) {
-                    for (int j = jstart; j < jstart + nj; j++) {
-                        for (int k = kstart; k < kstart + nk; k++) {
-                            size_t index = i * (N_[1] + 1L) * (N_[2] + 1L) + j * (N_[2] + 1L) + k;
-                            v2[index] = v[offset];
-                            offset++;
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // => Drop the grid out <= //
-
     std::stringstream ss;
-    ss << filepath_ << "/" << name << ".cube";
+    ss << filepath_ << "/" << name << "." << ext;
 
     // Is filepath a valid directory?
     boost::filesystem::path data_dir(filepath_);
@@ -281,7 +317,11 @@ void CubicScalarGrid::write_cube_file(double* v, const std::string& name)
         exit(Failure);
     }
 
-    FILE* fh = fopen(ss.str().c_str(), "w");
+    return fopen(ss.str().c_str(), mode);
+}
+void CubicScalarGrid::write_cube_file(double* v, const std::string& name)
+{
+    FILE* fh = open_file(name, "cube", "w");
     // Two comment lines
     fprintf(fh, "Psi4 Gaussian Cube File.\n");
     fprintf(fh, "Property: %s\n", name.c_str());
@@ -299,26 +339,75 @@ void CubicScalarGrid::write_cube_file(double* v, const std::string& name)
         fprintf(fh, "%3d %10.6f %10.6f %10.6f %10.6f\n", (int) mol_->Z(A), 0.0, mol_->x(A), mol_->y(A), mol_->z(A));
     }
 
-    // Data, striped (x, y, z)
-    for (size_t ind = 0; ind < npoints_; ind++) {
-        fprintf(fh, "%12.5E ", v2[ind]);
-        if (ind % 6 == 5) fprintf(fh,"\n");
+    // Data, striped (x, y, z), reordered one x plane at a time
+    size_t nplane = (N_[1] + 1L) * (N_[2] + 1L);
+    std::vector<double> plane(nplane);
+    size_t ind = 0L;
+    for (int i = 0; i <= N_[0]; i++) {
+        gather_plane(v, i, &plane[0]);
+        for (size_t P = 0; P < nplane; P++, ind++) {
+            fprintf(fh, "%12.5E ", plane[P]);
+            if (ind % 6 == 5) fprintf(fh,"\n");
+        }
+    }
+
+    fclose(fh);
+}
+void CubicScalarGrid::write_binary_file(double* v, const std::string& name)
+{
+    // Layout (native endianness):
+    //   char[8]  "PSI4BCUB"
+    //   int[4]   natom, N_x + 1, N_y + 1, N_z + 1
+    //   double[6] O_x, O_y, O_z, D_x, D_y, D_z
+    //   double[4 natom] (Z, x, y, z) of each atom
+    //   float[npoints] data, striped (x, y, z)
+    FILE* fh = open_file(name, "bcube", "wb");
+
+    fwrite("PSI4BCUB", sizeof(char), 8, fh);
+    int dims[4] = {mol_->natom(), N_[0] + 1, N_[1] + 1, N_[2] + 1};
+    fwrite(dims, sizeof(int), 4, fh);
+    fwrite(O_, sizeof(double), 3, fh);
+    fwrite(D_, sizeof(double), 3, fh);
+    for (int A = 0; A < mol_->natom(); A++) {
+        double atom[4] = {mol_->Z(A), mol_->x(A), mol_->y(A), mol_->z(A)};
+        fwrite(atom, sizeof(double), 4, fh);
+    }
+
+    // Single precision carries the five digits of the text cube in half the space
+    size_t nplane = (N_[1] + 1L) * (N_[2] + 1L);
+    std::vector<double> plane(nplane);
+    std::vector<float> plane_sp(nplane);
+    for (int i = 0; i <= N_[0]; i++) {
+        gather_plane(v, i, &plane[0]);
+        for (size_t P = 0; P < nplane; P++) {
+            plane_sp[P] = (float) plane[P];
+        }
+        fwrite(&plane_sp[0], sizeof(float), nplane, fh);
     }
 
     fclose(fh);
 }
 void CubicScalarGrid::add_density(double* v, boost::shared_ptr<Matrix> D)
 {
-    points_->set_pointers(D);
-    boost::shared_ptr<Vector> rho = points_->point_value("RHO_A");
-    double* rhop = rho->pointer();
+    for (int thread = 0; thread < points_.size(); thread++) {
+        points_[thread]->set_pointers(D);
+    }
 
-    size_t offset = 0L;
+    #pragma omp parallel for schedule(dynamic) num_threads(points_.size())
     for (int ind = 0; ind < blocks_.size(); ind++) {
-        points_->compute_points(blocks_[ind]);
+
+        int thread = 0;
+        #ifdef _OPENMP
+            thread = omp_get_thread_num();
+        #endif
+
+        // No significant functions: the tile contributes nothing
+        if (blocks_[ind]->functions_local_to_global().size() == 0) continue;
+
+        points_[thread]->compute_points(blocks_[ind]);
+        double* rhop = points_[thread]->point_value("RHO_A")->pointer();
         size_t npoints = blocks_[ind]->npoints();
-        C_DAXPY(npoints,1.0,rhop,1,&v[offset],1);        
-        offset += npoints;
+        C_DAXPY(npoints,1.0,rhop,1,&v[block_offsets_[ind]],1);        
     }
 }
 void CubicScalarGrid::add_esp(double* v, boost::shared_ptr<Matrix> D, const std::vector<double>& nuc_weights)
@@ -512,65 +601,90 @@ void CubicScalarGrid::add_esp(double* v, boost::shared_ptr<Matrix> D, const std:
 }
 void CubicScalarGrid::add_basis_functions(double** v, const std::vector<int>& indices)
 {
-    boost::shared_ptr<Matrix> phi = points_->basis_value("PHI");
-    double** phip = phi->pointer();
+    // Position of each basis function in indices, or -1
+    std::vector<int> requested(primary_->nbf(), -1);
+    for (int ind1 = 0; ind1 < indices.size(); ind1++) {
+        requested[indices[ind1]] = ind1;
+    }
 
-    size_t offset = 0L;
+    #pragma omp parallel for schedule(dynamic) num_threads(points_.size())
     for (int ind = 0; ind < blocks_.size(); ind++) {
-        points_->compute_functions(blocks_[ind]);
 
-        size_t npoints = blocks_[ind]->npoints();
+        int thread = 0;
+        #ifdef _OPENMP
+            thread = omp_get_thread_num();
+        #endif
+
         const std::vector<int>& function_map = blocks_[ind]->functions_local_to_global();
         int nlocal  = function_map.size();
-        int nglobal = points_->max_functions();
+        if (nlocal == 0) continue;
 
-        for (int ind1 = 0; ind1 < indices.size(); ind1++) {
-            for (int ind2 = 0; ind2 < function_map.size(); ind2++) {
-                if (indices[ind1] == function_map[ind2]) {
-                    C_DAXPY(npoints,1.0,&phip[0][ind2],nglobal,&v[ind1][offset],1);
-                }                
-            }
-        }
+        points_[thread]->compute_functions(blocks_[ind]);
+        double** phip = points_[thread]->basis_value("PHI")->pointer();
 
-        offset += npoints;
+        size_t npoints = blocks_[ind]->npoints();
+        size_t offset = block_offsets_[ind];
+        int nglobal = points_[thread]->max_functions();
+
+        for (int ind2 = 0; ind2 < nlocal; ind2++) {
+            int ind1 = requested[function_map[ind2]];
+            if (ind1 < 0) continue;
+            C_DAXPY(npoints,1.0,&phip[0][ind2],nglobal,&v[ind1][offset],1);
+        }
     }
 }
 void CubicScalarGrid::add_orbitals(double** v, boost::shared_ptr<Matrix> C)
 {
     int na = C->colspi()[0];    
 
-    points_->set_Cs(C);
-    boost::shared_ptr<Matrix> psi = points_->orbital_value("PSI_A");
-    double** psip = psi->pointer();
+    // All orbitals of a tile come from one GEMM against its collocation matrix
+    for (int thread = 0; thread < points_.size(); thread++) {
+        points_[thread]->set_Cs(C);
+    }
 
-    size_t offset = 0L;
+    #pragma omp parallel for schedule(dynamic) num_threads(points_.size())
     for (int ind = 0; ind < blocks_.size(); ind++) {
-        points_->compute_orbitals(blocks_[ind]);
+
+        int thread = 0;
+        #ifdef _OPENMP
+            thread = omp_get_thread_num();
+        #endif
+
+        if (blocks_[ind]->functions_local_to_global().size() == 0) continue;
+
+        points_[thread]->compute_orbitals(blocks_[ind]);
+        double** psip = points_[thread]->orbital_value("PSI_A")->pointer();
 
         size_t npoints = blocks_[ind]->npoints();
+        size_t offset = block_offsets_[ind];
         for (int a = 0; a < na; a++) {
             C_DAXPY(npoints,1.0,psip[a],1,&v[a][offset],1);
         }    
-
-        offset += npoints;
     }
 }
 void CubicScalarGrid::add_LOL(double* v, boost::shared_ptr<Matrix> D)
 {
-    points_->set_ansatz(2);
-    points_->set_pointers(D);
-
-    boost::shared_ptr<Vector> rho = points_->point_value("RHO_A");
-    boost::shared_ptr<Vector> tau = points_->point_value("TAU_A");
-    double* rhop = rho->pointer();
-    double* taup = tau->pointer();
+    for (int thread = 0; thread < points_.size(); thread++) {
+        points_[thread]->set_ansatz(2);
+        points_[thread]->set_pointers(D);
+    }
 
     double C = 3.0 / 5.0 * pow(6.0 * M_PI * M_PI, 2.0 / 3.0);
 
-    size_t offset = 0L;
+    #pragma omp parallel for schedule(dynamic) num_threads(points_.size())
     for (int ind = 0; ind < blocks_.size(); ind++) {
-        points_->compute_points(blocks_[ind]);
+
+        int thread = 0;
+        #ifdef _OPENMP
+            thread = omp_get_thread_num();
+        #endif
+
+        points_[thread]->compute_points(blocks_[ind]);
+        double* rhop = points_[thread]->point_value("RHO_A")->pointer();
+        double* taup = points_[thread]->point_value("TAU_A")->pointer();
+
         size_t npoints = blocks_[ind]->npoints();
+        size_t offset = block_offsets_[ind];
         for (int P = 0; P < npoints; P++) {
             double tau_LSDA = C * pow(rhop[P], 5.0 / 3.0);
             double tau_EX   = taup[P];
@@ -578,29 +692,36 @@ void CubicScalarGrid::add_LOL(double* v, boost::shared_ptr<Matrix> D)
             double v2 = (fabs(tau_EX / tau_LSDA) < 1.0E-15 ? 1.0 : t / (1.0 + t));
             v[P + offset] += v2;
         }
-        offset += npoints;
     }
     
-    points_->set_ansatz(0);
+    for (int thread = 0; thread < points_.size(); thread++) {
+        points_[thread]->set_ansatz(0);
+    }
 }
 void CubicScalarGrid::add_ELF(double* v, boost::shared_ptr<Matrix> D)
 {
-    points_->set_ansatz(2);
-    points_->set_pointers(D);
-
-    boost::shared_ptr<Vector> rho = points_->point_value("RHO_A");
-    boost::shared_ptr<Vector> gam = points_->point_value("GAMMA_AA");
-    boost::shared_ptr<Vector> tau = points_->point_value("TAU_A");
-    double* rhop = rho->pointer();
-    double* gamp = gam->pointer();
-    double* taup = tau->pointer();
+    for (int thread = 0; thread < points_.size(); thread++) {
+        points_[thread]->set_ansatz(2);
+        points_[thread]->set_pointers(D);
+    }
 
     double C = 3.0 / 5.0 * pow(6.0 * M_PI * M_PI, 2.0 / 3.0);
 
-    size_t offset = 0L;
+    #pragma omp parallel for schedule(dynamic) num_threads(points_.size())
     for (int ind = 0; ind < blocks_.size(); ind++) {
-        points_->compute_points(blocks_[ind]);
+
+        int thread = 0;
+        #ifdef _OPENMP
+            thread = omp_get_thread_num();
+        #endif
+
+        points_[thread]->compute_points(blocks_[ind]);
+        double* rhop = points_[thread]->point_value("RHO_A")->pointer();
+        double* gamp = points_[thread]->point_value("GAMMA_AA")->pointer();
+        double* taup = points_[thread]->point_value("TAU_A")->pointer();
+
         size_t npoints = blocks_[ind]->npoints();
+        size_t offset = block_offsets_[ind];
         for (int P = 0; P < npoints; P++) {
             double tau_LSDA = C * pow(rhop[P], 5.0 / 3.0);
             double tau_EX   = taup[P];
@@ -610,10 +731,11 @@ void CubicScalarGrid::add_ELF(double* v, boost::shared_ptr<Matrix> D)
             double v2 = (fabs(D_LSDA / D_EX) < 1.0E-15 ? 0.0 : 1.0 / (1.0 + B * B));
             v[P + offset] += v2;
         }
-        offset += npoints;
     }
     
-    points_->set_ansatz(0);
+    for (int thread = 0; thread < points_.size(); thread++) {
+        points_[thread]->set_ansatz(0);
+    }
 }
 void CubicScalarGrid::compute_density(boost::shared_ptr<Matrix> D, const std::string& name, const std::string& type)
 {
@@ -28,8 +28,10 @@
 #ifndef _psi_src_lib_libcubeprop_csg_h_
 #define _psi_src_lib_libcubeprop_csg_h_
 
+#include <cstdio>
 #include <map>
 #include <set>
+#include <vector>
 
 #include <libmints/typedefs.h>
 
@@ -84,13 +86,21 @@ protected:
     std::vector<boost::shared_ptr<BlockOPoints> > blocks_;
     /// Points to basis extents, built internally
     boost::shared_ptr<BasisExtents> extents_;
-    /// RKS points object
-    boost::shared_ptr<RKSFunctions> points_;
+    /// Offset of the first point of each block in the fast ordering
+    std::vector<size_t> block_offsets_;
+    /// RKS points objects, one per thread
+    std::vector<boost::shared_ptr<RKSFunctions> > points_;
 
     // => Helper Routines <= //
 
     /// Setup grid from info in N_, D_, O_
     void populate_grid();
+    /// Index of point (i,j,k) in the fast (blocked) ordering
+    size_t fast_index(int i, int j, int k) const;
+    /// Gather the x = i plane of v (fast ordering) into plane, striped (y, z)
+    void gather_plane(double* v, int i, double* plane) const;
+    /// Open filepath/name.ext for writing, exiting if filepath is not a directory
+    FILE* open_file(const std::string& name, const std::string& ext, const char* mode);
 
 public:
     // => Constructors <= //
@@ -147,6 +157,8 @@ public:
     void write_gen_file(double* v, const std::string& name, const std::string& type);
     /// Write a Gaussian cube file of the scalar field v (in fast ordering) to filepath/name.cube
     void write_cube_file(double* v, const std::string& name);
+    /// Write a binary cube file of the scalar field v (in fast ordering) to filepath/name.bcube
+    void write_binary_file(double* v, const std::string& name);
     
     // => Low-Level Scalar Field Computation (Use only if you know what you are doing) <= //
 
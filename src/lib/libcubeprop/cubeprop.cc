@@ -199,28 +199,28 @@ void CubeProperties::compute_properties()
 }
 void CubeProperties::compute_density(boost::shared_ptr<Matrix> D, const std::string& key)
 {
-    grid_->compute_density(D, key);
+    grid_->compute_density(D, key, options_.get_str("CUBEPROP_FORMAT"));
 }
 void CubeProperties::compute_esp(boost::shared_ptr<Matrix> Dt, const std::vector<double>& w)
 {
-    grid_->compute_density(Dt, "Dt");
-    grid_->compute_esp(Dt, w, "ESP");
+    grid_->compute_density(Dt, "Dt", options_.get_str("CUBEPROP_FORMAT"));
+    grid_->compute_esp(Dt, w, "ESP", options_.get_str("CUBEPROP_FORMAT"));
 }
 void CubeProperties::compute_orbitals(boost::shared_ptr<Matrix> C, const std::vector<int>& indices, const std::vector<std::string>& labels, const std::string& key)
 {
-    grid_->compute_orbitals(C, indices, labels, key);
+    grid_->compute_orbitals(C, indices, labels, key, options_.get_str("CUBEPROP_FORMAT"));
 }
 void CubeProperties::compute_basis_functions(const std::vector<int>& indices, const std::string& key)
 {
-    grid_->compute_basis_functions(indices, key);
+    grid_->compute_basis_functions(indices, key, options_.get_str("CUBEPROP_FORMAT"));
 }
 void CubeProperties::compute_LOL(boost::shared_ptr<Matrix> D, const std::string& key)
 {
-    grid_->compute_LOL(D, key);
+    grid_->compute_LOL(D, key, options_.get_str("CUBEPROP_FORMAT"));
 }
 void CubeProperties::compute_ELF(boost::shared_ptr<Matrix> D, const std::string& key)
 {
-    grid_->compute_ELF(D, key);
+    grid_->compute_ELF(D, key, options_.get_str("CUBEPROP_FORMAT"));
 }
 
 }
\ No newline at end of file
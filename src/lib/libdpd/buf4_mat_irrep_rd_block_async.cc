@@ -0,0 +1,197 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2016 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+/*! \file
+    \ingroup DPD
+    \brief Asynchronous (prefetched) reads and writes of dpdbuf4 row blocks
+*/
+#include <cstdio>
+#include <boost/shared_ptr.hpp>
+#include <libpsio/psio.h>
+#include <libpsio/psio.hpp>
+#include <libpsio/aiohandler.h>
+#include "dpd.h"
+
+namespace psi {
+
+namespace {
+
+/* One AIOHandler serves all asynchronous DPD I/O.  It is created on first use. */
+boost::shared_ptr<AIOHandler> dpd_aio;
+
+}
+
+/* buf4_mat_irrep_async_ok(): Returns 1 if row blocks of Buf can be
+** read asynchronously with buf4_mat_irrep_rd_block_async().  This
+** requires that prefetching is enabled (see dpd_set_prefetch()), that
+** the buffer is stored on disk exactly as it is laid out in core (no
+** packing, unpacking, or antisymmetrization on the way in), and that the
+** file is not already held in the cache.
+*/
+
+int DPD::buf4_mat_irrep_async_ok(dpdbuf4 *Buf)
+{
+    if(!dpd_main.prefetch) return 0;
+    if(Buf->anti) return 0;
+    if(Buf->file.incore) return 0;
+
+    return (Buf->params->perm_pq == Buf->file.params->perm_pq) &&
+            (Buf->params->perm_rs == Buf->file.params->perm_rs) &&
+            (Buf->params->peq == Buf->file.params->peq) &&
+            (Buf->params->res == Buf->file.params->res);
+}
+
+/* buf4_mat_irrep_rd_block_async(): Starts a read of num_pq rows of
+** symmetry block irrep of Buf, beginning with row start_pq, into the
+** caller's block.  block must hold at least num_pq rows, and neither it
+** nor Buf may be touched until buf4_mat_irrep_rd_block_wait() has
+** returned for the id handed back here.
+**
+** If buf4_mat_irrep_async_ok() is false, the read is done synchronously
+** with buf4_mat_irrep_rd_block() and 0 is returned, so callers can use
+** the same double-buffered loop either way.
+**
+** While a read is in flight the I/O thread owns its file: the caller
+** must not issue any other PSIO (or DPD I/O) calls until it has waited,
+** except for further asynchronous reads and writes of this family, which
+** the AIOHandler orders against each other.  Out-of-core loops therefore
+** start the read of bucket n+1, do the arithmetic on bucket n, and wait
+** before any further synchronous I/O.
+*/
+
+unsigned long int DPD::buf4_mat_irrep_rd_block_async(dpdbuf4 *Buf, int irrep,
+                                                     int start_pq, int num_pq,
+                                                     double **block)
+{
+    int coltot, seek_block;
+    long int size;
+    double **matrix;
+    psio_address irrep_ptr;
+
+    if(!buf4_mat_irrep_async_ok(Buf)) {
+        matrix = Buf->matrix[irrep];
+        Buf->matrix[irrep] = block;
+        buf4_mat_irrep_rd_block(Buf, irrep, start_pq, num_pq);
+        Buf->matrix[irrep] = matrix;
+        return 0;
+    }
+
+    coltot = Buf->file.params->coltot[irrep^(Buf->file.my_irrep)];
+    size = ((long) num_pq) * ((long) coltot);
+    if(!size) return 0;
+
+    /* Same address arithmetic as file4_mat_irrep_rd_block() */
+    irrep_ptr = Buf->file.lfiles[irrep];
+    seek_block = DPD_BIGNUM/(coltot * sizeof(double));
+    if(seek_block < 1) {
+        outfile->Printf( "\nLIBDPD Error: each row of %s is too long to compute an address.\n",
+                         Buf->file.label);
+        dpd_error("dpd_buf4_mat_irrep_rd_block_async", "outfile");
+    }
+    for(; start_pq > seek_block; start_pq -= seek_block)
+        irrep_ptr = psio_get_address(irrep_ptr, seek_block*coltot*sizeof(double));
+    irrep_ptr = psio_get_address(irrep_ptr, start_pq*coltot*sizeof(double));
+
+    if(!dpd_aio) dpd_aio = boost::shared_ptr<AIOHandler>(new AIOHandler(_default_psio_lib_));
+
+    return dpd_aio->read(Buf->file.filenum, Buf->file.label, (char *) block[0],
+                         size * ((long) sizeof(double)), irrep_ptr, NULL);
+}
+
+/* buf4_mat_irrep_wrt_block_async(): Starts a write of num_pq rows of
+** symmetry block irrep of Buf, beginning with row start_pq, from the
+** caller's block.  This is the write-side twin of
+** buf4_mat_irrep_rd_block_async(): block must not be touched until
+** buf4_mat_irrep_wrt_block_wait() has returned for the id handed back,
+** and if buf4_mat_irrep_async_ok() is false the write is done
+** synchronously with buf4_mat_irrep_wrt_block() and 0 is returned.
+**
+** Writes to one file are carried out in the order they were started,
+** and may overlap reads of another file started with
+** buf4_mat_irrep_rd_block_async().
+*/
+
+unsigned long int DPD::buf4_mat_irrep_wrt_block_async(dpdbuf4 *Buf, int irrep,
+                                                      int start_pq, int num_pq,
+                                                      double **block)
+{
+    int coltot, seek_block;
+    long int size;
+    double **matrix;
+    psio_address irrep_ptr;
+
+    if(!buf4_mat_irrep_async_ok(Buf)) {
+        matrix = Buf->matrix[irrep];
+        Buf->matrix[irrep] = block;
+        buf4_mat_irrep_wrt_block(Buf, irrep, start_pq, num_pq);
+        Buf->matrix[irrep] = matrix;
+        return 0;
+    }
+
+    coltot = Buf->file.params->coltot[irrep^(Buf->file.my_irrep)];
+    size = ((long) num_pq) * ((long) coltot);
+    if(!size) return 0;
+
+    /* Same address arithmetic as file4_mat_irrep_wrt_block() */
+    irrep_ptr = Buf->file.lfiles[irrep];
+    seek_block = DPD_BIGNUM/(coltot * sizeof(double));
+    if(seek_block < 1) {
+        outfile->Printf( "\nLIBDPD Error: each row of %s is too long to compute an address.\n",
+                         Buf->file.label);
+        dpd_error("dpd_buf4_mat_irrep_wrt_block_async", "outfile");
+    }
+    for(; start_pq > seek_block; start_pq -= seek_block)
+        irrep_ptr = psio_get_address(irrep_ptr, seek_block*coltot*sizeof(double));
+    irrep_ptr = psio_get_address(irrep_ptr, start_pq*coltot*sizeof(double));
+
+    if(!dpd_aio) dpd_aio = boost::shared_ptr<AIOHandler>(new AIOHandler(_default_psio_lib_));
+
+    return dpd_aio->write(Buf->file.filenum, Buf->file.label, (char *) block[0],
+                          size * ((long) sizeof(double)), irrep_ptr, NULL);
+}
+
+/* buf4_mat_irrep_rd_block_wait(): Blocks until the read started by
+** buf4_mat_irrep_rd_block_async() with the given id has completed.  An
+** id of 0 (a synchronous read) returns at once.
+*/
+
+void DPD::buf4_mat_irrep_rd_block_wait(unsigned long int jobid)
+{
+    if(jobid && dpd_aio) dpd_aio->wait_for_job(jobid);
+}
+
+/* buf4_mat_irrep_wrt_block_wait(): Blocks until the write started by
+** buf4_mat_irrep_wrt_block_async() with the given id has reached the
+** file.  An id of 0 (a synchronous write) returns at once.
+*/
+
+void DPD::buf4_mat_irrep_wrt_block_wait(unsigned long int jobid)
+{
+    if(jobid && dpd_aio) dpd_aio->wait_for_job(jobid);
+}
+
+}
@@ -106,15 +106,20 @@ namespace psi {
 ** sqrp: IC     ** sqpr: none
 ** srqp: IC     ** srpq: IC
 ** spqr: IC     ** sprq: IC
-** -RAK, Nov. 2005*/
+** -RAK, Nov. 2005
+**
+** All in-core orderings (now including sqpr) are handled by the
+** threaded, tiled kernel buf4_sort_incore().  The switch below is
+** reached only for the out-of-core algorithms.
+*/
 
 int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                     int pqnum, int rsnum, const char *label)
 {
-    int h,nirreps, row, col, my_irrep, r_irrep;
-    int p, q, r, s, P, Q, R, S, pq, rs, sr, pr, qs, qp, rq, qr, ps, sp, rp, sq;
+    int h, nirreps, my_irrep;
+    int p, q, r, s, pq, rs, sr, pr, qs, qp, qr, ps;
     int PQ, RS;
-    int Gp, Gq, Gr, Gs, Gpq, Grs, Gpr, Gqs, Grq, Gqr, Gps, Gsp, Grp, Gsq;
+    int Gp, Gr, Gs, Gpq, Grs, Gpr, Gps;
     dpdbuf4 OutBuf;
     int incore;
     long int rowtot, coltot, core_total, maxrows;
@@ -122,6 +127,9 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
     int out_rows_per_bucket, out_nbuckets, out_rows_left, out_row_start, n;
     int in_rows_per_bucket, in_nbuckets, in_rows_left, in_row_start, m;
     int rows_per_bucket, nbuckets, rows_left;
+    int row_start, nrows, next_rows, prefetch;
+    unsigned long int jobid;
+    double **InBlock[2];
 
     nirreps = InBuf->params->nirreps;
     my_irrep = InBuf->file.my_irrep;
@@ -191,79 +199,65 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
         }
     }
 
-    switch(index) {
-    case pqrs:
-        outfile->Printf( "\nDPD sort error: invalid index ordering.\n");
-        dpd_error("buf_sort", "outfile");
-        break;
+    if(incore && index != pqrs) {
+        buf4_sort_incore(InBuf, &OutBuf, index, 1.0, 0);
+    }
+    else {
+        switch(index) {
+        case pqrs:
+            outfile->Printf( "\nDPD sort error: invalid index ordering.\n");
+            dpd_error("buf_sort", "outfile");
+            break;
 
-    case pqsr:
+        case pqsr:
 
 #ifdef DPD_TIMER
-        timer_on("pqsr");
+            timer_on("pqsr");
 #endif
 
-        /* p->p; q->q; s->r; r->s = pqsr */
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
-
-                    row = InBuf->params->rowidx[p][q];
-
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
-
-                        sr = InBuf->params->colidx[s][r];
-
-                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[h][row][sr];
-                    }
-                }
-            }
-        }
-        else { /* out-of-core pqsr -> pqrs */
+            /* p->p; q->q; s->r; r->s = pqsr */
+            /* out-of-core pqsr -> pqrs */
 
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq ^ my_irrep;
-                rows_per_bucket = dpd_memfree()/ 2 / InBuf->params->coltot[Grs];
+                if(!InBuf->params->rowtot[Gpq] || !InBuf->params->coltot[Grs]) continue;
+
+                /* With prefetching, a second input bucket is read while
+                   the current one is sorted, so the core is split three ways */
+                prefetch = buf4_mat_irrep_async_ok(InBuf);
+                rows_per_bucket = dpd_memfree()/ (prefetch ? 3 : 2) / InBuf->params->coltot[Grs];
 
                 if(rows_per_bucket > InBuf->params->rowtot[Gpq])
                     rows_per_bucket = InBuf->params->rowtot[Gpq];
                 if(!rows_per_bucket) dpd_error("buf4_sort_pqsr: Not enough memory for one row!", "outfile");
 
                 nbuckets = (int) ceil(((double) InBuf->params->rowtot[Gpq])/((double) rows_per_bucket));
-                if(nbuckets == 1) rows_left = rows_per_bucket;
-                else rows_left = InBuf->params->rowtot[Gpq] % rows_per_bucket;
+                if(nbuckets == 1) prefetch = 0;
 
                 buf4_mat_irrep_init_block(InBuf, Gpq, rows_per_bucket);
                 buf4_mat_irrep_init_block(&OutBuf, Gpq, rows_per_bucket);
-
-                for(n=0; n < (rows_left ? nbuckets-1 : nbuckets); n++) {
-
-                    buf4_mat_irrep_rd_block(InBuf, Gpq, n*rows_per_bucket, rows_per_bucket);
-
-                    for(pq=0; pq < rows_per_bucket; pq++) {
-                        for(rs=0; rs < OutBuf.params->coltot[Grs]; rs++) {
-                            r = OutBuf.params->colorb[Grs][rs][0];
-                            s = OutBuf.params->colorb[Grs][rs][1];
-
-                            sr = InBuf->params->colidx[s][r];
-
-                            OutBuf.matrix[Gpq][pq][rs] = InBuf->matrix[Gpq][pq][sr];
-                        }
+                InBlock[0] = InBuf->matrix[Gpq];
+                InBlock[1] = prefetch ? dpd_block_matrix(rows_per_bucket, InBuf->params->coltot[Grs]) : InBlock[0];
+
+                jobid = 0;
+                for(n=0; n < nbuckets; n++) {
+                    row_start = n*rows_per_bucket;
+                    nrows = InBuf->params->rowtot[Gpq] - row_start;
+                    if(nrows > rows_per_bucket) nrows = rows_per_bucket;
+
+                    if(n == 0 || !prefetch)
+                        jobid = buf4_mat_irrep_rd_block_async(InBuf, Gpq, row_start, nrows, InBlock[n%2]);
+                    buf4_mat_irrep_rd_block_wait(jobid);
+                    InBuf->matrix[Gpq] = InBlock[n%2];
+
+                    if(prefetch && n < (nbuckets-1)) {
+                        next_rows = InBuf->params->rowtot[Gpq] - row_start - rows_per_bucket;
+                        if(next_rows > rows_per_bucket) next_rows = rows_per_bucket;
+                        jobid = buf4_mat_irrep_rd_block_async(InBuf, Gpq, row_start + rows_per_bucket,
+                                                              next_rows, InBlock[(n+1)%2]);
                     }
 
-                    buf4_mat_irrep_wrt_block(&OutBuf, Gpq, n*rows_per_bucket, rows_per_bucket);
-                }
-                if(rows_left) {
-
-                    buf4_mat_irrep_rd_block(InBuf, Gpq, n*rows_per_bucket, rows_left);
-
-                    for(pq=0; pq < rows_left; pq++) {
+                    for(pq=0; pq < nrows; pq++) {
                         for(rs=0; rs < OutBuf.params->coltot[Grs]; rs++) {
                             r = OutBuf.params->colorb[Grs][rs][0];
                             s = OutBuf.params->colorb[Grs][rs][1];
@@ -274,64 +268,30 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                         }
                     }
 
-                    buf4_mat_irrep_wrt_block(&OutBuf, Gpq, n*rows_per_bucket, rows_left);
+                    /* The write must not race the read of the next bucket */
+                    buf4_mat_irrep_rd_block_wait(jobid);
+                    buf4_mat_irrep_wrt_block(&OutBuf, Gpq, row_start, nrows);
                 }
 
+                InBuf->matrix[Gpq] = InBlock[0];
+                if(prefetch) free_dpd_block(InBlock[1], rows_per_bucket, InBuf->params->coltot[Grs]);
                 buf4_mat_irrep_close_block(InBuf, Gpq, rows_per_bucket);
                 buf4_mat_irrep_close_block(&OutBuf, Gpq, rows_per_bucket);
             }
-        }
 
 #ifdef DPD_TIMER
-        timer_off("pqsr");
+            timer_off("pqsr");
 #endif
-        break;
+            break;
 
-    case prqs:
+        case prqs:
 
 #ifdef DPD_TIMER
-        timer_on("prqs");
+            timer_on("prqs");
 #endif
 
-        /* p->p; r->q; q->r; s->s = prqs */
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        /* Irreps on the source */
-                        Gpr = Gp^Gr;  Gqs = Gq^Gs;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    pr = InBuf->params->rowidx[P][R];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        qs = InBuf->params->colidx[Q][S];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Gpr][pr][qs];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else { /* pqrs <- prqs */
+            /* p->p; r->q; q->r; s->s = prqs */
+            /* pqrs <- prqs */
 
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq^my_irrep;
@@ -374,7 +334,6 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                                 p = OutBuf.params->roworb[Gpq][pq+out_row_start][0];
                                 q = OutBuf.params->roworb[Gpq][pq+out_row_start][1];
                                 Gp = OutBuf.params->psym[p];
-                                Gq = Gpq^Gp;
                                 for(rs=0; rs < OutBuf.params->coltot[Grs]; rs++) {
                                     r = OutBuf.params->colorb[Grs][rs][0];
                                     s = OutBuf.params->colorb[Grs][rs][1];
@@ -403,7 +362,6 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                                 p = OutBuf.params->roworb[Gpq][pq+out_row_start][0];
                                 q = OutBuf.params->roworb[Gpq][pq+out_row_start][1];
                                 Gp = OutBuf.params->psym[p];
-                                Gq = Gpq^Gp;
                                 for(rs=0; rs < OutBuf.params->coltot[Grs]; rs++) {
                                     r = OutBuf.params->colorb[Grs][rs][0];
                                     s = OutBuf.params->colorb[Grs][rs][1];
@@ -454,7 +412,6 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                                 p = OutBuf.params->roworb[Gpq][pq+out_row_start][0];
                                 q = OutBuf.params->roworb[Gpq][pq+out_row_start][1];
                                 Gp = OutBuf.params->psym[p];
-                                Gq = Gpq^Gp;
                                 for(rs=0; rs < OutBuf.params->coltot[Grs]; rs++) {
                                     r = OutBuf.params->colorb[Grs][rs][0];
                                     s = OutBuf.params->colorb[Grs][rs][1];
@@ -483,7 +440,6 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                                 p = OutBuf.params->roworb[Gpq][pq+out_row_start][0];
                                 q = OutBuf.params->roworb[Gpq][pq+out_row_start][1];
                                 Gp = OutBuf.params->psym[p];
-                                Gq = Gpq^Gp;
                                 for(rs=0; rs < OutBuf.params->coltot[Grs]; rs++) {
                                     r = OutBuf.params->colorb[Grs][rs][0];
                                     s = OutBuf.params->colorb[Grs][rs][1];
@@ -511,57 +467,20 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
 
                 buf4_mat_irrep_close_block(&OutBuf, Gpq, out_rows_per_bucket);
             }
-        }
 
 #ifdef DPD_TIMER
-        timer_off("prqs");
+            timer_off("prqs");
 #endif
-        break;
+            break;
 
-    case prsq:
+        case prsq:
 
 #ifdef DPD_TIMER
-        timer_on("prsq");
+            timer_on("prsq");
 #endif
 
-        /* p->p; r->q; s->r; q->s = psqr */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gps = Gp^Gs;  Gqr = Gq^Gr;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
+            /* p->p; r->q; s->r; q->s = psqr */
 
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    qr = InBuf->params->colidx[Q][R];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        ps = InBuf->params->rowidx[P][S];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Gps][ps][qr];
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq^my_irrep;
 
@@ -603,7 +522,6 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                                 p = OutBuf.params->roworb[Gpq][pq+out_row_start][0];
                                 q = OutBuf.params->roworb[Gpq][pq+out_row_start][1];
                                 Gp = OutBuf.params->psym[p];
-                                Gq = Gpq^Gp;
                                 for(rs=0; rs < OutBuf.params->coltot[Grs]; rs++) {
                                     r = OutBuf.params->colorb[Grs][rs][0];
                                     s = OutBuf.params->colorb[Grs][rs][1];
@@ -632,7 +550,6 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                                 p = OutBuf.params->roworb[Gpq][pq+out_row_start][0];
                                 q = OutBuf.params->roworb[Gpq][pq+out_row_start][1];
                                 Gp = OutBuf.params->psym[p];
-                                Gq = Gpq^Gp;
                                 for(rs=0; rs < OutBuf.params->coltot[Grs]; rs++) {
                                     r = OutBuf.params->colorb[Grs][rs][0];
                                     s = OutBuf.params->colorb[Grs][rs][1];
@@ -683,7 +600,6 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                                 p = OutBuf.params->roworb[Gpq][pq+out_row_start][0];
                                 q = OutBuf.params->roworb[Gpq][pq+out_row_start][1];
                                 Gp = OutBuf.params->psym[p];
-                                Gq = Gpq^Gp;
                                 for(rs=0; rs < OutBuf.params->coltot[Grs]; rs++) {
                                     r = OutBuf.params->colorb[Grs][rs][0];
                                     s = OutBuf.params->colorb[Grs][rs][1];
@@ -713,7 +629,6 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                                 p = OutBuf.params->roworb[Gpq][pq+out_row_start][0];
                                 q = OutBuf.params->roworb[Gpq][pq+out_row_start][1];
                                 Gp = OutBuf.params->psym[p];
-                                Gq = Gpq^Gp;
                                 for(rs=0; rs < OutBuf.params->coltot[Grs]; rs++) {
                                     r = OutBuf.params->colorb[Grs][rs][0];
                                     s = OutBuf.params->colorb[Grs][rs][1];
@@ -742,151 +657,52 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
 
                 buf4_mat_irrep_close_block(&OutBuf, Gpq, out_rows_per_bucket);
             }
-        }
 
 #ifdef DPD_TIMER
-        timer_off("prsq");
+            timer_off("prsq");
 #endif
-        break;
+            break;
 
-    case psqr:
+        case psqr:
 
 #ifdef DPD_TIMER
-        timer_on("psqr");
+            timer_on("psqr");
 #endif
 
-        /* p->p; s->q; q->r; r->s = prsq */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gpr = Gp^Gr;  Gsq = Gs^Gq;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    pr = InBuf->params->rowidx[P][R];
+            /* p->p; s->q; q->r; r->s = prsq */
 
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        sq = InBuf->params->colidx[S][Q];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Gpr][pr][sq];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for psqr sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("psqr");
+            timer_off("psqr");
 #endif
-        break;
+            break;
 
-    case psrq:
+        case psrq:
 
 #ifdef DPD_TIMER
-        timer_on("psrq");
+            timer_on("psrq");
 #endif
 
-        /* p->p; s->q; r->r; q->s = psrq */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gps = Gp^Gs;  Grq = Gr^Gq;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
+            /* p->p; s->q; r->r; q->s = psrq */
 
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    rq = InBuf->params->colidx[R][Q];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        ps = InBuf->params->rowidx[P][S];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Gps][ps][rq];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for psrq sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("psrq");
+            timer_off("psrq");
 #endif
-        break;
+            break;
 
-    case qprs:
+        case qprs:
 
 #ifdef DPD_TIMER
-        timer_on("qprs");
+            timer_on("qprs");
 #endif
 
-        /* q->p; p->q; r->r; s->s = qprs */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
-                    qp = InBuf->params->rowidx[q][p];
-
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
-
-                        col = InBuf->params->colidx[r][s];
+            /* q->p; p->q; r->r; s->s = qprs */
 
-                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[h][qp][col];
-                    }
-                }
-
-            }
-        }
-        else {
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq ^ my_irrep;
 
@@ -979,41 +795,19 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                 buf4_mat_irrep_close_block(InBuf, Gpq, rows_per_bucket);
                 buf4_mat_irrep_close_block(&OutBuf, Gpq, rows_per_bucket);
             } /* Gpq */
-        }
 #ifdef DPD_TIMER
-        timer_off("qprs");
+            timer_off("qprs");
 #endif
-        break;
+            break;
 
-    case qpsr:
+        case qpsr:
 
 #ifdef DPD_TIMER
-        timer_on("qpsr");
+            timer_on("qpsr");
 #endif
 
-        /* q->p; p->q; s->r; r->s = qpsr */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
-                    qp = InBuf->params->rowidx[q][p];
+            /* q->p; p->q; s->r; r->s = qpsr */
 
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
-                        sr = InBuf->params->colidx[s][r];
-
-                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[h][qp][sr];
-                    }
-                }
-
-            }
-        }
-        else {
 
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq ^ my_irrep;
@@ -1139,513 +933,161 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                 buf4_mat_irrep_close_block(&OutBuf, Gpq, rows_per_bucket);
 
             } /* Gpq */
-        }
 
 #ifdef DPD_TIMER
-        timer_off("qpsr");
+            timer_off("qpsr");
 #endif
-        break;
+            break;
 
-    case qrps:
+        case qrps:
 #ifdef DPD_TIMER
-        timer_on("qrps");
+            timer_on("qrps");
 #endif
 
-        /* q->p; r->q; p->r; s->s = rpqs */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
+            /* q->p; r->q; p->r; s->s = rpqs */
 
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Grp = Gr^Gp; Gqs = Gq^Gs;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    rp = InBuf->params->rowidx[R][P];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        qs = InBuf->params->colidx[Q][S];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Grp][rp][qs];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for qrps sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("qrps");
+            timer_off("qrps");
 #endif
-        break;
+            break;
 
-    case qrsp:
+        case qrsp:
 
 #ifdef DPD_TIMER
-        timer_on("qrsp");
+            timer_on("qrsp");
 #endif
 
-        /* q->p; r->q; s->r; p->s = spqr */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gsp = Gs^Gp; Gqr = Gq^Gr;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    qr = InBuf->params->colidx[Q][R];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        sp = InBuf->params->rowidx[S][P];
+            /* q->p; r->q; s->r; p->s = spqr */
 
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Gsp][sp][qr];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for qrsp sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("qrsp");
+            timer_off("qrsp");
 #endif
-        break;
+            break;
 
-    case qspr:
+        case qspr:
 #ifdef DPD_TIMER
-        timer_on("qspr");
+            timer_on("qspr");
 #endif
 
-        /* q->p; s->q; p->r; r->s = rpsq */
+            /* q->p; s->q; p->r; r->s = rpsq */
 
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Grp = Gr^Gp; Gsq = Gs^Gq;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    rp = InBuf->params->rowidx[R][P];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        sq = InBuf->params->colidx[S][Q];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Grp][rp][sq];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for qspr sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("qspr");
+            timer_off("qspr");
 #endif
-        break;
+            break;
 
-    case qsrp:
+        case qsrp:
 
 #ifdef DPD_TIMER
-        timer_on("qsrp");
+            timer_on("qsrp");
 #endif
 
-        /* q->p; s->q; r->r; p->s = sprq */
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gsp = Gs^Gp; Grq = Gr^Gq;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    rq = InBuf->params->colidx[R][Q];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        sp = InBuf->params->rowidx[S][P];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Gsp][sp][rq];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
+            /* q->p; s->q; r->r; p->s = sprq */
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for qsrp sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("qsrp");
+            timer_off("qsrp");
 #endif
-        break;
+            break;
 
-    case rqps:
+        case rqps:
 
 #ifdef DPD_TIMER
-        timer_on("rqps");
+            timer_on("rqps");
 #endif
 
-        /* r->p; q->q; p->r; s->s = rqps */
+            /* r->p; q->q; p->r; s->s = rqps */
 
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Grq = Gr^Gq; Gps = Gp^Gs;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    rq = InBuf->params->rowidx[R][Q];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        ps = InBuf->params->colidx[P][S];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Grq][rq][ps];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for rqps sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("rqps");
+            timer_off("rqps");
 #endif
-        break;
+            break;
 
-    case rqsp:
+        case rqsp:
 
 #ifdef DPD_TIMER
-        timer_on("rqsp");
+            timer_on("rqsp");
 #endif
 
-        /* r->p; q->q; s->r; p->s = sqpr */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gsq = Gs^Gq;  Gpr = Gp^Gr;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    pr = InBuf->params->colidx[P][R];
+            /* r->p; q->q; s->r; p->s = sqpr */
 
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        sq = InBuf->params->rowidx[S][Q];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Gsq][sq][pr];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for rqsp sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("rqsp");
+            timer_off("rqsp");
 #endif
-        break;
+            break;
 
-    case rpqs:
+        case rpqs:
 
 #ifdef DPD_TIMER
-        timer_on("rpqs");
+            timer_on("rpqs");
 #endif
 
-        /* r->p; p->q; q->r; s->s = qrps */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gqr = Gq^Gr;  Gps = Gp^Gs;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    qr = InBuf->params->rowidx[Q][R];
+            /* r->p; p->q; q->r; s->s = qrps */
 
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        ps = InBuf->params->colidx[P][S];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Gqr][qr][ps];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for rpqs sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("rpqs");
+            timer_off("rpqs");
 #endif
-        break;
+            break;
 
-    case rpsq:
+        case rpsq:
 
 #ifdef DPD_TIMER
-        timer_on("rpsq");
+            timer_on("rpsq");
 #endif
 
-        /* r->p; p->q; s->r; q->s = qspr */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gqs = Gq^Gs;  Gpr = Gp^Gr;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
+            /* r->p; p->q; s->r; q->s = qspr */
 
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    pr = InBuf->params->colidx[P][R];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        qs = InBuf->params->rowidx[Q][S];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Gqs][qs][pr];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for rpsq sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("rpsq");
+            timer_off("rpsq");
 #endif
-        break;
+            break;
 
-    case rsqp:
+        case rsqp:
 
 #ifdef DPD_TIMER
-        timer_on("rsqp");
+            timer_on("rsqp");
 #endif
 
-        /* r->p; s->q; q->r; p->s = srpq */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
-
-                    col = InBuf->params->colidx[p][q];
-
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
+            /* r->p; s->q; q->r; p->s = srpq */
 
-                        row = InBuf->params->rowidx[s][r];
-
-                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[h][row][col];
-
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for rsqp sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("rsqp");
+            timer_off("rsqp");
 #endif
-        break;
+            break;
 
-    case rspq:
+        case rspq:
 
 #ifdef DPD_TIMER
-        timer_on("rspq");
+            timer_on("rspq");
 #endif
 
-        /* r->p; s->q; p->r; q->s = rspq */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
-
-                    col = InBuf->params->colidx[p][q];
-
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
+            /* r->p; s->q; p->r; q->s = rspq */
 
-                        row = InBuf->params->rowidx[r][s];
-
-                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[r_irrep][row][col];
-
-                    }
-                }
-            }
-        }
-        else {
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq ^ my_irrep;
 
@@ -1705,258 +1147,96 @@ int DPD::buf4_sort(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                 buf4_mat_irrep_close_block(InBuf, Grs, in_rows_per_bucket);
 
             } /* Gpq */
-        }
 
 #ifdef DPD_TIMER
-        timer_off("rspq");
+            timer_off("rspq");
 #endif
-        break;
+            break;
 
-    case sqrp:
+        case sqrp:
 
 #ifdef DPD_TIMER
-        timer_on("sqrp");
+            timer_on("sqrp");
 #endif
 
-        /* s->p; q->q; r->r; p->s = sqrp */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gsq = Gs^Gq;  Grp = Gr^Gp;
+            /* s->p; q->q; r->r; p->s = sqrp */
 
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    rp = InBuf->params->colidx[R][P];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        sq = InBuf->params->rowidx[S][Q];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Gsq][sq][rp];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for sqrp sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("sqrp");
+            timer_off("sqrp");
 #endif
-        break;
+            break;
 
-    case sqpr:
-        outfile->Printf("\nDPD sort error: sqpr index ordering not yet coded.\n");
-        dpd_error("buf_sort", "outfile");
-        break;
+        case sqpr:
+            outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for sqpr sort.\n");
+            dpd_error("buf_sort", "outfile");
+            break;
 
-    case srqp:
+        case srqp:
 
 #ifdef DPD_TIMER
-        timer_on("srqp");
+            timer_on("srqp");
 #endif
 
-        /* s->p; r->q; q->r; p->s = srqp */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
-
-                    col = InBuf->params->colidx[q][p];
+            /* s->p; r->q; q->r; p->s = srqp */
 
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
-
-                        row = InBuf->params->rowidx[s][r];
-
-                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[r_irrep][row][col];
-
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for srqp sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("srqp");
+            timer_off("srqp");
 #endif
-        break;
+            break;
 
-    case srpq:
+        case srpq:
 #ifdef DPD_TIMER
-        timer_on("srpq");
+            timer_on("srpq");
 #endif
 
-        /* s->p; r->q; p->r; q->s = rsqp */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
+            /* s->p; r->q; p->r; q->s = rsqp */
 
-                    col = InBuf->params->colidx[q][p];
-
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
-
-                        row = InBuf->params->rowidx[r][s];
-
-                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[h][row][col];
-
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for srpq sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("srpq");
+            timer_off("srpq");
 #endif
-        break;
+            break;
 
-    case spqr:
+        case spqr:
 
 #ifdef DPD_TIMER
-        timer_on("spqr");
+            timer_on("spqr");
 #endif
 
-        /* s->p; p->q; q->r; r->s = qrsp */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
+            /* s->p; p->q; q->r; r->s = qrsp */
 
-                        Gqr = Gq^Gr;  Gsp = Gs^Gp;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    qr = InBuf->params->rowidx[Q][R];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        sp = InBuf->params->colidx[S][P];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Gqr][qr][sp];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for spqr sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("spqr");
+            timer_off("spqr");
 #endif
-        break;
+            break;
 
-    case sprq:
+        case sprq:
 
 #ifdef DPD_TIMER
-        timer_on("sprq");
+            timer_on("sprq");
 #endif
 
-        /* s->p; p->q; r->r; q->s = qsrp */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gqs = Gq^Gs;  Grp = Gr^Gp;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    rp = InBuf->params->colidx[R][P];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        qs = InBuf->params->rowidx[Q][S];
-
-                                        OutBuf.matrix[h][pq][rs] = InBuf->matrix[Gqs][qs][rp];
+            /* s->p; p->q; r->r; q->s = qsrp */
 
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for sprq sort.\n");
             dpd_error("buf4_sort", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("sprq");
+            timer_off("sprq");
 #endif
-        break;
+            break;
+        }
     }
 
     if(incore) {
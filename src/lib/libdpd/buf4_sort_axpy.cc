@@ -86,14 +86,18 @@ namespace psi {
 **
 ** Added OOC algorithm for rpsq sort.
 ** -TDC, August 2005
+**
+** All in-core orderings (now including qspr, qsrp, and sqpr) are
+** handled by the threaded, tiled kernel buf4_sort_incore().  The
+** switch below is reached only for the out-of-core algorithms.
 */
 
 int DPD::buf4_sort_axpy(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                          int pqnum, int rsnum, const char *label, double alpha)
 {
-    int h,nirreps, row, col, my_irrep, r_irrep;
-    int p, q, r, s, P, Q, R, S, pq, rs, sr, pr, qs, qp, rq, qr, ps, sp, rp, sq;
-    int Gp, Gq, Gr, Gs, Gpq, Grs, Gsr, Gpr, Gqs, Grq, Gqr, Gps, Gsp, Grp, Gsq;
+    int h, nirreps, my_irrep;
+    int p, q, r, s, pq, rs, sr, pr, qs, qp, qr, ps;
+    int Gp, Gq, Gr, Gs, Gpq, Grs, Gpr, Gqs, Gqr, Gps;
     dpdbuf4 OutBuf;
     long int rowtot, coltot, core_total, maxrows;
     int incore;
@@ -153,42 +157,22 @@ int DPD::buf4_sort_axpy(dpdbuf4 *InBuf, int outfilenum, enum indices index,
     if(index == rspq) timer_off("axpy:alloc");
 #endif
 
-    switch(index) {
-    case pqrs:
-        outfile->Printf( "\nDPD sort error: invalid index ordering.\n");
-        dpd_error("buf_sort", "outfile");
-        break;
+    if(incore && index != pqrs) {
+        buf4_sort_incore(InBuf, &OutBuf, index, alpha, 1);
+    }
+    else {
+        switch(index) {
+        case pqrs:
+            outfile->Printf( "\nDPD sort error: invalid index ordering.\n");
+            dpd_error("buf_sort", "outfile");
+            break;
 
-    case pqsr:
+        case pqsr:
 
 #ifdef DPD_TIMER
-        timer_on("pqsr");
+            timer_on("pqsr");
 #endif
 
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                /* p->p; q->q; s->r; r->s = pqsr */
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
-
-                    row = InBuf->params->rowidx[p][q];
-
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
-
-                        sr = InBuf->params->colidx[s][r];
-
-                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[h][row][sr];
-                    }
-                }
-            }
-        }
-        else {
 
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq^my_irrep;
@@ -241,59 +225,20 @@ int DPD::buf4_sort_axpy(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                 buf4_mat_irrep_close_block(&OutBuf, Gpq, rows_per_bucket);
                 buf4_mat_irrep_close_block(InBuf, Gpq, rows_per_bucket);
             }
-        }
 
 #ifdef DPD_TIMER
-        timer_off("pqsr");
+            timer_off("pqsr");
 #endif
-        break;
+            break;
 
-    case prqs:
+        case prqs:
 
 #ifdef DPD_TIMER
-        timer_on("prqs");
+            timer_on("prqs");
 #endif
 
-        /* p->p; r->q; q->r; s->s = prqs */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        /* Irreps on the source */
-                        Gpr = Gp^Gr;  Gqs = Gq^Gs;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    pr = InBuf->params->rowidx[P][R];
+            /* p->p; r->q; q->r; s->s = prqs */
 
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        qs = InBuf->params->colidx[Q][S];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Gpr][pr][qs];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
 
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq^my_irrep;
@@ -479,59 +424,21 @@ int DPD::buf4_sort_axpy(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                 buf4_mat_irrep_close_block(&OutBuf, Gpq, out_rows_per_bucket);
             }
 
-        }
 
 
 #ifdef DPD_TIMER
-        timer_off("prqs");
+            timer_off("prqs");
 #endif
-        break;
+            break;
 
-    case prsq:
+        case prsq:
 
 #ifdef DPD_TIMER
-        timer_on("prsq");
+            timer_on("prsq");
 #endif
 
-        /* p->p; r->q; s->r; q->s = psqr */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gps = Gp^Gs;  Gqr = Gq^Gr;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    qr = InBuf->params->colidx[Q][R];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        ps = InBuf->params->rowidx[P][S];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Gps][ps][qr];
+            /* p->p; r->q; s->r; q->s = psqr */
 
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
 
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq^my_irrep;
@@ -717,469 +624,158 @@ int DPD::buf4_sort_axpy(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                 buf4_mat_irrep_close_block(&OutBuf, Gpq, out_rows_per_bucket);
             }
 
-        }
 
 #ifdef DPD_TIMER
-        timer_off("prsq");
+            timer_off("prsq");
 #endif
-        break;
+            break;
 
-    case psqr:
+        case psqr:
 
 #ifdef DPD_TIMER
-        timer_on("psqr");
+            timer_on("psqr");
 #endif
 
-        /* p->p; s->q; q->r; r->s = prsq */
+            /* p->p; s->q; q->r; r->s = prsq */
 
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gpr = Gp^Gr;  Gsq = Gs^Gq;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    pr = InBuf->params->rowidx[P][R];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        sq = InBuf->params->colidx[S][Q];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Gpr][pr][sq];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for psqr sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("psqr");
+            timer_off("psqr");
 #endif
-        break;
+            break;
 
-    case psrq:
+        case psrq:
 
 #ifdef DPD_TIMER
-        timer_on("psrq");
+            timer_on("psrq");
 #endif
 
-        /* p->p; s->q; r->r; q->s = psrq */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
+            /* p->p; s->q; r->r; q->s = psrq */
 
-                        Gps = Gp^Gs;  Grq = Gr^Gq;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    rq = InBuf->params->colidx[R][Q];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        ps = InBuf->params->rowidx[P][S];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Gps][ps][rq];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for psrq sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("psrq");
+            timer_off("psrq");
 #endif
-        break;
+            break;
 
-    case qprs:
+        case qprs:
 
 #ifdef DPD_TIMER
-        timer_on("qprs");
+            timer_on("qprs");
 #endif
 
-        /* q->p; p->q; r->r; s->s = qprs */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
-                    qp = InBuf->params->rowidx[q][p];
-
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
-
-                        col = InBuf->params->colidx[r][s];
+            /* q->p; p->q; r->r; s->s = qprs */
 
-                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[h][qp][col];
-                    }
-                }
-
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for qprs sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("qprs");
+            timer_off("qprs");
 #endif
-        break;
+            break;
 
-    case qpsr:
+        case qpsr:
 
 #ifdef DPD_TIMER
-        timer_on("qpsr");
+            timer_on("qpsr");
 #endif
 
-        /* q->p; p->q; s->r; r->s = qpsr */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
-                    qp = InBuf->params->rowidx[q][p];
-
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
-                        sr = InBuf->params->colidx[s][r];
+            /* q->p; p->q; s->r; r->s = qpsr */
 
-                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[h][qp][sr];
-                    }
-                }
-
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for qpsr sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("qpsr");
+            timer_off("qpsr");
 #endif
-        break;
+            break;
 
-    case qrps:
+        case qrps:
 #ifdef DPD_TIMER
-        timer_on("qrps");
+            timer_on("qrps");
 #endif
 
-        /* q->p; r->q; p->r; s->s = rpqs */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Grp = Gr^Gp; Gqs = Gq^Gs;
+            /* q->p; r->q; p->r; s->s = rpqs */
 
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    rp = InBuf->params->rowidx[R][P];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        qs = InBuf->params->colidx[Q][S];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Grp][rp][qs];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for qrps sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("qrps");
+            timer_off("qrps");
 #endif
-        break;
+            break;
 
-    case qrsp:
+        case qrsp:
 
 #ifdef DPD_TIMER
-        timer_on("qrsp");
+            timer_on("qrsp");
 #endif
 
-        /* q->p; r->q; s->r; p->s = spqr */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gsp = Gs^Gp; Gqr = Gq^Gr;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    qr = InBuf->params->colidx[Q][R];
+            /* q->p; r->q; s->r; p->s = spqr */
 
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        sp = InBuf->params->rowidx[S][P];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Gsp][sp][qr];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for qrsp sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("qrsp");
+            timer_off("qrsp");
 #endif
-        break;
+            break;
 
-    case qspr:
-        outfile->Printf("\nDPD sort error: qspr index ordering not yet coded.\n");
-        dpd_error("buf_sort", "outfile");
-        break;
+        case qspr:
+            outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for qspr sort.\n");
+            dpd_error("buf_sort", "outfile");
+            break;
 
-    case qsrp:
-        outfile->Printf("\nDPD sort error: qsrp index ordering not yet coded.\n");
-        dpd_error("buf_sort", "outfile");
-        break;
+        case qsrp:
+            outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for qsrp sort.\n");
+            dpd_error("buf_sort", "outfile");
+            break;
 
-    case rqps:
+        case rqps:
 
 #ifdef DPD_TIMER
-        timer_on("rqps");
+            timer_on("rqps");
 #endif
 
-        /* r->p; q->q; p->r; s->s = rqps */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Grq = Gr^Gq; Gps = Gp^Gs;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    rq = InBuf->params->rowidx[R][Q];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        ps = InBuf->params->colidx[P][S];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Grq][rq][ps];
+            /* r->p; q->q; p->r; s->s = rqps */
 
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for rqps sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
 
 #ifdef DPD_TIMER
-        timer_off("rqps");
+            timer_off("rqps");
 #endif
-        break;
+            break;
 
-    case rqsp:
+        case rqsp:
 
 #ifdef DPD_TIMER
-        timer_on("rqsp");
+            timer_on("rqsp");
 #endif
 
-        /* r->p; q->q; s->r; p->s = sqpr */
+            /* r->p; q->q; s->r; p->s = sqpr */
 
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gsq = Gs^Gq;  Gpr = Gp^Gr;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    pr = InBuf->params->colidx[P][R];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        sq = InBuf->params->rowidx[S][Q];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Gsq][sq][pr];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for rqsp sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
 
 
 #ifdef DPD_TIMER
-        timer_off("rqsp");
+            timer_off("rqsp");
 #endif
-        break;
+            break;
 
-    case rpqs:
+        case rpqs:
 
 #ifdef DPD_TIMER
-        timer_on("rpqs");
+            timer_on("rpqs");
 #endif
 
-        /* r->p; p->q; q->r; s->s = qrps */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
+            /* r->p; p->q; q->r; s->s = qrps */
 
-                        Gqr = Gq^Gr;  Gps = Gp^Gs;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    qr = InBuf->params->rowidx[Q][R];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        ps = InBuf->params->colidx[P][S];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Gqr][qr][ps];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
 
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq^my_irrep;
@@ -1364,58 +960,20 @@ int DPD::buf4_sort_axpy(dpdbuf4 *InBuf, int outfilenum, enum indices index,
 
                 buf4_mat_irrep_close_block(&OutBuf, Gpq, out_rows_per_bucket);
             }
-        }
 
 #ifdef DPD_TIMER
-        timer_off("rpqs");
+            timer_off("rpqs");
 #endif
-        break;
+            break;
 
-    case rpsq:
+        case rpsq:
 
 #ifdef DPD_TIMER
-        timer_on("rpsq");
+            timer_on("rpsq");
 #endif
 
-        /* r->p; p->q; s->r; q->s = qspr */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gqs = Gq^Gs;  Gpr = Gp^Gr;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
+            /* r->p; p->q; s->r; q->s = qspr */
 
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    pr = InBuf->params->colidx[P][R];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        qs = InBuf->params->rowidx[Q][S];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Gqs][qs][pr];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq^my_irrep;
 
@@ -1600,90 +1158,37 @@ int DPD::buf4_sort_axpy(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                 buf4_mat_irrep_close_block(&OutBuf, Gpq, out_rows_per_bucket);
             }
 
-        }
 
 #ifdef DPD_TIMER
-        timer_off("rpsq");
+            timer_off("rpsq");
 #endif
-        break;
+            break;
 
-    case rsqp:
+        case rsqp:
 
 #ifdef DPD_TIMER
-        timer_on("rsqp");
+            timer_on("rsqp");
 #endif
 
-        /* r->p; s->q; q->r; p->s = srpq */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
-
-                    col = InBuf->params->colidx[p][q];
-
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
-
-                        row = InBuf->params->rowidx[s][r];
-
-                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[h][row][col];
+            /* r->p; s->q; q->r; p->s = srpq */
 
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for rsqp sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
-
-#ifdef DPD_TIMER
-        timer_off("rsqp");
-#endif
-        break;
-
-    case rspq:
 
 #ifdef DPD_TIMER
-        timer_on("rspq");
+            timer_off("rsqp");
 #endif
+            break;
 
-        /* r->p; s->q; p->r; q->s = rspq */
+        case rspq:
 
-        /* loop over row irreps of OutBuf */
-        if(incore) {
 #ifdef DPD_TIMER
-            timer_on("axpy:sort");
+            timer_on("rspq");
 #endif
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
 
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
+            /* r->p; s->q; p->r; q->s = rspq */
 
-                    col = InBuf->params->colidx[p][q];
-
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
-
-                        row = InBuf->params->rowidx[r][s];
-
-                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[r_irrep][row][col];
-                    }
-                }
-            }
-#ifdef DPD_TIMER
-            timer_off("axpy:sort");
-#endif
-        }
-        else {
+            /* loop over row irreps of OutBuf */
 
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq^my_irrep;
@@ -1783,101 +1288,39 @@ int DPD::buf4_sort_axpy(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                 buf4_mat_irrep_close_block(&OutBuf, Gpq, out_rows_per_bucket);
 
             } /* Gpq */
-        }
 
 #ifdef DPD_TIMER
-        timer_off("rspq");
+            timer_off("rspq");
 #endif
-        break;
+            break;
 
-    case sqrp:
+        case sqrp:
 
 #ifdef DPD_TIMER
-        timer_on("sqrp");
+            timer_on("sqrp");
 #endif
 
-        /* s->p; q->q; r->r; p->s = sqrp */
-
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gsq = Gs^Gq;  Grp = Gr^Gp;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
+            /* s->p; q->q; r->r; p->s = sqrp */
 
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    rp = InBuf->params->colidx[R][P];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        sq = InBuf->params->rowidx[S][Q];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Gsq][sq][rp];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for sqrp sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
 #ifdef DPD_TIMER
-        timer_off("sqrp");
+            timer_off("sqrp");
 #endif
-        break;
+            break;
 
-    case sqpr:
-        outfile->Printf("\nDPD sort error: sqpr index ordering not yet coded.\n");
-        dpd_error("buf_sort", "outfile");
-        break;
+        case sqpr:
+            outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for sqpr sort.\n");
+            dpd_error("buf_sort", "outfile");
+            break;
 
-    case srqp:
+        case srqp:
 
 #ifdef DPD_TIMER
-        timer_on("srqp");
+            timer_on("srqp");
 #endif
 
-        /* s->p; r->q; q->r; p->s = srqp */
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
-
-                    col = InBuf->params->colidx[q][p];
-
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
-
-                        row = InBuf->params->rowidx[s][r];
-
-                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[r_irrep][row][col];
-
-                    }
-                }
-            }
-        }
-        else {
+            /* s->p; r->q; q->r; p->s = srqp */
 
             for(Gpq=0; Gpq < nirreps; Gpq++) {
                 Grs = Gpq^my_irrep;
@@ -2012,153 +1455,53 @@ int DPD::buf4_sort_axpy(dpdbuf4 *InBuf, int outfilenum, enum indices index,
 
             } /* Gpq */
 
-        }
 
 #ifdef DPD_TIMER
-        timer_off("srqp");
+            timer_off("srqp");
 #endif
-        break;
+            break;
 
-    case srpq:
+        case srpq:
 #ifdef DPD_TIMER
-        timer_on("srpq");
+            timer_on("srpq");
 #endif
 
-        /* s->p; r->q; p->r; q->s = rsqp */
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(pq=0; pq < OutBuf.params->rowtot[h]; pq++) {
-                    p = OutBuf.params->roworb[h][pq][0];
-                    q = OutBuf.params->roworb[h][pq][1];
-
-                    col = InBuf->params->colidx[q][p];
-
-                    for(rs=0; rs < OutBuf.params->coltot[r_irrep]; rs++) {
-                        r = OutBuf.params->colorb[r_irrep][rs][0];
-                        s = OutBuf.params->colorb[r_irrep][rs][1];
-
-                        row = InBuf->params->rowidx[r][s];
-
-                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[h][row][col];
-
-                    }
-                }
-            }
-        }
-        else {
+            /* s->p; r->q; p->r; q->s = rsqp */
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for srpq sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
 #ifdef DPD_TIMER
-        timer_off("srpq");
+            timer_off("srpq");
 #endif
-        break;
+            break;
 
-    case spqr:
+        case spqr:
 
 #ifdef DPD_TIMER
-        timer_on("spqr");
+            timer_on("spqr");
 #endif
 
-        /* s->p; p->q; q->r; r->s = qrsp */
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gqr = Gq^Gr;  Gsp = Gs^Gp;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    qr = InBuf->params->rowidx[Q][R];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        sp = InBuf->params->colidx[S][P];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Gqr][qr][sp];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
+            /* s->p; p->q; q->r; r->s = qrsp */
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for spqr sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
 #ifdef DPD_TIMER
-        timer_off("spqr");
+            timer_off("spqr");
 #endif
-        break;
+            break;
 
-    case sprq:
+        case sprq:
 
 #ifdef DPD_TIMER
-        timer_on("sprq");
+            timer_on("sprq");
 #endif
 
-        /* s->p; p->q; r->r; q->s = qsrp */
-        if(incore) {
-            for(h=0; h < nirreps; h++) {
-                r_irrep = h^my_irrep;
-
-                for(Gp=0; Gp < nirreps; Gp++) {
-                    Gq = Gp^h;
-                    for(Gr=0; Gr < nirreps; Gr++) {
-                        Gs = Gr^r_irrep;
-
-                        Gqs = Gq^Gs;  Grp = Gr^Gp;
-
-                        for(p=0; p < OutBuf.params->ppi[Gp]; p++) {
-                            P = OutBuf.params->poff[Gp] + p;
-                            for(q=0; q < OutBuf.params->qpi[Gq]; q++) {
-                                Q = OutBuf.params->qoff[Gq] + q;
-                                pq = OutBuf.params->rowidx[P][Q];
-
-                                for(r=0; r < OutBuf.params->rpi[Gr]; r++) {
-                                    R = OutBuf.params->roff[Gr] + r;
-                                    rp = InBuf->params->colidx[R][P];
-
-                                    for(s=0; s < OutBuf.params->spi[Gs]; s++) {
-                                        S = OutBuf.params->soff[Gs] + s;
-                                        rs = OutBuf.params->colidx[R][S];
-                                        qs = InBuf->params->rowidx[Q][S];
-
-                                        OutBuf.matrix[h][pq][rs] += alpha * InBuf->matrix[Gqs][qs][rp];
-
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
-        else {
+            /* s->p; p->q; r->r; q->s = qsrp */
             outfile->Printf( "LIBDPD: Out-of-core algorithm not yet coded for sprq sort.\n");
             dpd_error("buf4_sort_axpy", "outfile");
-        }
 #ifdef DPD_TIMER
-        timer_off("sprq");
+            timer_off("sprq");
 #endif
-        break;
+            break;
+        }
     }
 
 #ifdef DPD_TIMER
@@ -0,0 +1,147 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2016 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+/*! \file
+    \ingroup DPD
+    \brief Threaded in-core kernel shared by buf4_sort() and buf4_sort_axpy()
+*/
+#include <cstdio>
+#include <vector>
+#include <utility>
+#include "dpd.h"
+#include "psi4-dec.h"
+
+namespace psi {
+
+namespace {
+
+/* Source positions for each permutation in enum indices.  With the
+** target written as Out[pq][rs] (see the notes in buf4_sort.cc), the
+** source element is In[ab][cd], where a, b, c, d are the target
+** indices p, q, r, s (0, 1, 2, 3) found at these positions.  pqrs is
+** not a sort and is rejected. */
+const int sort_src[24][4] = {
+    {-1,-1,-1,-1}, {0,1,3,2}, {0,2,1,3}, {0,3,1,2}, {0,2,3,1}, {0,3,2,1}, /* pqrs ... psrq */
+    { 1, 0, 2, 3}, {1,0,3,2}, {2,0,1,3}, {3,0,1,2}, {2,0,3,1}, {3,0,2,1}, /* qprs ... qsrp */
+    { 2, 1, 0, 3}, {3,1,0,2}, {1,2,0,3}, {1,3,0,2}, {3,2,0,1}, {2,3,0,1}, /* rqps ... rspq */
+    { 3, 1, 2, 0}, {2,1,3,0}, {3,2,1,0}, {2,3,1,0}, {1,2,3,0}, {1,3,2,0}  /* sqrp ... sprq */
+};
+
+/* Edge length of the square (pq,rs) tiles of the target.  Each tile
+** touches at most tile^2 source elements, which keeps the scattered
+** reads of the bra-ket mixing sorts within a few cache lines per row. */
+const int sort_tile = 64;
+
+}
+
+/* buf4_sort_incore(): In-core permutation of all symmetry blocks of
+** InBuf into OutBuf, used by buf4_sort() and buf4_sort_axpy() for every
+** ordering they handle in core.  All blocks of both buffers must
+** already be initialized and InBuf read; OutBuf must also be read if
+** accumulate is set.
+**
+** The work is split into (irrep, row tile) tasks which are distributed
+** over threads with a dynamic schedule, so the large irreps do not
+** serialize the sort and the small ones fill in the gaps.  Every task
+** writes a distinct set of OutBuf rows, so no synchronization is needed.
+**
+** Arguments:
+**   dpdbuf4 *InBuf: The source buffer, all irreps in core.
+**   dpdbuf4 *OutBuf: The target buffer, all irreps in core.
+**   enum indices index: The sorting pattern (see dpd.h).
+**   double alpha: Scale factor applied to the source elements.
+**   int accumulate: If set, Out += alpha * In; otherwise Out = alpha * In.
+*/
+
+int DPD::buf4_sort_incore(dpdbuf4 *InBuf, dpdbuf4 *OutBuf, enum indices index,
+                          double alpha, int accumulate)
+{
+    int h, nirreps, my_irrep, pq;
+    long int ntasks, t;
+    const int *src;
+    dpdparams4 *InParams, *OutParams;
+    std::vector<std::pair<int,int> > tasks;
+
+    src = sort_src[index];
+    if(src[0] < 0) {
+        outfile->Printf( "\nDPD sort error: invalid index ordering.\n");
+        dpd_error("buf4_sort_incore", "outfile");
+    }
+
+    nirreps = OutBuf->params->nirreps;
+    my_irrep = OutBuf->file.my_irrep;
+    InParams = InBuf->params;
+    OutParams = OutBuf->params;
+
+    for(h=0; h < nirreps; h++) {
+        if(!OutParams->coltot[h^my_irrep]) continue;
+        for(pq=0; pq < OutParams->rowtot[h]; pq += sort_tile)
+            tasks.push_back(std::make_pair(h, pq));
+    }
+    ntasks = tasks.size();
+
+#pragma omp parallel for schedule(dynamic)
+    for(t=0; t < ntasks; t++) {
+        int Gpq = tasks[t].first;
+        int Grs = Gpq^my_irrep;
+        int pq_start = tasks[t].second;
+        int pq_stop = pq_start + sort_tile;
+        int coltot = OutParams->coltot[Grs];
+        int idx[4];
+        if(pq_stop > OutParams->rowtot[Gpq]) pq_stop = OutParams->rowtot[Gpq];
+
+        for(int rs_start=0; rs_start < coltot; rs_start += sort_tile) {
+            int rs_stop = rs_start + sort_tile;
+            if(rs_stop > coltot) rs_stop = coltot;
+
+            for(int row=pq_start; row < pq_stop; row++) {
+                double *Out = OutBuf->matrix[Gpq][row];
+                idx[0] = OutParams->roworb[Gpq][row][0];
+                idx[1] = OutParams->roworb[Gpq][row][1];
+
+                for(int col=rs_start; col < rs_stop; col++) {
+                    idx[2] = OutParams->colorb[Grs][col][0];
+                    idx[3] = OutParams->colorb[Grs][col][1];
+
+                    int a = idx[src[0]];
+                    int b = idx[src[1]];
+                    int c = idx[src[2]];
+                    int d = idx[src[3]];
+                    int Gab = InParams->psym[a]^InParams->qsym[b];
+                    double value = InBuf->matrix[Gab][InParams->rowidx[a][b]][InParams->colidx[c][d]];
+
+                    if(accumulate) Out[col] += alpha * value;
+                    else Out[col] = alpha * value;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+}
@@ -32,6 +32,8 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cmath>
+#include <cstring>
+#include <libciomr/libciomr.h>
 #include <libqt/qt.h>
 #include "dpd.h"
 
@@ -59,17 +61,18 @@ namespace psi {
 int DPD::contract424(dpdbuf4 *X, dpdfile2 *Y, dpdbuf4 *Z, int sum_X,
                      int sum_Y, int Ztrans, double alpha, double beta)
 {
-    int h, nirreps, GX, GY, GZ, hxbuf, hzbuf, h0, Hx, Hy, Hz, GsX, GsZ;
+    int nirreps, GX, GY, GZ, hxbuf, hzbuf, Hx, Hy, Hz;
     int rking=0, symlink;
     int Xtrans,Ytrans;
     int *numlinks, *numrows, *numcols;
     int incore;
-    long int core, memoryd, core_total, rowtot, coltot, maxrows;
-    int xcount, zcount, scount, Ysym;
-    int rowx, rowz, colx, colz;
-    int pq, rs, r, s, Gr, Gs;
+    long int memoryd, core_total, rowtot, coltot, maxrows;
+    int xcount, zcount;
+    int pq, Gr;
+    int xcols, zcols, nrows, *xoff, *zoff;
+    long int rows_per_batch, pq_start, ntasks;
     dpdtrans4 Xt, Zt;
-    double ***Xmat, ***Zmat;
+    double ***Xmat, ***Zmat, **Xblk, **Zblk;
 #ifdef DPD_DEBUG
     int *xrow, *xcol, *yrow, *ycol, *zrow, *zcol;
 #endif  
@@ -325,42 +328,78 @@ int DPD::contract424(dpdbuf4 *X, dpdfile2 *Y, dpdbuf4 *Z, int sum_X,
             buf4_mat_irrep_row_init(X, hxbuf);
             buf4_mat_irrep_row_init(Z, hzbuf);
 
-            /* Loop over rows of the X factor and the target */
-            for(pq=0; pq < Z->params->rowtot[hzbuf]; pq++) {
-
-                buf4_mat_irrep_row_zero(X, hxbuf, pq);
-                buf4_mat_irrep_row_rd(X, hxbuf, pq);
-
-                buf4_mat_irrep_row_zero(Z, hzbuf, pq);
-
-                if(fabs(beta) > 0.0)
-                    buf4_mat_irrep_row_rd(Z, hzbuf, pq);
-
-                xcount = zcount = 0;
+            /* Rows still go through the row I/O one at a time, but they are
+               contracted in batches: the (row, Gr) products within a batch are
+               independent and far too small for threaded BLAS, so they are
+               distributed over threads here instead. */
+            xcols = X->params->coltot[hxbuf^GX];
+            zcols = Z->params->coltot[hzbuf^GZ];
+            rowtot = Z->params->rowtot[hzbuf];
+
+            if(rowtot && xcols && zcols) {
+                rows_per_batch = dpd_memfree()/(xcols + zcols);
+                if(rows_per_batch > rowtot) rows_per_batch = rowtot;
+                if(rows_per_batch < 1)
+                    dpd_error("contract424: Not enough memory for one row", "outfile");
+
+                Xblk = dpd_block_matrix(rows_per_batch, xcols);
+                Zblk = dpd_block_matrix(rows_per_batch, zcols);
+
+                xoff = init_int_array(nirreps);
+                zoff = init_int_array(nirreps);
+                for(Gr=0, xcount=0, zcount=0; Gr < nirreps; Gr++) {
+                    xoff[Gr] = xcount;
+                    zoff[Gr] = zcount;
+                    xcount += X->params->rpi[Gr] * X->params->spi[Gr^hxbuf^GX];
+                    zcount += Z->params->rpi[Gr] * Z->params->spi[Gr^hzbuf^GZ];
+                }
 
-                for(Gr=0; Gr < nirreps; Gr++) {
-                    GsX = Gr^hxbuf^GX;
-                    GsZ = Gr^hzbuf^GZ;
+                for(pq_start=0; pq_start < rowtot; pq_start += rows_per_batch) {
+                    nrows = rowtot - pq_start;
+                    if(nrows > rows_per_batch) nrows = rows_per_batch;
 
-                    rowx = X->params->rpi[Gr];
-                    colx = X->params->spi[GsX];
-                    rowz = Z->params->rpi[Gr];
-                    colz = Z->params->spi[GsZ];
+                    for(pq=0; pq < nrows; pq++) {
+                        buf4_mat_irrep_row_zero(X, hxbuf, pq_start+pq);
+                        buf4_mat_irrep_row_rd(X, hxbuf, pq_start+pq);
+                        C_DCOPY(xcols, X->matrix[hxbuf][0], 1, Xblk[pq], 1);
 
-                    if(rowx && colx && colz) {
-                        C_DGEMM('n',Ytrans?'t':'n',rowx,colz,colx,alpha,
-                                &(X->matrix[hxbuf][0][xcount]),colx,
-                                &(Y->matrix[Ytrans?GsZ:GsX][0][0]),Ytrans?colx:colz,1.0,
-                                &(Z->matrix[hzbuf][0][zcount]),colz);
+                        if(fabs(beta) > 0.0) {
+                            buf4_mat_irrep_row_zero(Z, hzbuf, pq_start+pq);
+                            buf4_mat_irrep_row_rd(Z, hzbuf, pq_start+pq);
+                            C_DCOPY(zcols, Z->matrix[hzbuf][0], 1, Zblk[pq], 1);
+                        }
+                        else ::memset(Zblk[pq], 0, zcols*sizeof(double));
                     }
 
-                    xcount += rowx * colx;
-                    zcount += rowz * colz;
+                    ntasks = (long int) nrows * nirreps;
+#pragma omp parallel for schedule(dynamic)
+                    for(long int task=0; task < ntasks; task++) {
+                        int row = task / nirreps;
+                        int Gr = task % nirreps;
+                        int GsX = Gr^hxbuf^GX;
+                        int GsZ = Gr^hzbuf^GZ;
+                        int rowx = X->params->rpi[Gr];
+                        int colx = X->params->spi[GsX];
+                        int colz = Z->params->spi[GsZ];
+
+                        if(rowx && colx && colz) {
+                            C_DGEMM('n',Ytrans?'t':'n',rowx,colz,colx,alpha,
+                                    &(Xblk[row][xoff[Gr]]),colx,
+                                    &(Y->matrix[Ytrans?GsZ:GsX][0][0]),Ytrans?colx:colz,1.0,
+                                    &(Zblk[row][zoff[Gr]]),colz);
+                        }
+                    }
 
+                    for(pq=0; pq < nrows; pq++) {
+                        C_DCOPY(zcols, Zblk[pq], 1, Z->matrix[hzbuf][0], 1);
+                        buf4_mat_irrep_row_wrt(Z, hzbuf, pq_start+pq);
+                    }
                 }
 
-                buf4_mat_irrep_row_wrt(Z, hzbuf, pq);
-
+                free(xoff);
+                free(zoff);
+                free_dpd_block(Xblk, rows_per_batch, xcols);
+                free_dpd_block(Zblk, rows_per_batch, zcols);
             }
 
             buf4_mat_irrep_row_close(X, hxbuf);
@@ -31,12 +31,35 @@
 */
 #include <cstdio>
 #include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <libciomr/libciomr.h>
 #include <libqt/qt.h>
 #include <libpsio/psio.h>
 #include "dpd.h"
 
 namespace psi {
 
+/* Products below this many multiply-adds are scheduled as whole
+** irreps across threads instead of relying on threaded BLAS. */
+#define DPD_SMALL_GEMM 2097152
+
+namespace {
+
+void contract444_irreps(int Xtrans, int Ytrans, int GX, int GY, int Hx,
+                        int *Hy, int *Hz)
+{
+    if      ((!Xtrans)&&(!Ytrans))  {*Hy = Hx^GX;    *Hz = Hx;    }
+    else if ((!Xtrans)&&( Ytrans))  {*Hy = Hx^GX^GY; *Hz = Hx;    }
+    else if (( Xtrans)&&(!Ytrans))  {*Hy = Hx;       *Hz = Hx^GX; }
+    else /* (( Xtrans)&&( Ytrans))*/{*Hy = Hx^GY;    *Hz = Hx^GX; }
+}
+
+}
+
 /* dpd_contract444(): Contracts a pair of four-index quantities to
 ** give a product four-index quantity.
 **
@@ -58,10 +81,13 @@ int DPD::contract444(dpdbuf4 *X, dpdbuf4 *Y, dpdbuf4 *Z,
                      double beta)
 {
     int n, Hx, Hy, Hz, GX, GY, GZ, nirreps, Xtrans, Ytrans, *numlinks, symlink;
-    long int size_Y, size_Z, size_file_X_row;
+    long int size_Y, size_Z, size_file_X_row, size_task;
     int incore, nbuckets;
     long int memoryd, core, rows_per_bucket, rows_left, memtotal;
-    int nrows, ncols, nlinks;
+    int nrows, ncols, nlinks, *done, prefetch;
+    unsigned long int jobid;
+    double **Xblock[2];
+    std::vector<std::pair<double,int> > tasks;
 #if DPD_DEBUG
     int *xrow, *xcol, *yrow, *ycol, *zrow, *zcol;
     double byte_conv;
@@ -93,13 +119,73 @@ int DPD::contract444(dpdbuf4 *X, dpdbuf4 *Y, dpdbuf4 *Z,
     }
 #endif
 
+    /* Irrep-level scheduling: symmetry blocks whose products are too
+    ** small to gain from threaded BLAS are read in together and their
+    ** DGEMMs distributed over threads, largest first.  Everything else
+    ** goes through the loop below one irrep at a time. */
+    done = init_int_array(nirreps);
+    if(X != Y && nirreps > 1) {
+        core = 0;
+        for(Hx=0; Hx < nirreps; Hx++) {
+            contract444_irreps(Xtrans, Ytrans, GX, GY, Hx, &Hy, &Hz);
+            nrows = Z->params->rowtot[Hz];
+            ncols = Z->params->coltot[Hz^GZ];
+            nlinks = numlinks[Hx^symlink];
+            if(!nrows || !ncols || !nlinks) continue;
+            if(((double) nrows) * ncols * nlinks > DPD_SMALL_GEMM) continue;
+
+            size_task = ((long) X->params->rowtot[Hx]) * ((long) X->params->coltot[Hx^GX])
+                      + ((long) Y->params->rowtot[Hy]) * ((long) Y->params->coltot[Hy^GY])
+                      + ((long) nrows) * ((long) ncols);
+            if(core + size_task > dpd_memfree()) continue;
+            core += size_task;
+
+            tasks.push_back(std::make_pair(((double) nrows) * ncols * nlinks, Hx));
+        }
+    }
+
+    if(tasks.size() > 1) {
+        std::sort(tasks.begin(), tasks.end(), std::greater<std::pair<double,int> >());
+
+        for(n=0; n < (int) tasks.size(); n++) {
+            Hx = tasks[n].second;
+            contract444_irreps(Xtrans, Ytrans, GX, GY, Hx, &Hy, &Hz);
+            buf4_mat_irrep_init(X, Hx);
+            buf4_mat_irrep_rd(X, Hx);
+            buf4_mat_irrep_init(Y, Hy);
+            buf4_mat_irrep_rd(Y, Hy);
+            buf4_mat_irrep_init(Z, Hz);
+            if(fabs(beta) > 0.0) buf4_mat_irrep_rd(Z, Hz);
+        }
+
+#pragma omp parallel for schedule(dynamic)
+        for(int t=0; t < (int) tasks.size(); t++) {
+            int Hx = tasks[t].second, Hy, Hz;
+            contract444_irreps(Xtrans, Ytrans, GX, GY, Hx, &Hy, &Hz);
+            C_DGEMM(Xtrans?'t':'n', Ytrans?'t':'n',
+                    Z->params->rowtot[Hz], Z->params->coltot[Hz^GZ],
+                    numlinks[Hx^symlink], alpha,
+                    &(X->matrix[Hx][0][0]), X->params->coltot[Hx^GX],
+                    &(Y->matrix[Hy][0][0]), Y->params->coltot[Hy^GY], beta,
+                    &(Z->matrix[Hz][0][0]), Z->params->coltot[Hz^GZ]);
+        }
+
+        for(n=0; n < (int) tasks.size(); n++) {
+            Hx = tasks[n].second;
+            contract444_irreps(Xtrans, Ytrans, GX, GY, Hx, &Hy, &Hz);
+            buf4_mat_irrep_close(X, Hx);
+            buf4_mat_irrep_wrt(Z, Hz);
+            buf4_mat_irrep_close(Y, Hy);
+            buf4_mat_irrep_close(Z, Hz);
+            done[Hx] = 1;
+        }
+    }
 
     for(Hx=0; Hx < nirreps; Hx++) {
 
-        if      ((!Xtrans)&&(!Ytrans))  {Hy = Hx^GX;    Hz = Hx;    }
-        else if ((!Xtrans)&&( Ytrans))  {Hy = Hx^GX^GY; Hz = Hx;    }
-        else if (( Xtrans)&&(!Ytrans))  {Hy = Hx;       Hz = Hx^GX; }
-        else /* (( Xtrans)&&( Ytrans))*/{Hy = Hx^GY;    Hz = Hx^GX; }
+        if(done[Hx]) continue;
+
+        contract444_irreps(Xtrans, Ytrans, GX, GY, Hx, &Hy, &Hz);
 
         size_Y = ((long) Y->params->rowtot[Hy]) * ((long) Y->params->coltot[Hy^GY]);
         size_Z = ((long) Z->params->rowtot[Hz]) * ((long) Z->params->coltot[Hz^GZ]);
@@ -122,7 +208,7 @@ int DPD::contract444(dpdbuf4 *X, dpdbuf4 *Y, dpdbuf4 *Z,
             nbuckets = (int) ceil((double) X->params->rowtot[Hx]/
                                   (double) rows_per_bucket);
 
-            rows_left = X->params->rowtot[Hx] % rows_per_bucket;
+            rows_left = X->params->rowtot[Hx] - (nbuckets-1)*rows_per_bucket;
 
             incore = 1;
             if(nbuckets > 1) incore = 0;
@@ -189,19 +275,38 @@ int DPD::contract444(dpdbuf4 *X, dpdbuf4 *Y, dpdbuf4 *Z,
                 dpd_error("contract444", "outfile");
             }
 
+            /* When the X buckets can be read asynchronously, split the
+               memory between two of them and overlap the read of bucket
+               n+1 with the DGEMM on bucket n. */
+            prefetch = buf4_mat_irrep_async_ok(X);
+            if(prefetch) {
+                rows_per_bucket = (rows_per_bucket + 1)/2;
+                nbuckets = (int) ceil((double) X->params->rowtot[Hx]/
+                                      (double) rows_per_bucket);
+                rows_left = X->params->rowtot[Hx] - (nbuckets-1)*rows_per_bucket;
+            }
+
             buf4_mat_irrep_init_block(X, Hx, rows_per_bucket);
+            Xblock[0] = X->matrix[Hx];
+            Xblock[1] = prefetch ? dpd_block_matrix(rows_per_bucket, X->params->coltot[Hx^GX]) : Xblock[0];
 
             buf4_mat_irrep_init(Y, Hy);
             buf4_mat_irrep_rd(Y, Hy);
             buf4_mat_irrep_init(Z, Hz);
             if(fabs(beta) > 0.0) buf4_mat_irrep_rd(Z, Hz);
 
+            jobid = 0;
             for(n=0; n < nbuckets; n++) {
 
-                if(n < (nbuckets-1))
-                    buf4_mat_irrep_rd_block(X, Hx, n*rows_per_bucket, rows_per_bucket);
-                else
-                    buf4_mat_irrep_rd_block(X, Hx, n*rows_per_bucket, rows_left);
+                if(n == 0 || !prefetch)
+                    jobid = buf4_mat_irrep_rd_block_async(X, Hx, n*rows_per_bucket,
+                                                          n < (nbuckets-1) ? rows_per_bucket : rows_left, Xblock[n%2]);
+                buf4_mat_irrep_rd_block_wait(jobid);
+                X->matrix[Hx] = Xblock[n%2];
+
+                if(prefetch && n < (nbuckets-1))
+                    jobid = buf4_mat_irrep_rd_block_async(X, Hx, (n+1)*rows_per_bucket,
+                                                          n+1 < (nbuckets-1) ? rows_per_bucket : rows_left, Xblock[(n+1)%2]);
 
                 if(!Xtrans && Ytrans) {
                     nrows = n < (nbuckets-1) ? rows_per_bucket : rows_left;
@@ -229,7 +334,11 @@ int DPD::contract444(dpdbuf4 *X, dpdbuf4 *Y, dpdbuf4 *Z,
                 }
             }
 
+            buf4_mat_irrep_rd_block_wait(jobid);
+
+            X->matrix[Hx] = Xblock[0];
             buf4_mat_irrep_close_block(X, Hx, rows_per_bucket);
+            if(prefetch) free_dpd_block(Xblock[1], rows_per_bucket, X->params->coltot[Hx^GX]);
 
             buf4_mat_irrep_close(Y, Hy);
             buf4_mat_irrep_wrt(Z, Hz);
@@ -238,6 +347,8 @@ int DPD::contract444(dpdbuf4 *X, dpdbuf4 *Y, dpdbuf4 *Z,
         } // !incore
     } // Hx
 
+    free(done);
+
     return 0;
 }
 
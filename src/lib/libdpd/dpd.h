@@ -214,6 +214,7 @@ struct dpd_gbl {
     long int memused;       /* Total memory used (cache + other) */
     long int memcache;      /* Total memory in cache (locked and unlocked) */
     long int memlocked;     /* Total memory locked in the cache */
+    int prefetch;           /* Overlap out-of-core block reads with computation? */
 
     // The default C'tor will zero everything out properly
     dpd_gbl():
@@ -377,6 +378,8 @@ public:
                       int pqnum, int rsnum, const char *label);
     int buf4_sort_axpy(dpdbuf4 *InBuf, int outfilenum, enum indices index,
                        int pqnum, int rsnum, const char *label, double alpha);
+    int buf4_sort_incore(dpdbuf4 *InBuf, dpdbuf4 *OutBuf, enum indices index,
+                         double alpha, int accumulate);
     int buf4_axpy(dpdbuf4 *BufX, dpdbuf4 *BufY, double alpha);
     int buf4_axpbycz(dpdbuf4 *FileA, dpdbuf4 *FileB, dpdbuf4 *FileC,
                      double a, double b, double c);
@@ -401,6 +404,13 @@ public:
                                 int num_pq);
     int buf4_mat_irrep_wrt_block(dpdbuf4 *Buf, int irrep, int start_pq,
                                  int num_pq);
+    int buf4_mat_irrep_async_ok(dpdbuf4 *Buf);
+    unsigned long int buf4_mat_irrep_rd_block_async(dpdbuf4 *Buf, int irrep, int start_pq,
+                                                    int num_pq, double **block);
+    void buf4_mat_irrep_rd_block_wait(unsigned long int jobid);
+    unsigned long int buf4_mat_irrep_wrt_block_async(dpdbuf4 *Buf, int irrep, int start_pq,
+                                                     int num_pq, double **block);
+    void buf4_mat_irrep_wrt_block_wait(unsigned long int jobid);
     int buf4_dump(dpdbuf4 *DPDBuf, struct iwlbuf *IWLBuf,
                   int *prel, int *qrel, int *rrel, int *srel,
                   int bk_pack, int swap23);
@@ -527,6 +537,7 @@ extern int dpd_init(int dpd_num, int nirreps, long int memory, int cachetype,
 extern int dpd_close(int dpd_num);
 extern long int dpd_memfree(void);
 extern void dpd_memset(long int memory);
+extern void dpd_set_prefetch(int prefetch);
 
 
 }// Namespace psi
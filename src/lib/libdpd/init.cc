@@ -97,6 +97,12 @@ extern void dpd_memset(long int memory)
   dpd_main.memory = memory;
 }
 
+/* Turns asynchronous prefetching of out-of-core row blocks on or off */
+extern void dpd_set_prefetch(int prefetch)
+{
+  dpd_main.prefetch = prefetch;
+}
+
 DPD::DPD():
     nirreps(0),
     num_subspaces(0),
@@ -187,6 +193,7 @@ int DPD::init(int dpd_num_in, int nirreps_in, long int memory_in, int cachetype_
     dpd_main.memused = 0; /* At first... */
     dpd_main.memcache = 0; /* At first... */
     dpd_main.memlocked = 0; /* At first... */
+    dpd_main.prefetch = 1;
 
     dpd_main.cachetype = cachetype_in;
     dpd_main.cachelist = cachelist_in;
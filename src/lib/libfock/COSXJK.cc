@@ -0,0 +1,374 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2016 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+#include <libmints/mints.h>
+#include <libmints/sieve.h>
+#include <libqt/qt.h>
+#include <psi4-dec.h>
+#include "jk.h"
+#include "cubature.h"
+#include "points.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include "libparallel/ParallelPrinter.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace std;
+using namespace psi;
+
+namespace {
+
+// Distance from g to the segment from A to A + AB
+double segment_distance(const Vector3& g, const Vector3& A, const Vector3& AB)
+{
+    Vector3 Ag = g - A;
+    double AB2 = AB.dot(AB);
+    double t = (AB2 > 0.0 ? Ag.dot(AB) / AB2 : 0.0);
+    t = std::max(0.0, std::min(1.0, t));
+    Vector3 dg = Ag - t * AB;
+    return dg.norm();
+}
+
+}
+
+namespace psi {
+
+COSXJK::COSXJK(boost::shared_ptr<BasisSet> primary, Options& options) :
+   DirectJK(primary), options_(options)
+{
+    common_init();
+}
+COSXJK::~COSXJK()
+{
+}
+void COSXJK::common_init()
+{
+    cosx_radial_points_ = 35;
+    cosx_spherical_points_ = 110;
+    cosx_cutoff_ = 1.0E-12;
+}
+void COSXJK::print_header() const
+{
+    if (print_) {
+        outfile->Printf( "  ==> COSXJK: Direct J, Seminumerical K <==\n\n");
+
+        outfile->Printf( "    J tasked:          %11s\n", (do_J_ ? "Yes" : "No"));
+        outfile->Printf( "    K tasked:          %11s\n", (do_K_ ? "Yes" : "No"));
+        outfile->Printf( "    wK tasked:         %11s\n", (do_wK_ ? "Yes" : "No"));
+        outfile->Printf( "    OpenMP threads:    %11d\n", omp_nthread_);
+        outfile->Printf( "    Integrals threads: %11d\n", df_ints_num_threads_);
+        outfile->Printf( "    Radial Points:     %11d\n", cosx_radial_points_);
+        outfile->Printf( "    Spherical Points:  %11d\n", cosx_spherical_points_);
+        outfile->Printf( "    Incremental Fock:  %11s\n", (incfock_ ? "Yes" : "No"));
+        outfile->Printf( "    Schwarz Cutoff:    %11.0E\n", cutoff_);
+        outfile->Printf( "    COSX Cutoff:       %11.0E\n\n", cosx_cutoff_);
+    }
+}
+void COSXJK::preiterations()
+{
+    if (do_wK_) {
+        throw PSIEXCEPTION("COSXJK: wK integrals are not available");
+    }
+
+    DirectJK::preiterations();
+
+    std::map<std::string, int> grid_opts;
+    grid_opts["DFT_RADIAL_POINTS"] = cosx_radial_points_;
+    grid_opts["DFT_SPHERICAL_POINTS"] = cosx_spherical_points_;
+    grid_ = boost::shared_ptr<DFTGrid>(new DFTGrid(primary_->molecule(), primary_, grid_opts, options_));
+
+    if (print_ > 1) {
+        grid_->print("outfile", print_);
+    }
+}
+void COSXJK::postiterations()
+{
+    DirectJK::postiterations();
+    grid_.reset();
+}
+void COSXJK::compute_JK()
+{
+    if (do_wK_) {
+        throw PSIEXCEPTION("COSXJK: wK integrals are not available");
+    }
+
+    // DirectJK does J (and the incremental bookkeeping for it)
+    bool do_K = do_K_;
+    do_K_ = false;
+    if (do_J_) {
+        DirectJK::compute_JK();
+    }
+    do_K_ = do_K;
+
+    if (do_K_) {
+        build_K_cosx();
+    }
+}
+void COSXJK::build_K_cosx()
+{
+    int nbf = primary_->nbf();
+    int nshell = primary_->nshell();
+    int ndens = D_ao_.size();
+    int max_points = grid_->max_points();
+    int max_functions = grid_->max_functions();
+    const std::vector<boost::shared_ptr<BlockOPoints> >& blocks = grid_->blocks();
+    const std::vector<std::pair<int,int> >& shell_pairs = sieve_->shell_pairs();
+    size_t npairs = shell_pairs.size();
+
+    // |A_{rs}(g)| <= \sum_{ij} |c_i c_j| (pi/p)^{3/2} exp(-a_i b_j AB^2/p) min(2 (p/pi)^{1/2}, 1/d_ij)
+    // for s shells, d_ij the distance from g to the product center, which lies
+    // on the segment AB. Per pair: the summed overlaps (pair_overlap), the
+    // largest p (pair_pmax) and the segment (from pair_A to pair_A + pair_AB).
+    std::vector<double> pair_overlap(npairs);
+    std::vector<double> pair_near(npairs);
+    std::vector<Vector3> pair_A(npairs);
+    std::vector<Vector3> pair_AB(npairs);
+    for (size_t RS = 0; RS < npairs; RS++) {
+        const GaussianShell& Rsh = primary_->shell(shell_pairs[RS].first);
+        const GaussianShell& Ssh = primary_->shell(shell_pairs[RS].second);
+        pair_A[RS] = Rsh.center();
+        pair_AB[RS] = Ssh.center() - Rsh.center();
+        double AB2 = pair_AB[RS].dot(pair_AB[RS]);
+        double overlap = 0.0;
+        double pmax = 0.0;
+        for (int i = 0; i < Rsh.nprimitive(); i++) {
+            for (int j = 0; j < Ssh.nprimitive(); j++) {
+                double a = Rsh.exp(i);
+                double b = Ssh.exp(j);
+                double p = a + b;
+                overlap += fabs(Rsh.coef(i) * Ssh.coef(j)) * pow(M_PI / p, 1.5) * exp(-a * b * AB2 / p);
+                pmax = std::max(pmax, p);
+            }
+        }
+        pair_overlap[RS] = overlap;
+        pair_near[RS] = 2.0 * sqrt(pmax / M_PI);
+    }
+
+    for (int N = 0; N < ndens; N++) {
+        K_ao_[N]->zero();
+    }
+
+    int nthread = omp_nthread_;
+
+    // => Per-thread integrals and scratch <= //
+
+    boost::shared_ptr<IntegralFactory> factory(new IntegralFactory(primary_,primary_,primary_,primary_));
+    std::vector<boost::shared_ptr<OneBodyAOInt> > ints;
+    std::vector<boost::shared_ptr<BasisFunctions> > points;
+    std::vector<SharedMatrix> charges;
+    std::vector<SharedMatrix> Dtemps;
+    std::vector<SharedMatrix> Ktemps;
+    std::vector<std::vector<SharedMatrix> > Ftemps;
+    std::vector<std::vector<SharedMatrix> > Gtemps;
+    std::vector<std::vector<double> > Fmaxes;
+    std::vector<std::vector<int> > block_pairs;
+    std::vector<std::vector<int> > block_shells;
+    for (int thread = 0; thread < nthread; thread++) {
+        ints.push_back(boost::shared_ptr<OneBodyAOInt>(factory->ao_potential()));
+        // A unit negative charge turns the nuclear attraction into (rs|1/|r-g|)
+        charges.push_back(SharedMatrix(new Matrix("Point Charge (Z,x,y,z)", 1, 4)));
+        charges[thread]->set(0, 0, -1.0);
+        static_cast<PotentialInt*>(ints[thread].get())->set_charge_field(charges[thread]);
+        points.push_back(boost::shared_ptr<BasisFunctions>(new BasisFunctions(primary_, max_points, max_functions)));
+        Dtemps.push_back(SharedMatrix(new Matrix("D Local", max_functions, nbf)));
+        Ktemps.push_back(SharedMatrix(new Matrix("K Local", max_functions, nbf)));
+        Ftemps.push_back(std::vector<SharedMatrix>());
+        Gtemps.push_back(std::vector<SharedMatrix>());
+        for (int N = 0; N < ndens; N++) {
+            Ftemps[thread].push_back(SharedMatrix(new Matrix("F", max_points, nbf)));
+            Gtemps[thread].push_back(SharedMatrix(new Matrix("G", max_points, nbf)));
+        }
+        Fmaxes.push_back(std::vector<double>(nshell));
+        block_pairs.push_back(std::vector<int>());
+        block_shells.push_back(std::vector<int>());
+    }
+
+    // => Blocks in parallel <= //
+
+    #pragma omp parallel for schedule(dynamic) num_threads(nthread)
+    for (size_t Q = 0; Q < blocks.size(); Q++) {
+
+        int thread = 0;
+        #ifdef _OPENMP
+            thread = omp_get_thread_num();
+        #endif
+
+        boost::shared_ptr<BlockOPoints> block = blocks[Q];
+        int npoints = block->npoints();
+        const std::vector<int>& function_map = block->functions_local_to_global();
+        int nlocal = function_map.size();
+        if (npoints == 0 || nlocal == 0) continue;
+
+        double* x = block->x();
+        double* y = block->y();
+        double* z = block->z();
+        double* w = block->w();
+
+        points[thread]->compute_functions(block);
+        double** Xp = points[thread]->basis_value(BASIS_PHI)->pointer();
+
+        double** Dlp = Dtemps[thread]->pointer();
+        double** Klp = Ktemps[thread]->pointer();
+        double** Zp = charges[thread]->pointer();
+        std::vector<double>& Fmax = Fmaxes[thread];
+        boost::shared_ptr<OneBodyAOInt> pot = ints[thread];
+        const double* buffer = pot->buffer();
+
+        // => F_{gr} = X_{gs} D_{sr} <= //
+
+        for (int N = 0; N < ndens; N++) {
+            double** Dp = D_ao_[N]->pointer();
+            for (int ml = 0; ml < nlocal; ml++) {
+                ::memcpy(Dlp[ml], Dp[function_map[ml]], sizeof(double) * nbf);
+            }
+            double** Fp = Ftemps[thread][N]->pointer();
+            C_DGEMM('N','N',npoints,nbf,nlocal,1.0,Xp[0],max_functions,Dlp[0],nbf,0.0,Fp[0],nbf);
+            ::memset(Gtemps[thread][N]->pointer()[0], '\0', sizeof(double) * npoints * nbf);
+        }
+
+        // => Significant shells and pairs of the block <= //
+
+        // Shell maxima of |F| over the points of the block and all densities
+        std::fill(Fmax.begin(), Fmax.end(), 0.0);
+        for (int N = 0; N < ndens; N++) {
+            double** Fp = Ftemps[thread][N]->pointer();
+            for (int P = 0; P < npoints; P++) {
+                for (int R = 0; R < nshell; R++) {
+                    int oR = primary_->shell(R).function_index();
+                    int nR = primary_->shell(R).nfunction();
+                    for (int r = 0; r < nR; r++) {
+                        Fmax[R] = std::max(Fmax[R], fabs(Fp[P][oR + r]));
+                    }
+                }
+            }
+        }
+
+        std::vector<int>& pairs = block_pairs[thread];
+        std::vector<int>& shells = block_shells[thread];
+        pairs.clear();
+        shells.clear();
+        std::vector<char> shell_used(nshell, 0);
+        const Vector3& xc = block->xc();
+        for (size_t RS = 0; RS < npairs; RS++) {
+            int R = shell_pairs[RS].first;
+            int S = shell_pairs[RS].second;
+            double Fbound = std::max(Fmax[R], Fmax[S]) * pair_overlap[RS];
+            if (Fbound * pair_near[RS] < cosx_cutoff_) continue;
+            double d = segment_distance(xc, pair_A[RS], pair_AB[RS]) - block->R();
+            if (d > 0.0 && Fbound / d < cosx_cutoff_) continue;
+            pairs.push_back(RS);
+            if (!shell_used[R]) shells.push_back(R);
+            if (!shell_used[S] && S != R) shells.push_back(S);
+            shell_used[R] = shell_used[S] = 1;
+        }
+
+        // => G_{gn} = A_{rn}(g) F_{gr}, one point at a time, over the pairs of the block <= //
+
+        for (int P = 0; P < npoints; P++) {
+
+            // Shell maxima of |F_g| over all densities, on the shells of the block
+            for (size_t k = 0; k < shells.size(); k++) {
+                int R = shells[k];
+                int oR = primary_->shell(R).function_index();
+                int nR = primary_->shell(R).nfunction();
+                double FR = 0.0;
+                for (int N = 0; N < ndens; N++) {
+                    double* Fg = Ftemps[thread][N]->pointer()[P];
+                    for (int r = 0; r < nR; r++) {
+                        FR = std::max(FR, fabs(Fg[oR + r]));
+                    }
+                }
+                Fmax[R] = FR;
+            }
+
+            Vector3 g(x[P], y[P], z[P]);
+            Zp[0][1] = x[P];
+            Zp[0][2] = y[P];
+            Zp[0][3] = z[P];
+
+            for (size_t k = 0; k < pairs.size(); k++) {
+                int RS = pairs[k];
+                int R = shell_pairs[RS].first;
+                int S = shell_pairs[RS].second;
+                double d = segment_distance(g, pair_A[RS], pair_AB[RS]);
+                double A_est = pair_overlap[RS] * (d * pair_near[RS] > 1.0 ? 1.0 / d : pair_near[RS]);
+                if (A_est * std::max(Fmax[R], Fmax[S]) < cosx_cutoff_) continue;
+
+                pot->compute_shell(R,S);
+
+                int nR = primary_->shell(R).nfunction();
+                int nS = primary_->shell(S).nfunction();
+                int oR = primary_->shell(R).function_index();
+                int oS = primary_->shell(S).function_index();
+
+                for (int N = 0; N < ndens; N++) {
+                    double* Fg = Ftemps[thread][N]->pointer()[P];
+                    double* Gg = Gtemps[thread][N]->pointer()[P];
+                    for (int r = 0; r < nR; r++) {
+                        for (int s = 0; s < nS; s++) {
+                            double val = buffer[r * nS + s];
+                            Gg[oS + s] += Fg[oR + r] * val;
+                            if (R != S) Gg[oR + r] += Fg[oS + s] * val;
+                        }
+                    }
+                }
+            }
+        }
+
+        // => K_{mn} += w_g X_{gm} G_{gn} <= //
+
+        for (int N = 0; N < ndens; N++) {
+            double** Gp = Gtemps[thread][N]->pointer();
+            for (int P = 0; P < npoints; P++) {
+                C_DSCAL(nbf,w[P],Gp[P],1);
+            }
+            C_DGEMM('T','N',nlocal,nbf,npoints,1.0,Xp[0],max_functions,Gp[0],nbf,0.0,Klp[0],nbf);
+
+            double** Kp = K_ao_[N]->pointer();
+            #pragma omp critical
+            {
+                for (int ml = 0; ml < nlocal; ml++) {
+                    C_DAXPY(nbf,1.0,Klp[ml],1,Kp[function_map[ml]],1);
+                }
+            }
+        }
+    }
+
+    // The quadrature only reaches the exact (symmetric) K in the grid limit
+    if (lr_symmetric_) {
+        for (int N = 0; N < ndens; N++) {
+            K_ao_[N]->hermitivitize();
+        }
+    }
+}
+
+}
@@ -43,6 +43,7 @@
 
 #include<lib3index/cholesky.h>
 
+#include <algorithm>
 #include <sstream>
 #include "libparallel/ParallelPrinter.h"
 #ifdef _OPENMP
@@ -74,6 +75,8 @@ void DFJK::common_init()
     unit_ = PSIF_DFSCF_BJ;
     is_core_ = true;
     psio_ = PSIO::shared_object();
+    sparse_left_ = 0L;
+    sparse_right_ = 0L;
 }
 SharedVector DFJK::iaia(SharedMatrix Ci, SharedMatrix Ca)
 {
@@ -300,6 +303,8 @@ unsigned long int DFJK::memory_temp() const
     mem += 2L * sieve_->function_pairs().size() + auxiliary_->nbf();
     // K Overhead (C_temp, Q_temp)
     mem += omp_nthread_ * (unsigned long int) primary_->nbf() * (auxiliary_->nbf() + max_nocc());
+    // Sparse K overhead (R_temp, K_temp), only when some K_ao_[N] can go sparse
+    mem += omp_nthread_ * (unsigned long int) sparse_right_ * (auxiliary_->nbf() + sparse_left_);
 
     return mem;
 }
@@ -307,10 +312,9 @@ int DFJK::max_rows() const
 {
     // Start with all memory
     unsigned long int mem = memory_;
-    // Subtract J/K/wK/C/D overhead
-    mem -= memory_overhead();
-    // Subtract threading temp overhead
-    mem -= memory_temp();
+    // Subtract J/K/wK/C/D overhead and threading temp overhead
+    unsigned long int temp = memory_overhead() + memory_temp();
+    mem = (mem > temp ? mem - temp : 0L);
 
     // How much will each row cost?
     unsigned long int row_cost = 0L;
@@ -336,6 +340,78 @@ int DFJK::max_nocc() const
     }
     return max_nocc;
 }
+std::vector<std::vector<int> > DFJK::K_significant_functions(SharedMatrix C, const std::vector<double>& Qmax) const
+{
+    const std::vector<long int>& function_pairs_reverse = sieve_->function_pairs_reverse();
+
+    int nbf = C->rowspi()[0];
+    int nocc = C->colspi()[0];
+    double** Cp = C->pointer();
+
+    std::vector<double> Cmax(nbf, 0.0);
+    for (int n = 0; n < nbf; n++) {
+        for (int i = 0; i < nocc; i++) {
+            Cmax[n] = std::max(Cmax[n], fabs(Cp[n][i]));
+        }
+    }
+
+    // The screen of block_K_transform; with the largest |(Q|mn)| over all Q
+    // it keeps every (m,i) that any block of Q can keep
+    std::vector<std::vector<int> > funs(nocc);
+    std::vector<double> bound(nocc);
+    for (int m = 0; m < nbf; m++) {
+        std::fill(bound.begin(), bound.end(), 0.0);
+        const std::vector<int>& pairs = sieve_->function_to_function()[m];
+        for (size_t k = 0; k < pairs.size(); k++) {
+            int n = pairs[k];
+            long int ij = function_pairs_reverse[(m >= n ? (m * (m + 1L) >> 1) + n : (n * (n + 1L) >> 1) + m)];
+            if (Qmax[ij] * Cmax[n] < cutoff_) continue;
+            for (int i = 0; i < nocc; i++) {
+                bound[i] += Qmax[ij] * fabs(Cp[n][i]);
+            }
+        }
+        for (int i = 0; i < nocc; i++) {
+            if (bound[i] >= cutoff_) funs[i].push_back(m);
+        }
+    }
+    return funs;
+}
+void DFJK::sparse_K_extents()
+{
+    sparse_K_.assign(K_ao_.size(), 0);
+    sparse_left_ = 0L;
+    sparse_right_ = 0L;
+    if (!do_K_ || Qmax_.empty()) return;
+
+    int nbf = primary_->nbf();
+    std::vector<std::vector<int> > left_funs;
+    std::vector<std::vector<int> > right_funs;
+    for (size_t N = 0; N < K_ao_.size(); N++) {
+        int nocc = C_left_ao_[N]->colspi()[0];
+        if (!nocc) continue;
+
+        if (N == 0 || C_left_[N].get() != C_left_[N-1].get())
+            left_funs = K_significant_functions(C_left_ao_[N], Qmax_);
+        if (!lr_symmetric_ && (N == 0 || C_right_[N].get() != C_right_[N-1].get()))
+            right_funs = K_significant_functions(C_right_ao_[N], Qmax_);
+        const std::vector<std::vector<int> >& rfuns = (lr_symmetric_ ? left_funs : right_funs);
+
+        // Same test as block_K_contract; canonical orbitals never pass it
+        double sparse_flops = 0.0;
+        size_t max_left = 0L;
+        size_t max_right = 0L;
+        for (int i = 0; i < nocc; i++) {
+            sparse_flops += (double) left_funs[i].size() * rfuns[i].size();
+            max_left = std::max(max_left, left_funs[i].size());
+            max_right = std::max(max_right, rfuns[i].size());
+        }
+        if (sparse_flops >= 0.5 * nbf * (double) nbf * nocc) continue;
+
+        sparse_K_[N] = 1;
+        sparse_left_ = std::max(sparse_left_, max_left);
+        sparse_right_ = std::max(sparse_right_, max_right);
+    }
+}
 void DFJK::initialize_temps()
 {
     J_temp_ = boost::shared_ptr<Vector>(new Vector("Jtemp", sieve_->function_pairs().size()));
@@ -367,6 +443,12 @@ void DFJK::initialize_temps()
     else
         E_right_ = boost::shared_ptr<Matrix>(new Matrix("E_right", primary_->nbf(), max_rows_ * max_nocc_));
 
+    if (sparse_left_ && sparse_right_) {
+        for (int thread = 0; thread < omp_nthread_; thread++) {
+            R_temp_.push_back(SharedMatrix(new Matrix("Rtemp", max_rows_, sparse_right_)));
+            K_temp_.push_back(SharedMatrix(new Matrix("Ktemp", sparse_left_, sparse_right_)));
+        }
+    }
 }
 void DFJK::initialize_w_temps()
 {
@@ -404,6 +486,8 @@ void DFJK::free_temps()
     E_right_.reset();
     C_temp_.clear();
     Q_temp_.clear();
+    R_temp_.clear();
+    K_temp_.clear();
 }
 void DFJK::free_w_temps()
 {
@@ -440,6 +524,7 @@ void DFJK::preiterations()
 void DFJK::compute_JK()
 {
     max_nocc_ = max_nocc();
+    sparse_K_extents();
     max_rows_ = max_rows();
 
     if (do_J_ || do_K_) {
@@ -493,6 +578,8 @@ void DFJK::initialize_JK_core()
         psio_->open(unit_,PSIO_OPEN_OLD);
         psio_->read_entry(unit_, "(Q|mn) Integrals", (char*) Qmnp[0], sizeof(double) * ntri * auxiliary_->nbf());
         psio_->close(unit_,1);
+        Qmax_.assign(ntri, 0.0);
+        form_Qmax(Qmnp, auxiliary_->nbf(), 0L, ntri, ntri);
         return;
     }
 
@@ -592,6 +679,9 @@ void DFJK::initialize_JK_core()
     timer_off("JK: (Q|mn)");
     //Qmn_->print();
 
+    Qmax_.assign(ntri, 0.0);
+    form_Qmax(Qmnp, auxiliary_->nbf(), 0L, ntri, ntri);
+
     if (df_ints_io_ == "SAVE") {
         psio_->open(unit_,PSIO_OPEN_NEW);
         psio_->write_entry(unit_, "(Q|mn) Integrals", (char*) Qmnp[0], sizeof(double) * ntri * auxiliary_->nbf());
@@ -600,7 +690,8 @@ void DFJK::initialize_JK_core()
 }
 void DFJK::initialize_JK_disk()
 {
-    // Try to load
+    // Try to load (without Qmax_, K stays dense)
+    Qmax_.clear();
     if (df_ints_io_ == "LOAD") {
         return;
     }
@@ -691,6 +782,14 @@ void DFJK::initialize_JK_disk()
         throw PSIEXCEPTION(message.str());
     }
 
+    // Two half-size chunks, if they fit: one is written behind while the
+    // other is filled
+    int nbuffer = 1;
+    if (2L * min_mem <= buffer_memory) {
+        nbuffer = 2;
+        buffer_memory /= 2L;
+    }
+
     // ==> Reduced indexing by M <== //
 
     // Figure out the MN start index per M row
@@ -792,11 +891,14 @@ void DFJK::initialize_JK_disk()
             max_cols = mn_col_b[block];
     }
 
-    // Primary buffer
-    Qmn_ = SharedMatrix(new Matrix("(Q|mn) (Disk Chunk)", naux, max_cols));
+    // Primary buffers
+    std::vector<SharedMatrix> Qmn_chunks;
+    for (int buf = 0; buf < nbuffer; buf++)
+        Qmn_chunks.push_back(SharedMatrix(new Matrix("(Q|mn) (Disk Chunk)", naux, max_cols)));
+    std::vector<unsigned long int> Qmn_writes(nbuffer, 0L);
     // Fitting buffer
     SharedMatrix Amn (new Matrix("(Q|mn) (Buffer)",naux,naux));
-    double** Qmnp = Qmn_->pointer();
+    double** Qmnp = Qmn_chunks[0]->pointer();
     double** Amnp = Amn->pointer();
 
     // ==> Prestripe/Jinv <== //
@@ -842,6 +944,13 @@ void DFJK::initialize_JK_disk()
         int MN_col_val = MN_col_b[block];
         int mn_col_val = mn_col_b[block];
 
+        // The chunk must be on disk before it is refilled
+        int buf = block % nbuffer;
+        timer_on("JK: (Q|mn) Write");
+        if (Qmn_writes[buf]) aio->wait_for_job(Qmn_writes[buf]);
+        timer_off("JK: (Q|mn) Write");
+        Qmnp = Qmn_chunks[buf]->pointer();
+
         // ==> (A|mn) integrals <== //
 
         timer_on("JK: (A|mn)");
@@ -899,21 +1008,22 @@ void DFJK::initialize_JK_disk()
 
         timer_off("JK: (Q|mn)");
 
-        // ==> Disk striping <== //
-
-        timer_on("JK: (Q|mn) Write");
+        if (block == 0) Qmax_.assign(ntri, 0.0);
+        form_Qmax(Qmnp, naux, mn_start_val, mn_col_val, max_cols);
 
-        psio_address addr;
-        for (int Q = 0; Q < naux; Q++) {
-            addr = psio_get_address(PSIO_ZERO, (Q*(ULI) ntri + mn_start_val)*sizeof(double));
-            psio_->write(unit_,"(Q|mn) Integrals", (char*)Qmnp[Q],mn_col_val*sizeof(double),addr,&addr);
-        }
+        // ==> Disk striping <== //
 
-        timer_off("JK: (Q|mn) Write");
+        // Row Q of the chunk goes to columns mn_start_val onwards of row Q on disk
+        Qmn_writes[buf] = aio->write_discont(unit_,"(Q|mn) Integrals",Qmnp,naux,mn_col_val,ntri - mn_col_val,
+            psio_get_address(PSIO_ZERO, mn_start_val*sizeof(double)));
     }
 
+    timer_on("JK: (Q|mn) Write");
+    aio->synchronize();
+    timer_off("JK: (Q|mn) Write");
+
     // ==> Close out <== //
-    Qmn_.reset();
+    Qmn_chunks.clear();
     delete[] eri;
 
     psio_->close(unit_,1);
@@ -1657,27 +1767,71 @@ void DFJK::manage_JK_core()
 void DFJK::manage_JK_disk()
 {
     int ntri = sieve_->function_pairs().size();
-    Qmn_ = SharedMatrix(new Matrix("(Q|mn) Block", max_rows_, ntri));
+    int naux_total = auxiliary_->nbf();
     psio_->open(unit_,PSIO_OPEN_OLD);
-    for (int Q = 0 ; Q < auxiliary_->nbf(); Q += max_rows_) {
-        int naux = (auxiliary_->nbf() - Q <= max_rows_ ? auxiliary_->nbf() - Q : max_rows_);
+
+    // If the file is memory mapped (PSIOManager::set_specific_mmap), the
+    // blocks are used in place and no staging buffer is needed
+    double* Qmn_mapped = (double*) psio_->mapped_pointer(unit_,"(Q|mn) Integrals",PSIO_ZERO,0);
+    if (((size_t) Qmn_mapped) % sizeof(double))
+        Qmn_mapped = NULL;
+
+    // Otherwise the blocks are streamed through two half-size buffers, the
+    // next block being read ahead while the current one is contracted
+    int max_rows = max_rows_;
+    int nbuffer = 1;
+    if (!Qmn_mapped && max_rows_ > 1 && max_rows_ < naux_total) {
+        nbuffer = 2;
+        max_rows = max_rows_ / 2;
+    }
+    int nblock = (naux_total + max_rows - 1) / max_rows;
+
+    std::vector<SharedMatrix> Qmn_blocks;
+    std::vector<unsigned long int> reads(nbuffer, 0L);
+    std::vector<psio_address> ends(nbuffer);
+    boost::shared_ptr<AIOHandler> aio;
+    if (!Qmn_mapped) {
+        for (int buf = 0; buf < nbuffer; buf++)
+            Qmn_blocks.push_back(SharedMatrix(new Matrix("(Q|mn) Block", max_rows, ntri)));
+        Qmn_ = Qmn_blocks[0];
+        aio = boost::shared_ptr<AIOHandler>(new AIOHandler(psio_));
+    }
+
+    int next = 0;
+    for (int block = 0; block < nblock; block++) {
+        int Q = block * max_rows;
+        int naux = (naux_total - Q <= max_rows ? naux_total - Q : max_rows);
         psio_address addr = psio_get_address(PSIO_ZERO, (Q*(ULI) ntri) * sizeof(double));
+        double* Qmnp;
 
         timer_on("JK: (Q|mn) Read");
-        psio_->read(unit_,"(Q|mn) Integrals", (char*)(Qmn_->pointer()[0]),sizeof(double)*naux*ntri,addr,&addr);
+        if (Qmn_mapped) {
+            Qmnp = (double*) psio_->mapped_pointer(unit_,"(Q|mn) Integrals",addr,sizeof(double)*naux*ntri);
+        } else {
+            for (; next < nblock && next < block + nbuffer; next++) {
+                int Qn = next * max_rows;
+                int nauxn = (naux_total - Qn <= max_rows ? naux_total - Qn : max_rows);
+                int buf = next % nbuffer;
+                reads[buf] = aio->read(unit_,"(Q|mn) Integrals",(char*)(Qmn_blocks[buf]->pointer()[0]),
+                    sizeof(double)*nauxn*ntri,psio_get_address(PSIO_ZERO,(Qn*(ULI) ntri)*sizeof(double)),&ends[buf]);
+            }
+            aio->wait_for_job(reads[block % nbuffer]);
+            Qmnp = Qmn_blocks[block % nbuffer]->pointer()[0];
+        }
         timer_off("JK: (Q|mn) Read");
 
         if (do_J_) {
             timer_on("JK: J");
-            block_J(&Qmn_->pointer()[0],naux);
+            block_J(&Qmnp,naux);
             timer_off("JK: J");
         }
         if (do_K_) {
             timer_on("JK: K");
-            block_K(&Qmn_->pointer()[0],naux);
+            block_K(&Qmnp,naux);
             timer_off("JK: K");
         }
     }
+    aio.reset();
     psio_->close(unit_,1);
     Qmn_.reset();
 }
@@ -1756,11 +1910,37 @@ void DFJK::block_J(double** Qmnp, int naux)
         }
     }
 }
+void DFJK::form_Qmax(double** Qmnp, int naux, size_t col, size_t ncol, size_t ld)
+{
+    #pragma omp parallel for schedule (static)
+    for (long int mn = 0L; mn < (long int) ncol; mn++) {
+        double Qmn = Qmax_[col + mn];
+        for (int Q = 0; Q < naux; Q++) {
+            Qmn = std::max(Qmn, fabs(Qmnp[0][Q * ld + mn]));
+        }
+        Qmax_[col + mn] = Qmn;
+    }
+}
 void DFJK::block_K(double** Qmnp, int naux)
 {
-    const std::vector<std::pair<int, int> >& function_pairs = sieve_->function_pairs();
-    const std::vector<long int>& function_pairs_reverse = sieve_->function_pairs_reverse();
-    unsigned long int num_nm = function_pairs.size();
+    unsigned long int num_nm = sieve_->function_pairs().size();
+
+    // Largest |(Q|mn)| over this block of rows, for screening the occupied transforms
+    std::vector<double> Qmax(num_nm, 0.0);
+    const unsigned long int tile = 1024L;
+    #pragma omp parallel for schedule (static)
+    for (long int mn0 = 0L; mn0 < (long int) num_nm; mn0 += tile) {
+        unsigned long int mn1 = std::min(mn0 + tile, num_nm);
+        for (int Q = 0; Q < naux; Q++) {
+            for (unsigned long int mn = mn0; mn < mn1; mn++) {
+                Qmax[mn] = std::max(Qmax[mn], fabs(Qmnp[Q][mn]));
+            }
+        }
+    }
+
+    // Which (m,i) blocks of E_left/E_right are significant
+    std::vector<char> left_mask;
+    std::vector<char> right_mask;
 
     for (size_t N = 0; N < K_ao_.size(); N++) {
 
@@ -1769,87 +1949,186 @@ void DFJK::block_K(double** Qmnp, int naux)
 
         if (!nocc) continue;
 
-        double** Clp  = C_left_ao_[N]->pointer();
-        double** Crp  = C_right_ao_[N]->pointer();
         double** Elp  = E_left_->pointer();
         double** Erp  = E_right_->pointer();
         double** Kp   = K_ao_[N]->pointer();
 
         if (N == 0 || C_left_[N].get() != C_left_[N-1].get()) {
-
             timer_on("JK: K1");
+            block_K_transform(Qmnp, naux, Qmax, C_left_ao_[N], Elp, left_mask);
+            timer_off("JK: K1");
+        }
 
-            #pragma omp parallel for schedule (dynamic)
-            for (int m = 0; m < nbf; m++) {
-
-                int thread = 0;
-                #ifdef _OPENMP
-                    thread = omp_get_thread_num();
-                #endif
+        if (!lr_symmetric_ && (N == 0 || C_right_[N].get() != C_right_[N-1].get())) {
 
-                double** Ctp = C_temp_[thread]->pointer();
-                double** QSp = Q_temp_[thread]->pointer();
+            if (C_right_[N].get() == C_left_[N].get()) {
+                ::memcpy((void*) Erp[0], (void*) Elp[0], sizeof(double) * naux * nocc * nbf);
+                right_mask = left_mask;
+            } else {
+                timer_on("JK: K1");
+                block_K_transform(Qmnp, naux, Qmax, C_right_ao_[N], Erp, right_mask);
+                timer_off("JK: K1");
+            }
 
-                const std::vector<int>& pairs = sieve_->function_to_function()[m];
-                int rows = pairs.size();
+        }
 
-                for (int i = 0; i < rows; i++) {
-                    int n = pairs[i];
-                    long int ij = function_pairs_reverse[(m >= n ? (m * (m + 1L) >> 1) + n : (n * (n + 1L) >> 1) + m)];
-                    C_DCOPY(naux,&Qmnp[0][ij],num_nm,&QSp[0][i],nbf);
-                    C_DCOPY(nocc,Clp[n],1,&Ctp[0][i],nbf);
-                }
+        timer_on("JK: K2");
+        if (!sparse_K_[N] || !block_K_contract(naux, nocc, Elp, Erp, left_mask, (lr_symmetric_ ? left_mask : right_mask), Kp)) {
+            C_DGEMM('N','T',nbf,nbf,naux*nocc,1.0,Elp[0],naux*nocc,Erp[0],naux*nocc,1.0,Kp[0],nbf);
+        }
+        timer_off("JK: K2");
+    }
 
-                C_DGEMM('N','T',nocc,naux,rows,1.0,Ctp[0],nbf,QSp[0],nbf,0.0,&Elp[0][m*(ULI)nocc*naux],naux);
-            }
+}
+void DFJK::block_K_transform(double** Qmnp, int naux, const std::vector<double>& Qmax,
+                             SharedMatrix C, double** Ep, std::vector<char>& mask)
+{
+    const std::vector<std::pair<int, int> >& function_pairs = sieve_->function_pairs();
+    const std::vector<long int>& function_pairs_reverse = sieve_->function_pairs_reverse();
+    unsigned long int num_nm = function_pairs.size();
 
-            timer_off("JK: K1");
+    int nbf = C->rowspi()[0];
+    int nocc = C->colspi()[0];
+    double** Cp = C->pointer();
 
+    // Largest coefficient on each function; local orbitals make most of these small
+    std::vector<double> Cmax(nbf, 0.0);
+    for (int n = 0; n < nbf; n++) {
+        for (int i = 0; i < nocc; i++) {
+            Cmax[n] = std::max(Cmax[n], fabs(Cp[n][i]));
         }
+    }
 
-        if (!lr_symmetric_ && (N == 0 || C_right_[N].get() != C_right_[N-1].get())) {
+    mask.assign(nbf * (size_t) nocc, 0);
+    std::vector<std::vector<double> > bounds(omp_nthread_, std::vector<double>(nocc));
 
-            if (C_right_[N].get() == C_left_[N].get()) {
-                ::memcpy((void*) Erp[0], (void*) Elp[0], sizeof(double) * naux * nocc * nbf);
-            } else {
+    #pragma omp parallel for schedule (dynamic)
+    for (int m = 0; m < nbf; m++) {
 
-                timer_on("JK: K1");
+        int thread = 0;
+        #ifdef _OPENMP
+            thread = omp_get_thread_num();
+        #endif
 
-                #pragma omp parallel for schedule (dynamic)
-                for (int m = 0; m < nbf; m++) {
+        double** Ctp = C_temp_[thread]->pointer();
+        double** QSp = Q_temp_[thread]->pointer();
+        double* Em = &Ep[0][m*(ULI)nocc*naux];
+
+        // |E_{miQ}| <= \sum_n max_Q |(Q|mn)| |C_{ni}|
+        std::vector<double>& bound = bounds[thread];
+        std::fill(bound.begin(), bound.end(), 0.0);
+
+        const std::vector<int>& pairs = sieve_->function_to_function()[m];
+        int rows = 0;
+
+        for (size_t k = 0; k < pairs.size(); k++) {
+            int n = pairs[k];
+            long int ij = function_pairs_reverse[(m >= n ? (m * (m + 1L) >> 1) + n : (n * (n + 1L) >> 1) + m)];
+            if (Qmax[ij] * Cmax[n] < cutoff_) continue;
+            C_DCOPY(naux,&Qmnp[0][ij],num_nm,&QSp[0][rows],nbf);
+            C_DCOPY(nocc,Cp[n],1,&Ctp[0][rows],nbf);
+            for (int i = 0; i < nocc; i++) {
+                bound[i] += Qmax[ij] * fabs(Cp[n][i]);
+            }
+            rows++;
+        }
 
-                    int thread = 0;
-                    #ifdef _OPENMP
-                        thread = omp_get_thread_num();
-                    #endif
+        if (!rows) {
+            ::memset((void*) Em, '\0', sizeof(double) * nocc * naux);
+            continue;
+        }
 
-                    double** Ctp = C_temp_[thread]->pointer();
-                    double** QSp = Q_temp_[thread]->pointer();
+        C_DGEMM('N','T',nocc,naux,rows,1.0,Ctp[0],nbf,QSp[0],nbf,0.0,Em,naux);
 
-                    const std::vector<int>& pairs = sieve_->function_to_function()[m];
-                    int rows = pairs.size();
+        for (int i = 0; i < nocc; i++) {
+            mask[m * (size_t) nocc + i] = (bound[i] >= cutoff_);
+        }
+    }
+}
+bool DFJK::block_K_contract(int naux, int nocc, double** Elp, double** Erp,
+                            const std::vector<char>& left_mask, const std::vector<char>& right_mask,
+                            double** Kp)
+{
+    int nbf = primary_->nbf();
 
-                    for (int i = 0; i < rows; i++) {
-                        int n = pairs[i];
-                        long int ij = function_pairs_reverse[(m >= n ? (m * (m + 1L) >> 1) + n : (n * (n + 1L) >> 1) + m)];
-                        C_DCOPY(naux,&Qmnp[0][ij],num_nm,&QSp[0][i],nbf);
-                        C_DCOPY(nocc,Crp[n],1,&Ctp[0][i],nbf);
-                    }
+    // Significant functions of each occupied orbital
+    std::vector<std::vector<int> > left_funs(nocc);
+    std::vector<std::vector<int> > right_funs(nocc);
+    for (int m = 0; m < nbf; m++) {
+        for (int i = 0; i < nocc; i++) {
+            if (left_mask[m * (size_t) nocc + i]) left_funs[i].push_back(m);
+            if (right_mask[m * (size_t) nocc + i]) right_funs[i].push_back(m);
+        }
+    }
 
-                    C_DGEMM('N','T',nocc,naux,rows,1.0,Ctp[0],nbf,QSp[0],nbf,0.0,&Erp[0][m*(ULI)nocc*naux],naux);
-                }
+    // Gathers cost about as much as the flops they save, so only go sparse
+    // when the blocks cover less than half of the dense K_{mn} <- E E^T
+    double sparse_flops = 0.0;
+    size_t max_left = 0L;
+    size_t max_right = 0L;
+    for (int i = 0; i < nocc; i++) {
+        sparse_flops += (double) left_funs[i].size() * right_funs[i].size();
+        max_left = std::max(max_left, left_funs[i].size());
+        max_right = std::max(max_right, right_funs[i].size());
+    }
+    if (sparse_flops >= 0.5 * nbf * (double) nbf * nocc) return false;
+    // Blocks of Q never exceed the extents over all of Q; this is just a guard
+    if (max_left > sparse_left_ || max_right > sparse_right_) return false;
+    if (!max_left || !max_right) return true;
+
+    // K_{mn} += \sum_i \sum_Q E_{miQ} E_{niQ}, m and n restricted to the blocks of i.
+    // A round of orbitals fills one K_temp block each (Lt in Q_temp, Rt in
+    // R_temp of the thread), then the blocks go into K in orbital order, so K
+    // does not depend on which thread took which orbital.
+    int nround = K_temp_.size();
+    for (int i0 = 0; i0 < nocc; i0 += nround) {
+        int ni = std::min(nround, nocc - i0);
 
-                timer_off("JK: K1");
+        #pragma omp parallel for schedule (dynamic)
+        for (int di = 0; di < ni; di++) {
+
+            int thread = 0;
+            #ifdef _OPENMP
+                thread = omp_get_thread_num();
+            #endif
+
+            int i = i0 + di;
+            const std::vector<int>& mfuns = left_funs[i];
+            const std::vector<int>& nfuns = right_funs[i];
+            int nl = mfuns.size();
+            int nr = nfuns.size();
+            if (!nl || !nr) continue;
+
+            double** Ltp = Q_temp_[thread]->pointer();
+            double** Rtp = R_temp_[thread]->pointer();
+            double** Ktp = K_temp_[di]->pointer();
 
+            for (int a = 0; a < nl; a++) {
+                C_DCOPY(naux,&Elp[0][(mfuns[a] * (ULI) nocc + i) * naux],1,&Ltp[0][a],sparse_left_);
+            }
+            for (int b = 0; b < nr; b++) {
+                C_DCOPY(naux,&Erp[0][(nfuns[b] * (ULI) nocc + i) * naux],1,&Rtp[0][b],sparse_right_);
             }
 
+            C_DGEMM('T','N',nl,nr,naux,1.0,Ltp[0],sparse_left_,Rtp[0],sparse_right_,0.0,Ktp[0],sparse_right_);
         }
 
-        timer_on("JK: K2");
-        C_DGEMM('N','T',nbf,nbf,naux*nocc,1.0,Elp[0],naux*nocc,Erp[0],naux*nocc,1.0,Kp[0],nbf);
-        timer_off("JK: K2");
+        for (int di = 0; di < ni; di++) {
+            const std::vector<int>& mfuns = left_funs[i0 + di];
+            const std::vector<int>& nfuns = right_funs[i0 + di];
+            int nl = mfuns.size();
+            int nr = nfuns.size();
+            double** Ktp = K_temp_[di]->pointer();
+            for (int a = 0; a < nl; a++) {
+                double* Km = Kp[mfuns[a]];
+                for (int b = 0; b < nr; b++) {
+                    Km[nfuns[b]] += Ktp[a][b];
+                }
+            }
+        }
     }
 
+    return true;
 }
 void DFJK::block_wK(double** Qlmnp, double** Qrmnp, int naux)
 {
@@ -44,6 +44,7 @@
 
 #include<lib3index/cholesky.h>
 
+#include <algorithm>
 #include <sstream>
 #include "libparallel/ParallelPrinter.h"
 #ifdef _OPENMP
@@ -54,6 +55,18 @@ using namespace std;
 using namespace psi;
 
 namespace psi {
+
+namespace {
+
+/// Orders (cost, task) pairs by descending cost, then ascending task index
+bool task_cost_greater(const std::pair<double, size_t>& a, const std::pair<double, size_t>& b)
+{
+    if (a.first != b.first) return a.first > b.first;
+    return a.second < b.second;
+}
+
+}
+
 DirectJK::DirectJK(boost::shared_ptr<BasisSet> primary) :
    JK(primary)
 {
@@ -68,6 +81,16 @@ void DirectJK::common_init()
     #ifdef _OPENMP
         df_ints_num_threads_ = omp_get_max_threads();
     #endif
+
+    density_screening_ = false;
+
+    incfock_ = false;
+    incfock_full_fock_every_ = 10;
+    incfock_count_ = 0;
+    incfock_last_ = false;
+    incfock_nincremental_ = 0;
+    incfock_nfull_ = 0;
+    incfock_lr_symmetric_ = false;
 }
 void DirectJK::print_header() const
 {
@@ -81,15 +104,116 @@ void DirectJK::print_header() const
             outfile->Printf( "    Omega:             %11.3E\n", omega_);
         outfile->Printf( "    Integrals threads: %11d\n", df_ints_num_threads_);
         //outfile->Printf( "    Memory (MB):       %11ld\n", (memory_ *8L) / (1024L * 1024L));
+        outfile->Printf( "    Screening Type:    %11s\n", (density_screening_ ? "DENSITY" : "SCHWARZ"));
+        outfile->Printf( "    Incremental Fock:  %11s\n", (incfock_ ? "Yes" : "No"));
+        if (incfock_)
+            outfile->Printf( "    Full Fock Every:   %11d\n", incfock_full_fock_every_);
         outfile->Printf( "    Schwarz Cutoff:    %11.0E\n\n", cutoff_);
     }
 }
 void DirectJK::preiterations()
 {
     sieve_ = boost::shared_ptr<ERISieve>(new ERISieve(primary_, cutoff_));
+    incfock_reset();
+}
+void DirectJK::incfock_reset()
+{
+    incfock_count_ = 0;
+    incfock_last_ = false;
+    incfock_nincremental_ = 0;
+    incfock_nfull_ = 0;
+    D_prev_.clear();
+    J_prev_.clear();
+    K_prev_.clear();
+    wK_prev_.clear();
+    delta_D_.clear();
+}
+bool DirectJK::incfock_setup()
+{
+    if (!incfock_) return false;
+
+    // The stored state is only usable if the caller is asking for the same
+    // kind of build as last time (SOSCF, CPHF, etc. share this object)
+    bool compatible = (D_prev_.size() == D_ao_.size()) &&
+                      (incfock_lr_symmetric_ == lr_symmetric_) &&
+                      (J_prev_.size() == (do_J_ ? D_ao_.size() : 0)) &&
+                      (K_prev_.size() == (do_K_ ? D_ao_.size() : 0)) &&
+                      (wK_prev_.size() == (do_wK_ ? D_ao_.size() : 0));
+
+    if (!compatible) incfock_count_ = 0;
+
+    int full_every = (incfock_full_fock_every_ > 0 ? incfock_full_fock_every_ : 1);
+    bool incremental = compatible && (incfock_count_ % full_every != 0);
+    incfock_count_++;
+
+    if (!incremental) return false;
+
+    if (delta_D_.size() != D_ao_.size()) {
+        delta_D_.clear();
+        for (size_t N = 0; N < D_ao_.size(); N++) {
+            delta_D_.push_back(SharedMatrix(D_ao_[N]->clone()));
+        }
+    }
+    for (size_t N = 0; N < D_ao_.size(); N++) {
+        delta_D_[N]->copy(D_ao_[N]);
+        delta_D_[N]->subtract(D_prev_[N]);
+    }
+
+    return true;
+}
+void DirectJK::incfock_postiter(bool incremental)
+{
+    incfock_last_ = incremental;
+    if (!incfock_) return;
+
+    if (incremental) {
+        incfock_nincremental_++;
+    } else {
+        incfock_nfull_++;
+    }
+    Process::environment.globals["DIRECTJK INCREMENTAL BUILDS"] = incfock_nincremental_;
+    Process::environment.globals["DIRECTJK FULL BUILDS"] = incfock_nfull_;
+
+    if (incremental) {
+        for (size_t N = 0; N < J_prev_.size(); N++) J_ao_[N]->add(J_prev_[N]);
+        for (size_t N = 0; N < K_prev_.size(); N++) K_ao_[N]->add(K_prev_[N]);
+        for (size_t N = 0; N < wK_prev_.size(); N++) wK_ao_[N]->add(wK_prev_[N]);
+    } else {
+        // D_ao_ and friends may alias the SO quantities, so deep copies are needed
+        D_prev_.clear();
+        J_prev_.clear();
+        K_prev_.clear();
+        wK_prev_.clear();
+        for (size_t N = 0; N < D_ao_.size(); N++) {
+            D_prev_.push_back(SharedMatrix(D_ao_[N]->clone()));
+            if (do_J_) J_prev_.push_back(SharedMatrix(J_ao_[N]->clone()));
+            if (do_K_) K_prev_.push_back(SharedMatrix(K_ao_[N]->clone()));
+            if (do_wK_) wK_prev_.push_back(SharedMatrix(wK_ao_[N]->clone()));
+        }
+        incfock_lr_symmetric_ = lr_symmetric_;
+        return;
+    }
+
+    for (size_t N = 0; N < D_ao_.size(); N++) {
+        D_prev_[N]->copy(D_ao_[N]);
+        if (do_J_) J_prev_[N]->copy(J_ao_[N]);
+        if (do_K_) K_prev_[N]->copy(K_ao_[N]);
+        if (do_wK_) wK_prev_[N]->copy(wK_ao_[N]);
+    }
 }
 void DirectJK::compute_JK()
 {
+    // => Incremental Fock Build <= //
+
+    bool incremental = incfock_setup();
+    std::vector<SharedMatrix>& D = (incremental ? delta_D_ : D_ao_);
+    // Incremental builds are always density screened, or the dD contraction gains nothing
+    bool density_screen = incremental || density_screening_;
+
+    if (debug_ && incfock_) {
+        outfile->Printf( "  DirectJK: %s build\n", (incremental ? "Incremental" : "Full"));
+    }
+
     boost::shared_ptr<IntegralFactory> factory(new IntegralFactory(primary_,primary_,primary_,primary_));
 
     if (do_wK_) {
@@ -99,13 +223,13 @@ void DirectJK::compute_JK()
         }
         // TODO: Fast K algorithm
         if (do_J_) {
-            build_JK(ints,D_ao_,J_ao_,wK_ao_);
+            build_JK(ints,D,J_ao_,wK_ao_,density_screen);
         } else {
             std::vector<boost::shared_ptr<Matrix> > temp;
             for (size_t i = 0; i < D_ao_.size(); i++) {
                 temp.push_back(boost::shared_ptr<Matrix>(new Matrix("temp", primary_->nbf(), primary_->nbf())));
             }
-            build_JK(ints,D_ao_,temp,wK_ao_);
+            build_JK(ints,D,temp,wK_ao_,density_screen);
         }
     }
 
@@ -115,31 +239,34 @@ void DirectJK::compute_JK()
             ints.push_back(boost::shared_ptr<TwoBodyAOInt>(factory->erd_eri()));
         }
         if (do_J_ && do_K_) {
-            build_JK(ints,D_ao_,J_ao_,K_ao_);
+            build_JK(ints,D,J_ao_,K_ao_,density_screen);
         } else if (do_J_) {
             std::vector<boost::shared_ptr<Matrix> > temp;
             for (size_t i = 0; i < D_ao_.size(); i++) {
                 temp.push_back(boost::shared_ptr<Matrix>(new Matrix("temp", primary_->nbf(), primary_->nbf())));
             }
-            build_JK(ints,D_ao_,J_ao_,temp);
+            build_JK(ints,D,J_ao_,temp,density_screen);
         } else {
             std::vector<boost::shared_ptr<Matrix> > temp;
             for (size_t i = 0; i < D_ao_.size(); i++) {
                 temp.push_back(boost::shared_ptr<Matrix>(new Matrix("temp", primary_->nbf(), primary_->nbf())));
             }
-            build_JK(ints,D_ao_,temp,K_ao_);
+            build_JK(ints,D,temp,K_ao_,density_screen);
         }
     }
 
+    incfock_postiter(incremental);
 }
 void DirectJK::postiterations()
 {
     sieve_.reset();
+    incfock_reset();
 }
 void DirectJK::build_JK(std::vector<boost::shared_ptr<TwoBodyAOInt> >& ints,
                         std::vector<boost::shared_ptr<Matrix> >& D,
                         std::vector<boost::shared_ptr<Matrix> >& J,
-                        std::vector<boost::shared_ptr<Matrix> >& K)
+                        std::vector<boost::shared_ptr<Matrix> >& K,
+                        bool density_screen)
 {
     // => Zeroing <= //
 
@@ -230,6 +357,65 @@ void DirectJK::build_JK(std::vector<boost::shared_ptr<TwoBodyAOInt> >& ints,
     size_t ntask_pair = task_pairs.size();
     size_t ntask_pair2 = ntask_pair * ntask_pair;
 
+    // => Density Screening <= //
+
+    if (density_screen) {
+        sieve_->set_density(D);
+    }
+
+    // => Significant Task Quartets, Sorted by Cost <= //
+
+    // Each (PQ|RS) task is costed as cost(PQ) x cost(RS), where the cost of a
+    // task pair sums the function and primitive counts of its significant
+    // shell pairs. Handing out the most expensive tasks first keeps the
+    // dynamic schedule from ending on a few large diffuse/high-AM blocks
+    // while the other threads sit idle. Density screening is left to the
+    // master loop, so the estimate needs no pass over the shell quartets.
+
+    std::vector<double> pair_cost(ntask_pair, 0.0);
+    for (size_t task1 = 0L; task1 < ntask_pair; task1++) {
+        int Ptask = task_pairs[task1].first;
+        int Qtask = task_pairs[task1].second;
+        for (int P2 = task_starts[Ptask]; P2 < task_starts[Ptask+1]; P2++) {
+            for (int Q2 = task_starts[Qtask]; Q2 < task_starts[Qtask+1]; Q2++) {
+                if (Q2 > P2) continue;
+                int P = task_shells[P2];
+                int Q = task_shells[Q2];
+                if (!sieve_->shell_pair_significant(P,Q)) continue;
+                const GaussianShell& Pshell = primary_->shell(P);
+                const GaussianShell& Qshell = primary_->shell(Q);
+                pair_cost[task1] += (double) Pshell.nfunction() * Qshell.nfunction() *
+                                    Pshell.nprimitive() * Qshell.nprimitive();
+            }
+        }
+    }
+
+    std::vector<std::pair<double, size_t> > tasks;
+    for (size_t task1 = 0L; task1 < ntask_pair; task1++) {
+        if (pair_cost[task1] == 0.0) continue;
+        int Ptask = task_pairs[task1].first;
+        for (size_t task2 = 0L; task2 < ntask_pair; task2++) {
+            // See the GOTCHA in the master task loop
+            if (task_pairs[task2].first > Ptask) continue;
+            if (pair_cost[task2] == 0.0) continue;
+            tasks.push_back(std::pair<double, size_t>(pair_cost[task1] * pair_cost[task2], task1 * ntask_pair + task2));
+        }
+    }
+
+    // Descending cost, ties broken by task index so the order is reproducible
+    std::sort(tasks.begin(), tasks.end(), task_cost_greater);
+    size_t ntask_quartet = tasks.size();
+
+    if (debug_) {
+        outfile->Printf( "  ==> DirectJK: Task Quartets <==\n\n");
+        outfile->Printf( "    Significant Task Quartets: %11zu of %11zu\n", ntask_quartet, ntask_pair2);
+        if (ntask_quartet) {
+            outfile->Printf( "    Max Task Cost:             %11.3E\n", tasks[0].first);
+            outfile->Printf( "    Min Task Cost:             %11.3E\n", tasks[ntask_quartet - 1].first);
+        }
+        outfile->Printf( "\n");
+    }
+
     // => Intermediate Buffers <= //
 
     std::vector<std::vector<boost::shared_ptr<Matrix> > > JKT;
@@ -248,8 +434,9 @@ void DirectJK::build_JK(std::vector<boost::shared_ptr<TwoBodyAOInt> >& ints,
     // ==> Master Task Loop <== //
 
     #pragma omp parallel for num_threads(nthread) schedule(dynamic) reduction(+: computed_shells)
-    for (size_t task = 0L; task < ntask_pair2; task++) {
+    for (size_t task_ind = 0L; task_ind < ntask_quartet; task_ind++) {
 
+        size_t task = tasks[task_ind].second;
         size_t task1 = task / ntask_pair;
         size_t task2 = task % ntask_pair;
 
@@ -303,7 +490,7 @@ void DirectJK::build_JK(std::vector<boost::shared_ptr<TwoBodyAOInt> >& ints,
             int S = task_shells[S2];
             if (R2 * nshell + S2 > P2 * nshell + Q2) continue;
             if (!sieve_->shell_pair_significant(R,S)) continue;
-            if (!sieve_->shell_significant(P,Q,R,S)) continue;
+            if (!sieve_->shell_significant_density(P,Q,R,S)) continue;
 
             //printf("Quartet: %2d %2d %2d %2d\n", P, Q, R, S);
 
@@ -560,6 +747,10 @@ void DirectJK::build_JK(std::vector<boost::shared_ptr<TwoBodyAOInt> >& ints,
 
     } // End master task list
 
+    if (density_screen) {
+        sieve_->clear_density();
+    }
+
     for (size_t ind = 0; ind < D.size(); ind++) {
         J[ind]->scale(2.0);
         J[ind]->hermitivitize();
@@ -169,7 +169,7 @@ void PSJK::build_QR()
     int offset = 0;
     for (int index = 0; index < blocks.size(); index++) {
         points->compute_functions(blocks[index]);
-        SharedMatrix phi = points->basis_value("PHI");
+        SharedMatrix phi = points->basis_value(BASIS_PHI);
         double** phip = phi->pointer();
         const std::vector<int>& funmap = blocks[index]->functions_local_to_global();
         int nP = blocks[index]->npoints();
@@ -30,8 +30,12 @@
 #include "gridblocker.h"
 #include <libciomr/libciomr.h>
 #include <libqt/qt.h>
+#include <libpsio/psio.hpp>
+#include <psifiles.h>
 
 #include <vector>
+#include <list>
+#include <algorithm>
 #include <string>
 #include <sstream>
 #include <cstdio>
@@ -2662,16 +2666,19 @@ class NuclearWeightMgr
     boost::shared_ptr<Molecule> molecule_;
     double** inv_dist_;
     double** amatrix_;
+    // Atom positions, copied so that threads need not touch the Molecule
+    std::vector<Vector3> xyz_;
     ////
 
     inline double distToAtom(MassPoint mp, int A) const {
-        return sqrt((mp.x - molecule_->x(A)) * (mp.x - molecule_->x(A)) +
-                    (mp.y - molecule_->y(A)) * (mp.y - molecule_->y(A)) +
-                    (mp.z - molecule_->z(A)) * (mp.z - molecule_->z(A)));
+        return sqrt((mp.x - xyz_[A][0]) * (mp.x - xyz_[A][0]) +
+                    (mp.y - xyz_[A][1]) * (mp.y - xyz_[A][1]) +
+                    (mp.z - xyz_[A][2]) * (mp.z - xyz_[A][2]));
     }
 
     static double BeckeStepFunction(double x);
     static double StratmannStepFunction(double mu);
+    double computeStratmannWeight(const double* dist, int A) const;
 
     // Becke says u = (chi-1)/(chi+1), a = u/(u^2-1), then clip so that |a| <= 1/2.
     // We can save a step and find `a' directly from chi.
@@ -2683,6 +2690,7 @@ public:
 
     NuclearWeightMgr(boost::shared_ptr<Molecule> mol, int scheme);
     ~NuclearWeightMgr();
+    int natom() const { return xyz_.size(); }
     double GetStratmannCutoff(int A) const;
     double computeNuclearWeight(MassPoint mp, int A, double stratmannCutoff) const;
 };
@@ -2694,6 +2702,8 @@ NuclearWeightMgr::NuclearWeightMgr(boost::shared_ptr<Molecule> mol, int scheme)
     int natom = mol->natom();
     scheme_ = (enum NuclearSchemes)scheme;
     molecule_ = mol;
+    for (int A = 0; A < natom; A++)
+        xyz_.push_back(mol->xyz(A));
     inv_dist_ = block_matrix(natom, natom);
     amatrix_ = block_matrix(natom, natom);
 
@@ -2836,6 +2846,9 @@ double NuclearWeightMgr::computeNuclearWeight(MassPoint mp, int A, double stratm
     for (int l = 0; l < natom; l++)
         dist[l] = distToAtom(mp, l);
 
+    if (scheme_ == STRATMANN)
+        return computeStratmannWeight(dist, A);
+
     double (*stepFunction)(double) = (scheme_ == STRATMANN) ? StratmannStepFunction : BeckeStepFunction;
 
     double numerator = NAN;
@@ -2858,6 +2871,58 @@ double NuclearWeightMgr::computeNuclearWeight(MassPoint mp, int A, double stratm
     return numerator/denominator;
 }
 
+// Stratmann's step function is exactly 1 for nu <= -0.64 and exactly 0 for
+// nu >= 0.64, and nu = mu in this scheme. Since R_ij <= d_i + d_j:
+//    d_i >= K d_j   gives   mu_ij >= (K-1)/(K+1) >= 0.64,   so s(mu_ij) = 0
+//    d_j >= K d_i   gives   mu_ij <= (1-K)/(K+1) <= -0.64,  so s(mu_ij) = 1
+// for K = 4.6 > 1.64/0.36. So only atoms i within K of the nearest distance
+// have a nonzero cell function, and only atoms j within K d_i of the point
+// enter it. Every factor left out is exactly 0 or 1, and the rest are taken
+// in the same order as in computeNuclearWeight, so the weights are bitwise
+// the same as the full natom^2 loop at O(natom + nnear^2) cost.
+double NuclearWeightMgr::computeStratmannWeight(const double* dist, int A) const
+{
+    const double K = 4.6;
+    int natom = molecule_->natom();
+
+    double dmin = dist[0];
+    for (int l = 1; l < natom; l++)
+        dmin = (dist[l] < dmin ? dist[l] : dmin);
+
+    // The parent atom is always within reach (it is the reason for the point)
+    if (dist[A] >= K * dmin)
+        return 0.0;
+
+    // Superset of every j needed below, in index order
+    int near[natom];
+    int nnear = 0;
+    for (int l = 0; l < natom; l++)
+        if (dist[l] < K * K * dmin)
+            near[nnear++] = l;
+
+    double numerator = 0.0;
+    double denominator = 0.0;
+    for (int ii = 0; ii < nnear; ii++) {
+        int i = near[ii];
+        if (dist[i] >= K * dmin)
+            continue;
+        double prod = 1;
+        for (int jj = 0; jj < nnear; jj++) {
+            int j = near[jj];
+            if (i == j || dist[j] >= K * dist[i])
+                continue;
+            double mu = (dist[i] - dist[j])*inv_dist_[i][j];
+            double s = StratmannStepFunction(mu);
+            prod *= s;
+            if (prod == 0)
+                break;
+        }
+        if (i == A) numerator = prod;
+        denominator += prod;
+    }
+    return numerator/denominator;
+}
+
 class OrientationMgr
 {
     // "Local" vector, matrix, atom, and molecule definitions.
@@ -3521,14 +3586,92 @@ int RadialPruneMgr::GetPrunedNumAngPts(double rho)
     return LebedevGridMgr::findNPointsByOrder_roundUp(pruned_order);
 }
 
+// Atom-centered grid templates: the radial and (pruned) spherical grids of
+// an element, and their product points about the origin in the standard
+// orientation, before nuclear weights. These depend only on Z and the grid
+// options, so every atom of a molecule, and every later molecule, that
+// matches shares one template.
+class AtomGridMgr {
+public:
+    struct AtomGrid {
+        boost::shared_ptr<RadialGrid> radial;
+        std::vector<boost::shared_ptr<SphericalGrid> > spheres;
+        std::vector<MassPoint> points;
+    };
+    static const AtomGrid& GetAtomGrid(int Z, MolecularGrid::MolecularGridOptions const& opt);
+private:
+    static std::map<std::string, AtomGrid> grids_;
+};
+
+std::map<std::string, AtomGridMgr::AtomGrid> AtomGridMgr::grids_;
+
+const AtomGridMgr::AtomGrid& AtomGridMgr::GetAtomGrid(int Z, MolecularGrid::MolecularGridOptions const& opt)
+{
+    std::stringstream key;
+    key.precision(17);
+    key << Z << " " << opt.radscheme << " " << opt.prunescheme << " " << opt.nradpts << " " << opt.nangpts
+        << " " << opt.bs_radius_alpha << " " << opt.pruning_alpha;
+
+    std::map<std::string, AtomGrid>::iterator it = grids_.find(key.str());
+    if (it != grids_.end()) return it->second;
+
+    AtomGrid& atom = grids_[key.str()];
+    RadialPruneMgr prune(opt);
+
+    std::vector<double> r(opt.nradpts);
+    std::vector<double> wr(opt.nradpts);
+    double alpha = GetBSRadius(Z) * opt.bs_radius_alpha;
+    RadialGridMgr::makeRadialGrid(opt.nradpts, RadialGridMgr::MuraKnowlesHack(opt.radscheme, Z), &r[0], &wr[0], alpha);
+
+    // RMP: Want this stuff too
+    atom.radial = RadialGrid::build("Unknown", opt.nradpts, &r[0], &wr[0], alpha);
+
+    for (int i = 0; i < opt.nradpts; i++) {
+        int numAngPts = prune.GetPrunedNumAngPts(r[i]/alpha);
+        const MassPoint *anggrid = LebedevGridMgr::findGridByNPoints(numAngPts);
+
+        // RMP: And this stuff! This whole thing is completely and utterly FUBAR.
+        atom.spheres.push_back(SphericalGrid::build("Unknown", numAngPts, anggrid));
+
+        for (int j = 0; j < numAngPts; j++) {
+            MassPoint mp = { r[i] * anggrid[j].x, r[i]*anggrid[j].y, r[i]*anggrid[j].z, wr[i]*anggrid[j].w };
+            atom.points.push_back(mp);
+        }
+    }
+
+    return atom;
+}
+
+// Scales the weights of the placed points by their nuclear partition
+// weights. The points are independent, so they are spread over threads; the
+// grid keeps its order, so the result does not depend on the thread count.
+static void applyNuclearWeights(const NuclearWeightMgr& nuc, std::vector<MassPoint>& grid,
+                                const std::vector<int>& parent)
+{
+    int natom = nuc.natom();
+    std::vector<double> stratmannCutoff(natom);
+    for (int A = 0; A < natom; A++)
+        stratmannCutoff[A] = nuc.GetStratmannCutoff(A);
+
+    long int npoints = grid.size();
+    #pragma omp parallel for schedule(dynamic, 256)
+    for (long int P = 0; P < npoints; P++) {
+        int A = parent[P];
+        grid[P].w *= nuc.computeNuclearWeight(grid[P], A, stratmannCutoff[A]);
+    }
+
+    for (long int P = 0; P < npoints; P++)
+        assert(!std::isnan(grid[P].w));
+}
+
 void MolecularGrid::buildGridFromOptions(MolecularGridOptions const& opt)
 {
     options_ = opt; // Save a copy
 
     std::vector<MassPoint> grid; // This is just for the first pass.
+    std::vector<int> parent;     // Atom each point belongs to
 
     OrientationMgr std_orientation(molecule_);
-    RadialPruneMgr prune(opt);
     NuclearWeightMgr nuc(molecule_, opt.nucscheme);
 
     // RMP: Like, I want to keep this info, yo?
@@ -3539,33 +3682,17 @@ void MolecularGrid::buildGridFromOptions(MolecularGridOptions const& opt)
     // Iterate over atoms
     for (int A = 0; A < molecule_->natom(); A++) {
         int Z = molecule_->true_atomic_number(A);
-        double stratmannCutoff = nuc.GetStratmannCutoff(A);
 
         if (opt.namedGrid == -1) { // Not using a named grid
-            double r[opt.nradpts];
-            double wr[opt.nradpts];
-            double alpha = GetBSRadius(Z) * opt.bs_radius_alpha;
-            RadialGridMgr::makeRadialGrid(opt.nradpts, RadialGridMgr::MuraKnowlesHack(opt.radscheme, Z), r, wr, alpha);
-            
-            // RMP: Want this stuff too
-            radial_grids_.push_back(RadialGrid::build("Unknown", opt.nradpts, r, wr, alpha));
-            std::vector<boost::shared_ptr<SphericalGrid> > spheres;
-            spherical_grids_.push_back(spheres);
-    
-            for (int i = 0; i < opt.nradpts; i++) {
-                int numAngPts = prune.GetPrunedNumAngPts(r[i]/alpha);
-                const MassPoint *anggrid = LebedevGridMgr::findGridByNPoints(numAngPts);
-                
-                // RMP: And this stuff! This whole thing is completely and utterly FUBAR. 
-                spherical_grids_[A].push_back(SphericalGrid::build("Unknown", numAngPts, anggrid)); 
+            const AtomGridMgr::AtomGrid& atom = AtomGridMgr::GetAtomGrid(Z, opt);
 
-                for (int j = 0; j < numAngPts; j++) {
-                    MassPoint mp = { r[i] * anggrid[j].x, r[i]*anggrid[j].y, r[i]*anggrid[j].z, wr[i]*anggrid[j].w };
-                    mp = std_orientation.MoveIntoPosition(mp, A);
-                    mp.w *= nuc.computeNuclearWeight(mp, A, stratmannCutoff); // This ain't gonna fly. Must abate this mickey mouse a most rikky tikki tavi. 
-                    grid.push_back(mp);
-                    assert(!std::isnan(mp.w));
-                }
+            radial_grids_.push_back(atom.radial);
+            spherical_grids_.push_back(atom.spheres);
+
+            for (size_t i = 0; i < atom.points.size(); i++) {
+                MassPoint mp = std_orientation.MoveIntoPosition(atom.points[i], A);
+                grid.push_back(mp);
+                parent.push_back(A);
             }
         } else {
             assert(opt.namedGrid == 0 || opt.namedGrid == 1);
@@ -3574,13 +3701,14 @@ void MolecularGrid::buildGridFromOptions(MolecularGridOptions const& opt)
 
             for (int i = 0; i < npts; i++) {
                 MassPoint mp = std_orientation.MoveIntoPosition(sg[i], A);
-                mp.w *= nuc.computeNuclearWeight(mp, A, stratmannCutoff); // This ain't gonna fly. Must abate this mickey mouse a most rikky tikki tavi. 
                 grid.push_back(mp);
-                assert(!std::isnan(mp.w));
+                parent.push_back(A);
             }
         }
     }
 
+    applyNuclearWeights(nuc, grid, parent);
+
     npoints_ = grid.size();
     x_ = new double[npoints_];
     y_ = new double[npoints_];
@@ -3604,6 +3732,7 @@ void MolecularGrid::buildGridFromOptions(MolecularGridOptions const& opt,
     options_ = opt; // Save a copy
 
     std::vector<MassPoint> grid; // This is just for the first pass.
+    std::vector<int> parent;     // Atom each point belongs to
 
     OrientationMgr std_orientation(molecule_);
     RadialPruneMgr prune(opt);
@@ -3617,7 +3746,6 @@ void MolecularGrid::buildGridFromOptions(MolecularGridOptions const& opt,
     // Iterate over atoms
     for (int A = 0; A < molecule_->natom(); A++) {
         int Z = molecule_->true_atomic_number(A);
-        double stratmannCutoff = nuc.GetStratmannCutoff(A);
 
             double  r[rs[A].size()];
             double wr[rs[A].size()];
@@ -3644,13 +3772,14 @@ void MolecularGrid::buildGridFromOptions(MolecularGridOptions const& opt,
                 for (int j = 0; j < numAngPts; j++) {
                     MassPoint mp = { r[i] * anggrid[j].x, r[i]*anggrid[j].y, r[i]*anggrid[j].z, wr[i]*anggrid[j].w };
                     mp = std_orientation.MoveIntoPosition(mp, A);
-                    mp.w *= nuc.computeNuclearWeight(mp, A, stratmannCutoff); // This ain't gonna fly. Must abate this mickey mouse a most rikky tikki tavi. 
                     grid.push_back(mp);
-                    assert(!std::isnan(mp.w));
+                    parent.push_back(A);
                 }
             }
     }
 
+    applyNuclearWeights(nuc, grid, parent);
+
     npoints_ = grid.size();
     x_ = new double[npoints_];
     y_ = new double[npoints_];
@@ -3940,12 +4069,37 @@ DFTGrid::DFTGrid(boost::shared_ptr<Molecule> molecule,
 {
     buildGridFromOptions();
 }
+DFTGrid::DFTGrid(boost::shared_ptr<Molecule> molecule,
+                 boost::shared_ptr<BasisSet> primary,
+                 const std::map<std::string, int>& int_opts_map,
+                 Options& options) :
+    MolecularGrid(molecule), primary_(primary), options_(options)
+{
+    buildGridFromOptions(int_opts_map);
+}
 DFTGrid::~DFTGrid()
 {
 }
 
 void DFTGrid::buildGridFromOptions()
 {
+    buildGridFromOptions(std::map<std::string, int>());
+}
+void DFTGrid::buildGridFromOptions(const std::map<std::string, int>& int_opts_map)
+{
+    // Integer options, overridden by the caller's map where present
+    std::map<std::string, int> int_opts;
+    const char* int_keys[] = {"DFT_RADIAL_POINTS", "DFT_SPHERICAL_POINTS",
+                              "DFT_BLOCK_MAX_POINTS", "DFT_BLOCK_MIN_POINTS"};
+    for (int i = 0; i < 4; i++) {
+        int_opts[int_keys[i]] = options_.get_int(int_keys[i]);
+    }
+    for (std::map<std::string, int>::const_iterator it = int_opts_map.begin(); it != int_opts_map.end(); ++it) {
+        if (!int_opts.count(it->first))
+            throw PSIEXCEPTION("DFTGrid: " + it->first + " cannot be overridden");
+        int_opts[it->first] = it->second;
+    }
+
     MolecularGridOptions opt;
     opt.bs_radius_alpha = options_.get_double("DFT_BS_RADIUS_ALPHA");
     opt.pruning_alpha = options_.get_double("DFT_PRUNING_ALPHA");
@@ -3953,25 +4107,303 @@ void DFTGrid::buildGridFromOptions()
     opt.prunescheme = RadialPruneMgr::WhichPruneScheme(options_.get_str("DFT_PRUNING_SCHEME").c_str());
     opt.nucscheme = NuclearWeightMgr::WhichScheme(options_.get_str("DFT_NUCLEAR_SCHEME").c_str());
     opt.namedGrid = StandardGridMgr::WhichGrid(options_.get_str("DFT_GRID_NAME").c_str());
-    opt.nradpts = options_.get_int("DFT_RADIAL_POINTS");
-    opt.nangpts = options_.get_int("DFT_SPHERICAL_POINTS");
+    opt.nradpts = int_opts["DFT_RADIAL_POINTS"];
+    opt.nangpts = int_opts["DFT_SPHERICAL_POINTS"];
 
     if (LebedevGridMgr::findOrderByNPoints(opt.nangpts) < -1) {
         LebedevGridMgr::PrintHelp(); // Tell what the admissible values are.
         throw PSIEXCEPTION("Invalid number of spherical points (not a Lebedev number)");
     }
 
-    MolecularGrid::buildGridFromOptions(opt);
-
     // Blocking/sieving info
-    int max_points = options_.get_int("DFT_BLOCK_MAX_POINTS");
-    int min_points = options_.get_int("DFT_BLOCK_MIN_POINTS");
+    int max_points = int_opts["DFT_BLOCK_MAX_POINTS"];
+    int min_points = int_opts["DFT_BLOCK_MIN_POINTS"];
     double max_radius = options_.get_double("DFT_BLOCK_MAX_RADIUS");
     double epsilon = options_.get_double("DFT_BASIS_TOLERANCE");
     boost::shared_ptr<BasisExtents> extents(new BasisExtents(primary_, epsilon));
+
+    // Same molecule, basis and options as a grid built before? Then only
+    // the significant functions of each block need to be redone
+    bool use_cache = options_.get_bool("DFT_GRID_CACHE");
+    bool use_file = options_.get_bool("DFT_GRID_FILE");
+    std::string key;
+    if (use_cache || use_file) {
+        key = cache_key(opt, max_points, min_points, max_radius, epsilon);
+        MolecularGrid::options_ = opt;
+        if (use_cache && load_cached(key, extents)) {
+            outfile->Printf("  DFT grid taken from the in-core grid cache.\n\n");
+            Process::environment.globals["DFT GRID REUSED"] = 1.0;
+            return;
+        }
+        if (use_file && load_file(key, extents)) {
+            outfile->Printf("  DFT grid read from the grid file.\n\n");
+            Process::environment.globals["DFT GRID REUSED"] = 1.0;
+            if (use_cache) save_cached(key);
+            return;
+        }
+    }
+
+    MolecularGrid::buildGridFromOptions(opt);
     postProcess(extents, max_points, min_points, max_radius);
+    Process::environment.globals["DFT GRID REUSED"] = 0.0;
+
+    if (use_cache) save_cached(key);
+    if (use_file) save_file(key);
 }
 
+namespace {
+
+// A blocked DFTGrid, less the BlockOPoints (which belong to a basis)
+struct CachedGrid {
+    std::string key;
+    std::vector<double> x, y, z, w;
+    std::vector<int> index;
+    std::vector<int> block_sizes;
+    int max_functions;
+    boost::shared_ptr<Matrix> orientation;
+    std::vector<boost::shared_ptr<RadialGrid> > radial_grids;
+    std::vector<std::vector<boost::shared_ptr<SphericalGrid> > > spherical_grids;
+};
+
+// In-core grid cache, most recently used first. Holds at most four grids, and
+// no more than a tenth of the memory; emptied by DFTGrid::clear_cache()
+std::list<boost::shared_ptr<CachedGrid> > grid_cache;
+const size_t grid_cache_size = 4;
+
+size_t cached_bytes(const CachedGrid& grid)
+{
+    return grid.x.size() * (4 * sizeof(double) + sizeof(int)) + grid.block_sizes.size() * sizeof(int);
+}
+
+// 64-bit FNV-1a, for the basis fingerprint and the PSIF_DFT_GRID labels
+unsigned long long fnv1a(const void* data, size_t len, unsigned long long hash = 14695981039346656037ULL)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < len; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Prefix of the PSIF_DFT_GRID entries of the grid stored under key
+std::string grid_file_prefix(const std::string& key)
+{
+    char prefix[32];
+    sprintf(prefix, "DFT Grid %016llX", fnv1a(key.c_str(), key.size()));
+    return std::string(prefix);
+}
+
+}
+
+std::string DFTGrid::cache_key(MolecularGridOptions const& opt, int max_points, int min_points,
+    double max_radius, double epsilon) const
+{
+    std::stringstream key;
+    key.precision(17);
+
+    key << opt.bs_radius_alpha << " " << opt.pruning_alpha << " " << opt.radscheme << " "
+        << opt.prunescheme << " " << opt.nucscheme << " " << opt.namedGrid << " "
+        << opt.nradpts << " " << opt.nangpts;
+
+    // MolecularGrid::block() takes the scheme from the global options
+    key << " " << Process::environment.options.get_str("DFT_BLOCK_SCHEME") << " "
+        << max_points << " " << min_points << " " << max_radius << " " << epsilon;
+
+    for (int A = 0; A < molecule_->natom(); A++) {
+        Vector3 v = molecule_->xyz(A);
+        key << " " << molecule_->true_atomic_number(A) << " " << molecule_->Z(A)
+            << " " << v[0] << " " << v[1] << " " << v[2];
+    }
+
+    unsigned long long hash = fnv1a(NULL, 0);
+    for (int P = 0; P < primary_->nshell(); P++) {
+        const GaussianShell& shell = primary_->shell(P);
+        int info[3] = {shell.am(), shell.nprimitive(), shell.ncenter()};
+        hash = fnv1a(info, sizeof(info), hash);
+        hash = fnv1a(shell.exps(), sizeof(double) * info[1], hash);
+        hash = fnv1a(shell.coefs(), sizeof(double) * info[1], hash);
+    }
+    key << " " << primary_->nbf() << " " << primary_->has_puream() << " " << std::hex << hash;
+
+    return key.str();
+}
+bool DFTGrid::load_cached(const std::string& key, boost::shared_ptr<BasisExtents> extents)
+{
+    for (std::list<boost::shared_ptr<CachedGrid> >::iterator it = grid_cache.begin(); it != grid_cache.end(); ++it) {
+        boost::shared_ptr<CachedGrid> grid = *it;
+        if (grid->key != key) continue;
+
+        grid_cache.erase(it);
+        grid_cache.push_front(grid);
+
+        adopt(grid->x, grid->y, grid->z, grid->w, grid->index, grid->block_sizes, grid->max_functions, extents);
+        orientation_ = grid->orientation;
+        radial_grids_ = grid->radial_grids;
+        spherical_grids_ = grid->spherical_grids;
+        return true;
+    }
+    return false;
+}
+void DFTGrid::save_cached(const std::string& key) const
+{
+    boost::shared_ptr<CachedGrid> grid(new CachedGrid);
+    grid->key = key;
+    grid->x.assign(x_, x_ + npoints_);
+    grid->y.assign(y_, y_ + npoints_);
+    grid->z.assign(z_, z_ + npoints_);
+    grid->w.assign(w_, w_ + npoints_);
+    grid->index.assign(index_, index_ + npoints_);
+    for (size_t Q = 0; Q < blocks_.size(); Q++) {
+        grid->block_sizes.push_back(blocks_[Q]->npoints());
+    }
+    grid->max_functions = max_functions_;
+    grid->orientation = orientation_;
+    grid->radial_grids = radial_grids_;
+    grid->spherical_grids = spherical_grids_;
+
+    // Grids are not counted against the memory of the methods, so keep them small
+    size_t limit = Process::environment.get_memory() / 10;
+    size_t total = cached_bytes(*grid);
+    if (total > limit) return;
+
+    grid_cache.push_front(grid);
+    std::list<boost::shared_ptr<CachedGrid> >::iterator it = grid_cache.begin();
+    size_t ngrid = 1;
+    for (++it; it != grid_cache.end(); ++ngrid) {
+        total += cached_bytes(**it);
+        if (ngrid >= grid_cache_size || total > limit) it = grid_cache.erase(it);
+        else ++it;
+    }
+}
+void DFTGrid::clear_cache()
+{
+    grid_cache.clear();
+}
+bool DFTGrid::load_file(const std::string& key, boost::shared_ptr<BasisExtents> extents)
+{
+    boost::shared_ptr<PSIO> psio = PSIO::shared_object();
+    if (!psio->exists(PSIF_DFT_GRID)) return false;
+
+    char label[PSIO_KEYLEN];
+    std::string prefix = grid_file_prefix(key);
+
+    psio->open(PSIF_DFT_GRID, PSIO_OPEN_OLD);
+
+    // Sizes: key length, points, blocks, max functions
+    int sizes[4];
+    sprintf(label, "%s Sizes", prefix.c_str());
+    if (!psio->tocscan(PSIF_DFT_GRID, label)) {
+        psio->close(PSIF_DFT_GRID, 1);
+        return false;
+    }
+    psio->read_entry(PSIF_DFT_GRID, label, (char*) sizes, sizeof(sizes));
+
+    std::vector<char> stored(sizes[0]);
+    sprintf(label, "%s Key", prefix.c_str());
+    psio->read_entry(PSIF_DFT_GRID, label, &stored[0], sizes[0]);
+    if (std::string(stored.begin(), stored.end()) != key) {
+        psio->close(PSIF_DFT_GRID, 1);
+        return false;
+    }
+
+    int npoints = sizes[1];
+    int nblocks = sizes[2];
+    std::vector<double> x(npoints), y(npoints), z(npoints), w(npoints);
+    std::vector<int> index(npoints), block_sizes(nblocks);
+    sprintf(label, "%s X", prefix.c_str());
+    psio->read_entry(PSIF_DFT_GRID, label, (char*) &x[0], sizeof(double) * npoints);
+    sprintf(label, "%s Y", prefix.c_str());
+    psio->read_entry(PSIF_DFT_GRID, label, (char*) &y[0], sizeof(double) * npoints);
+    sprintf(label, "%s Z", prefix.c_str());
+    psio->read_entry(PSIF_DFT_GRID, label, (char*) &z[0], sizeof(double) * npoints);
+    sprintf(label, "%s W", prefix.c_str());
+    psio->read_entry(PSIF_DFT_GRID, label, (char*) &w[0], sizeof(double) * npoints);
+    sprintf(label, "%s Index", prefix.c_str());
+    psio->read_entry(PSIF_DFT_GRID, label, (char*) &index[0], sizeof(int) * npoints);
+    sprintf(label, "%s Blocks", prefix.c_str());
+    psio->read_entry(PSIF_DFT_GRID, label, (char*) &block_sizes[0], sizeof(int) * nblocks);
+
+    psio->close(PSIF_DFT_GRID, 1);
+
+    adopt(x, y, z, w, index, block_sizes, sizes[3], extents);
+    return true;
+}
+void DFTGrid::save_file(const std::string& key) const
+{
+    boost::shared_ptr<PSIO> psio = PSIO::shared_object();
+
+    char label[PSIO_KEYLEN];
+    std::string prefix = grid_file_prefix(key);
+
+    std::vector<int> block_sizes;
+    for (size_t Q = 0; Q < blocks_.size(); Q++) {
+        block_sizes.push_back(blocks_[Q]->npoints());
+    }
+    int sizes[4] = {(int) key.size(), npoints_, (int) block_sizes.size(), max_functions_};
+
+    psio->open(PSIF_DFT_GRID, (psio->exists(PSIF_DFT_GRID) ? PSIO_OPEN_OLD : PSIO_OPEN_NEW));
+
+    sprintf(label, "%s Sizes", prefix.c_str());
+    psio->write_entry(PSIF_DFT_GRID, label, (char*) sizes, sizeof(sizes));
+    sprintf(label, "%s Key", prefix.c_str());
+    psio->write_entry(PSIF_DFT_GRID, label, (char*) key.c_str(), key.size());
+    if (npoints_) {
+        sprintf(label, "%s X", prefix.c_str());
+        psio->write_entry(PSIF_DFT_GRID, label, (char*) x_, sizeof(double) * npoints_);
+        sprintf(label, "%s Y", prefix.c_str());
+        psio->write_entry(PSIF_DFT_GRID, label, (char*) y_, sizeof(double) * npoints_);
+        sprintf(label, "%s Z", prefix.c_str());
+        psio->write_entry(PSIF_DFT_GRID, label, (char*) z_, sizeof(double) * npoints_);
+        sprintf(label, "%s W", prefix.c_str());
+        psio->write_entry(PSIF_DFT_GRID, label, (char*) w_, sizeof(double) * npoints_);
+        sprintf(label, "%s Index", prefix.c_str());
+        psio->write_entry(PSIF_DFT_GRID, label, (char*) index_, sizeof(int) * npoints_);
+        sprintf(label, "%s Blocks", prefix.c_str());
+        psio->write_entry(PSIF_DFT_GRID, label, (char*) &block_sizes[0], sizeof(int) * block_sizes.size());
+    }
+
+    psio->close(PSIF_DFT_GRID, 1);
+}
+void DFTGrid::adopt(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z,
+    const std::vector<double>& w, const std::vector<int>& index, const std::vector<int>& block_sizes,
+    int max_functions, boost::shared_ptr<BasisExtents> extents)
+{
+    extents_ = extents;
+    MolecularGrid::primary_ = extents_->basis();
+
+    npoints_ = x.size();
+    if (npoints_) {
+        x_ = new double[npoints_];
+        y_ = new double[npoints_];
+        z_ = new double[npoints_];
+        w_ = new double[npoints_];
+        index_ = new int[npoints_];
+        ::memcpy((void*) x_, (void*) &x[0], sizeof(double) * npoints_);
+        ::memcpy((void*) y_, (void*) &y[0], sizeof(double) * npoints_);
+        ::memcpy((void*) z_, (void*) &z[0], sizeof(double) * npoints_);
+        ::memcpy((void*) w_, (void*) &w[0], sizeof(double) * npoints_);
+        ::memcpy((void*) index_, (void*) &index[0], sizeof(int) * npoints_);
+    }
+
+    // The blocks point into x_ .. w_, and redo their significant functions
+    std::vector<int> block_start(block_sizes.size());
+    max_points_ = 0;
+    int offset = 0;
+    for (size_t Q = 0; Q < block_sizes.size(); Q++) {
+        block_start[Q] = offset;
+        max_points_ = std::max(max_points_, block_sizes[Q]);
+        offset += block_sizes[Q];
+    }
+    blocks_.clear();
+    blocks_.resize(block_sizes.size());
+    #pragma omp parallel for schedule(dynamic)
+    for (size_t Q = 0; Q < block_sizes.size(); Q++) {
+        int start = block_start[Q];
+        blocks_[Q] = boost::shared_ptr<BlockOPoints>(new BlockOPoints(block_sizes[Q],&x_[start],&y_[start],&z_[start],&w_[start],extents_));
+    }
+    max_functions_ = max_functions;
+}
 
 PseudospectralGrid::PseudospectralGrid(boost::shared_ptr<Molecule> molecule,
                                        boost::shared_ptr<BasisSet> primary,
@@ -4397,6 +4829,35 @@ OctreeGridBlocker::OctreeGridBlocker(const int npoints_ref, double const* x_ref,
 OctreeGridBlocker::~OctreeGridBlocker()
 {
 }
+bool OctreeGridBlocker::leaf_finished(const std::vector<int>& leaf, double const* x, double const* y,
+                                      double const* z, double T2) const
+{
+    if (leaf.size() > (size_t)tol_max_points_) return false;
+    if (leaf.size() <= (size_t)tol_min_points_) return true;
+
+    double XC[3]; ::memset((void*) XC, '\0', 3*sizeof(double));
+    for (size_t Q = 0; Q < leaf.size(); Q++) {
+        XC[0] += x[leaf[Q]];
+        XC[1] += y[leaf[Q]];
+        XC[2] += z[leaf[Q]];
+    }
+    XC[0] /= leaf.size();
+    XC[1] /= leaf.size();
+    XC[2] /= leaf.size();
+
+    // Determine radius of bounding sphere
+    double RC2 = 0.0;
+    for (size_t Q = 0; Q < leaf.size(); Q++) {
+        double dx = x[leaf[Q]] - XC[0];
+        double dy = y[leaf[Q]] - XC[1];
+        double dz = z[leaf[Q]] - XC[2];
+        double R2 = dx * dx + dy * dy + dz * dz;
+        RC2 = (RC2 > R2 ? RC2 : R2);
+    }
+
+    // Terminate if necessary
+    return RC2 < T2;
+}
 void OctreeGridBlocker::block()
 {
     // K-PR Octree algorithm (Rob Parrish and Justin Turney)
@@ -4441,10 +4902,17 @@ void OctreeGridBlocker::block()
 
             new_leaves.clear();
             double const* X = dims[k];
-            for (size_t A = 0; A < active_tree.size(); A++) {
+
+            // Leaves split independently; halves 2A and 2A+1 come from leaf A
+            size_t nleaves = active_tree.size();
+            std::vector<std::vector<int> > halves(2 * nleaves);
+            std::vector<char> finished(2 * nleaves);
+
+            #pragma omp parallel for schedule(dynamic) if(!bench_)
+            for (size_t A = 0; A < nleaves; A++) {
 
                 // Block to subdivide
-                std::vector<int> block = active_tree[A];
+                const std::vector<int>& block = active_tree[A];
 
                 // Determine xcenter of mass
                 double xc = 0.0;
@@ -4466,8 +4934,8 @@ void OctreeGridBlocker::block()
                     printer->Printf("   %4d %5d %15.6E %15.6E %15.6E\n", tree_level,A, XC[0],XC[1],XC[2]);
                 }
 
-                std::vector<int> left;
-                std::vector<int> right;
+                std::vector<int>& left = halves[2 * A];
+                std::vector<int>& right = halves[2 * A + 1];
                 for (size_t Q = 0; Q < block.size(); Q++) {
                     if (X[block[Q]] < xc) {
                         left.push_back(block[Q]);
@@ -4476,76 +4944,22 @@ void OctreeGridBlocker::block()
                     }
                 }
 
-                // Left side fate
-                if (left.size() > (size_t)tol_max_points_) {
-                    new_leaves.push_back(left);
-                } else if (left.size() <= (size_t)tol_min_points_) {
-                    completed_tree.push_back(left);
-                } else {
-                    double XC[3]; ::memset((void*) XC, '\0', 3*sizeof(double));
-                    for (size_t Q = 0; Q < left.size(); Q++) {
-                        XC[0] += x[left[Q]];
-                        XC[1] += y[left[Q]];
-                        XC[2] += z[left[Q]];
-                    }
-                    XC[0] /= left.size();
-                    XC[1] /= left.size();
-                    XC[2] /= left.size();
-
-                    // Determine radius of bounding sphere
-                    double RC2 = 0.0;
-                    for (size_t Q = 0; Q < left.size(); Q++) {
-                        double dx = x[left[Q]] - XC[0];
-                        double dy = y[left[Q]] - XC[1];
-                        double dz = z[left[Q]] - XC[2];
-                        double R2 = dx * dx + dy * dy + dz * dz;
-                        RC2 = (RC2 > R2 ? RC2 : R2);
-                    }
-
-                    // Terminate if necessary
-                    if (RC2 < T2) {
-                        completed_tree.push_back(left);
-                    } else {
-                        new_leaves.push_back(left);
-                    }
-                }
+                // Left and right side fates
+                finished[2 * A] = leaf_finished(left, x, y, z, T2);
+                finished[2 * A + 1] = leaf_finished(right, x, y, z, T2);
+            }
 
-                // Right side fate
-                if (right.size() > tol_max_points_) {
-                    new_leaves.push_back(right);
-                } else if (right.size() <= tol_min_points_) {
-                    completed_tree.push_back(right);
+            // Collect in leaf order, so the blocking does not depend on the thread count
+            for (size_t L = 0; L < 2 * nleaves; L++) {
+                if (finished[L]) {
+                    completed_tree.push_back(std::vector<int>());
+                    completed_tree.back().swap(halves[L]);
                 } else {
-                    double XC[3]; ::memset((void*) XC, '\0', 3*sizeof(double));
-                    for (size_t Q = 0; Q < right.size(); Q++) {
-                        XC[0] += x[right[Q]];
-                        XC[1] += y[right[Q]];
-                        XC[2] += z[right[Q]];
-                    }
-                    XC[0] /= right.size();
-                    XC[1] /= right.size();
-                    XC[2] /= right.size();
-
-                    // Determine radius of bounding sphere
-                    double RC2 = 0.0;
-                    for (size_t Q = 0; Q < right.size(); Q++) {
-                        double dx = x[right[Q]] - XC[0];
-                        double dy = y[right[Q]] - XC[1];
-                        double dz = z[right[Q]] - XC[2];
-                        double R2 = dx * dx + dy * dy + dz * dz;
-                        RC2 = (RC2 > R2 ? RC2 : R2);
-                    }
-
-                    // Terminate if necessary
-                    if (RC2 < T2) {
-                        completed_tree.push_back(right);
-                    } else {
-                        new_leaves.push_back(right);
-                    }
-
+                    new_leaves.push_back(std::vector<int>());
+                    new_leaves.back().swap(halves[L]);
                 }
             }
-            active_tree = new_leaves;
+            active_tree.swap(new_leaves);
             tree_level++;
             if (!active_tree.size()) {
                 completed = true;
@@ -4586,16 +5000,25 @@ void OctreeGridBlocker::block()
     }
 
 
+    // Offsets of the nonempty blocks, then their shell lists in parallel
+    std::vector<int> block_start;
+    std::vector<int> block_size;
     index = 0;
     max_points_ = 0;
     for (size_t A = 0; A < completed_tree.size(); A++) {
-        std::vector<int> block = completed_tree[A];
-        if (!block.size()) continue;
-        blocks_.push_back(boost::shared_ptr<BlockOPoints>(new BlockOPoints(block.size(),&x_[index],&y_[index],&z_[index],&w_[index],extents_)));
-        if ((size_t)max_points_ < block.size()) {
-            max_points_ = block.size();
-        }
-        index += block.size();
+        int size = completed_tree[A].size();
+        if (!size) continue;
+        block_start.push_back(index);
+        block_size.push_back(size);
+        max_points_ = (max_points_ < size ? size : max_points_);
+        index += size;
+    }
+
+    blocks_.resize(block_start.size());
+    #pragma omp parallel for schedule(dynamic)
+    for (size_t A = 0; A < block_start.size(); A++) {
+        int start = block_start[A];
+        blocks_[A] = boost::shared_ptr<BlockOPoints>(new BlockOPoints(block_size[A],&x_[start],&y_[start],&z_[start],&w_[start],extents_));
     }
 
     max_functions_ = 0;
@@ -205,13 +205,44 @@ protected:
     boost::shared_ptr<BasisSet> primary_; 
     /// Master builder methods
     void buildGridFromOptions();
+    void buildGridFromOptions(const std::map<std::string, int>& int_opts_map);
     /// The Options object
     Options& options_;
 
+    // => Grid cache (DFT_GRID_CACHE, DFT_GRID_FILE) <= //
+
+    /// Everything the blocked grid depends on: geometry, basis and grid options
+    std::string cache_key(MolecularGridOptions const& opt, int max_points, int min_points,
+        double max_radius, double epsilon) const;
+    /// Adopt the grid stored under key in the in-core cache, if any
+    bool load_cached(const std::string& key, boost::shared_ptr<BasisExtents> extents);
+    /// Store this grid in the in-core cache under key
+    void save_cached(const std::string& key) const;
+    /// Adopt the grid stored under key in PSIF_DFT_GRID, if any
+    bool load_file(const std::string& key, boost::shared_ptr<BasisExtents> extents);
+    /// Store this grid in PSIF_DFT_GRID under key
+    void save_file(const std::string& key) const;
+    /// Take over a blocked grid built earlier (points in block order)
+    void adopt(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z,
+        const std::vector<double>& w, const std::vector<int>& index, const std::vector<int>& block_sizes,
+        int max_functions, boost::shared_ptr<BasisExtents> extents);
+
 public:
     DFTGrid(boost::shared_ptr<Molecule> molecule,
             boost::shared_ptr<BasisSet> primary,
             Options& options);
+    /// Drop the grids of the in-core cache (DFT_GRID_CACHE)
+    static void clear_cache();
+    /**
+     * Build a grid from the DFT_ options, except for the integer
+     * options named in int_opts_map (e.g. "DFT_RADIAL_POINTS"),
+     * which take the values given there. Lets other methods
+     * (COSX, etc.) size their own grids without touching the DFT one
+     */
+    DFTGrid(boost::shared_ptr<Molecule> molecule,
+            boost::shared_ptr<BasisSet> primary,
+            const std::map<std::string, int>& int_opts_map,
+            Options& options);
     virtual ~DFTGrid();
 };
 
@@ -421,6 +452,10 @@ public:
     const std::vector<int>& shells_local_to_global() const { return shells_local_to_global_; }
     /// Relevant functions, local -> global 
     const std::vector<int>& functions_local_to_global() const { return functions_local_to_global_; }
+    /// Center of the bounding sphere
+    const Vector3& xc() const { return xc_; }
+    /// Radius of the bounding sphere
+    double R() const { return R_; }
 };
 
 class BasisExtents {
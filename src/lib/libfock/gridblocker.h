@@ -124,6 +124,11 @@ public:
  */
 class OctreeGridBlocker : public GridBlocker {
 
+protected:
+    /// Whether a leaf is small enough (in points or radius) to become a block
+    bool leaf_finished(const std::vector<int>& leaf, double const* x, double const* y,
+                       double const* z, double T2) const;
+
 public:
     
     OctreeGridBlocker(const int npoints_ref, double const* x_ref, double const* y_ref, double const* z_ref,
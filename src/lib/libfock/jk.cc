@@ -189,6 +189,40 @@ boost::shared_ptr<JK> JK::build_JK(boost::shared_ptr<BasisSet> primary, Options&
             jk->set_bench(options.get_int("BENCH"));
         if (options["DF_INTS_NUM_THREADS"].has_changed())
             jk->set_df_ints_num_threads(options.get_int("DF_INTS_NUM_THREADS"));
+        if (options["SCREENING"].has_changed())
+            jk->set_density_screening(options.get_str("SCREENING") == "DENSITY");
+        if (options["INCFOCK"].has_changed())
+            jk->set_incfock(options.get_bool("INCFOCK"));
+        if (options["INCFOCK_FULL_FOCK_EVERY"].has_changed())
+            jk->set_incfock_full_fock_every(options.get_int("INCFOCK_FULL_FOCK_EVERY"));
+
+        return boost::shared_ptr<JK>(jk);
+
+    } else if (jk_type == "COSX") {
+        COSXJK* jk = new COSXJK(primary, options);
+
+        if (options["INTS_TOLERANCE"].has_changed())
+            jk->set_cutoff(options.get_double("INTS_TOLERANCE"));
+        if (options["PRINT"].has_changed())
+            jk->set_print(options.get_int("PRINT"));
+        if (options["DEBUG"].has_changed())
+            jk->set_debug(options.get_int("DEBUG"));
+        if (options["BENCH"].has_changed())
+            jk->set_bench(options.get_int("BENCH"));
+        if (options["DF_INTS_NUM_THREADS"].has_changed())
+            jk->set_df_ints_num_threads(options.get_int("DF_INTS_NUM_THREADS"));
+        if (options["SCREENING"].has_changed())
+            jk->set_density_screening(options.get_str("SCREENING") == "DENSITY");
+        if (options["INCFOCK"].has_changed())
+            jk->set_incfock(options.get_bool("INCFOCK"));
+        if (options["INCFOCK_FULL_FOCK_EVERY"].has_changed())
+            jk->set_incfock_full_fock_every(options.get_int("INCFOCK_FULL_FOCK_EVERY"));
+        if (options["COSX_RADIAL_POINTS"].has_changed())
+            jk->set_cosx_radial_points(options.get_int("COSX_RADIAL_POINTS"));
+        if (options["COSX_SPHERICAL_POINTS"].has_changed())
+            jk->set_cosx_spherical_points(options.get_int("COSX_SPHERICAL_POINTS"));
+        if (options["COSX_INTS_TOLERANCE"].has_changed())
+            jk->set_cosx_cutoff(options.get_double("COSX_INTS_TOLERANCE"));
 
         return boost::shared_ptr<JK>(jk);
 
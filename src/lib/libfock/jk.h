@@ -43,6 +43,7 @@ class TwoBodyAOInt;
 class Options;
 class FittingMetric;
 class PSIO;
+class DFTGrid;
 
 namespace pk {
 class PKManager;
@@ -656,6 +657,34 @@ protected:
     int df_ints_num_threads_;
     /// ERI Sieve
     boost::shared_ptr<ERISieve> sieve_;
+    /// Weight the Schwarz bounds by the density shell-pair maxima in full builds?
+    bool density_screening_;
+
+    // => Incremental Fock Build State <= //
+
+    /// Contract only the density change since the last build?
+    bool incfock_;
+    /// Number of builds between full (non-incremental) rebuilds
+    int incfock_full_fock_every_;
+    /// Number of builds since the last full rebuild
+    int incfock_count_;
+    /// Was the last build incremental?
+    bool incfock_last_;
+    /// Number of incremental and of full builds since preiterations
+    int incfock_nincremental_;
+    int incfock_nfull_;
+    /// Left-right symmetry of the densities in the last build
+    bool incfock_lr_symmetric_;
+    /// AO densities of the last build
+    std::vector<SharedMatrix> D_prev_;
+    /// AO J matrices of the last build
+    std::vector<SharedMatrix> J_prev_;
+    /// AO K matrices of the last build
+    std::vector<SharedMatrix> K_prev_;
+    /// AO wK matrices of the last build
+    std::vector<SharedMatrix> wK_prev_;
+    /// AO density differences D - D_prev for the current build
+    std::vector<SharedMatrix> delta_D_;
 
     // => Required Algorithm-Specific Methods <= //
 
@@ -668,11 +697,26 @@ protected:
     /// Delete integrals, files, etc
     virtual void postiterations();
 
-    /// Build the J and K matrices for this integral class
+    /**
+     * Build the J and K matrices for this integral class.
+     * Shell-quartet tasks are screened, costed and handed out to
+     * the threads most expensive first
+     * @param density_screen if true, a shell quartet is skipped when its
+     *        Schwarz bound times the largest |D| element over the six
+     *        shell pairs it touches falls below the cutoff
+     */
     void build_JK(std::vector<boost::shared_ptr<TwoBodyAOInt> >& ints,
         std::vector<boost::shared_ptr<Matrix> >& D,
         std::vector<boost::shared_ptr<Matrix> >& J,
-        std::vector<boost::shared_ptr<Matrix> >& K);
+        std::vector<boost::shared_ptr<Matrix> >& K,
+        bool density_screen = false);
+
+    /// Decide if this build is incremental, and form delta_D_ if so
+    bool incfock_setup();
+    /// Add the stored J/K/wK to the incremental results and save the current state
+    void incfock_postiter(bool incremental);
+    /// Drop all stored incremental state, next build is a full one
+    void incfock_reset();
 
     /// Common initialization
     void common_init();
@@ -698,9 +742,119 @@ public:
      * @param val a positive integer
      */
     void set_df_ints_num_threads(int val) { df_ints_num_threads_ = val; }
+    /**
+     * Screen shell quartets by Schwarz bound times the largest
+     * density element they touch, rather than by Schwarz alone?
+     * Incremental builds are always density screened
+     * @param val defaults to false
+     */
+    void set_density_screening(bool val) { density_screening_ = val; }
+    /**
+     * Do incremental Fock builds? If true, each build after the
+     * first contracts only D - D_prev and adds the stored J/K,
+     * with density-weighted Schwarz screening of the quartets
+     * @param incfock defaults to false
+     */
+    void set_incfock(bool incfock) { incfock_ = incfock; }
+    /**
+     * How often to rebuild J/K from the full density
+     * when incremental Fock builds are enabled
+     * @param val a positive integer, defaults to 10
+     */
+    void set_incfock_full_fock_every(int val) { incfock_full_fock_every_ = val; }
 
     // => Accessors <= //
 
+    /// Was the last build incremental?
+    bool incfock_last() const { return incfock_last_; }
+
+    /**
+    * Print header information regarding JK
+    * type on output file
+    */
+    virtual void print_header() const;
+};
+
+/**
+ * Class COSXJK
+ *
+ * Chain-of-spheres (seminumerical) exchange. J is built
+ * integral-direct, exactly as in DirectJK. K is built on a
+ * DFTGrid (OCTREE blocking) from basis function values X
+ * and analytic potential integrals A at each point g:
+ *
+ *  K_{mn} = \sum_g w_g X_{gm} \sum_{rs} A_{rn}(g) X_{gs} D_{sr}
+ *
+ * Each block of points first keeps the Schwarz-surviving shell pairs
+ * (r,n) whose estimated |A_{rn}(g)| over the block, times the largest
+ * F_{gr} = X_{gs} D_{sr} they touch there, reaches the COSX cutoff.
+ * The points of the block then screen that list alone with the same
+ * estimate at the point. The estimate is the Coulomb potential of the
+ * pair's primitive overlap distribution seen from the segment between
+ * the two shell centers: a bound for s shells, a heuristic beyond.
+ *
+ * The grid is sized by COSX_RADIAL_POINTS and COSX_SPHERICAL_POINTS,
+ * everything else follows the DFT_ grid options. wK is not available.
+ */
+class COSXJK : public DirectJK {
+
+protected:
+
+    /// Options object, for the grid
+    Options& options_;
+    /// Radial points per atom of the exchange grid
+    int cosx_radial_points_;
+    /// Spherical points per shell of the exchange grid
+    int cosx_spherical_points_;
+    /// The exchange grid, built in preiterations
+    boost::shared_ptr<DFTGrid> grid_;
+    /// Cutoff for the estimated (rn|1/|r-g|) X D products
+    double cosx_cutoff_;
+
+    // => Required Algorithm-Specific Methods <= //
+
+    /// Setup the sieve and the grid
+    virtual void preiterations();
+    /// Direct J, then seminumerical K
+    virtual void compute_JK();
+    /// Drop the grid
+    virtual void postiterations();
+
+    /// Seminumerical K for all densities in D_ao_
+    void build_K_cosx();
+
+    /// Common initialization
+    void common_init();
+
+public:
+    // => Constructors < = //
+
+    /**
+     * @param primary primary basis set for this system.
+     * @param options Options object, for the grid
+     */
+    COSXJK(boost::shared_ptr<BasisSet> primary, Options& options);
+    /// Destructor
+    virtual ~COSXJK();
+
+    // => Knobs <= //
+
+    /**
+     * Number of radial points per atom in the exchange grid
+     * @param val a positive integer, defaults to 35
+     */
+    void set_cosx_radial_points(int val) { cosx_radial_points_ = val; }
+    /**
+     * Number of spherical points per radial shell in the exchange grid
+     * @param val a Lebedev number, defaults to 110
+     */
+    void set_cosx_spherical_points(int val) { cosx_spherical_points_ = val; }
+    /**
+     * Cutoff for the seminumerical K screen
+     * @param val a small positive number, defaults to 1.0E-12
+     */
+    void set_cosx_cutoff(double val) { cosx_cutoff_ = val; }
+
     /**
     * Print header information regarding JK
     * type on output file
@@ -788,6 +942,13 @@ protected:
     int max_nocc_;
     /// Sieve, must be static throughout the life of the object
     boost::shared_ptr<ERISieve> sieve_;
+    /// Largest |(Q|mn)| over all Q per function pair (empty: sparse K is off)
+    std::vector<double> Qmax_;
+    /// May K_ao_[N] take the sparse contraction in this build?
+    std::vector<char> sparse_K_;
+    /// Largest significant function counts of any occupied orbital, over the sparse K_ao_[N]
+    size_t sparse_left_;
+    size_t sparse_right_;
 
     /// Main (Q|mn) Tensor (or chunk for disk-based)
     SharedMatrix Qmn_;
@@ -805,6 +966,9 @@ protected:
     SharedMatrix E_right_;
     std::vector<SharedMatrix > C_temp_;
     std::vector<SharedMatrix > Q_temp_;
+    /// Gathered right blocks (per thread) and K blocks (per orbital of a round) of the sparse K
+    std::vector<SharedMatrix > R_temp_;
+    std::vector<SharedMatrix > K_temp_;
 
     // => Required Algorithm-Specific Methods <= //
 
@@ -824,6 +988,12 @@ protected:
     unsigned long int memory_temp() const;
     int max_rows() const;
     int max_nocc() const;
+    /// Folds rows [0,naux) of columns [col,col+ncol) of a (Q|mn) block (leading dimension ld) into Qmax_
+    void form_Qmax(double** Qmnp, int naux, size_t col, size_t ncol, size_t ld);
+    /// Decides sparse_K_ and sparse_left_/sparse_right_ for the current C from Qmax_
+    void sparse_K_extents();
+    /// Functions of each occupied orbital of C that can be significant in any block of Q
+    std::vector<std::vector<int> > K_significant_functions(SharedMatrix C, const std::vector<double>& Qmax) const;
     void initialize_temps();
     void free_temps();
     void initialize_w_temps();
@@ -836,6 +1006,13 @@ protected:
     virtual void manage_JK_disk();
     virtual void block_J(double** Qmnp, int naux);
     virtual void block_K(double** Qmnp, int naux);
+    /// E_{miQ} = (Q|mn) C_{ni}, screened by max_Q |(Q|mn)| C_{ni}; mask marks the significant (m,i)
+    void block_K_transform(double** Qmnp, int naux, const std::vector<double>& Qmax,
+                           SharedMatrix C, double** Ep, std::vector<char>& mask);
+    /// K_{mn} += E_{miQ} E_{niQ} over the significant (m,i) blocks only; false if too dense to pay off
+    bool block_K_contract(int naux, int nocc, double** Elp, double** Erp,
+                          const std::vector<char>& left_mask, const std::vector<char>& right_mask,
+                          double** Kp);
 
     // => wK <= //
     virtual void initialize_wK_core();
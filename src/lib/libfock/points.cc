@@ -28,12 +28,60 @@
 #include <libmints/mints.h>
 #include <libqt/qt.h>
 #include <cmath>
+#include <algorithm>
+#include <functional>
 #include "points.h"
 #include "cubature.h"
 #include "psiconfig.h"
 #include "libparallel/ParallelPrinter.h"
 namespace psi {
 
+namespace {
+
+// Keys of basis_values_, by BasisSlot
+const char* const basis_names[BASIS_NSLOTS] = {
+    "PHI",
+    "PHI_X",
+    "PHI_Y",
+    "PHI_Z",
+    "PHI_XX",
+    "PHI_XY",
+    "PHI_XZ",
+    "PHI_YY",
+    "PHI_YZ",
+    "PHI_ZZ"
+};
+
+// Primitives whose contribution to phi (or its derivatives) is below this are
+// dropped from the collocation
+const double prim_cutoff = 1.0E-20;
+
+// Squared radius past which |c| r^L (L + 1 + 2 a r)^deriv exp(-a r^2), with r
+// taken as at least 1, stays below prim_cutoff. This bounds the primitive's
+// contribution to every Cartesian component of phi and of its derivatives up
+// to deriv, so diffuse and high-L primitives keep their polynomial tails.
+double primitive_R2(double c, double alpha, int L, int deriv)
+{
+    c = fabs(c);
+    if (c <= prim_cutoff) return 0.0;
+
+    // Fixed point of R2 = ln(c poly(R) / cutoff) / a, from below
+    double R2 = log(c / prim_cutoff) / alpha;
+    for (int iter = 0; iter < 50; iter++) {
+        double R = std::max(sqrt(R2), 1.0);
+        double poly = pow(R, L) * pow(L + 1.0 + 2.0 * alpha * R, deriv);
+        double R2new = log(c * poly / prim_cutoff) / alpha;
+        if (R2new - R2 < 1.0E-10 * R2) {
+            R2 = R2new;
+            break;
+        }
+        R2 = R2new;
+    }
+    return R2;
+}
+
+}
+
 RKSFunctions::RKSFunctions(boost::shared_ptr<BasisSet> primary, int max_points, int max_functions) :
     PointFunctions(primary,max_points,max_functions)
 {
@@ -86,6 +134,8 @@ void RKSFunctions::allocate()
         point_values_["TAU_A"] = boost::shared_ptr<Vector>(new Vector("TAU_A", max_points_));
         point_values_["TAU_B"] = point_values_["TAU_A"];
     }
+
+    build_point_slots();
 }
 void RKSFunctions::set_pointers(SharedMatrix D_AO)
 {
@@ -109,7 +159,6 @@ void RKSFunctions::compute_points(boost::shared_ptr<BlockOPoints> block)
     // => Global information <= //
     int npoints = block->npoints();
     const std::vector<int>& function_map = block->functions_local_to_global();
-    int nglobal = max_functions_;
     int nlocal  = function_map.size();
 
     double** Tp = temp_->pointer();
@@ -131,10 +180,10 @@ void RKSFunctions::compute_points(boost::shared_ptr<BlockOPoints> block)
     }
 
     // => Build LSDA quantities <= //
-    double** phip = basis_values_["PHI"]->pointer();
-    double* rhoap = point_values_["RHO_A"]->pointer();
+    double** phip = basis_slots_[BASIS_PHI]->pointer();
+    double* rhoap = point_ptrs_[XC_RHO_A];
 
-    C_DGEMM('N','N',npoints,nlocal,nlocal,1.0,phip[0],nglobal,D2p[0],nglobal,0.0,Tp[0],nglobal);
+    contract_density(phip,D2p,Tp,npoints);
     for (int P = 0; P < npoints; P++) {
         rhoap[P] = C_DDOT(nlocal,phip[P],1,Tp[P],1);
     }
@@ -142,13 +191,13 @@ void RKSFunctions::compute_points(boost::shared_ptr<BlockOPoints> block)
     // => Build GGA quantities <= //
     if (ansatz_ >= 1) {
 
-        double** phixp = basis_values_["PHI_X"]->pointer();
-        double** phiyp = basis_values_["PHI_Y"]->pointer();
-        double** phizp = basis_values_["PHI_Z"]->pointer();
-        double* rhoaxp = point_values_["RHO_AX"]->pointer();
-        double* rhoayp = point_values_["RHO_AY"]->pointer();
-        double* rhoazp = point_values_["RHO_AZ"]->pointer();
-        double* gammaaap = point_values_["GAMMA_AA"]->pointer();
+        double** phixp = basis_slots_[BASIS_PHI_X]->pointer();
+        double** phiyp = basis_slots_[BASIS_PHI_Y]->pointer();
+        double** phizp = basis_slots_[BASIS_PHI_Z]->pointer();
+        double* rhoaxp = point_ptrs_[XC_RHO_AX];
+        double* rhoayp = point_ptrs_[XC_RHO_AY];
+        double* rhoazp = point_ptrs_[XC_RHO_AZ];
+        double* gammaaap = point_ptrs_[XC_GAMMA_AA];
 
         for (int P = 0; P < npoints; P++) {
             double rho_x = 2.0 * C_DDOT(nlocal,phixp[P],1,Tp[P],1);
@@ -163,10 +212,10 @@ void RKSFunctions::compute_points(boost::shared_ptr<BlockOPoints> block)
 
     // => Build Meta quantities <= //
     if (ansatz_ >= 2) {
-        double** phixp = basis_values_["PHI_X"]->pointer();
-        double** phiyp = basis_values_["PHI_Y"]->pointer();
-        double** phizp = basis_values_["PHI_Z"]->pointer();
-        double* taup = point_values_["TAU_A"]->pointer();
+        double** phixp = basis_slots_[BASIS_PHI_X]->pointer();
+        double** phiyp = basis_slots_[BASIS_PHI_Y]->pointer();
+        double** phizp = basis_slots_[BASIS_PHI_Z]->pointer();
+        double* taup = point_ptrs_[XC_TAU_A];
 
         ::memset((void*) taup, '\0', sizeof(double) * npoints);
 
@@ -177,7 +226,7 @@ void RKSFunctions::compute_points(boost::shared_ptr<BlockOPoints> block)
 
         for (int x = 0; x < 3; x++) {
             double** phic = phi[x];
-            C_DGEMM('N','N',npoints,nlocal,nlocal,1.0,phic[0],nglobal,D2p[0],nglobal,0.0,Tp[0],nglobal);
+            contract_density(phic,D2p,Tp,npoints);
             for (int P = 0; P < npoints; P++) {
                 taup[P] += C_DDOT(nlocal, phic[P], 1, Tp[P], 1);
             }
@@ -223,7 +272,7 @@ void RKSFunctions::compute_orbitals(boost::shared_ptr<BlockOPoints> block)
 
     // => Build orbitals <= //
 
-    double** phip = basis_values_["PHI"]->pointer();
+    double** phip = basis_slots_[BASIS_PHI]->pointer();
     double** psiap = orbital_values_["PSI_A"]->pointer();
 
     C_DGEMM('T','T',na,npoints,nlocal,1.0,Ca2p[0],na,phip[0],nglobal,0.0,psiap[0],max_points_);
@@ -314,6 +363,8 @@ void UKSFunctions::allocate()
         point_values_["TAU_A"] = boost::shared_ptr<Vector>(new Vector("TAU_A", max_points_));
         point_values_["TAU_B"] = boost::shared_ptr<Vector>(new Vector("TAU_A", max_points_));
     }
+
+    build_point_slots();
 }
 void UKSFunctions::set_pointers(SharedMatrix /*Da_AO*/)
 {
@@ -338,7 +389,6 @@ void UKSFunctions::compute_points(boost::shared_ptr<BlockOPoints> block)
     // => Global information <= //
     int npoints = block->npoints();
     const std::vector<int>& function_map = block->functions_local_to_global();
-    int nglobal = max_functions_;
     int nlocal  = function_map.size();
 
     double** Tap = tempa_->pointer();
@@ -366,16 +416,16 @@ void UKSFunctions::compute_points(boost::shared_ptr<BlockOPoints> block)
     }
 
     // => Build LSDA quantities <= //
-    double** phip = basis_values_["PHI"]->pointer();
-    double* rhoap = point_values_["RHO_A"]->pointer();
-    double* rhobp = point_values_["RHO_B"]->pointer();
+    double** phip = basis_slots_[BASIS_PHI]->pointer();
+    double* rhoap = point_ptrs_[XC_RHO_A];
+    double* rhobp = point_ptrs_[XC_RHO_B];
 
-    C_DGEMM('N','N',npoints,nlocal,nlocal,1.0,phip[0],nglobal,Da2p[0],nglobal,0.0,Tap[0],nglobal);
+    contract_density(phip,Da2p,Tap,npoints);
     for (int P = 0; P < npoints; P++) {
         rhoap[P] = C_DDOT(nlocal,phip[P],1,Tap[P],1);
     }
 
-    C_DGEMM('N','N',npoints,nlocal,nlocal,1.0,phip[0],nglobal,Db2p[0],nglobal,0.0,Tbp[0],nglobal);
+    contract_density(phip,Db2p,Tbp,npoints);
     for (int P = 0; P < npoints; P++) {
         rhobp[P] = C_DDOT(nlocal,phip[P],1,Tbp[P],1);
     }
@@ -383,18 +433,18 @@ void UKSFunctions::compute_points(boost::shared_ptr<BlockOPoints> block)
     // => Build GGA quantities <= //
     if (ansatz_ >= 1) {
 
-        double** phixp = basis_values_["PHI_X"]->pointer();
-        double** phiyp = basis_values_["PHI_Y"]->pointer();
-        double** phizp = basis_values_["PHI_Z"]->pointer();
-        double* rhoaxp = point_values_["RHO_AX"]->pointer();
-        double* rhoayp = point_values_["RHO_AY"]->pointer();
-        double* rhoazp = point_values_["RHO_AZ"]->pointer();
-        double* rhobxp = point_values_["RHO_BX"]->pointer();
-        double* rhobyp = point_values_["RHO_BY"]->pointer();
-        double* rhobzp = point_values_["RHO_BZ"]->pointer();
-        double* gammaaap = point_values_["GAMMA_AA"]->pointer();
-        double* gammaabp = point_values_["GAMMA_AB"]->pointer();
-        double* gammabbp = point_values_["GAMMA_BB"]->pointer();
+        double** phixp = basis_slots_[BASIS_PHI_X]->pointer();
+        double** phiyp = basis_slots_[BASIS_PHI_Y]->pointer();
+        double** phizp = basis_slots_[BASIS_PHI_Z]->pointer();
+        double* rhoaxp = point_ptrs_[XC_RHO_AX];
+        double* rhoayp = point_ptrs_[XC_RHO_AY];
+        double* rhoazp = point_ptrs_[XC_RHO_AZ];
+        double* rhobxp = point_ptrs_[XC_RHO_BX];
+        double* rhobyp = point_ptrs_[XC_RHO_BY];
+        double* rhobzp = point_ptrs_[XC_RHO_BZ];
+        double* gammaaap = point_ptrs_[XC_GAMMA_AA];
+        double* gammaabp = point_ptrs_[XC_GAMMA_AB];
+        double* gammabbp = point_ptrs_[XC_GAMMA_BB];
 
         for (int P = 0; P < npoints; P++) {
             double rhoa_x = 2.0 * C_DDOT(nlocal,phixp[P],1,Tap[P],1);
@@ -417,11 +467,11 @@ void UKSFunctions::compute_points(boost::shared_ptr<BlockOPoints> block)
 
     // => Build Meta quantities <= //
     if (ansatz_ >= 2) {
-        double** phixp = basis_values_["PHI_X"]->pointer();
-        double** phiyp = basis_values_["PHI_Y"]->pointer();
-        double** phizp = basis_values_["PHI_Z"]->pointer();
-        double* tauap = point_values_["TAU_A"]->pointer();
-        double* taubp = point_values_["TAU_B"]->pointer();
+        double** phixp = basis_slots_[BASIS_PHI_X]->pointer();
+        double** phiyp = basis_slots_[BASIS_PHI_Y]->pointer();
+        double** phizp = basis_slots_[BASIS_PHI_Z]->pointer();
+        double* tauap = point_ptrs_[XC_TAU_A];
+        double* taubp = point_ptrs_[XC_TAU_B];
 
         ::memset((void*) tauap, '\0', sizeof(double) * npoints);
         ::memset((void*) taubp, '\0', sizeof(double) * npoints);
@@ -449,7 +499,7 @@ void UKSFunctions::compute_points(boost::shared_ptr<BlockOPoints> block)
                 double** Dc = D[t];
                 double** Tc = T[t];
                 double*  tauc = tau[t];
-                C_DGEMM('N','N',npoints,nlocal,nlocal,1.0,phic[0],nglobal,Dc[0],nglobal,0.0,Tc[0],nglobal);
+                contract_density(phic,Dc,Tc,npoints);
                 for (int P = 0; P < npoints; P++) {
                     tauc[P] += C_DDOT(nlocal, phic[P], 1, Tc[P], 1);
                 }
@@ -506,7 +556,7 @@ void UKSFunctions::compute_orbitals(boost::shared_ptr<BlockOPoints> block)
 
     // => Build orbitals <= //
 
-    double** phip = basis_values_["PHI"]->pointer();
+    double** phip = basis_slots_[BASIS_PHI]->pointer();
     double** psiap = orbital_values_["PSI_A"]->pointer();
     double** psibp = orbital_values_["PSI_B"]->pointer();
 
@@ -551,6 +601,16 @@ PointFunctions::PointFunctions(boost::shared_ptr<BasisSet> primary, int max_poin
 PointFunctions::~PointFunctions()
 {
 }
+void PointFunctions::build_point_slots()
+{
+    point_ptrs_.assign(XC_NPOINT_SLOTS, static_cast<double*>(NULL));
+    for (int slot = 0; slot < XC_NPOINT_SLOTS; slot++) {
+        std::map<std::string, SharedVector>::const_iterator it = point_values_.find(xc_point_name(slot));
+        if (it != point_values_.end()) {
+            point_ptrs_[slot] = (*it).second->pointer();
+        }
+    }
+}
 SharedVector PointFunctions::point_value(const std::string& key)
 {
     return point_values_[key];
@@ -562,7 +622,7 @@ SharedMatrix PointFunctions::orbital_value(const std::string& key)
 }
 
 BasisFunctions::BasisFunctions(boost::shared_ptr<BasisSet> primary, int max_points, int max_functions) :
-    primary_(primary), max_points_(max_points), max_functions_(max_functions)
+    primary_(primary), max_points_(max_points), max_functions_(max_functions), pair_cutoff_(0.0)
 {
     build_spherical();
     set_deriv(0);
@@ -593,6 +653,35 @@ void BasisFunctions::build_spherical()
         spherical_transforms_.push_back(comp);
     }
 }
+void BasisFunctions::build_primitives()
+{
+    prim_order_.clear();
+    prim_R2_.clear();
+
+    for (int Q = 0; Q < primary_->nshell(); Q++) {
+        const GaussianShell& Qshell = primary_->shell(Q);
+        int L         = Qshell.am();
+        int nprim     = Qshell.nprimitive();
+        const double *alpha = Qshell.exps();
+        const double *norm  = Qshell.coefs();
+
+        // Sorted by decreasing radius, the primitives of a point at R2 are a
+        // prefix of the list: the collocation loops stop at the first
+        // primitive with R2 past its radius
+        std::vector<std::pair<double,int> > order;
+        for (int K = 0; K < nprim; K++) {
+            order.push_back(std::make_pair(primitive_R2(norm[K], alpha[K], L, deriv_), K));
+        }
+        std::sort(order.begin(), order.end(), std::greater<std::pair<double,int> >());
+
+        prim_order_.push_back(std::vector<int>());
+        prim_R2_.push_back(std::vector<double>());
+        for (int K = 0; K < nprim; K++) {
+            prim_order_[Q].push_back(order[K].second);
+            prim_R2_[Q].push_back(order[K].first);
+        }
+    }
+}
 void BasisFunctions::allocate()
 {
     basis_values_.clear();
@@ -632,6 +721,15 @@ void BasisFunctions::allocate()
 
     if (deriv_ >= 3)
         throw PSIEXCEPTION("BasisFunctions: Only up to Hessians are currently supported");
+
+    basis_slots_.assign(BASIS_NSLOTS, SharedMatrix());
+    basis_temp_slots_.assign(BASIS_NSLOTS, SharedMatrix());
+    for (int slot = 0; slot < BASIS_NSLOTS; slot++) {
+        if (basis_values_.count(basis_names[slot])) {
+            basis_slots_[slot] = basis_values_[basis_names[slot]];
+            basis_temp_slots_[slot] = basis_temps_[basis_names[slot]];
+        }
+    }
 }
 SharedMatrix BasisFunctions::basis_value(const std::string& key)
 {
@@ -659,9 +757,15 @@ void BasisFunctions::compute_functions(boost::shared_ptr<BlockOPoints> block)
 
     int nsig_functions = block->functions_local_to_global().size();
 
+    shell_offsets_.resize(shells.size() + 1);
+    shell_offsets_[0] = 0;
+    for (size_t Qlocal = 0; Qlocal < shells.size(); Qlocal++) {
+        shell_offsets_[Qlocal + 1] = shell_offsets_[Qlocal] + primary_->shell(shells[Qlocal]).nfunction();
+    }
+
     if (deriv_ == 0) {
-        double** cartp = basis_temps_["PHI"]->pointer();
-        double** purep = basis_values_["PHI"]->pointer();
+        double** cartp = basis_temp_slots_[BASIS_PHI]->pointer();
+        double** purep = basis_slots_[BASIS_PHI]->pointer();
 
         for (int P = 0; P < npoints; P++) {
             ::memset(static_cast<void*>(purep[P]),'\0',nsig_functions*sizeof(double));
@@ -677,6 +781,8 @@ void BasisFunctions::compute_functions(boost::shared_ptr<BlockOPoints> block)
             int nprim     = Qshell.nprimitive();
             const double *alpha = Qshell.exps();
             const double *norm  = Qshell.coefs();
+            const int *prim_order = &prim_order_[Qglobal][0];
+            const double *prim_R2 = &prim_R2_[Qglobal][0];
 
             const std::vector<boost::tuple<int,int,double> >& transform = spherical_transforms_[L];
 
@@ -699,8 +805,9 @@ void BasisFunctions::compute_functions(boost::shared_ptr<BlockOPoints> block)
 
                 double R2 = xc * xc + yc * yc + zc * zc;
                 double S0 = 0.0;
-                for (int K = 0; K < nprim; K++) {
-                    S0 += norm[K] * exp(-alpha[K] * R2);
+                for (int K = 0; K < nprim && R2 < prim_R2[K]; K++) {
+                    int k = prim_order[K];
+                    S0 += norm[k] * exp(-alpha[k] * R2);
                 }
 
                 for (int i=0, index = 0; i<=L; ++i) {
@@ -732,14 +839,14 @@ void BasisFunctions::compute_functions(boost::shared_ptr<BlockOPoints> block)
             function_offset += nQ;
         }
     } else if (deriv_ == 1) {
-        double** cartp = basis_temps_["PHI"]->pointer();
-        double** cartxp = basis_temps_["PHI_X"]->pointer();
-        double** cartyp = basis_temps_["PHI_Y"]->pointer();
-        double** cartzp = basis_temps_["PHI_Z"]->pointer();
-        double** purep = basis_values_["PHI"]->pointer();
-        double** purexp = basis_values_["PHI_X"]->pointer();
-        double** pureyp = basis_values_["PHI_Y"]->pointer();
-        double** purezp = basis_values_["PHI_Z"]->pointer();
+        double** cartp = basis_temp_slots_[BASIS_PHI]->pointer();
+        double** cartxp = basis_temp_slots_[BASIS_PHI_X]->pointer();
+        double** cartyp = basis_temp_slots_[BASIS_PHI_Y]->pointer();
+        double** cartzp = basis_temp_slots_[BASIS_PHI_Z]->pointer();
+        double** purep = basis_slots_[BASIS_PHI]->pointer();
+        double** purexp = basis_slots_[BASIS_PHI_X]->pointer();
+        double** pureyp = basis_slots_[BASIS_PHI_Y]->pointer();
+        double** purezp = basis_slots_[BASIS_PHI_Z]->pointer();
 
         for (int P = 0; P < npoints; P++) {
             ::memset(static_cast<void*>(purep[P]),'\0',nsig_functions*sizeof(double));
@@ -758,6 +865,8 @@ void BasisFunctions::compute_functions(boost::shared_ptr<BlockOPoints> block)
             int nprim     = Qshell.nprimitive();
             const double *alpha = Qshell.exps();
             const double *norm  = Qshell.coefs();
+            const int *prim_order = &prim_order_[Qglobal][0];
+            const double *prim_R2 = &prim_R2_[Qglobal][0];
 
             const std::vector<boost::tuple<int,int,double> >& transform = spherical_transforms_[L];
 
@@ -785,9 +894,10 @@ void BasisFunctions::compute_functions(boost::shared_ptr<BlockOPoints> block)
                 double V2 = 0.0;
 //                double V3 = 0.0;
                 double T1,T2;
-                for (int K = 0; K < nprim; K++) {
-                    T1 =  norm[K] * exp(-alpha[K] * R2);
-                    T2 =  -2.0 * alpha[K] * T1;
+                for (int K = 0; K < nprim && R2 < prim_R2[K]; K++) {
+                    int k = prim_order[K];
+                    T1 =  norm[k] * exp(-alpha[k] * R2);
+                    T2 =  -2.0 * alpha[k] * T1;
                     V1 += T1;
                     V2 += T2;
                 }
@@ -839,26 +949,26 @@ void BasisFunctions::compute_functions(boost::shared_ptr<BlockOPoints> block)
             function_offset += nQ;
         }
     } else if (deriv_ == 2) {
-        double** cartp = basis_temps_["PHI"]->pointer();
-        double** cartxp = basis_temps_["PHI_X"]->pointer();
-        double** cartyp = basis_temps_["PHI_Y"]->pointer();
-        double** cartzp = basis_temps_["PHI_Z"]->pointer();
-        double** cartxxp = basis_temps_["PHI_XX"]->pointer();
-        double** cartxyp = basis_temps_["PHI_XY"]->pointer();
-        double** cartxzp = basis_temps_["PHI_XZ"]->pointer();
-        double** cartyyp = basis_temps_["PHI_YY"]->pointer();
-        double** cartyzp = basis_temps_["PHI_YZ"]->pointer();
-        double** cartzzp = basis_temps_["PHI_ZZ"]->pointer();
-        double** purep = basis_values_["PHI"]->pointer();
-        double** purexp = basis_values_["PHI_X"]->pointer();
-        double** pureyp = basis_values_["PHI_Y"]->pointer();
-        double** purezp = basis_values_["PHI_Z"]->pointer();
-        double** purexxp = basis_values_["PHI_XX"]->pointer();
-        double** purexyp = basis_values_["PHI_XY"]->pointer();
-        double** purexzp = basis_values_["PHI_XZ"]->pointer();
-        double** pureyyp = basis_values_["PHI_YY"]->pointer();
-        double** pureyzp = basis_values_["PHI_YZ"]->pointer();
-        double** purezzp = basis_values_["PHI_ZZ"]->pointer();
+        double** cartp = basis_temp_slots_[BASIS_PHI]->pointer();
+        double** cartxp = basis_temp_slots_[BASIS_PHI_X]->pointer();
+        double** cartyp = basis_temp_slots_[BASIS_PHI_Y]->pointer();
+        double** cartzp = basis_temp_slots_[BASIS_PHI_Z]->pointer();
+        double** cartxxp = basis_temp_slots_[BASIS_PHI_XX]->pointer();
+        double** cartxyp = basis_temp_slots_[BASIS_PHI_XY]->pointer();
+        double** cartxzp = basis_temp_slots_[BASIS_PHI_XZ]->pointer();
+        double** cartyyp = basis_temp_slots_[BASIS_PHI_YY]->pointer();
+        double** cartyzp = basis_temp_slots_[BASIS_PHI_YZ]->pointer();
+        double** cartzzp = basis_temp_slots_[BASIS_PHI_ZZ]->pointer();
+        double** purep = basis_slots_[BASIS_PHI]->pointer();
+        double** purexp = basis_slots_[BASIS_PHI_X]->pointer();
+        double** pureyp = basis_slots_[BASIS_PHI_Y]->pointer();
+        double** purezp = basis_slots_[BASIS_PHI_Z]->pointer();
+        double** purexxp = basis_slots_[BASIS_PHI_XX]->pointer();
+        double** purexyp = basis_slots_[BASIS_PHI_XY]->pointer();
+        double** purexzp = basis_slots_[BASIS_PHI_XZ]->pointer();
+        double** pureyyp = basis_slots_[BASIS_PHI_YY]->pointer();
+        double** pureyzp = basis_slots_[BASIS_PHI_YZ]->pointer();
+        double** purezzp = basis_slots_[BASIS_PHI_ZZ]->pointer();
 
         for (int P = 0; P < npoints; P++) {
             ::memset(static_cast<void*>(purep[P]),'\0',nsig_functions*sizeof(double));
@@ -883,6 +993,8 @@ void BasisFunctions::compute_functions(boost::shared_ptr<BlockOPoints> block)
             int nprim     = Qshell.nprimitive();
             const double *alpha = Qshell.exps();
             const double *norm  = Qshell.coefs();
+            const int *prim_order = &prim_order_[Qglobal][0];
+            const double *prim_R2 = &prim_R2_[Qglobal][0];
 
             const std::vector<boost::tuple<int,int,double> >& transform = spherical_transforms_[L];
 
@@ -913,10 +1025,11 @@ void BasisFunctions::compute_functions(boost::shared_ptr<BlockOPoints> block)
                 double V2 = 0.0;
                 double V3 = 0.0;
                 double T1,T2,T3;
-                for (int K = 0; K < nprim; K++) {
-                    T1 =  norm[K] * exp(-alpha[K] * R2);
-                    T2 =  -2.0 * alpha[K] * T1;
-                    T3 =  -2.0 * alpha[K] * T2;
+                for (int K = 0; K < nprim && R2 < prim_R2[K]; K++) {
+                    int k = prim_order[K];
+                    T1 =  norm[k] * exp(-alpha[k] * R2);
+                    T2 =  -2.0 * alpha[k] * T1;
+                    T3 =  -2.0 * alpha[k] * T2;
                     V1 += T1;
                     V2 += T2;
                     V3 += T3;
@@ -1007,6 +1120,134 @@ void BasisFunctions::compute_functions(boost::shared_ptr<BlockOPoints> block)
     delete[] xc_pow;
     delete[] yc_pow;
     delete[] zc_pow;
+
+    if (pair_cutoff_ > 0.0) {
+        compute_shell_max(npoints);
+    }
+}
+void BasisFunctions::compute_shell_max(int npoints)
+{
+    int nshell = shell_offsets_.size() - 1;
+    shell_max_.assign(nshell, 0.0);
+
+    for (int slot = 0; slot < BASIS_NSLOTS; slot++) {
+        if (!basis_slots_[slot]) continue;
+        double** phip = basis_slots_[slot]->pointer();
+        for (int P = 0; P < npoints; P++) {
+            for (int M = 0; M < nshell; M++) {
+                double val = shell_max_[M];
+                for (int m = shell_offsets_[M]; m < shell_offsets_[M + 1]; m++) {
+                    val = std::max(val, fabs(phip[P][m]));
+                }
+                shell_max_[M] = val;
+            }
+        }
+    }
+}
+void BasisFunctions::contract_density(double** phip, double** Dp, double** Tp, int npoints)
+{
+    int nshell = shell_offsets_.size() - 1;
+
+    if (pair_cutoff_ == 0.0) {
+        pair_mask_.assign(nshell * nshell, 1);
+    } else {
+        pair_mask_.resize(nshell * nshell);
+        for (int M = 0; M < nshell; M++) {
+            for (int N = 0; N < nshell; N++) {
+                double Dmax = 0.0;
+                for (int m = shell_offsets_[M]; m < shell_offsets_[M + 1]; m++) {
+                    for (int n = shell_offsets_[N]; n < shell_offsets_[N + 1]; n++) {
+                        Dmax = std::max(Dmax, fabs(Dp[m][n]));
+                    }
+                }
+                pair_mask_[M * nshell + N] = (shell_max_[M] * Dmax * shell_max_[N] >= pair_cutoff_);
+            }
+        }
+    }
+
+    contract_pairs('N', phip, Dp, Tp, npoints, 0.0);
+}
+void BasisFunctions::contract_potential(double** phip, double** Tp, double** Vp, int npoints, double beta)
+{
+    int nshell = shell_offsets_.size() - 1;
+
+    if (pair_cutoff_ == 0.0) {
+        pair_mask_.assign(nshell * nshell, 1);
+    } else {
+        std::vector<double> Tmax(nshell, 0.0);
+        for (int P = 0; P < npoints; P++) {
+            for (int N = 0; N < nshell; N++) {
+                for (int n = shell_offsets_[N]; n < shell_offsets_[N + 1]; n++) {
+                    Tmax[N] = std::max(Tmax[N], fabs(Tp[P][n]));
+                }
+            }
+        }
+        pair_mask_.resize(nshell * nshell);
+        for (int M = 0; M < nshell; M++) {
+            for (int N = 0; N < nshell; N++) {
+                pair_mask_[M * nshell + N] = (npoints * shell_max_[M] * Tmax[N] >= pair_cutoff_);
+            }
+        }
+    }
+
+    contract_pairs('T', phip, Tp, Vp, npoints, beta);
+}
+void BasisFunctions::contract_pairs(char transa, double** Ap, double** Bp, double** Cp, int npoints, double beta)
+{
+    int nshell = shell_offsets_.size() - 1;
+    int nlocal = shell_offsets_[nshell];
+    int ld = max_functions_;
+
+    if (nlocal == 0 || npoints == 0) return;
+
+    // Nothing to skip: one dense GEMM
+    if (std::find(pair_mask_.begin(), pair_mask_.end(), 0) == pair_mask_.end()) {
+        if (transa == 'N') {
+            C_DGEMM('N','N',npoints,nlocal,nlocal,1.0,Ap[0],ld,Bp[0],ld,beta,Cp[0],ld);
+        } else {
+            C_DGEMM('T','N',nlocal,nlocal,npoints,1.0,Ap[0],ld,Bp[0],ld,beta,Cp[0],ld);
+        }
+        return;
+    }
+
+    // One GEMM per run of consecutive significant M shells in each column shell N
+    for (int N = 0; N < nshell; N++) {
+        int n0 = shell_offsets_[N];
+        int nN = shell_offsets_[N + 1] - n0;
+        bool written = false;
+
+        for (int M = 0; M < nshell;) {
+            char sig = pair_mask_[M * nshell + N];
+            int M2 = M;
+            while (M2 < nshell && pair_mask_[M2 * nshell + N] == sig) M2++;
+            int m0 = shell_offsets_[M];
+            int nM = shell_offsets_[M2] - m0;
+
+            if (transa == 'N') {
+                // C_{PN} = \sum_M A_{PM} B_{MN}
+                if (sig) {
+                    C_DGEMM('N','N',npoints,nN,nM,1.0,&Ap[0][m0],ld,&Bp[m0][n0],ld,(written ? 1.0 : beta),&Cp[0][n0],ld);
+                    written = true;
+                }
+            } else {
+                // C_{MN} = \sum_P A_{PM} B_{PN}
+                if (sig) {
+                    C_DGEMM('T','N',nM,nN,npoints,1.0,&Ap[0][m0],ld,&Bp[0][n0],ld,beta,&Cp[m0][n0],ld);
+                } else if (beta == 0.0) {
+                    for (int m = m0; m < m0 + nM; m++) {
+                        ::memset(static_cast<void*>(&Cp[m][n0]),'\0',nN*sizeof(double));
+                    }
+                }
+            }
+            M = M2;
+        }
+
+        if (transa == 'N' && !written && beta == 0.0) {
+            for (int P = 0; P < npoints; P++) {
+                ::memset(static_cast<void*>(&Cp[P][n0]),'\0',nN*sizeof(double));
+            }
+        }
+    }
 }
 void BasisFunctions::print(std::string out, int print) const
 {
@@ -32,6 +32,7 @@
 #include <map>
 
 #include <libmints/typedefs.h>
+#include <libfunctional/xcslots.h>
 #include <boost/tuple/tuple.hpp>
 
 namespace psi {
@@ -44,6 +45,20 @@ class IntVector;
 class Vector3;
 class BlockOPoints;
 
+/// Basis function values and derivatives, the keys of BasisFunctions::basis_values()
+enum BasisSlot {
+    BASIS_PHI,
+    BASIS_PHI_X,
+    BASIS_PHI_Y,
+    BASIS_PHI_Z,
+    BASIS_PHI_XX,
+    BASIS_PHI_XY,
+    BASIS_PHI_XZ,
+    BASIS_PHI_YY,
+    BASIS_PHI_YZ,
+    BASIS_PHI_ZZ,
+    BASIS_NSLOTS
+};
 
 class BasisFunctions {
 
@@ -62,11 +77,36 @@ protected:
     std::map<std::string, SharedMatrix > basis_values_;
     /// Map of temp names to Matrices containing temps
     std::map<std::string, SharedMatrix > basis_temps_;
+    /// basis_values_ by BasisSlot (NULL if not allocated)
+    std::vector<SharedMatrix> basis_slots_;
+    /// basis_temps_ by BasisSlot (NULL if not allocated)
+    std::vector<SharedMatrix> basis_temp_slots_;
     /// [L]: pure_index, cart_index, coef
     std::vector<std::vector<boost::tuple<int,int,double> > > spherical_transforms_;
 
+    // => Screening <= //
+
+    /// Primitives of each shell, most diffuse (largest significant radius) first
+    std::vector<std::vector<int> > prim_order_;
+    /// Squared radius beyond which each primitive of prim_order_ is negligible
+    std::vector<std::vector<double> > prim_R2_;
+    /// Cutoff on the shell-pair bounds of the density and V contractions (0.0 is dense)
+    double pair_cutoff_;
+    /// Offsets of the local shells of the last block in the local functions (nshell + 1)
+    std::vector<int> shell_offsets_;
+    /// Largest |phi| (or derivative) over the points of the last block, per local shell
+    std::vector<double> shell_max_;
+    /// Significant local shell pairs of the last contraction, nshell x nshell
+    std::vector<char> pair_mask_;
+
     /// Setup spherical_transforms_
     void build_spherical();
+    /// Setup prim_order_ and prim_R2_ for deriv_
+    void build_primitives();
+    /// Record shell_max_ for the last block
+    void compute_shell_max(int npoints);
+    /// Dense or block-sparse GEMM over the local shell pairs in pair_mask_
+    void contract_pairs(char transa, double** Ap, double** Bp, double** Cp, int npoints, double beta);
     /// Allocate registers
     virtual void allocate();
 
@@ -80,22 +120,32 @@ public:
 
     void compute_functions(boost::shared_ptr<BlockOPoints> block);
 
+    /// T = phi D for the last block, skipping shell pairs (M,N) with
+    /// max|phi_M| max|D_MN| max|phi_N| below the pair cutoff
+    void contract_density(double** phip, double** Dp, double** Tp, int npoints);
+    /// V = phi^T T + beta V for the last block, skipping shell pairs (M,N)
+    /// with npoints max|phi_M| max|T_N| below the pair cutoff
+    void contract_potential(double** phip, double** Tp, double** Vp, int npoints, double beta = 0.0);
+
     // => Accessors <= //
 
     SharedMatrix basis_value(const std::string& key);
+    const SharedMatrix& basis_value(BasisSlot slot) const { return basis_slots_[slot]; }
     std::map<std::string, SharedMatrix>& basis_values() { return basis_values_; }
 
     int max_functions() const { return max_functions_; }
     int max_points() const { return max_points_; }
     int deriv() const { return deriv_; }
+    double pair_cutoff() const { return pair_cutoff_; }
 
     virtual void print(std::string OutFileRMR = "outfile", int print = 2) const;
     
     // => Setters <= //
 
-    void set_deriv(int deriv) { deriv_ = deriv; allocate(); }
+    void set_deriv(int deriv) { deriv_ = deriv; allocate(); build_primitives(); }
     void set_max_functions(int max_functions) { max_functions_ = max_functions; allocate(); }
     void set_max_points(int max_points) { max_points_ = max_points; allocate(); }
+    void set_pair_cutoff(double pair_cutoff) { pair_cutoff_ = pair_cutoff; }
 };
 
 class PointFunctions : public BasisFunctions {
@@ -105,6 +155,11 @@ protected:
     int ansatz_;
     /// Map of value names to Vectors containing values
     std::map<std::string, boost::shared_ptr<Vector> > point_values_;
+    /// Data pointers of point_values_ by XCPointSlot (NULL if not allocated)
+    std::vector<double*> point_ptrs_;
+
+    /// Rebuild point_ptrs_ from point_values_
+    void build_point_slots();
 
     // => Orbital Collocation <= //
 
@@ -125,6 +180,8 @@ public:
 
     boost::shared_ptr<Vector> point_value(const std::string& key);
     std::map<std::string, SharedVector>& point_values() { return point_values_; }
+    /// Point values by XCPointSlot, the input of SuperFunctional::compute_functional
+    double* const* point_pointers() const { return &point_ptrs_[0]; }
     
     virtual std::vector<SharedMatrix> scratch() = 0;
     virtual std::vector<SharedMatrix> D_scratch() = 0;
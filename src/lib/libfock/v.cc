@@ -35,6 +35,9 @@
 #include "v.h"
 
 #include <sstream>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace psi;
 
@@ -54,6 +57,18 @@ void VBase::common_init()
 {
     print_ = options_.get_int("PRINT");
     debug_ = options_.get_int("DEBUG");
+    num_threads_ = 1;
+    #ifdef _OPENMP
+        num_threads_ = omp_get_max_threads();
+    #endif
+}
+void VBase::build_functional_workers()
+{
+    functional_workers_.clear();
+    functional_workers_.push_back(functional_);
+    for (int thread = 1; thread < num_threads_; thread++) {
+        functional_workers_.push_back(functional_->build_worker());
+    }
 }
 boost::shared_ptr<VBase> VBase::build_V(boost::shared_ptr<BasisSet> primary, 
                                         Options& options, const std::string& type)
@@ -388,6 +403,8 @@ SharedMatrix VBase::compute_gradient()
 }
 void VBase::finalize()
 {
+    point_workers_.clear();
+    functional_workers_.clear();
     grid_.reset();
 }
 void VBase::print_header() const
@@ -410,8 +427,15 @@ void RV::initialize()
     VBase::initialize();
     int max_points = grid_->max_points();
     int max_functions = grid_->max_functions(); 
-    properties_ = boost::shared_ptr<PointFunctions>(new RKSFunctions(primary_,max_points,max_functions));
-    properties_->set_ansatz(functional_->ansatz());
+    point_workers_.clear();
+    for (int thread = 0; thread < num_threads_; thread++) {
+        boost::shared_ptr<PointFunctions> point_tmp(new RKSFunctions(primary_,max_points,max_functions));
+        point_tmp->set_ansatz(functional_->ansatz());
+        point_tmp->set_pair_cutoff(options_.get_double("DFT_SHELL_PAIR_TOLERANCE"));
+        point_workers_.push_back(point_tmp);
+    }
+    properties_ = point_workers_[0];
+    build_functional_workers();
 }
 void RV::finalize()
 {
@@ -430,7 +454,9 @@ void RV::compute_V()
     // Setup the pointers
     SharedMatrix D_AO = D_AO_[0];
     SharedMatrix V_AO = V_AO_[0];
-    properties_->set_pointers(D_AO);
+    for (int thread = 0; thread < num_threads_; thread++) {
+        point_workers_[thread]->set_pointers(D_AO);
+    }
 
     // What local XC ansatz are we in?
     int ansatz = functional_->ansatz();
@@ -439,29 +465,44 @@ void RV::compute_V()
     int max_functions = grid_->max_functions(); 
     int max_points = grid_->max_points();
 
-    // Local/global V matrices
-    SharedMatrix V_local(new Matrix("V Temp", max_functions, max_functions));
-    double** V2p = V_local->pointer();
-    double** Vp = V_AO->pointer();
-
-    // Scratch
-    std::vector<SharedMatrix> scratch = properties_->scratch();
-    SharedMatrix T_local = scratch[0];
-    double** Tp = T_local->pointer();
+    // Local/global V matrices, one per thread (the first thread accumulates into V_AO)
+    int nthread = num_threads_;
+    std::vector<SharedMatrix> V_local;
+    std::vector<SharedMatrix> V_thread;
+    std::vector<SharedVector> QT;
+    for (int thread = 0; thread < nthread; thread++) {
+        V_local.push_back(SharedMatrix(new Matrix("V Temp", max_functions, max_functions)));
+        V_thread.push_back(thread == 0 ? V_AO : SharedMatrix(V_AO->clone()));
+        if (thread) V_thread[thread]->zero();
+        QT.push_back(SharedVector(new Vector("Quadrature Temp", max_points)));
+    }
 
     // Traverse the blocks of points
-    double functionalq = 0.0;
-    double rhoaq       = 0.0;
-    double rhoaxq      = 0.0;
-    double rhoayq      = 0.0;
-    double rhoazq      = 0.0;
-
-    boost::shared_ptr<Vector> QT(new Vector("Quadrature Temp", max_points));
-    double *restrict QTp = QT->pointer();
+    std::vector<double> functionalq(nthread, 0.0);
+    std::vector<double> rhoaq(nthread, 0.0);
+    std::vector<double> rhoaxq(nthread, 0.0);
+    std::vector<double> rhoayq(nthread, 0.0);
+    std::vector<double> rhoazq(nthread, 0.0);
+
     const std::vector<boost::shared_ptr<BlockOPoints> >& blocks = grid_->blocks();
 
+    // Blocks go to the threads round robin, so that every thread sums the same blocks
+    // in the same order on each run with the same number of threads
+    #pragma omp parallel for schedule(static, 1) num_threads(nthread)
     for (size_t Q = 0; Q < blocks.size(); Q++) {
 
+        int thread = 0;
+        #ifdef _OPENMP
+            thread = omp_get_thread_num();
+        #endif
+
+        boost::shared_ptr<PointFunctions> properties = point_workers_[thread];
+        boost::shared_ptr<SuperFunctional> functional = functional_workers_[thread];
+        double** V2p = V_local[thread]->pointer();
+        double** Vp = V_thread[thread]->pointer();
+        double** Tp = properties->scratch()[0]->pointer();
+        double *restrict QTp = QT[thread]->pointer();
+
         boost::shared_ptr<BlockOPoints> block = blocks[Q];
         int npoints = block->npoints();
         double *restrict x = block->x();
@@ -471,65 +512,58 @@ void RV::compute_V()
         const std::vector<int>& function_map = block->functions_local_to_global();
         int nlocal = function_map.size();
 
-        timer_on("Properties");
-        properties_->compute_points(block);
-        timer_off("Properties");
-        timer_on("Functional");
-        std::map<std::string, SharedVector>& vals = functional_->compute_functional(properties_->point_values(), npoints); 
-        timer_off("Functional");
+        properties->compute_points(block);
+        double* const* vals = functional->compute_functional(properties->point_pointers(), npoints); 
 
         if (debug_ > 4) {
-            block->print("outfile", debug_);
-            properties_->print("outfile", debug_);
+            #pragma omp critical
+            {
+                block->print("outfile", debug_);
+                properties->print("outfile", debug_);
+            }
         }
 
-        timer_on("V_XC");
-        double** phi = properties_->basis_value("PHI")->pointer();
-        double *restrict rho_a = properties_->point_value("RHO_A")->pointer();
-        double *restrict zk = vals["V"]->pointer(); 
-        double *restrict v_rho_a = vals["V_RHO_A"]->pointer();
+        double** phi = properties->basis_value(BASIS_PHI)->pointer();
+        double *restrict rho_a = properties->point_pointers()[XC_RHO_A];
+        double *restrict zk = vals[XC_V]; 
+        double *restrict v_rho_a = vals[XC_V_RHO_A];
 
         // => Quadrature values <= //
-        functionalq += C_DDOT(npoints,w,1,zk,1);
+        functionalq[thread] += C_DDOT(npoints,w,1,zk,1);
         for (int P = 0; P < npoints; P++) {
             QTp[P] = w[P] * rho_a[P];
         }
-        rhoaq       += C_DDOT(npoints,w,1,rho_a,1);
-        rhoaxq      += C_DDOT(npoints,QTp,1,x,1);
-        rhoayq      += C_DDOT(npoints,QTp,1,y,1);
-        rhoazq      += C_DDOT(npoints,QTp,1,z,1);
+        rhoaq[thread]       += C_DDOT(npoints,w,1,rho_a,1);
+        rhoaxq[thread]      += C_DDOT(npoints,QTp,1,x,1);
+        rhoayq[thread]      += C_DDOT(npoints,QTp,1,y,1);
+        rhoazq[thread]      += C_DDOT(npoints,QTp,1,z,1);
 
         // => LSDA contribution (symmetrized) <= //
-        timer_on("LSDA");
         for (int P = 0; P < npoints; P++) {
             ::memset(static_cast<void*>(Tp[P]),'\0',nlocal*sizeof(double));
             C_DAXPY(nlocal,0.5 * v_rho_a[P] * w[P], phi[P], 1, Tp[P], 1); 
         }
-        timer_off("LSDA");
         
         // => GGA contribution (symmetrized) <= // 
         if (ansatz >= 1) {
-            timer_on("GGA");
-            double** phix = properties_->basis_value("PHI_X")->pointer();
-            double** phiy = properties_->basis_value("PHI_Y")->pointer();
-            double** phiz = properties_->basis_value("PHI_Z")->pointer();
-            double *restrict rho_ax = properties_->point_value("RHO_AX")->pointer();
-            double *restrict rho_ay = properties_->point_value("RHO_AY")->pointer();
-            double *restrict rho_az = properties_->point_value("RHO_AZ")->pointer();
-            double *restrict v_sigma_aa = vals["V_GAMMA_AA"]->pointer(); 
-            double *restrict v_sigma_ab = vals["V_GAMMA_AB"]->pointer(); 
+            double** phix = properties->basis_value(BASIS_PHI_X)->pointer();
+            double** phiy = properties->basis_value(BASIS_PHI_Y)->pointer();
+            double** phiz = properties->basis_value(BASIS_PHI_Z)->pointer();
+            double *restrict rho_ax = properties->point_pointers()[XC_RHO_AX];
+            double *restrict rho_ay = properties->point_pointers()[XC_RHO_AY];
+            double *restrict rho_az = properties->point_pointers()[XC_RHO_AZ];
+            double *restrict v_sigma_aa = vals[XC_V_GAMMA_AA]; 
+            double *restrict v_sigma_ab = vals[XC_V_GAMMA_AB]; 
 
             for (int P = 0; P < npoints; P++) {
                 C_DAXPY(nlocal,w[P] * (2.0 * v_sigma_aa[P] * rho_ax[P] + v_sigma_ab[P] * rho_ax[P]), phix[P], 1, Tp[P], 1); 
                 C_DAXPY(nlocal,w[P] * (2.0 * v_sigma_aa[P] * rho_ay[P] + v_sigma_ab[P] * rho_ay[P]), phiy[P], 1, Tp[P], 1); 
                 C_DAXPY(nlocal,w[P] * (2.0 * v_sigma_aa[P] * rho_az[P] + v_sigma_ab[P] * rho_az[P]), phiz[P], 1, Tp[P], 1); 
             }        
-            timer_off("GGA");
         }
 
-        // Single GEMM slams GGA+LSDA together (man but GEM's hot!)
-        timer_on("LSDA");
-        C_DGEMM('T','N',nlocal,nlocal,npoints,1.0,phi[0],max_functions,Tp[0],max_functions,0.0,V2p[0],max_functions);
+        // Single (shell-pair screened) GEMM slams GGA+LSDA together (man but GEM's hot!)
+        properties->contract_potential(phi,Tp,V2p,npoints);
 
         // Symmetrization (V is Hermitian)
         for (int m = 0; m < nlocal; m++) {
@@ -537,15 +571,13 @@ void RV::compute_V()
                 V2p[m][n] = V2p[n][m] = V2p[m][n] + V2p[n][m]; 
             }
         } 
-        timer_off("LSDA");
 
         // => Meta contribution <= //
         if (ansatz >= 2) {
-            timer_on("Meta");
-            double** phix = properties_->basis_value("PHI_X")->pointer();
-            double** phiy = properties_->basis_value("PHI_Y")->pointer();
-            double** phiz = properties_->basis_value("PHI_Z")->pointer();
-            double *restrict v_tau_a = vals["V_TAU_A"]->pointer(); 
+            double** phix = properties->basis_value(BASIS_PHI_X)->pointer();
+            double** phiy = properties->basis_value(BASIS_PHI_Y)->pointer();
+            double** phiz = properties->basis_value(BASIS_PHI_Z)->pointer();
+            double *restrict v_tau_a = vals[XC_V_TAU_A]; 
             
             double** phi[3];
             phi[0] = phix;
@@ -558,9 +590,8 @@ void RV::compute_V()
                     ::memset(static_cast<void*>(Tp[P]),'\0',nlocal*sizeof(double));
                     C_DAXPY(nlocal,v_tau_a[P] * w[P], phiw[P], 1, Tp[P], 1); 
                 }        
-                C_DGEMM('T','N',nlocal,nlocal,npoints,1.0,phiw[0],max_functions,Tp[0],max_functions,1.0,V2p[0],max_functions);
+                properties->contract_potential(phiw,Tp,V2p,npoints,1.0);
             }            
-            timer_off("Meta");
         }       
  
         // => Unpacking <= //
@@ -573,18 +604,28 @@ void RV::compute_V()
             }
             Vp[mg][mg] += V2p[ml][ml];
         }
-        timer_off("V_XC");
     } 
    
-    quad_values_["FUNCTIONAL"] = functionalq;
-    quad_values_["RHO_A"]      = rhoaq; 
-    quad_values_["RHO_AX"]     = rhoaxq; 
-    quad_values_["RHO_AY"]     = rhoayq; 
-    quad_values_["RHO_AZ"]     = rhoazq; 
-    quad_values_["RHO_B"]      = rhoaq; 
-    quad_values_["RHO_BX"]     = rhoaxq; 
-    quad_values_["RHO_BY"]     = rhoayq; 
-    quad_values_["RHO_BZ"]     = rhoazq; 
+    // Reduce over threads in thread order; with the static schedule above the result
+    // is bitwise reproducible for a given number of threads
+    for (int thread = 1; thread < nthread; thread++) {
+        V_AO->add(V_thread[thread]);
+        functionalq[0] += functionalq[thread];
+        rhoaq[0]       += rhoaq[thread];
+        rhoaxq[0]      += rhoaxq[thread];
+        rhoayq[0]      += rhoayq[thread];
+        rhoazq[0]      += rhoazq[thread];
+    }
+
+    quad_values_["FUNCTIONAL"] = functionalq[0];
+    quad_values_["RHO_A"]      = rhoaq[0]; 
+    quad_values_["RHO_AX"]     = rhoaxq[0]; 
+    quad_values_["RHO_AY"]     = rhoayq[0]; 
+    quad_values_["RHO_AZ"]     = rhoazq[0]; 
+    quad_values_["RHO_B"]      = rhoaq[0]; 
+    quad_values_["RHO_BX"]     = rhoaxq[0]; 
+    quad_values_["RHO_BY"]     = rhoayq[0]; 
+    quad_values_["RHO_BZ"]     = rhoazq[0]; 
  
     if (debug_) {
         outfile->Printf( "   => Numerical Integrals <=\n\n");
@@ -606,15 +647,19 @@ SharedMatrix RV::compute_gradient()
     // Build the target gradient Matrix
     int natom = primary_->molecule()->natom();
     SharedMatrix G(new Matrix("XC Gradient", natom,3));
-    double** Gp = G->pointer();
 
     // Set Hessian derivative level in properties
     int old_deriv = properties_->deriv(); 
-    properties_->set_deriv((functional_->is_gga() || functional_->is_meta() ? 2 : 1));
+    int nthread = num_threads_;
+    for (int thread = 0; thread < nthread; thread++) {
+        point_workers_[thread]->set_deriv((functional_->is_gga() || functional_->is_meta() ? 2 : 1));
+    }
 
     // Setup the pointers
     SharedMatrix D_AO = D_AO_[0];
-    properties_->set_pointers(D_AO);
+    for (int thread = 0; thread < nthread; thread++) {
+        point_workers_[thread]->set_pointers(D_AO);
+    }
 
     // What local XC ansatz are we in?
 //    int ansatz = functional_->ansatz();
@@ -623,29 +668,42 @@ SharedMatrix RV::compute_gradient()
     int max_functions = grid_->max_functions(); 
     int max_points = grid_->max_points();
 
-    // Scratch
-    std::vector<SharedMatrix> scratch = properties_->scratch();
-    SharedMatrix T_local = scratch[0];
-    SharedMatrix U_local(T_local->clone());
-    double** Tp = T_local->pointer();
-    double** Up = U_local->pointer();
-    std::vector<SharedMatrix> Dscratch = properties_->D_scratch();
-    SharedMatrix D_local = Dscratch[0];
-    double** Dp = D_local->pointer();
+    // Scratch and gradient contributions, one per thread
+    std::vector<SharedMatrix> U_local;
+    std::vector<SharedMatrix> G_thread;
+    std::vector<SharedVector> QT;
+    for (int thread = 0; thread < nthread; thread++) {
+        U_local.push_back(SharedMatrix(point_workers_[thread]->scratch()[0]->clone()));
+        G_thread.push_back(thread == 0 ? G : SharedMatrix(G->clone()));
+        QT.push_back(SharedVector(new Vector("Quadrature Temp", max_points)));
+    }
 
     // Traverse the blocks of points
-    double functionalq = 0.0;
-    double rhoaq       = 0.0;
-    double rhoaxq      = 0.0;
-    double rhoayq      = 0.0;
-    double rhoazq      = 0.0;
-
-    boost::shared_ptr<Vector> QT(new Vector("Quadrature Temp", max_points));
-    double* QTp = QT->pointer();
+    std::vector<double> functionalq(nthread, 0.0);
+    std::vector<double> rhoaq(nthread, 0.0);
+    std::vector<double> rhoaxq(nthread, 0.0);
+    std::vector<double> rhoayq(nthread, 0.0);
+    std::vector<double> rhoazq(nthread, 0.0);
+
     const std::vector<boost::shared_ptr<BlockOPoints> >& blocks = grid_->blocks();
 
+    // Same static schedule as RV::compute_V, for a reproducible reduction
+    #pragma omp parallel for schedule(static, 1) num_threads(nthread)
     for (size_t Q = 0; Q < blocks.size(); Q++) {
 
+        int thread = 0;
+        #ifdef _OPENMP
+            thread = omp_get_thread_num();
+        #endif
+
+        boost::shared_ptr<PointFunctions> properties = point_workers_[thread];
+        boost::shared_ptr<SuperFunctional> functional = functional_workers_[thread];
+        double** Tp = properties->scratch()[0]->pointer();
+        double** Up = U_local[thread]->pointer();
+        double** Dp = properties->D_scratch()[0]->pointer();
+        double** Gp = G_thread[thread]->pointer();
+        double* QTp = QT[thread]->pointer();
+
         boost::shared_ptr<BlockOPoints> block = blocks[Q];
         int npoints = block->npoints();
         double* x = block->x();
@@ -655,30 +713,26 @@ SharedMatrix RV::compute_gradient()
         const std::vector<int>& function_map = block->functions_local_to_global();
         int nlocal = function_map.size();
 
-        timer_on("Properties");
-        properties_->compute_points(block);
-        timer_off("Properties");
-        timer_on("Functional");
-        std::map<std::string, SharedVector>& vals = functional_->compute_functional(properties_->point_values(), npoints); 
-        timer_off("Functional");
-
-        double** phi = properties_->basis_value("PHI")->pointer();
-        double** phi_x = properties_->basis_value("PHI_X")->pointer();
-        double** phi_y = properties_->basis_value("PHI_Y")->pointer();
-        double** phi_z = properties_->basis_value("PHI_Z")->pointer();
-        double* rho_a = properties_->point_value("RHO_A")->pointer();
-        double* zk = vals["V"]->pointer(); 
-        double* v_rho_a = vals["V_RHO_A"]->pointer();
+        properties->compute_points(block);
+        double* const* vals = functional->compute_functional(properties->point_pointers(), npoints); 
+
+        double** phi = properties->basis_value(BASIS_PHI)->pointer();
+        double** phi_x = properties->basis_value(BASIS_PHI_X)->pointer();
+        double** phi_y = properties->basis_value(BASIS_PHI_Y)->pointer();
+        double** phi_z = properties->basis_value(BASIS_PHI_Z)->pointer();
+        double* rho_a = properties->point_pointers()[XC_RHO_A];
+        double* zk = vals[XC_V]; 
+        double* v_rho_a = vals[XC_V_RHO_A];
 
         // => Quadrature values <= //
-        functionalq += C_DDOT(npoints,w,1,zk,1);
+        functionalq[thread] += C_DDOT(npoints,w,1,zk,1);
         for (int P = 0; P < npoints; P++) {
             QTp[P] = w[P] * rho_a[P];
         }
-        rhoaq       += C_DDOT(npoints,w,1,rho_a,1);
-        rhoaxq      += C_DDOT(npoints,QTp,1,x,1);
-        rhoayq      += C_DDOT(npoints,QTp,1,y,1);
-        rhoazq      += C_DDOT(npoints,QTp,1,z,1);
+        rhoaq[thread]       += C_DDOT(npoints,w,1,rho_a,1);
+        rhoaxq[thread]      += C_DDOT(npoints,QTp,1,x,1);
+        rhoayq[thread]      += C_DDOT(npoints,QTp,1,y,1);
+        rhoazq[thread]      += C_DDOT(npoints,QTp,1,z,1);
 
         // => LSDA Contribution <= //
         for (int P = 0; P < npoints; P++) {
@@ -688,11 +742,11 @@ SharedMatrix RV::compute_gradient()
     
         // => GGA Contribution (Term 1) <= //
         if (functional_->is_gga()) {
-            double* rho_ax = properties_->point_value("RHO_AX")->pointer();
-            double* rho_ay = properties_->point_value("RHO_AY")->pointer();
-            double* rho_az = properties_->point_value("RHO_AZ")->pointer();
-            double* v_gamma_aa = vals["V_GAMMA_AA"]->pointer();
-            double* v_gamma_ab = vals["V_GAMMA_AB"]->pointer();
+            double* rho_ax = properties->point_pointers()[XC_RHO_AX];
+            double* rho_ay = properties->point_pointers()[XC_RHO_AY];
+            double* rho_az = properties->point_pointers()[XC_RHO_AZ];
+            double* v_gamma_aa = vals[XC_V_GAMMA_AA];
+            double* v_gamma_ab = vals[XC_V_GAMMA_AB];
 
             for (int P = 0; P < npoints; P++) {
                 C_DAXPY(nlocal, -2.0 * w[P] * (2.0 * v_gamma_aa[P] * rho_ax[P] + v_gamma_ab[P] * rho_ax[P]), phi_x[P], 1, Tp[P], 1);
@@ -714,19 +768,19 @@ SharedMatrix RV::compute_gradient()
         
         // => GGA Contribution (Term 2) <= //
         if (functional_->is_gga()) {
-            double** phi_xx = properties_->basis_value("PHI_XX")->pointer();
-            double** phi_xy = properties_->basis_value("PHI_XY")->pointer();
-            double** phi_xz = properties_->basis_value("PHI_XZ")->pointer();
-            double** phi_yy = properties_->basis_value("PHI_YY")->pointer();
-            double** phi_yz = properties_->basis_value("PHI_YZ")->pointer();
-            double** phi_zz = properties_->basis_value("PHI_ZZ")->pointer();
-            double* rho_ax = properties_->point_value("RHO_AX")->pointer();
-            double* rho_ay = properties_->point_value("RHO_AY")->pointer();
-            double* rho_az = properties_->point_value("RHO_AZ")->pointer();
-            double* v_gamma_aa = vals["V_GAMMA_AA"]->pointer();
-            double* v_gamma_ab = vals["V_GAMMA_AB"]->pointer();
-
-            C_DGEMM('N','N',npoints,nlocal,nlocal,1.0,phi[0],max_functions,Dp[0],max_functions,0.0,Up[0],max_functions);
+            double** phi_xx = properties->basis_value(BASIS_PHI_XX)->pointer();
+            double** phi_xy = properties->basis_value(BASIS_PHI_XY)->pointer();
+            double** phi_xz = properties->basis_value(BASIS_PHI_XZ)->pointer();
+            double** phi_yy = properties->basis_value(BASIS_PHI_YY)->pointer();
+            double** phi_yz = properties->basis_value(BASIS_PHI_YZ)->pointer();
+            double** phi_zz = properties->basis_value(BASIS_PHI_ZZ)->pointer();
+            double* rho_ax = properties->point_pointers()[XC_RHO_AX];
+            double* rho_ay = properties->point_pointers()[XC_RHO_AY];
+            double* rho_az = properties->point_pointers()[XC_RHO_AZ];
+            double* v_gamma_aa = vals[XC_V_GAMMA_AA];
+            double* v_gamma_ab = vals[XC_V_GAMMA_AB];
+
+            properties->contract_density(phi,Dp,Up,npoints);
             
             // x
             for (int P = 0; P < npoints; P++) {
@@ -768,13 +822,13 @@ SharedMatrix RV::compute_gradient()
         
         // => Meta Contribution <= //
         if (functional_->is_meta()) {
-            double** phi_xx = properties_->basis_value("PHI_XX")->pointer();
-            double** phi_xy = properties_->basis_value("PHI_XY")->pointer();
-            double** phi_xz = properties_->basis_value("PHI_XZ")->pointer();
-            double** phi_yy = properties_->basis_value("PHI_YY")->pointer();
-            double** phi_yz = properties_->basis_value("PHI_YZ")->pointer();
-            double** phi_zz = properties_->basis_value("PHI_ZZ")->pointer();
-            double* v_tau_a = vals["V_TAU_A"]->pointer();
+            double** phi_xx = properties->basis_value(BASIS_PHI_XX)->pointer();
+            double** phi_xy = properties->basis_value(BASIS_PHI_XY)->pointer();
+            double** phi_xz = properties->basis_value(BASIS_PHI_XZ)->pointer();
+            double** phi_yy = properties->basis_value(BASIS_PHI_YY)->pointer();
+            double** phi_yz = properties->basis_value(BASIS_PHI_YZ)->pointer();
+            double** phi_zz = properties->basis_value(BASIS_PHI_ZZ)->pointer();
+            double* v_tau_a = vals[XC_V_TAU_A];
 
             double** phi_i[3];
             phi_i[0] = phi_x;
@@ -794,7 +848,7 @@ SharedMatrix RV::compute_gradient()
 
             for (int i = 0; i < 3; i++) {
                 double*** phi_j = phi_ij[i];
-                C_DGEMM('N','N',npoints,nlocal,nlocal,1.0,phi_i[i][0],max_functions,Dp[0],max_functions,0.0,Up[0],max_functions);
+                properties->contract_density(phi_i[i],Dp,Up,npoints);
                 for (int P = 0; P < npoints; P++) {
                     ::memset((void*) Tp[P], '\0', sizeof(double) * nlocal);
                     C_DAXPY(nlocal, -2.0 * w[P] * (v_tau_a[P]), Up[P], 1, Tp[P], 1);
@@ -809,15 +863,25 @@ SharedMatrix RV::compute_gradient()
         }
     } 
    
-    quad_values_["FUNCTIONAL"] = functionalq;
-    quad_values_["RHO_A"]      = rhoaq; 
-    quad_values_["RHO_AX"]     = rhoaxq; 
-    quad_values_["RHO_AY"]     = rhoayq; 
-    quad_values_["RHO_AZ"]     = rhoazq; 
-    quad_values_["RHO_B"]      = rhoaq; 
-    quad_values_["RHO_BX"]     = rhoaxq; 
-    quad_values_["RHO_BY"]     = rhoayq; 
-    quad_values_["RHO_BZ"]     = rhoazq; 
+    // Reduce over threads in thread order (see RV::compute_V)
+    for (int thread = 1; thread < nthread; thread++) {
+        G->add(G_thread[thread]);
+        functionalq[0] += functionalq[thread];
+        rhoaq[0]       += rhoaq[thread];
+        rhoaxq[0]      += rhoaxq[thread];
+        rhoayq[0]      += rhoayq[thread];
+        rhoazq[0]      += rhoazq[thread];
+    }
+
+    quad_values_["FUNCTIONAL"] = functionalq[0];
+    quad_values_["RHO_A"]      = rhoaq[0]; 
+    quad_values_["RHO_AX"]     = rhoaxq[0]; 
+    quad_values_["RHO_AY"]     = rhoayq[0]; 
+    quad_values_["RHO_AZ"]     = rhoazq[0]; 
+    quad_values_["RHO_B"]      = rhoaq[0]; 
+    quad_values_["RHO_BX"]     = rhoaxq[0]; 
+    quad_values_["RHO_BY"]     = rhoayq[0]; 
+    quad_values_["RHO_BZ"]     = rhoazq[0]; 
  
     if (debug_) {
         outfile->Printf( "   => XC Gradient: Numerical Integrals <=\n\n");
@@ -828,7 +892,9 @@ SharedMatrix RV::compute_gradient()
         outfile->Printf( "    <\\vec r\\rho_b>  : <%24.16E,%24.16E,%24.16E>\n\n",quad_values_["RHO_BX"],quad_values_["RHO_BY"],quad_values_["RHO_BZ"]);
     }
 
-    properties_->set_deriv(old_deriv);
+    for (int thread = 0; thread < nthread; thread++) {
+        point_workers_[thread]->set_deriv(old_deriv);
+    }
 
     // RKS
     G->scale(2.0);
@@ -849,8 +915,15 @@ void UV::initialize()
     VBase::initialize();
     int max_points = grid_->max_points();
     int max_functions = grid_->max_functions(); 
-    properties_ = boost::shared_ptr<PointFunctions>(new UKSFunctions(primary_,max_points,max_functions));
-    properties_->set_ansatz(functional_->ansatz());
+    point_workers_.clear();
+    for (int thread = 0; thread < num_threads_; thread++) {
+        boost::shared_ptr<PointFunctions> point_tmp(new UKSFunctions(primary_,max_points,max_functions));
+        point_tmp->set_ansatz(functional_->ansatz());
+        point_tmp->set_pair_cutoff(options_.get_double("DFT_SHELL_PAIR_TOLERANCE"));
+        point_workers_.push_back(point_tmp);
+    }
+    properties_ = point_workers_[0];
+    build_functional_workers();
 }
 void UV::finalize()
 {
@@ -871,7 +944,9 @@ void UV::compute_V()
     SharedMatrix Va_AO = V_AO_[0];
     SharedMatrix Db_AO = D_AO_[1];
     SharedMatrix Vb_AO = V_AO_[1];
-    properties_->set_pointers(Da_AO,Db_AO);
+    for (int thread = 0; thread < num_threads_; thread++) {
+        point_workers_[thread]->set_pointers(Da_AO,Db_AO);
+    }
 
     // What local XC ansatz are we in?
     int ansatz = functional_->ansatz();
@@ -880,38 +955,60 @@ void UV::compute_V()
     int max_functions = grid_->max_functions();
     int max_points = grid_->max_points();
 
-    // Local/global V matrices
-    SharedMatrix Va_local(new Matrix("Va Temp", max_functions, max_functions));
-    double** Va2p = Va_local->pointer();
-    double** Vap = Va_AO->pointer();
-    SharedMatrix Vb_local(new Matrix("Vb Temp", max_functions, max_functions));
-    double** Vb2p = Vb_local->pointer();
-    double** Vbp = Vb_AO->pointer();
-
-    // Scratch
-    std::vector<SharedMatrix> scratch = properties_->scratch();
-    SharedMatrix Ta_local = scratch[0];
-    SharedMatrix Tb_local = scratch[1]; 
-    double** Tap = Ta_local->pointer();
-    double** Tbp = Tb_local->pointer();
+    // Local/global V matrices, one per thread (the first thread accumulates into Va/Vb_AO)
+    int nthread = num_threads_;
+    std::vector<SharedMatrix> Va_local;
+    std::vector<SharedMatrix> Vb_local;
+    std::vector<SharedMatrix> Va_thread;
+    std::vector<SharedMatrix> Vb_thread;
+    std::vector<SharedVector> QTa;
+    std::vector<SharedVector> QTb;
+    for (int thread = 0; thread < nthread; thread++) {
+        Va_local.push_back(SharedMatrix(new Matrix("Va Temp", max_functions, max_functions)));
+        Vb_local.push_back(SharedMatrix(new Matrix("Vb Temp", max_functions, max_functions)));
+        Va_thread.push_back(thread == 0 ? Va_AO : SharedMatrix(Va_AO->clone()));
+        Vb_thread.push_back(thread == 0 ? Vb_AO : SharedMatrix(Vb_AO->clone()));
+        if (thread) {
+            Va_thread[thread]->zero();
+            Vb_thread[thread]->zero();
+        }
+        QTa.push_back(SharedVector(new Vector("Quadrature Temp", max_points)));
+        QTb.push_back(SharedVector(new Vector("Quadrature Temp", max_points)));
+    }
 
     // Traverse the blocks of points
-    double functionalq = 0.0;
-    double rhoaq       = 0.0;
-    double rhoaxq      = 0.0;
-    double rhoayq      = 0.0;
-    double rhoazq      = 0.0;
-    double rhobq       = 0.0;
-    double rhobxq      = 0.0;
-    double rhobyq      = 0.0;
-    double rhobzq      = 0.0;
-    boost::shared_ptr<Vector> QTa(new Vector("Quadrature Temp", max_points));
-    double* QTap = QTa->pointer();
-    boost::shared_ptr<Vector> QTb(new Vector("Quadrature Temp", max_points));
-    double* QTbp = QTb->pointer();
+    std::vector<double> functionalq(nthread, 0.0);
+    std::vector<double> rhoaq(nthread, 0.0);
+    std::vector<double> rhoaxq(nthread, 0.0);
+    std::vector<double> rhoayq(nthread, 0.0);
+    std::vector<double> rhoazq(nthread, 0.0);
+    std::vector<double> rhobq(nthread, 0.0);
+    std::vector<double> rhobxq(nthread, 0.0);
+    std::vector<double> rhobyq(nthread, 0.0);
+    std::vector<double> rhobzq(nthread, 0.0);
     const std::vector<boost::shared_ptr<BlockOPoints> >& blocks = grid_->blocks();
+
+    // Same static schedule as RV::compute_V, for a reproducible reduction
+    #pragma omp parallel for schedule(static, 1) num_threads(nthread)
     for (size_t Q = 0; Q < blocks.size(); Q++) {
 
+        int thread = 0;
+        #ifdef _OPENMP
+            thread = omp_get_thread_num();
+        #endif
+
+        boost::shared_ptr<PointFunctions> properties = point_workers_[thread];
+        boost::shared_ptr<SuperFunctional> functional = functional_workers_[thread];
+        double** Va2p = Va_local[thread]->pointer();
+        double** Vb2p = Vb_local[thread]->pointer();
+        double** Vap = Va_thread[thread]->pointer();
+        double** Vbp = Vb_thread[thread]->pointer();
+        std::vector<SharedMatrix> scratch = properties->scratch();
+        double** Tap = scratch[0]->pointer();
+        double** Tbp = scratch[1]->pointer();
+        double* QTap = QTa[thread]->pointer();
+        double* QTbp = QTb[thread]->pointer();
+
         boost::shared_ptr<BlockOPoints> block = blocks[Q];
         int npoints = block->npoints();
         double* x = block->x();
@@ -921,66 +1018,60 @@ void UV::compute_V()
         const std::vector<int>& function_map = block->functions_local_to_global();
         int nlocal = function_map.size();
 
-        timer_on("Properties");
-        properties_->compute_points(block);
-        timer_off("Properties");
-        timer_on("Functional");
-        std::map<std::string, SharedVector>& vals = functional_->compute_functional(properties_->point_values(), npoints); 
-        timer_off("Functional");
+        properties->compute_points(block);
+        double* const* vals = functional->compute_functional(properties->point_pointers(), npoints); 
 
         if (debug_ > 3) {
-            block->print("outfile", debug_);
-            properties_->print("outfile", debug_);
+            #pragma omp critical
+            {
+                block->print("outfile", debug_);
+                properties->print("outfile", debug_);
+            }
         }
-
-        timer_on("V_XC");
-        double** phi = properties_->basis_value("PHI")->pointer();
-        double *restrict rho_a = properties_->point_value("RHO_A")->pointer();
-        double *restrict rho_b = properties_->point_value("RHO_B")->pointer();
-        double *restrict zk = vals["V"]->pointer(); 
-        double *restrict v_rho_a = vals["V_RHO_A"]->pointer(); 
-        double *restrict v_rho_b = vals["V_RHO_B"]->pointer(); 
+        double** phi = properties->basis_value(BASIS_PHI)->pointer();
+        double *restrict rho_a = properties->point_pointers()[XC_RHO_A];
+        double *restrict rho_b = properties->point_pointers()[XC_RHO_B];
+        double *restrict zk = vals[XC_V]; 
+        double *restrict v_rho_a = vals[XC_V_RHO_A]; 
+        double *restrict v_rho_b = vals[XC_V_RHO_B]; 
 
         // => Quadrature values <= //
-        functionalq += C_DDOT(npoints,w,1,zk,1);
+        functionalq[thread] += C_DDOT(npoints,w,1,zk,1);
         for (int P = 0; P < npoints; P++) {
             QTap[P] = w[P] * rho_a[P];
             QTbp[P] = w[P] * rho_b[P];
         }
-        rhoaq       += C_DDOT(npoints,w,1,rho_a,1);
-        rhoaxq      += C_DDOT(npoints,QTap,1,x,1);
-        rhoayq      += C_DDOT(npoints,QTap,1,y,1);
-        rhoazq      += C_DDOT(npoints,QTap,1,z,1);
-        rhobq       += C_DDOT(npoints,w,1,rho_b,1);
-        rhobxq      += C_DDOT(npoints,QTbp,1,x,1);
-        rhobyq      += C_DDOT(npoints,QTbp,1,y,1);
-        rhobzq      += C_DDOT(npoints,QTbp,1,z,1);
+        rhoaq[thread]       += C_DDOT(npoints,w,1,rho_a,1);
+        rhoaxq[thread]      += C_DDOT(npoints,QTap,1,x,1);
+        rhoayq[thread]      += C_DDOT(npoints,QTap,1,y,1);
+        rhoazq[thread]      += C_DDOT(npoints,QTap,1,z,1);
+        rhobq[thread]       += C_DDOT(npoints,w,1,rho_b,1);
+        rhobxq[thread]      += C_DDOT(npoints,QTbp,1,x,1);
+        rhobyq[thread]      += C_DDOT(npoints,QTbp,1,y,1);
+        rhobzq[thread]      += C_DDOT(npoints,QTbp,1,z,1);
 
         // => LSDA contribution (symmetrized) <= //
-        timer_on("LSDA");
         for (int P = 0; P < npoints; P++) {
             ::memset(static_cast<void*>(Tap[P]),'\0',nlocal*sizeof(double));
             ::memset(static_cast<void*>(Tbp[P]),'\0',nlocal*sizeof(double));
             C_DAXPY(nlocal,0.5 * v_rho_a[P] * w[P], phi[P], 1, Tap[P], 1); 
             C_DAXPY(nlocal,0.5 * v_rho_b[P] * w[P], phi[P], 1, Tbp[P], 1); 
         }
-        timer_off("LSDA");
         
         // => GGA contribution (symmetrized) <= // 
         if (ansatz >= 1) {
-            timer_on("GGA");
-            double** phix = properties_->basis_value("PHI_X")->pointer();
-            double** phiy = properties_->basis_value("PHI_Y")->pointer();
-            double** phiz = properties_->basis_value("PHI_Z")->pointer();
-            double *restrict rho_ax = properties_->point_value("RHO_AX")->pointer();
-            double *restrict rho_ay = properties_->point_value("RHO_AY")->pointer();
-            double *restrict rho_az = properties_->point_value("RHO_AZ")->pointer();
-            double *restrict rho_bx = properties_->point_value("RHO_BX")->pointer();
-            double *restrict rho_by = properties_->point_value("RHO_BY")->pointer();
-            double *restrict rho_bz = properties_->point_value("RHO_BZ")->pointer();
-            double *restrict v_sigma_aa = vals["V_GAMMA_AA"]->pointer(); 
-            double *restrict v_sigma_ab = vals["V_GAMMA_AB"]->pointer(); 
-            double *restrict v_sigma_bb = vals["V_GAMMA_BB"]->pointer(); 
+            double** phix = properties->basis_value(BASIS_PHI_X)->pointer();
+            double** phiy = properties->basis_value(BASIS_PHI_Y)->pointer();
+            double** phiz = properties->basis_value(BASIS_PHI_Z)->pointer();
+            double *restrict rho_ax = properties->point_pointers()[XC_RHO_AX];
+            double *restrict rho_ay = properties->point_pointers()[XC_RHO_AY];
+            double *restrict rho_az = properties->point_pointers()[XC_RHO_AZ];
+            double *restrict rho_bx = properties->point_pointers()[XC_RHO_BX];
+            double *restrict rho_by = properties->point_pointers()[XC_RHO_BY];
+            double *restrict rho_bz = properties->point_pointers()[XC_RHO_BZ];
+            double *restrict v_sigma_aa = vals[XC_V_GAMMA_AA]; 
+            double *restrict v_sigma_ab = vals[XC_V_GAMMA_AB]; 
+            double *restrict v_sigma_bb = vals[XC_V_GAMMA_BB]; 
 
             for (int P = 0; P < npoints; P++) {
                 C_DAXPY(nlocal,w[P] * (2.0 * v_sigma_aa[P] * rho_ax[P] + v_sigma_ab[P] * rho_bx[P]), phix[P], 1, Tap[P], 1); 
@@ -990,13 +1081,10 @@ void UV::compute_V()
                 C_DAXPY(nlocal,w[P] * (2.0 * v_sigma_bb[P] * rho_by[P] + v_sigma_ab[P] * rho_ay[P]), phiy[P], 1, Tbp[P], 1); 
                 C_DAXPY(nlocal,w[P] * (2.0 * v_sigma_bb[P] * rho_bz[P] + v_sigma_ab[P] * rho_az[P]), phiz[P], 1, Tbp[P], 1); 
             }        
-            timer_off("GGA");
         }
-
-        timer_on("LSDA");
-        // Single GEMM slams GGA+LSDA together (man but GEM's hot!)
-        C_DGEMM('T','N',nlocal,nlocal,npoints,1.0,phi[0],max_functions,Tap[0],max_functions,0.0,Va2p[0],max_functions);
-        C_DGEMM('T','N',nlocal,nlocal,npoints,1.0,phi[0],max_functions,Tbp[0],max_functions,0.0,Vb2p[0],max_functions);
+        // Single (shell-pair screened) GEMM slams GGA+LSDA together (man but GEM's hot!)
+        properties->contract_potential(phi,Tap,Va2p,npoints);
+        properties->contract_potential(phi,Tbp,Vb2p,npoints);
 
         // Symmetrization (V is Hermitian) 
         for (int m = 0; m < nlocal; m++) {
@@ -1005,16 +1093,14 @@ void UV::compute_V()
                 Vb2p[m][n] = Vb2p[n][m] = Vb2p[m][n] + Vb2p[n][m]; 
             }
         }
-        timer_off("LSDA");
         
         // => Meta contribution <= //
         if (ansatz >= 2) {
-            timer_on("Meta");
-            double** phix = properties_->basis_value("PHI_X")->pointer();
-            double** phiy = properties_->basis_value("PHI_Y")->pointer();
-            double** phiz = properties_->basis_value("PHI_Z")->pointer();
-            double *restrict v_tau_a = vals["V_TAU_A"]->pointer(); 
-            double *restrict v_tau_b = vals["V_TAU_B"]->pointer(); 
+            double** phix = properties->basis_value(BASIS_PHI_X)->pointer();
+            double** phiy = properties->basis_value(BASIS_PHI_Y)->pointer();
+            double** phiz = properties->basis_value(BASIS_PHI_Z)->pointer();
+            double *restrict v_tau_a = vals[XC_V_TAU_A]; 
+            double *restrict v_tau_b = vals[XC_V_TAU_B]; 
 
             double** phi[3];
             phi[0] = phix;
@@ -1038,11 +1124,9 @@ void UV::compute_V()
                         ::memset(static_cast<void*>(Tap[P]),'\0',nlocal*sizeof(double));
                         C_DAXPY(nlocal,v_taup[P] * w[P], phiw[P], 1, Tap[P], 1); 
                     }        
-                    C_DGEMM('T','N',nlocal,nlocal,npoints,1.0,phiw[0],max_functions,Tap[0],max_functions,1.0,V2p[0],max_functions);
+                    properties->contract_potential(phiw,Tap,V2p,npoints,1.0);
                 }            
             }
-
-            timer_off("Meta");
         }       
  
         // => Unpacking <= //
@@ -1058,18 +1142,32 @@ void UV::compute_V()
             Vap[mg][mg] += Va2p[ml][ml];
             Vbp[mg][mg] += Vb2p[ml][ml];
         }
-        timer_off("V_XC");
     } 
    
-    quad_values_["FUNCTIONAL"] = functionalq;
-    quad_values_["RHO_A"]      = rhoaq; 
-    quad_values_["RHO_AX"]     = rhoaxq; 
-    quad_values_["RHO_AY"]     = rhoayq; 
-    quad_values_["RHO_AZ"]     = rhoazq; 
-    quad_values_["RHO_B"]      = rhobq; 
-    quad_values_["RHO_BX"]     = rhobxq; 
-    quad_values_["RHO_BY"]     = rhobyq; 
-    quad_values_["RHO_BZ"]     = rhobzq; 
+    // Reduce over threads in thread order (see RV::compute_V)
+    for (int thread = 1; thread < nthread; thread++) {
+        Va_AO->add(Va_thread[thread]);
+        Vb_AO->add(Vb_thread[thread]);
+        functionalq[0] += functionalq[thread];
+        rhoaq[0]       += rhoaq[thread];
+        rhoaxq[0]      += rhoaxq[thread];
+        rhoayq[0]      += rhoayq[thread];
+        rhoazq[0]      += rhoazq[thread];
+        rhobq[0]       += rhobq[thread];
+        rhobxq[0]      += rhobxq[thread];
+        rhobyq[0]      += rhobyq[thread];
+        rhobzq[0]      += rhobzq[thread];
+    }
+
+    quad_values_["FUNCTIONAL"] = functionalq[0];
+    quad_values_["RHO_A"]      = rhoaq[0]; 
+    quad_values_["RHO_AX"]     = rhoaxq[0]; 
+    quad_values_["RHO_AY"]     = rhoayq[0]; 
+    quad_values_["RHO_AZ"]     = rhoazq[0]; 
+    quad_values_["RHO_B"]      = rhobq[0]; 
+    quad_values_["RHO_BX"]     = rhobxq[0]; 
+    quad_values_["RHO_BY"]     = rhobyq[0]; 
+    quad_values_["RHO_BZ"]     = rhobzq[0]; 
  
     if (debug_) {
         outfile->Printf( "   => Numerical Integrals <=\n\n");
@@ -1091,16 +1189,20 @@ SharedMatrix UV::compute_gradient()
     // Build the target gradient Matrix
     int natom = primary_->molecule()->natom();
     SharedMatrix G(new Matrix("XC Gradient", natom,3));
-    double** Gp = G->pointer();
 
     // Set Hessian derivative level in properties
     int old_deriv = properties_->deriv(); 
-    properties_->set_deriv((functional_->is_gga() || functional_->is_meta() ? 2 : 1));
+    int nthread = num_threads_;
+    for (int thread = 0; thread < nthread; thread++) {
+        point_workers_[thread]->set_deriv((functional_->is_gga() || functional_->is_meta() ? 2 : 1));
+    }
 
     // Setup the pointers
     SharedMatrix Da_AO = D_AO_[0];
     SharedMatrix Db_AO = D_AO_[1];
-    properties_->set_pointers(Da_AO, Db_AO);
+    for (int thread = 0; thread < nthread; thread++) {
+        point_workers_[thread]->set_pointers(Da_AO, Db_AO);
+    }
 
     // What local XC ansatz are we in?
 //    int ansatz = functional_->ansatz();
@@ -1109,33 +1211,50 @@ SharedMatrix UV::compute_gradient()
     int max_functions = grid_->max_functions(); 
     int max_points = grid_->max_points();
 
-    // Scratch
-    std::vector<SharedMatrix> scratch = properties_->scratch();
-    SharedMatrix Ta_local = scratch[0];
-    SharedMatrix Ua_local(Ta_local->clone());
-    SharedMatrix Tb_local = scratch[1];
-    SharedMatrix Ub_local(Tb_local->clone());
-    double** Tap = Ta_local->pointer();
-    double** Uap = Ua_local->pointer();
-    double** Tbp = Tb_local->pointer();
-    double** Ubp = Ub_local->pointer();
-    std::vector<SharedMatrix> Dscratch = properties_->D_scratch();
-    SharedMatrix Da_local = Dscratch[0];
-    SharedMatrix Db_local = Dscratch[1];
-    double** Dap = Da_local->pointer();
-    double** Dbp = Db_local->pointer();
+    // Scratch and gradient contributions, one per thread
+    std::vector<SharedMatrix> Ua_local;
+    std::vector<SharedMatrix> Ub_local;
+    std::vector<SharedMatrix> G_thread;
+    std::vector<SharedVector> QT;
+    for (int thread = 0; thread < nthread; thread++) {
+        std::vector<SharedMatrix> scratch = point_workers_[thread]->scratch();
+        Ua_local.push_back(SharedMatrix(scratch[0]->clone()));
+        Ub_local.push_back(SharedMatrix(scratch[1]->clone()));
+        G_thread.push_back(thread == 0 ? G : SharedMatrix(G->clone()));
+        QT.push_back(SharedVector(new Vector("Quadrature Temp", max_points)));
+    }
 
     // Traverse the blocks of points
-    boost::shared_ptr<Vector> QT(new Vector("Quadrature Temp", max_points));
-    double* QTp = QT->pointer();
     const std::vector<boost::shared_ptr<BlockOPoints> >& blocks = grid_->blocks();
 
     for (std::map<std::string, double>::const_iterator it = quad_values_.begin(); it != quad_values_.end(); ++it) {
         quad_values_[(*it).first] = 0.0;
     }
+    std::vector<std::map<std::string, double> > quad_thread(nthread, quad_values_);
 
+    // Same static schedule as RV::compute_V, for a reproducible reduction
+    #pragma omp parallel for schedule(static, 1) num_threads(nthread)
     for (size_t Q = 0; Q < blocks.size(); Q++) {
 
+        int thread = 0;
+        #ifdef _OPENMP
+            thread = omp_get_thread_num();
+        #endif
+
+        boost::shared_ptr<PointFunctions> properties = point_workers_[thread];
+        boost::shared_ptr<SuperFunctional> functional = functional_workers_[thread];
+        std::vector<SharedMatrix> scratch = properties->scratch();
+        std::vector<SharedMatrix> Dscratch = properties->D_scratch();
+        double** Tap = scratch[0]->pointer();
+        double** Tbp = scratch[1]->pointer();
+        double** Uap = Ua_local[thread]->pointer();
+        double** Ubp = Ub_local[thread]->pointer();
+        double** Dap = Dscratch[0]->pointer();
+        double** Dbp = Dscratch[1]->pointer();
+        double** Gp = G_thread[thread]->pointer();
+        double* QTp = QT[thread]->pointer();
+        std::map<std::string, double>& quad = quad_thread[thread];
+
         boost::shared_ptr<BlockOPoints> block = blocks[Q];
         int npoints = block->npoints();
         double* x = block->x();
@@ -1145,39 +1264,35 @@ SharedMatrix UV::compute_gradient()
         const std::vector<int>& function_map = block->functions_local_to_global();
         int nlocal = function_map.size();
 
-        timer_on("Properties");
-        properties_->compute_points(block);
-        timer_off("Properties");
-        timer_on("Functional");
-        std::map<std::string, SharedVector>& vals = functional_->compute_functional(properties_->point_values(), npoints); 
-        timer_off("Functional");
-
-        double** phi = properties_->basis_value("PHI")->pointer();
-        double** phi_x = properties_->basis_value("PHI_X")->pointer();
-        double** phi_y = properties_->basis_value("PHI_Y")->pointer();
-        double** phi_z = properties_->basis_value("PHI_Z")->pointer();
-        double* rho_a = properties_->point_value("RHO_A")->pointer();
-        double* rho_b = properties_->point_value("RHO_B")->pointer();
-        double* zk = vals["V"]->pointer(); 
-        double* v_rho_a = vals["V_RHO_A"]->pointer();
-        double* v_rho_b = vals["V_RHO_B"]->pointer();
+        properties->compute_points(block);
+        double* const* vals = functional->compute_functional(properties->point_pointers(), npoints); 
+
+        double** phi = properties->basis_value(BASIS_PHI)->pointer();
+        double** phi_x = properties->basis_value(BASIS_PHI_X)->pointer();
+        double** phi_y = properties->basis_value(BASIS_PHI_Y)->pointer();
+        double** phi_z = properties->basis_value(BASIS_PHI_Z)->pointer();
+        double* rho_a = properties->point_pointers()[XC_RHO_A];
+        double* rho_b = properties->point_pointers()[XC_RHO_B];
+        double* zk = vals[XC_V]; 
+        double* v_rho_a = vals[XC_V_RHO_A];
+        double* v_rho_b = vals[XC_V_RHO_B];
 
         // => Quadrature values <= //
-        quad_values_["FUNCTIONAL"] += C_DDOT(npoints,w,1,zk,1); 
+        quad["FUNCTIONAL"] += C_DDOT(npoints,w,1,zk,1); 
         for (int P = 0; P < npoints; P++) {
             QTp[P] = w[P] * rho_a[P];
         }
-        quad_values_["RHO_A"] += C_DDOT(npoints,w,1,rho_a,1);
-        quad_values_["RHO_AX"] += C_DDOT(npoints,QTp,1,x,1);
-        quad_values_["RHO_AY"] += C_DDOT(npoints,QTp,1,y,1);
-        quad_values_["RHO_AZ"] += C_DDOT(npoints,QTp,1,z,1);
+        quad["RHO_A"] += C_DDOT(npoints,w,1,rho_a,1);
+        quad["RHO_AX"] += C_DDOT(npoints,QTp,1,x,1);
+        quad["RHO_AY"] += C_DDOT(npoints,QTp,1,y,1);
+        quad["RHO_AZ"] += C_DDOT(npoints,QTp,1,z,1);
         for (int P = 0; P < npoints; P++) {
             QTp[P] = w[P] * rho_b[P];
         }
-        quad_values_["RHO_B"] += C_DDOT(npoints,w,1,rho_b,1);
-        quad_values_["RHO_BX"] += C_DDOT(npoints,QTp,1,x,1);
-        quad_values_["RHO_BY"] += C_DDOT(npoints,QTp,1,y,1);
-        quad_values_["RHO_BZ"] += C_DDOT(npoints,QTp,1,z,1);
+        quad["RHO_B"] += C_DDOT(npoints,w,1,rho_b,1);
+        quad["RHO_BX"] += C_DDOT(npoints,QTp,1,x,1);
+        quad["RHO_BY"] += C_DDOT(npoints,QTp,1,y,1);
+        quad["RHO_BZ"] += C_DDOT(npoints,QTp,1,z,1);
     
         // => LSDA Contribution <= //
         for (int P = 0; P < npoints; P++) {
@@ -1189,15 +1304,15 @@ SharedMatrix UV::compute_gradient()
     
         // => GGA Contribution (Term 1) <= //
         if (functional_->is_gga()) {
-            double* rho_ax = properties_->point_value("RHO_AX")->pointer();
-            double* rho_ay = properties_->point_value("RHO_AY")->pointer();
-            double* rho_az = properties_->point_value("RHO_AZ")->pointer();
-            double* rho_bx = properties_->point_value("RHO_BX")->pointer();
-            double* rho_by = properties_->point_value("RHO_BY")->pointer();
-            double* rho_bz = properties_->point_value("RHO_BZ")->pointer();
-            double* v_gamma_aa = vals["V_GAMMA_AA"]->pointer();
-            double* v_gamma_ab = vals["V_GAMMA_AB"]->pointer();
-            double* v_gamma_bb = vals["V_GAMMA_BB"]->pointer();
+            double* rho_ax = properties->point_pointers()[XC_RHO_AX];
+            double* rho_ay = properties->point_pointers()[XC_RHO_AY];
+            double* rho_az = properties->point_pointers()[XC_RHO_AZ];
+            double* rho_bx = properties->point_pointers()[XC_RHO_BX];
+            double* rho_by = properties->point_pointers()[XC_RHO_BY];
+            double* rho_bz = properties->point_pointers()[XC_RHO_BZ];
+            double* v_gamma_aa = vals[XC_V_GAMMA_AA];
+            double* v_gamma_ab = vals[XC_V_GAMMA_AB];
+            double* v_gamma_bb = vals[XC_V_GAMMA_BB];
 
             for (int P = 0; P < npoints; P++) {
                 C_DAXPY(nlocal, -2.0 * w[P] * (2.0 * v_gamma_aa[P] * rho_ax[P] + v_gamma_ab[P] * rho_bx[P]), phi_x[P], 1, Tap[P], 1);
@@ -1226,21 +1341,21 @@ SharedMatrix UV::compute_gradient()
         
         // => GGA Contribution (Term 2) <= //
         if (functional_->is_gga()) {
-            double** phi_xx = properties_->basis_value("PHI_XX")->pointer();
-            double** phi_xy = properties_->basis_value("PHI_XY")->pointer();
-            double** phi_xz = properties_->basis_value("PHI_XZ")->pointer();
-            double** phi_yy = properties_->basis_value("PHI_YY")->pointer();
-            double** phi_yz = properties_->basis_value("PHI_YZ")->pointer();
-            double** phi_zz = properties_->basis_value("PHI_ZZ")->pointer();
-            double* rho_ax = properties_->point_value("RHO_AX")->pointer();
-            double* rho_ay = properties_->point_value("RHO_AY")->pointer();
-            double* rho_az = properties_->point_value("RHO_AZ")->pointer();
-            double* rho_bx = properties_->point_value("RHO_BX")->pointer();
-            double* rho_by = properties_->point_value("RHO_BY")->pointer();
-            double* rho_bz = properties_->point_value("RHO_BZ")->pointer();
-            double* v_gamma_aa = vals["V_GAMMA_AA"]->pointer();
-            double* v_gamma_ab = vals["V_GAMMA_AB"]->pointer();
-            double* v_gamma_bb = vals["V_GAMMA_BB"]->pointer();
+            double** phi_xx = properties->basis_value(BASIS_PHI_XX)->pointer();
+            double** phi_xy = properties->basis_value(BASIS_PHI_XY)->pointer();
+            double** phi_xz = properties->basis_value(BASIS_PHI_XZ)->pointer();
+            double** phi_yy = properties->basis_value(BASIS_PHI_YY)->pointer();
+            double** phi_yz = properties->basis_value(BASIS_PHI_YZ)->pointer();
+            double** phi_zz = properties->basis_value(BASIS_PHI_ZZ)->pointer();
+            double* rho_ax = properties->point_pointers()[XC_RHO_AX];
+            double* rho_ay = properties->point_pointers()[XC_RHO_AY];
+            double* rho_az = properties->point_pointers()[XC_RHO_AZ];
+            double* rho_bx = properties->point_pointers()[XC_RHO_BX];
+            double* rho_by = properties->point_pointers()[XC_RHO_BY];
+            double* rho_bz = properties->point_pointers()[XC_RHO_BZ];
+            double* v_gamma_aa = vals[XC_V_GAMMA_AA];
+            double* v_gamma_ab = vals[XC_V_GAMMA_AB];
+            double* v_gamma_bb = vals[XC_V_GAMMA_BB];
 
             C_DGEMM('N','N',npoints,nlocal,nlocal,1.0,phi[0],max_functions,Dap[0],max_functions,0.0,Uap[0],max_functions);
             C_DGEMM('N','N',npoints,nlocal,nlocal,1.0,phi[0],max_functions,Dbp[0],max_functions,0.0,Ubp[0],max_functions);
@@ -1300,14 +1415,14 @@ SharedMatrix UV::compute_gradient()
         
         // => Meta Contribution <= //
         if (functional_->is_meta()) {
-            double** phi_xx = properties_->basis_value("PHI_XX")->pointer();
-            double** phi_xy = properties_->basis_value("PHI_XY")->pointer();
-            double** phi_xz = properties_->basis_value("PHI_XZ")->pointer();
-            double** phi_yy = properties_->basis_value("PHI_YY")->pointer();
-            double** phi_yz = properties_->basis_value("PHI_YZ")->pointer();
-            double** phi_zz = properties_->basis_value("PHI_ZZ")->pointer();
-            double* v_tau_a = vals["V_TAU_A"]->pointer();
-            double* v_tau_b = vals["V_TAU_B"]->pointer();
+            double** phi_xx = properties->basis_value(BASIS_PHI_XX)->pointer();
+            double** phi_xy = properties->basis_value(BASIS_PHI_XY)->pointer();
+            double** phi_xz = properties->basis_value(BASIS_PHI_XZ)->pointer();
+            double** phi_yy = properties->basis_value(BASIS_PHI_YY)->pointer();
+            double** phi_yz = properties->basis_value(BASIS_PHI_YZ)->pointer();
+            double** phi_zz = properties->basis_value(BASIS_PHI_ZZ)->pointer();
+            double* v_tau_a = vals[XC_V_TAU_A];
+            double* v_tau_b = vals[XC_V_TAU_B];
 
             double** phi_i[3];
             phi_i[0] = phi_x;
@@ -1354,6 +1469,14 @@ SharedMatrix UV::compute_gradient()
         }
 
     } 
+
+    // Reduce over threads in thread order (see RV::compute_V)
+    for (int thread = 0; thread < nthread; thread++) {
+        if (thread) G->add(G_thread[thread]);
+        for (std::map<std::string, double>::const_iterator it = quad_thread[thread].begin(); it != quad_thread[thread].end(); ++it) {
+            quad_values_[(*it).first] += (*it).second;
+        }
+    }
  
     if (debug_) {
         outfile->Printf( "   => XC Gradient: Numerical Integrals <=\n\n");
@@ -1364,7 +1487,9 @@ SharedMatrix UV::compute_gradient()
         outfile->Printf( "    <\\vec r\\rho_b>  : <%24.16E,%24.16E,%24.16E>\n\n",quad_values_["RHO_BX"],quad_values_["RHO_BY"],quad_values_["RHO_BZ"]);
     }
 
-    properties_->set_deriv(old_deriv);
+    for (int thread = 0; thread < nthread; thread++) {
+        point_workers_[thread]->set_deriv(old_deriv);
+    }
 
     return G;
 }
@@ -63,6 +63,12 @@ protected:
     boost::shared_ptr<SuperFunctional> functional_;
     /// Point function computer (densities, gammas, basis values)
     boost::shared_ptr<PointFunctions> properties_;
+    /// Number of threads the blocks of points are spread over
+    int num_threads_;
+    /// Point function computers, one per thread (the first is properties_)
+    std::vector<boost::shared_ptr<PointFunctions> > point_workers_;
+    /// Superfunctional workers, one per thread (the first is functional_)
+    std::vector<boost::shared_ptr<SuperFunctional> > functional_workers_;
     /// Integration grid, built by KSPotential
     boost::shared_ptr<DFTGrid> grid_;
     /// Quadrature values obtained during integration 
@@ -102,6 +108,8 @@ protected:
 
     /// Actually build V_AO
     virtual void compute_V() = 0;
+    /// Build the per-thread superfunctional workers
+    void build_functional_workers();
     /// Set things up
     void common_init();
 public:
@@ -42,7 +42,7 @@ public:
 
     FT97_CFunctional();
     virtual ~FT97_CFunctional(); 
-    virtual void compute_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha);
+    virtual void compute_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha);
 
 };
 
@@ -107,13 +107,13 @@ void CFunctional::set_parameter(const std::string& key, double val)
         throw PSIEXCEPTION("Error, unknown generalized correlation functional parameter");    
     }
 }
-void CFunctional::compute_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha)
+void CFunctional::compute_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha)
 {
     compute_ss_functional(in,out,npoints,deriv,alpha,true);
     compute_ss_functional(in,out,npoints,deriv,alpha,false);
     compute_os_functional(in,out,npoints,deriv,alpha);
 }
-void CFunctional::compute_ss_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha, bool spin)
+void CFunctional::compute_ss_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha, bool spin)
 {
     if (deriv > 1) {
         throw PSIEXCEPTION("CFunctional: 2nd and higher partials not implemented yet.");
@@ -127,12 +127,12 @@ void CFunctional::compute_ss_functional(const std::map<std::string,SharedVector>
     double* rho_s = NULL;
     double* gamma_s = NULL;
     double* tau_s = NULL;
-    rho_s = in.find(spin ? "RHO_A" : "RHO_B")->second->pointer();
+    rho_s = in[spin ? XC_RHO_A : XC_RHO_B];
     if (gga_) {
-        gamma_s = in.find(spin ? "GAMMA_AA" : "GAMMA_BB")->second->pointer();
+        gamma_s = in[spin ? XC_GAMMA_AA : XC_GAMMA_BB];
     }
     if (meta_) {
-        tau_s = in.find(spin ? "TAU_A" : "TAU_B")->second->pointer();
+        tau_s = in[spin ? XC_TAU_A : XC_TAU_B];
     }
 
     // => Output variables <= //
@@ -142,14 +142,14 @@ void CFunctional::compute_ss_functional(const std::map<std::string,SharedVector>
     double* v_gamma = NULL;
     double* v_tau = NULL;
     
-    v = out.find(spin ? "V" : "V")->second->pointer();
+    v = out[XC_V];
     if (deriv >= 1) {
-        v_rho = out.find(spin ? "V_RHO_A" : "V_RHO_B")->second->pointer();
+        v_rho = out[spin ? XC_V_RHO_A : XC_V_RHO_B];
         if (gga_) {
-            v_gamma = out.find(spin ? "V_GAMMA_AA" : "V_GAMMA_BB")->second->pointer();
+            v_gamma = out[spin ? XC_V_GAMMA_AA : XC_V_GAMMA_BB];
         }
         if (meta_) {
-            v_tau = out.find(spin ? "V_TAU_A" : "V_TAU_B")->second->pointer();
+            v_tau = out[spin ? XC_V_TAU_A : XC_V_TAU_B];
         }
     }
      
@@ -256,7 +256,7 @@ void CFunctional::compute_ss_functional(const std::map<std::string,SharedVector>
         }
     }
 }
-void CFunctional::compute_os_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha)
+void CFunctional::compute_os_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha)
 {
     if (deriv > 1) {
         throw PSIEXCEPTION("CFunctional: 2nd and higher partials not implemented yet.");
@@ -272,11 +272,11 @@ void CFunctional::compute_os_functional(const std::map<std::string,SharedVector>
     double* gamma_aap = NULL;
     double* gamma_bbp = NULL;
 
-    rho_ap = in.find("RHO_A")->second->pointer();
-    rho_bp = in.find("RHO_B")->second->pointer();
+    rho_ap = in[XC_RHO_A];
+    rho_bp = in[XC_RHO_B];
     if (gga_) {
-        gamma_aap = in.find("GAMMA_AA")->second->pointer();
-        gamma_bbp = in.find("GAMMA_BB")->second->pointer();
+        gamma_aap = in[XC_GAMMA_AA];
+        gamma_bbp = in[XC_GAMMA_BB];
     }
 
     // => Output variables <= //
@@ -287,13 +287,13 @@ void CFunctional::compute_os_functional(const std::map<std::string,SharedVector>
     double* v_gamma_aa = NULL;
     double* v_gamma_bb = NULL;
     
-    v = out.find("V")->second->pointer();
+    v = out[XC_V];
     if (deriv >= 1) {
-        v_rho_a = out.find("V_RHO_A")->second->pointer();
-        v_rho_b = out.find("V_RHO_B")->second->pointer();
+        v_rho_a = out[XC_V_RHO_A];
+        v_rho_b = out[XC_V_RHO_B];
         if (gga_) {
-            v_gamma_aa = out.find("V_GAMMA_AA")->second->pointer();
-            v_gamma_bb = out.find("V_GAMMA_BB")->second->pointer();
+            v_gamma_aa = out[XC_V_GAMMA_AA];
+            v_gamma_bb = out[XC_V_GAMMA_BB];
         }
     }
      
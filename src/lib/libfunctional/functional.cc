@@ -55,6 +55,35 @@ void Functional::set_parameter(const std::string& key, double val)
 {
     parameters_[key] = val;
 }
+void Functional::classify_points(const double* rho_ap, const double* rho_bp, int npoints, std::vector<int>& Qs, int* nQ) const
+{
+    nQ[0] = nQ[1] = nQ[2] = 0;
+    for (int Q = 0; Q < npoints; Q++) {
+        bool a0 = rho_ap[Q] < lsda_cutoff_;
+        bool b0 = rho_bp[Q] < lsda_cutoff_;
+        if (!a0 && !b0) {
+            nQ[0]++;
+        } else if (!b0) {
+            nQ[1]++;
+        } else if (!a0) {
+            nQ[2]++;
+        }
+    }
+
+    Qs.resize(nQ[0] + nQ[1] + nQ[2]);
+    int offset[3] = {0, nQ[0], nQ[0] + nQ[1]};
+    for (int Q = 0; Q < npoints; Q++) {
+        bool a0 = rho_ap[Q] < lsda_cutoff_;
+        bool b0 = rho_bp[Q] < lsda_cutoff_;
+        if (!a0 && !b0) {
+            Qs[offset[0]++] = Q;
+        } else if (!b0) {
+            Qs[offset[1]++] = Q;
+        } else if (!a0) {
+            Qs[offset[2]++] = Q;
+        }
+    }
+}
 void Functional::print(std::string out, int level) const
 {
     if (level < 1) return;
@@ -84,7 +113,7 @@ void Functional::print(std::string out, int level) const
         printer->Printf( "\n");
     }
 } 
-void Functional::compute_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha)
+void Functional::compute_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha)
 {
     throw PSIEXCEPTION("Functional: pseudo-abstract class.");
 }
@@ -29,6 +29,7 @@
 #define FUNCTIONAL_H
 
 #include <libmints/typedefs.h>
+#include "xcslots.h"
 #include <map>
 #include <vector>
 
@@ -80,6 +81,13 @@ protected:
     // Initialize null functional
     void common_init();
 
+    // Sort the points of a batch by LSDA cutoff regime, so that the kernels
+    // can run one branch-free (vectorizable) loop per regime. On return Qs
+    // holds the points with both densities above lsda_cutoff_ (nQ[0] of
+    // them), then those with only rho_a below it (nQ[1]), then those with
+    // only rho_b below it (nQ[2]). Points with both below are dropped.
+    void classify_points(const double* rho_ap, const double* rho_bp, int npoints, std::vector<int>& Qs, int* nQ) const;
+
 public:
 
     // => Constructors (Use the factory constructor, or really know what's up) <= //
@@ -91,8 +99,9 @@ public:
     static boost::shared_ptr<Functional> build_base(const std::string& alias);
         
     // => Computers <= //
-    
-    virtual void compute_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha) = 0;
+
+    // in is indexed by XCPointSlot, out by XCValueSlot (see xcslots.h)
+    virtual void compute_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha) = 0;
 
     // => Parameters <= //
     
@@ -33,6 +33,97 @@ name = sys.argv[1]
 os.system("sed -i 's/NAME/%s/g' %sfunctional.cc" %(name,name))
 os.system("sed -i 's/NAME/%s/g' %sfunctional.h" %(name,name))
 
+# Each regime of the point loop is emitted as one simd loop per
+# "if (deriv >= n) { ... }" section, over the packed points of that regime
+# (see Functional::classify_points). Only the inputs a section uses are
+# loaded, so the loops carry no branches on gga_/meta_.
+point_vars = ['rho_a', 'rho_b', 'gamma_aa', 'gamma_ab', 'gamma_bb', 'tau_a', 'tau_b']
+
+def batch_loops(lines, count, index):
+    out = []
+    comment = None
+    i = 0
+    while i < len(lines):
+        l = lines[i]
+        if l.startswith('//'):
+            comment = l
+            i += 1
+            continue
+        if l.startswith('if (deriv >= '):
+            j = i + 1
+            while not lines[j].startswith('}'):
+                j += 1
+            body = lines[i+1:j]
+            text = ''.join(body)
+            if comment:
+                out.append(comment)
+            out.append(l)
+            out.append('    #pragma omp simd\n')
+            out.append('    for (int P = 0; P < %s; P++) {\n' % count)
+            out.append('        int Q = %s[P];\n' % index)
+            for v in point_vars:
+                if re.search(r'\b%s\b' % v, text):
+                    out.append('        double %s = %sp[Q];\n' % (v, v))
+            for b in body:
+                out.append(('    ' + b) if b.strip() else '\n')
+            out.append('    }\n')
+            out.append('}\n')
+            comment = None
+            i = j + 1
+            continue
+        out.append(l)
+        i += 1
+    return out
+
+# The template declares and fetches every input and output slot. Those the
+# generated kernel never touches are dropped again, along with any if
+# blocks left empty, so the kernels compile without unused variables.
+decl_re   = re.compile(r'^\s*double\* (\w+) = NULL;\s*$')
+fetch_re  = re.compile(r'^\s*(\w+) = (in|out)\[\w+\];\s*$')
+open_re   = re.compile(r'^\s*if \(.*\)\s*\{\s*$')
+close_re  = re.compile(r'^\s*\}\s*$')
+
+def prune_pointers(lines):
+    names = [decl_re.match(l).group(1) for l in lines if decl_re.match(l)]
+    unused = set()
+    for n in names:
+        use_re = re.compile(r'\b%s\b' % n)
+        used = False
+        for l in lines:
+            m = decl_re.match(l) or fetch_re.match(l)
+            if m and m.group(1) == n:
+                continue
+            if use_re.search(l):
+                used = True
+                break
+        if not used:
+            unused.add(n)
+    out = []
+    for l in lines:
+        m = decl_re.match(l) or fetch_re.match(l)
+        if m and m.group(1) in unused:
+            continue
+        out.append(l)
+    pruned = True
+    while pruned:
+        pruned = False
+        for i in range(len(out) - 1):
+            if open_re.match(out[i]) and close_re.match(out[i+1]):
+                del out[i:i+2]
+                pruned = True
+                break
+    # Collapse the blank lines left behind by dropped declarations
+    lines = out
+    out = []
+    decls = True
+    for l in lines:
+        if '// => Loop over points <= //' in l:
+            decls = False
+        if decls and not l.strip() and out and not out[-1].strip():
+            continue
+        out.append(l)
+    return out
+
 fh = open('preamble', 'r')
 preamble = fh.readlines()
 fh.close()
@@ -57,7 +148,7 @@ fh = open('%sfunctional.cc' % (name), 'r')
 template = fh.readlines()
 fh.close()
 
-fh = open('%sfunctional.cc' % (name), 'w')
+out = []
 
 pre_re    = re.compile(r'^(\s+)PREAMBLE$')
 par_re    = re.compile(r'^(\s+)PARAMETERS$')
@@ -70,38 +161,40 @@ for line in template:
     if mobj:
         spaces = mobj.group(1)
         for l in preamble:
-            fh.write(spaces + l)
+            out.append(spaces + l)
         continue
     mobj = re.match(par_re, line);
     if mobj:
         spaces = mobj.group(1)
         for l in parameters:
-            fh.write(spaces + l)
+            out.append(spaces + l)
         continue
     mobj = re.match(fun_re, line);
     if mobj:
         spaces = mobj.group(1)
-        for l in functional:
-            fh.write(spaces + l)
+        for l in batch_loops(functional, 'nQ[0]', 'Q_ab'):
+            out.append(spaces + l)
         continue
     mobj = re.match(fun_a0_re, line);
     if mobj:
         spaces = mobj.group(1)
-        for l in functional_rho_a0:
-            fh.write(spaces + l)
+        for l in batch_loops(functional_rho_a0, 'nQ[1]', 'Q_a0'):
+            out.append(spaces + l)
         continue
     mobj = re.match(fun_b0_re, line);
     if mobj:
         spaces = mobj.group(1)
-        for l in functional_rho_b0:
-            fh.write(spaces + l)
+        for l in batch_loops(functional_rho_b0, 'nQ[2]', 'Q_b0'):
+            out.append(spaces + l)
         continue
-    fh.write(line)
+    out.append(line)
+
+fh = open('%sfunctional.cc' % (name), 'w')
+fh.writelines(prune_pointers(out))
+fh.close()
 
 os.system('rm preamble')
 os.system('rm parameters')
 os.system('rm functional')
 os.system('rm functional_rho_a0')
 os.system('rm functional_rho_b0')
-
-fh.close()
\ No newline at end of file
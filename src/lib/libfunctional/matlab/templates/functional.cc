@@ -41,7 +41,7 @@ NAMEFunctional::NAMEFunctional()
 NAMEFunctional::~NAMEFunctional()
 {
 }
-void NAMEFunctional::compute_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha)
+void NAMEFunctional::compute_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha)
 {
     PARAMETERS
 
@@ -59,17 +59,17 @@ void NAMEFunctional::compute_functional(const std::map<std::string,SharedVector>
     double* tau_bp = NULL;
 
     if (true) {
-        rho_ap = in.find("RHO_A")->second->pointer();
-        rho_bp = in.find("RHO_B")->second->pointer();
+        rho_ap = in[XC_RHO_A];
+        rho_bp = in[XC_RHO_B];
     }
     if (gga_) {  
-        gamma_aap = in.find("GAMMA_AA")->second->pointer();
-        gamma_abp = in.find("GAMMA_AB")->second->pointer();
-        gamma_bbp = in.find("GAMMA_BB")->second->pointer();
+        gamma_aap = in[XC_GAMMA_AA];
+        gamma_abp = in[XC_GAMMA_AB];
+        gamma_bbp = in[XC_GAMMA_BB];
     } 
     if (meta_)  {
-        tau_ap = in.find("TAU_A")->second->pointer();
-        tau_bp = in.find("TAU_B")->second->pointer();
+        tau_ap = in[XC_TAU_A];
+        tau_bp = in[XC_TAU_B];
     }
 
     // => Outut variables <= //
@@ -114,104 +114,90 @@ void NAMEFunctional::compute_functional(const std::map<std::string,SharedVector>
     double* v_gamma_bb_tau_b = NULL;
 
     if (deriv >= 0) {
-        v = out.find("V")->second->pointer();
+        v = out[XC_V];
     } 
     if (deriv >= 1) {
         if (true) {
-            v_rho_a = out.find("V_RHO_A")->second->pointer();
-            v_rho_b = out.find("V_RHO_B")->second->pointer();
+            v_rho_a = out[XC_V_RHO_A];
+            v_rho_b = out[XC_V_RHO_B];
         }
         if (gga_) {
-            v_gamma_aa = out.find("V_GAMMA_AA")->second->pointer();
-            v_gamma_ab = out.find("V_GAMMA_AB")->second->pointer();
-            v_gamma_bb = out.find("V_GAMMA_BB")->second->pointer();
+            v_gamma_aa = out[XC_V_GAMMA_AA];
+            v_gamma_ab = out[XC_V_GAMMA_AB];
+            v_gamma_bb = out[XC_V_GAMMA_BB];
         }
         if (meta_) {    
-            v_tau_a = out.find("V_TAU_A")->second->pointer();
-            v_tau_b = out.find("V_TAU_B")->second->pointer();
+            v_tau_a = out[XC_V_TAU_A];
+            v_tau_b = out[XC_V_TAU_B];
         }
     }
     if (deriv >= 2) {
         if (true) {
-            v_rho_a_rho_a = out.find("V_RHO_A_RHO_A")->second->pointer();
-            v_rho_a_rho_b = out.find("V_RHO_A_RHO_B")->second->pointer();
-            v_rho_b_rho_b = out.find("V_RHO_B_RHO_B")->second->pointer();
+            v_rho_a_rho_a = out[XC_V_RHO_A_RHO_A];
+            v_rho_a_rho_b = out[XC_V_RHO_A_RHO_B];
+            v_rho_b_rho_b = out[XC_V_RHO_B_RHO_B];
         }
         if (gga_) {
-            v_gamma_aa_gamma_aa = out.find("V_GAMMA_AA_GAMMA_AA")->second->pointer();
-            v_gamma_aa_gamma_ab = out.find("V_GAMMA_AA_GAMMA_AB")->second->pointer();
-            v_gamma_aa_gamma_bb = out.find("V_GAMMA_AA_GAMMA_BB")->second->pointer();
-            v_gamma_ab_gamma_ab = out.find("V_GAMMA_AB_GAMMA_AB")->second->pointer();
-            v_gamma_ab_gamma_bb = out.find("V_GAMMA_AB_GAMMA_BB")->second->pointer();
-            v_gamma_bb_gamma_bb = out.find("V_GAMMA_BB_GAMMA_BB")->second->pointer();
+            v_gamma_aa_gamma_aa = out[XC_V_GAMMA_AA_GAMMA_AA];
+            v_gamma_aa_gamma_ab = out[XC_V_GAMMA_AA_GAMMA_AB];
+            v_gamma_aa_gamma_bb = out[XC_V_GAMMA_AA_GAMMA_BB];
+            v_gamma_ab_gamma_ab = out[XC_V_GAMMA_AB_GAMMA_AB];
+            v_gamma_ab_gamma_bb = out[XC_V_GAMMA_AB_GAMMA_BB];
+            v_gamma_bb_gamma_bb = out[XC_V_GAMMA_BB_GAMMA_BB];
         }
         if (meta_) {
-            v_tau_a_tau_a = out.find("V_TAU_A_TAU_A")->second->pointer();
-            v_tau_a_tau_b = out.find("V_TAU_A_TAU_B")->second->pointer();
-            v_tau_b_tau_b = out.find("V_TAU_B_TAU_B")->second->pointer();
+            v_tau_a_tau_a = out[XC_V_TAU_A_TAU_A];
+            v_tau_a_tau_b = out[XC_V_TAU_A_TAU_B];
+            v_tau_b_tau_b = out[XC_V_TAU_B_TAU_B];
         }
         if (gga_) {
-            v_rho_a_gamma_aa = out.find("V_RHO_A_GAMMA_AA")->second->pointer();
-            v_rho_a_gamma_ab = out.find("V_RHO_A_GAMMA_AB")->second->pointer();
-            v_rho_a_gamma_bb = out.find("V_RHO_A_GAMMA_BB")->second->pointer();
-            v_rho_b_gamma_aa = out.find("V_RHO_B_GAMMA_AA")->second->pointer();
-            v_rho_b_gamma_ab = out.find("V_RHO_B_GAMMA_AB")->second->pointer();
-            v_rho_b_gamma_bb = out.find("V_RHO_B_GAMMA_BB")->second->pointer();
+            v_rho_a_gamma_aa = out[XC_V_RHO_A_GAMMA_AA];
+            v_rho_a_gamma_ab = out[XC_V_RHO_A_GAMMA_AB];
+            v_rho_a_gamma_bb = out[XC_V_RHO_A_GAMMA_BB];
+            v_rho_b_gamma_aa = out[XC_V_RHO_B_GAMMA_AA];
+            v_rho_b_gamma_ab = out[XC_V_RHO_B_GAMMA_AB];
+            v_rho_b_gamma_bb = out[XC_V_RHO_B_GAMMA_BB];
         }
         if (meta_) {
-            v_rho_a_tau_a = out.find("V_RHO_A_TAU_A")->second->pointer();
-            v_rho_a_tau_b = out.find("V_RHO_A_TAU_B")->second->pointer();
-            v_rho_b_tau_a = out.find("V_RHO_B_TAU_A")->second->pointer();
-            v_rho_b_tau_b = out.find("V_RHO_B_TAU_B")->second->pointer();
+            v_rho_a_tau_a = out[XC_V_RHO_A_TAU_A];
+            v_rho_a_tau_b = out[XC_V_RHO_A_TAU_B];
+            v_rho_b_tau_a = out[XC_V_RHO_B_TAU_A];
+            v_rho_b_tau_b = out[XC_V_RHO_B_TAU_B];
         }
         if (gga_ && meta_) {
-            v_gamma_aa_tau_a = out.find("V_GAMMA_AA_TAU_A")->second->pointer();
-            v_gamma_aa_tau_b = out.find("V_GAMMA_AA_TAU_B")->second->pointer();
-            v_gamma_ab_tau_a = out.find("V_GAMMA_AB_TAU_A")->second->pointer();
-            v_gamma_ab_tau_b = out.find("V_GAMMA_AB_TAU_B")->second->pointer();
-            v_gamma_bb_tau_a = out.find("V_GAMMA_BB_TAU_A")->second->pointer();
-            v_gamma_bb_tau_b = out.find("V_GAMMA_BB_TAU_B")->second->pointer();
+            v_gamma_aa_tau_a = out[XC_V_GAMMA_AA_TAU_A];
+            v_gamma_aa_tau_b = out[XC_V_GAMMA_AA_TAU_B];
+            v_gamma_ab_tau_a = out[XC_V_GAMMA_AB_TAU_A];
+            v_gamma_ab_tau_b = out[XC_V_GAMMA_AB_TAU_B];
+            v_gamma_bb_tau_a = out[XC_V_GAMMA_BB_TAU_A];
+            v_gamma_bb_tau_b = out[XC_V_GAMMA_BB_TAU_B];
         }
     }
 
     // => Loop over points <= //
 
-    for (int Q = 0; Q < npoints; Q++) {
+    // The density cutoffs are resolved up front (see classify_points), so
+    // each regime below is a set of branch-free loops over packed points
+    std::vector<int> Qs;
+    int nQ[3];
+    classify_points(rho_ap, rho_bp, npoints, Qs, nQ);
+    if (Qs.empty()) return;
 
-        // Input variables 
-        double rho_a;
-        double rho_b;
-        double gamma_aa;
-        double gamma_ab;
-        double gamma_bb;
-        double tau_a;
-        double tau_b;
+    const int* Q_ab = &Qs[0];
+    const int* Q_a0 = Q_ab + nQ[0];
+    const int* Q_b0 = Q_ab + nQ[0] + nQ[1];
 
-        if (true) {
-            rho_a = rho_ap[Q];
-            rho_b = rho_bp[Q];
-        }        
-        if (gga_) {
-            gamma_aa = gamma_aap[Q];
-            gamma_ab = gamma_abp[Q];
-            gamma_bb = gamma_bbp[Q];
-        }        
-        if (meta_) {
-            tau_a = tau_ap[Q];
-            tau_b = tau_bp[Q];
-        }        
-
-        // Definitions (asymptotics to prevent numerical problems)
-        if (rho_a < lsda_cutoff_ && rho_b < lsda_cutoff_) {
-            continue;
-        } else if (rho_a < lsda_cutoff_) {
-            FUNCTIONAL_RHO_A0
-        } else if (rho_b < lsda_cutoff_) {
-            FUNCTIONAL_RHO_B0
-        } else {
-            FUNCTIONAL
-        }
-    }
+    // => Both densities above the cutoff <= //
+
+    FUNCTIONAL
+
+    // => rho_a below the cutoff <= //
+
+    FUNCTIONAL_RHO_A0
+
+    // => rho_b below the cutoff <= //
+
+    FUNCTIONAL_RHO_B0
 }
 
-}
\ No newline at end of file
+}
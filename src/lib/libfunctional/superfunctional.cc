@@ -59,6 +59,12 @@ boost::shared_ptr<SuperFunctional> SuperFunctional::blank()
 {
     return boost::shared_ptr<SuperFunctional>(new SuperFunctional());
 }
+boost::shared_ptr<SuperFunctional> SuperFunctional::build_worker()
+{
+    boost::shared_ptr<SuperFunctional> worker(new SuperFunctional(*this));
+    worker->allocate();
+    return worker;
+}
 void SuperFunctional::print(std::string out, int level) const
 {
     if (level < 1) return;
@@ -289,26 +295,42 @@ void SuperFunctional::allocate()
         }   
     }
 
+    value_ptrs_.assign(XC_NVALUE_SLOTS, static_cast<double*>(NULL));
     for (int i = 0; i < list.size(); i++) {
-        values_[list[i]] = SharedVector(new Vector(list[i],max_points_));
+        SharedVector vec(new Vector(list[i],max_points_));
+        values_[list[i]] = vec;
+        int slot = xc_value_slot(list[i]);
+        value_ptrs_[slot] = vec->pointer();
     }
 }
-std::map<std::string, SharedVector>& SuperFunctional::compute_functional(const std::map<std::string, SharedVector>& vals, int npoints)
+double* const* SuperFunctional::compute_functional(double* const* vals, int npoints)
 {
-    npoints = (npoints == -1 ? vals.find("RHO_A")->second->dimpi()[0] : npoints);
-    
-    for (std::map<std::string, SharedVector>::const_iterator it = values_.begin();
-        it != values_.end(); ++it) {
-        ::memset((void*)((*it).second->pointer()),'\0',sizeof(double) * npoints);
+    for (int slot = 0; slot < XC_NVALUE_SLOTS; slot++) {
+        if (value_ptrs_[slot]) {
+            ::memset((void*)value_ptrs_[slot],'\0',sizeof(double) * npoints);
+        }
     }
 
     for (int i = 0; i < x_functionals_.size(); i++) {
-        x_functionals_[i]->compute_functional(vals, values_, npoints, deriv_, (1.0 - x_alpha_));
+        x_functionals_[i]->compute_functional(vals, &value_ptrs_[0], npoints, deriv_, (1.0 - x_alpha_));
     }
     for (int i = 0; i < c_functionals_.size(); i++) {
-        c_functionals_[i]->compute_functional(vals, values_, npoints, deriv_, (1.0 - c_alpha_));
+        c_functionals_[i]->compute_functional(vals, &value_ptrs_[0], npoints, deriv_, (1.0 - c_alpha_));
     }
-    
+
+    return &value_ptrs_[0];
+}
+std::map<std::string, SharedVector>& SuperFunctional::compute_functional(const std::map<std::string, SharedVector>& vals, int npoints)
+{
+    npoints = (npoints == -1 ? vals.find("RHO_A")->second->dimpi()[0] : npoints);
+
+    double* ptrs[XC_NPOINT_SLOTS];
+    for (int slot = 0; slot < XC_NPOINT_SLOTS; slot++) {
+        std::map<std::string, SharedVector>::const_iterator it = vals.find(xc_point_name(slot));
+        ptrs[slot] = (it == vals.end() || !(*it).second ? NULL : (*it).second->pointer());
+    }
+    compute_functional(ptrs, npoints);
+
     return values_;
 }
 void SuperFunctional::test_functional(SharedVector rho_a, 
@@ -29,6 +29,7 @@
 #define SUPERFUNCTIONAL_H
 
 #include <libmints/typedefs.h>
+#include "xcslots.h"
 #include <map>
 #include <vector>
 
@@ -99,6 +100,8 @@ protected:
     int max_points_;
     int deriv_;
     std::map<std::string, SharedVector> values_;
+    // Data pointers of values_ by XCValueSlot, NULL if not allocated
+    std::vector<double*> value_ptrs_;
 
     // The omegas or alphas have changed, we're in a GKS environment. 
     // Update the short-range DFAs
@@ -116,12 +119,18 @@ public:
     static boost::shared_ptr<SuperFunctional> current(Options& options, int max_points = -1, int deriv = 1);
     static boost::shared_ptr<SuperFunctional> build(const std::string& alias, int max_points = 5000, int deriv = 1); 
     static boost::shared_ptr<SuperFunctional> blank();
+    // A copy that shares the DFA objects but owns its values, for one thread of a
+    // quadrature (compute_functional on distinct workers may run concurrently)
+    boost::shared_ptr<SuperFunctional> build_worker();
 
     // Allocate values (MUST be called after adding new functionals to the superfunctional)
     void allocate();
 
     // => Computers <= //
     
+    // vals is indexed by XCPointSlot, the result by XCValueSlot. This is the quadrature path.
+    double* const* compute_functional(double* const* vals, int npoints);
+    // Map-keyed version for the Python layer
     std::map<std::string, SharedVector>& compute_functional(const std::map<std::string, SharedVector>& vals, int npoints = -1);
     void test_functional(SharedVector rho_a, 
                          SharedVector rho_b,
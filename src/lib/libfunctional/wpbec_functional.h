@@ -119,7 +119,7 @@ public:
 
     // => Computers <= //
 
-    virtual void compute_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha);
+    virtual void compute_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha);
 
     void set_wPBEC_type(wPBEC_Type type) { type_ = type; common_init(); }
 };
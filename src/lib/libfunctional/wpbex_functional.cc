@@ -93,12 +93,12 @@ void wPBEXFunctional::set_parameter(const std::string& key, double val)
         throw PSIEXCEPTION("Error, unknown HJS exchange functional parameter");    
     }
 }
-void wPBEXFunctional::compute_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha)
+void wPBEXFunctional::compute_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha)
 {
     compute_sigma_functional(in,out,npoints,deriv,alpha,true);
     compute_sigma_functional(in,out,npoints,deriv,alpha,false);
 }
-void wPBEXFunctional::compute_sigma_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha, bool spin)
+void wPBEXFunctional::compute_sigma_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha, bool spin)
 {
     if (deriv > 1) {
         throw PSIEXCEPTION("wPBEXFunctional: 2nd and higher partials not implemented yet.");
@@ -112,8 +112,8 @@ void wPBEXFunctional::compute_sigma_functional(const std::map<std::string,Shared
     double* rho_s = NULL;
     double* gamma_s = NULL;
     double* tau_s = NULL;
-    rho_s = in.find(spin ? "RHO_A" : "RHO_B")->second->pointer();
-    gamma_s = in.find(spin ? "GAMMA_AA" : "GAMMA_BB")->second->pointer();
+    rho_s = in[spin ? XC_RHO_A : XC_RHO_B];
+    gamma_s = in[spin ? XC_GAMMA_AA : XC_GAMMA_BB];
 
     // => Output variables <= //
 
@@ -121,10 +121,10 @@ void wPBEXFunctional::compute_sigma_functional(const std::map<std::string,Shared
     double* v_rho = NULL;
     double* v_gamma = NULL;
     
-    v = out.find(spin ? "V" : "V")->second->pointer();
+    v = out[XC_V];
     if (deriv >=1) {
-        v_rho = out.find(spin ? "V_RHO_A" : "V_RHO_B")->second->pointer();
-        v_gamma = out.find(spin ? "V_GAMMA_AA" : "V_GAMMA_BB")->second->pointer();
+        v_rho = out[spin ? XC_V_RHO_A : XC_V_RHO_B];
+        v_gamma = out[spin ? XC_V_GAMMA_AA : XC_V_GAMMA_BB];
     }
      
     // => Main Loop over points <= //
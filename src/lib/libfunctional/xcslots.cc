@@ -0,0 +1,114 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2016 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+#include "xcslots.h"
+
+namespace psi {
+
+namespace {
+
+const char* const point_names[XC_NPOINT_SLOTS] = {
+    "RHO_A",
+    "RHO_B",
+    "RHO_AX",
+    "RHO_AY",
+    "RHO_AZ",
+    "RHO_BX",
+    "RHO_BY",
+    "RHO_BZ",
+    "GAMMA_AA",
+    "GAMMA_AB",
+    "GAMMA_BB",
+    "TAU_A",
+    "TAU_B"
+};
+
+const char* const value_names[XC_NVALUE_SLOTS] = {
+    "V",
+    "V_RHO_A",
+    "V_RHO_B",
+    "V_RHO_A_RHO_A",
+    "V_RHO_A_RHO_B",
+    "V_RHO_B_RHO_B",
+    "V_GAMMA_AA",
+    "V_GAMMA_AB",
+    "V_GAMMA_BB",
+    "V_GAMMA_AA_GAMMA_AA",
+    "V_GAMMA_AA_GAMMA_AB",
+    "V_GAMMA_AA_GAMMA_BB",
+    "V_GAMMA_AB_GAMMA_AB",
+    "V_GAMMA_AB_GAMMA_BB",
+    "V_GAMMA_BB_GAMMA_BB",
+    "V_TAU_A",
+    "V_TAU_B",
+    "V_TAU_A_TAU_A",
+    "V_TAU_A_TAU_B",
+    "V_TAU_B_TAU_B",
+    "V_RHO_A_GAMMA_AA",
+    "V_RHO_A_GAMMA_AB",
+    "V_RHO_A_GAMMA_BB",
+    "V_RHO_B_GAMMA_AA",
+    "V_RHO_B_GAMMA_AB",
+    "V_RHO_B_GAMMA_BB",
+    "V_RHO_A_TAU_A",
+    "V_RHO_A_TAU_B",
+    "V_RHO_B_TAU_A",
+    "V_RHO_B_TAU_B",
+    "V_GAMMA_AA_TAU_A",
+    "V_GAMMA_AA_TAU_B",
+    "V_GAMMA_AB_TAU_A",
+    "V_GAMMA_AB_TAU_B",
+    "V_GAMMA_BB_TAU_A",
+    "V_GAMMA_BB_TAU_B"
+};
+
+}
+
+const char* xc_point_name(int slot)
+{
+    return point_names[slot];
+}
+int xc_point_slot(const std::string& name)
+{
+    for (int slot = 0; slot < XC_NPOINT_SLOTS; slot++) {
+        if (name == point_names[slot]) return slot;
+    }
+    return -1;
+}
+const char* xc_value_name(int slot)
+{
+    return value_names[slot];
+}
+int xc_value_slot(const std::string& name)
+{
+    for (int slot = 0; slot < XC_NVALUE_SLOTS; slot++) {
+        if (name == value_names[slot]) return slot;
+    }
+    return -1;
+}
+
+}
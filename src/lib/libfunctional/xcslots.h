@@ -0,0 +1,122 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2016 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+#ifndef FUNCTIONAL_XCSLOTS_H
+#define FUNCTIONAL_XCSLOTS_H
+
+#include <string>
+
+namespace psi {
+
+/**
+ * Slot layout of the DFT quadrature.
+ *
+ * Point values (density and friends on a block of grid points) and the
+ * functional values and partials are passed between PointFunctions,
+ * SuperFunctional, and the Functional kernels as arrays of double*
+ * indexed by these enums. A NULL entry means the quantity is not
+ * allocated for the current ansatz/derivative level.
+ *
+ * The string names (the old map keys) are still used by the Python
+ * layer and by cubeprop, and map one-to-one onto the slots below.
+ **/
+
+enum XCPointSlot {
+    XC_RHO_A,
+    XC_RHO_B,
+    XC_RHO_AX,
+    XC_RHO_AY,
+    XC_RHO_AZ,
+    XC_RHO_BX,
+    XC_RHO_BY,
+    XC_RHO_BZ,
+    XC_GAMMA_AA,
+    XC_GAMMA_AB,
+    XC_GAMMA_BB,
+    XC_TAU_A,
+    XC_TAU_B,
+    XC_NPOINT_SLOTS
+};
+
+enum XCValueSlot {
+    XC_V,
+    // LSDA
+    XC_V_RHO_A,
+    XC_V_RHO_B,
+    XC_V_RHO_A_RHO_A,
+    XC_V_RHO_A_RHO_B,
+    XC_V_RHO_B_RHO_B,
+    // GGA
+    XC_V_GAMMA_AA,
+    XC_V_GAMMA_AB,
+    XC_V_GAMMA_BB,
+    XC_V_GAMMA_AA_GAMMA_AA,
+    XC_V_GAMMA_AA_GAMMA_AB,
+    XC_V_GAMMA_AA_GAMMA_BB,
+    XC_V_GAMMA_AB_GAMMA_AB,
+    XC_V_GAMMA_AB_GAMMA_BB,
+    XC_V_GAMMA_BB_GAMMA_BB,
+    // Meta
+    XC_V_TAU_A,
+    XC_V_TAU_B,
+    XC_V_TAU_A_TAU_A,
+    XC_V_TAU_A_TAU_B,
+    XC_V_TAU_B_TAU_B,
+    // LSDA-GGA cross
+    XC_V_RHO_A_GAMMA_AA,
+    XC_V_RHO_A_GAMMA_AB,
+    XC_V_RHO_A_GAMMA_BB,
+    XC_V_RHO_B_GAMMA_AA,
+    XC_V_RHO_B_GAMMA_AB,
+    XC_V_RHO_B_GAMMA_BB,
+    // LSDA-Meta cross
+    XC_V_RHO_A_TAU_A,
+    XC_V_RHO_A_TAU_B,
+    XC_V_RHO_B_TAU_A,
+    XC_V_RHO_B_TAU_B,
+    // GGA-Meta cross
+    XC_V_GAMMA_AA_TAU_A,
+    XC_V_GAMMA_AA_TAU_B,
+    XC_V_GAMMA_AB_TAU_A,
+    XC_V_GAMMA_AB_TAU_B,
+    XC_V_GAMMA_BB_TAU_A,
+    XC_V_GAMMA_BB_TAU_B,
+    XC_NVALUE_SLOTS
+};
+
+/// Map key of a point slot ("RHO_A", ...)
+const char* xc_point_name(int slot);
+/// Point slot of a map key, or -1 if there is none
+int xc_point_slot(const std::string& name);
+/// Map key of a value slot ("V_RHO_A", ...)
+const char* xc_value_name(int slot);
+/// Value slot of a map key, or -1 if there is none
+int xc_value_slot(const std::string& name);
+
+}
+
+#endif
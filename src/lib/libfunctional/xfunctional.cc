@@ -119,12 +119,12 @@ void XFunctional::set_parameter(const std::string& key, double val)
         throw PSIEXCEPTION("Error, unknown generalized exchange functional parameter");
     }
 }
-void XFunctional::compute_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha)
+void XFunctional::compute_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha)
 {
     compute_sigma_functional(in,out,npoints,deriv,alpha,true);
     compute_sigma_functional(in,out,npoints,deriv,alpha,false);
 }
-void XFunctional::compute_sigma_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha, bool spin)
+void XFunctional::compute_sigma_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha, bool spin)
 {
     if (deriv > 1) {
         throw PSIEXCEPTION("XFunctional: 2nd and higher partials not implemented yet.");
@@ -138,12 +138,12 @@ void XFunctional::compute_sigma_functional(const std::map<std::string,SharedVect
     double* rho_s = NULL;
     double* gamma_s = NULL;
     double* tau_s = NULL;
-    rho_s = in.find(spin ? "RHO_A" : "RHO_B")->second->pointer();
+    rho_s = in[spin ? XC_RHO_A : XC_RHO_B];
     if (gga_) {
-        gamma_s = in.find(spin ? "GAMMA_AA" : "GAMMA_BB")->second->pointer();
+        gamma_s = in[spin ? XC_GAMMA_AA : XC_GAMMA_BB];
     }
     if (meta_) {
-        tau_s = in.find(spin ? "TAU_A" : "TAU_B")->second->pointer();
+        tau_s = in[spin ? XC_TAU_A : XC_TAU_B];
     }
 
     // => Output variables <= //
@@ -153,14 +153,14 @@ void XFunctional::compute_sigma_functional(const std::map<std::string,SharedVect
     double* v_gamma = NULL;
     double* v_tau = NULL;
 
-    v = out.find(spin ? "V" : "V")->second->pointer();
+    v = out[XC_V];
     if (deriv >= 1) {
-        v_rho = out.find(spin ? "V_RHO_A" : "V_RHO_B")->second->pointer();
+        v_rho = out[spin ? XC_V_RHO_A : XC_V_RHO_B];
         if (gga_) {
-            v_gamma = out.find(spin ? "V_GAMMA_AA" : "V_GAMMA_BB")->second->pointer();
+            v_gamma = out[spin ? XC_V_GAMMA_AA : XC_V_GAMMA_BB];
         }
         if (meta_) {
-            v_tau = out.find(spin ? "V_TAU_A" : "V_TAU_B")->second->pointer();
+            v_tau = out[spin ? XC_V_TAU_A : XC_V_TAU_B];
         }
     }
 
@@ -113,9 +113,9 @@ public:
 
     // => Computers <= //
 
-    virtual void compute_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha);
+    virtual void compute_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha);
 
-    void compute_sigma_functional(const std::map<std::string,SharedVector>& in, const std::map<std::string,SharedVector>& out, int npoints, int deriv, double alpha, bool spin);
+    void compute_sigma_functional(double* const* in, double* const* out, int npoints, int deriv, double alpha, bool spin);
 };
 
 }
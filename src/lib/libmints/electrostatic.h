@@ -77,6 +77,9 @@ public:
     /// Does the method provide first derivatives?
     bool has_deriv1() { return false; }
 
+    /// PotentialInt::clone() would not reproduce this class
+    virtual bool cloneable() { return false; }
+
     static SharedVector nuclear_contribution(boost::shared_ptr<Molecule> mol);
 };
 
@@ -69,6 +69,13 @@ KineticInt::~KineticInt()
     delete[] buffer_;
 }
 
+OneBodyAOInt* KineticInt::clone()
+{
+    KineticInt* ints = new KineticInt(spherical_transforms_, bs1_, bs2_, deriv_);
+    ints->set_force_cartesian(force_cartesian_);
+    return ints;
+}
+
 // The engine only supports segmented basis sets
 void KineticInt::compute_pair(const GaussianShell& s1, const GaussianShell& s2)
 {
@@ -64,6 +64,10 @@ public:
     //! Virtual destructor.
     virtual ~KineticInt();
 
+    /// Clones share the basis sets and transforms, but own their buffers
+    virtual bool cloneable() { return true; }
+    virtual OneBodyAOInt* clone();
+
     /// Does the method provide first derivatives?
     bool has_deriv1() { return true; }
 
@@ -34,6 +34,8 @@
 #include <sstream>
 #include <utility>
 #include <fstream>
+#include <cstring>
+#include <algorithm>
 #include <psifiles.h>
 #include <libpsio/psio.hpp>
 #include <libiwl/iwl.hpp>
@@ -46,6 +48,9 @@
 
 #include <boost/tuple/tuple.hpp>
 #include <boost/tuple/tuple_comparison.hpp>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace boost;
 using namespace psi;
@@ -1031,12 +1036,271 @@ public:
     }
 };
 
+/*
+ * Atom-pair multipoles for the far field of grid ESPs and fields.
+ *
+ * The share of the density on all shell pairs of atoms (A,B) is expanded
+ * through the quadrupole about the midpoint C of A and B. A grid point g at
+ * R = g - C uses the expansion when it is outside the pair's charge cloud and
+ * the estimated error of the pair is below ESP_FARFIELD_TOLERANCE divided by
+ * the number of atom pairs, so that the errors of all pairs at a point add up
+ * to at most the tolerance. The estimates come from the actual octupole
+ * moments O of the pair (the first neglected term, doubled for the rest of
+ * the series): 5 sum|O| / R^4 for the potential and 35 sum|O| / R^5 for each
+ * field component. Every other atom pair gets exact integrals over its shell
+ * pairs, so a zero tolerance (the default) reproduces the exact result.
+ * Summing the shell pairs per atom pair leaves natom^2/2 far-field terms
+ * per point instead of nshell^2/2 integrals.
+ */
+class AtomPairMultipoles {
+public:
+    struct Pair {
+        int A, B;
+        // The shell pairs (M,N), M >= N, of the two atoms
+        std::vector<std::pair<int, int> > shells;
+        double C[3];
+        // Moments of rho = sum_mn D_mn phi_m phi_n about C: charge, dipole, second moments xx xy xz yy yz zz
+        double q;
+        double mu[3];
+        double Q[6];
+        // The expansion is used only beyond this distance
+        double R_near;
+        // sum_abc |O_abc|, O the third moments about C
+        double O;
+    };
+private:
+    std::vector<Pair> pairs_;
+    double tol_;
+    // The share of the tolerance of each atom pair
+    double pair_tol_;
+
+    // Outside the cloud, and far enough that the series converges quickly
+    bool outside(const Pair& pair, double R2) const
+    {
+        return tol_ > 0.0 && R2 > 4.0 * pair.R_near * pair.R_near;
+    }
+public:
+    AtomPairMultipoles(boost::shared_ptr<BasisSet> basis, boost::shared_ptr<IntegralFactory> factory,
+                       SharedMatrix D, double tol) : tol_(tol)
+    {
+        int nbf = basis->nbf();
+        int natom = basis->molecule()->natom();
+        SharedMatrix S(new Matrix("S", nbf, nbf));
+        std::vector<SharedMatrix> moments;
+        boost::shared_ptr<OneBodyAOInt> Sint(factory->ao_overlap());
+        Sint->compute(S);
+        if (tol_ > 0.0) {
+            for (int k = 0; k < 19; k++)
+                moments.push_back(SharedMatrix(new Matrix("Multipoles", nbf, nbf)));
+            boost::shared_ptr<OneBodyAOInt> Mint(factory->ao_multipoles(3));
+            Mint->compute(moments);
+        }
+
+        // Cartesian indices of the dipole, second and third moment components
+        // in the order of MultipoleInt: lx = l - ii, lz = 0..ii, ly = ii - lz
+        std::vector<std::vector<int> > comps;
+        for (int l = 1; l <= 3; l++) {
+            for (int ii = 0; ii <= l; ii++) {
+                for (int lz = 0; lz <= ii; lz++) {
+                    std::vector<int> c;
+                    for (int k = 0; k < l - ii; k++) c.push_back(0);
+                    for (int k = 0; k < ii - lz; k++) c.push_back(1);
+                    for (int k = 0; k < lz; k++) c.push_back(2);
+                    comps.push_back(c);
+                }
+            }
+        }
+
+        double** Dp = D->pointer();
+        double** Sp = S->pointer();
+        double lntol = (tol_ > 0.0 ? -log(tol_) : 0.0);
+
+        std::vector<int> index(natom * natom, -1);
+        for (int M = 0; M < basis->nshell(); M++) {
+            for (int N = 0; N <= M; N++) {
+                int A = std::max(basis->shell(M).ncenter(), basis->shell(N).ncenter());
+                int B = std::min(basis->shell(M).ncenter(), basis->shell(N).ncenter());
+                if (index[A * natom + B] < 0) {
+                    index[A * natom + B] = pairs_.size();
+                    Pair pair;
+                    pair.A = A;
+                    pair.B = B;
+                    pair.R_near = 0.0;
+                    pairs_.push_back(pair);
+                }
+                pairs_[index[A * natom + B]].shells.push_back(std::make_pair(M, N));
+            }
+        }
+
+        for (size_t P = 0; P < pairs_.size(); P++) {
+            Pair& pair = pairs_[P];
+            Vector3 xA = basis->molecule()->xyz(pair.A);
+            Vector3 xB = basis->molecule()->xyz(pair.B);
+            for (int k = 0; k < 3; k++) pair.C[k] = 0.5 * (xA[k] + xB[k]);
+            double AB = xA.distance(xB);
+
+            // Raw moments about the origin; the multipole integrals carry the electron's -1
+            double q = 0.0;
+            double d[3] = {0.0, 0.0, 0.0};
+            double m2[3][3], m3[3][3][3];
+            ::memset(m2, 0, sizeof(m2));
+            ::memset(m3, 0, sizeof(m3));
+            for (size_t MN = 0; MN < pair.shells.size(); MN++) {
+                const GaussianShell& sM = basis->shell(pair.shells[MN].first);
+                const GaussianShell& sN = basis->shell(pair.shells[MN].second);
+
+                // The most diffuse primitive product sets the size of the cloud
+                double aM = sM.exp(0);
+                double aN = sN.exp(0);
+                for (int p = 1; p < sM.nprimitive(); p++) aM = std::min(aM, sM.exp(p));
+                for (int p = 1; p < sN.nprimitive(); p++) aN = std::min(aN, sN.exp(p));
+                pair.R_near = std::max(pair.R_near, 0.5 * AB + sqrt(lntol / (aM + aN)));
+
+                double perm = (pair.shells[MN].first == pair.shells[MN].second ? 1.0 : 2.0);
+                int oM = sM.function_index();
+                int oN = sN.function_index();
+                for (int m = oM; m < oM + sM.nfunction(); m++) {
+                    for (int n = oN; n < oN + sN.nfunction(); n++) {
+                        double Dmn = perm * Dp[m][n];
+                        q += Dmn * Sp[m][n];
+                        if (tol_ <= 0.0) continue;
+                        for (size_t k = 0; k < comps.size(); k++) {
+                            double v = -Dmn * moments[k]->get(0, m, n);
+                            const std::vector<int>& c = comps[k];
+                            if (c.size() == 1) {
+                                d[c[0]] += v;
+                            } else if (c.size() == 2) {
+                                m2[c[0]][c[1]] += v;
+                                if (c[0] != c[1]) m2[c[1]][c[0]] += v;
+                            } else {
+                                // All distinct orderings of the three indices
+                                int perms[6][3] = {{0,1,2},{0,2,1},{1,0,2},{1,2,0},{2,0,1},{2,1,0}};
+                                bool seen[3][3][3];
+                                ::memset(seen, 0, sizeof(seen));
+                                for (int t = 0; t < 6; t++) {
+                                    int a = c[perms[t][0]], b = c[perms[t][1]], e = c[perms[t][2]];
+                                    if (seen[a][b][e]) continue;
+                                    seen[a][b][e] = true;
+                                    m3[a][b][e] += v;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Shift to C
+            const double* C = pair.C;
+            pair.q = q;
+            for (int k = 0; k < 3; k++)
+                pair.mu[k] = d[k] - q * C[k];
+            int kk = 0;
+            for (int a = 0; a < 3; a++) {
+                for (int b = a; b < 3; b++, kk++) {
+                    pair.Q[kk] = m2[a][b] - C[a] * d[b] - d[a] * C[b] + q * C[a] * C[b];
+                }
+            }
+            double O = 0.0;
+            for (int a = 0; a < 3; a++) {
+                for (int b = 0; b < 3; b++) {
+                    for (int e = 0; e < 3; e++) {
+                        double Oabe = m3[a][b][e]
+                            - C[a] * m2[b][e] - C[b] * m2[a][e] - C[e] * m2[a][b]
+                            + C[a] * C[b] * d[e] + C[a] * C[e] * d[b] + C[b] * C[e] * d[a]
+                            - q * C[a] * C[b] * C[e];
+                        O += fabs(Oabe);
+                    }
+                }
+            }
+            pair.O = O;
+        }
+        pair_tol_ = (pairs_.size() ? tol_ / pairs_.size() : 0.0);
+    }
+
+    const std::vector<Pair>& pairs() const { return pairs_; }
+
+    /// Whether the potential at g, at R = g - C with |R|^2 = R2, may use the expansion of pair
+    bool far_potential(const Pair& pair, double R2) const
+    {
+        if (!outside(pair, R2)) return false;
+        // |sum_abc O_abc d_abc(1/R)| / 3! <= 15/6 sum |O_abc| / R^4, doubled for the tail
+        return 5.0 * pair.O < pair_tol_ * R2 * R2;
+    }
+
+    /// Whether the field at g may use the expansion of pair
+    bool far_field(const Pair& pair, double R2) const
+    {
+        if (!outside(pair, R2)) return false;
+        // Each component of d_abcd(1/R) / 3! is at most 105/6 / R^5, doubled for the tail
+        return 35.0 * pair.O < pair_tol_ * R2 * R2 * sqrt(R2);
+    }
+
+    /// Phi = int rho(r) / |r - g|, the electronic ESP is -Phi
+    static double potential(const Pair& p, const double R[3], double R2)
+    {
+        double R1 = sqrt(R2);
+        double iR2 = 1.0 / R2;
+        double iR1 = 1.0 / R1;
+        double iR3 = iR1 * iR2;
+        double muR = p.mu[0] * R[0] + p.mu[1] * R[1] + p.mu[2] * R[2];
+        double RQR = p.Q[0] * R[0] * R[0] + p.Q[3] * R[1] * R[1] + p.Q[5] * R[2] * R[2] +
+                     2.0 * (p.Q[1] * R[0] * R[1] + p.Q[2] * R[0] * R[2] + p.Q[4] * R[1] * R[2]);
+        double trQ = p.Q[0] + p.Q[3] + p.Q[5];
+        return p.q * iR1 + muR * iR3 + 0.5 * (3.0 * RQR - R2 * trQ) * iR3 * iR2;
+    }
+
+    /// grad_g Phi, the electronic field
+    static void field(const Pair& p, const double R[3], double R2, double E[3])
+    {
+        double R1 = sqrt(R2);
+        double iR2 = 1.0 / R2;
+        double iR3 = iR2 / R1;
+        double iR5 = iR3 * iR2;
+        double iR7 = iR5 * iR2;
+        double muR = p.mu[0] * R[0] + p.mu[1] * R[1] + p.mu[2] * R[2];
+        double QR[3];
+        QR[0] = p.Q[0] * R[0] + p.Q[1] * R[1] + p.Q[2] * R[2];
+        QR[1] = p.Q[1] * R[0] + p.Q[3] * R[1] + p.Q[4] * R[2];
+        QR[2] = p.Q[2] * R[0] + p.Q[4] * R[1] + p.Q[5] * R[2];
+        double RQR = R[0] * QR[0] + R[1] * QR[1] + R[2] * QR[2];
+        double trQ = p.Q[0] + p.Q[3] + p.Q[5];
+        double num = 3.0 * RQR - R2 * trQ;
+        for (int k = 0; k < 3; k++) {
+            E[k] = -p.q * R[k] * iR3
+                 + p.mu[k] * iR3 - 3.0 * muR * R[k] * iR5
+                 + 0.5 * (6.0 * QR[k] - 2.0 * trQ * R[k]) * iR5 - 2.5 * num * R[k] * iR7;
+        }
+    }
+};
+
+/// Report the share of atom-pair terms taken from the far field
+static void print_farfield(const std::string& what, long int nfar, long int nterms)
+{
+    double frac = (nterms ? static_cast<double>(nfar) / nterms : 0.0);
+    outfile->Printf("  Far-field atom pairs for the %s: %ld of %ld (%5.1f%%)\n", what.c_str(), nfar, nterms, 100.0 * frac);
+    /*- Process::environment.globals["GRID ESP FARFIELD FRACTION"] -*/
+    /*- Process::environment.globals["GRID FIELD FARFIELD FRACTION"] -*/
+    Process::environment.globals["GRID " + what + " FARFIELD FRACTION"] = frac;
+}
+
+/// The grid.dat points, in bohr
+static std::vector<Vector3> read_grid(boost::shared_ptr<Molecule> mol)
+{
+    std::vector<Vector3> points;
+    GridIterator griditer("grid.dat");
+    for(griditer.first(); !griditer.last(); griditer.next()){
+        Vector3 origin(griditer.gridpoints());
+        if(mol->units() == Molecule::Angstrom)
+            origin /= pc_bohr2angstroms;
+        points.push_back(origin);
+    }
+    return points;
+}
+
 void OEProp::compute_esp_over_grid()
 {
     boost::shared_ptr<Molecule> mol = basisset_->molecule();
 
-    boost::shared_ptr<ElectrostaticInt> epot(dynamic_cast<ElectrostaticInt*>(integral_->electrostatic()));
-
     outfile->Printf( "\n Electrostatic potential computed on the grid and written to grid_esp.dat\n");
 
     SharedMatrix Dtot = wfn_->D_subset_helper(Da_so_, Ca_so_, "AO");
@@ -1045,22 +1309,61 @@ void OEProp::compute_esp_over_grid()
     }else{
         Dtot->add(wfn_->D_subset_helper(Db_so_, Cb_so_, "AO"));
     }
+    double** Dp = Dtot->pointer();
 
-    int nbf = basisset_->nbf();
-    SharedMatrix ints(new Matrix("Ex integrals", nbf, nbf));
+    double tol = Process::environment.options.get_double("ESP_FARFIELD_TOLERANCE");
+    AtomPairMultipoles multipoles(basisset_, integral_, Dtot, tol);
+    const std::vector<AtomPairMultipoles::Pair>& pairs = multipoles.pairs();
+
+    int nthread = 1;
+#ifdef _OPENMP
+    nthread = omp_get_max_threads();
+#endif
+    std::vector<boost::shared_ptr<ElectrostaticInt> > epots;
+    for (int t = 0; t < nthread; t++)
+        epots.push_back(boost::shared_ptr<ElectrostaticInt>(dynamic_cast<ElectrostaticInt*>(integral_->electrostatic())));
+
+    std::vector<Vector3> points = read_grid(mol);
+    long int npoints = points.size();
+    Vvals_.assign(npoints, 0.0);
+
+    long int nfar = 0;
+    #pragma omp parallel for schedule(dynamic, 16) num_threads(nthread) reduction(+:nfar)
+    for (long int P = 0; P < npoints; P++) {
+        int thread = 0;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+#endif
+        const Vector3& origin = points[P];
+        const double* buffer = epots[thread]->buffer();
+
+        double Velec = 0.0;
+        for (size_t AB = 0; AB < pairs.size(); AB++) {
+            const AtomPairMultipoles::Pair& pair = pairs[AB];
+            double R[3] = {origin[0] - pair.C[0], origin[1] - pair.C[1], origin[2] - pair.C[2]};
+            double R2 = R[0] * R[0] + R[1] * R[1] + R[2] * R[2];
+            if (multipoles.far_potential(pair, R2)) {
+                Velec -= AtomPairMultipoles::potential(pair, R, R2);
+                nfar++;
+                continue;
+            }
+            for (size_t MN = 0; MN < pair.shells.size(); MN++) {
+                int M = pair.shells[MN].first;
+                int N = pair.shells[MN].second;
+                epots[thread]->compute_shell(M, N, origin);
+                const GaussianShell& sM = basisset_->shell(M);
+                const GaussianShell& sN = basisset_->shell(N);
+                double perm = (M == N ? 1.0 : 2.0);
+                int oM = sM.function_index();
+                int oN = sN.function_index();
+                int nM = sM.nfunction();
+                int nN = sN.nfunction();
+                for (int m = 0; m < nM; m++)
+                    for (int n = 0; n < nN; n++)
+                        Velec += perm * Dp[oM + m][oN + n] * buffer[m * nN + n];
+            }
+        }
 
-    Vvals_.clear();
-    FILE *gridout = fopen("grid_esp.dat", "w");
-    if(!gridout)
-        throw PSIEXCEPTION("Unable to write to grid_esp.dat");
-    GridIterator griditer("grid.dat");
-    for(griditer.first(); !griditer.last(); griditer.next()){
-        Vector3 origin(griditer.gridpoints());
-        if(mol->units() == Molecule::Angstrom)
-            origin /= pc_bohr2angstroms;
-        ints->zero();
-        epot->compute(ints, origin);
-        double Velec = Dtot->vector_dot(ints);
         double Vnuc = 0.0;
         int natom = mol->natom();
         for(int i=0; i < natom; i++) {
@@ -1069,9 +1372,16 @@ void OEProp::compute_esp_over_grid()
             if(r > 1.0E-8)
                 Vnuc += mol->Z(i)/r;
         }
-        Vvals_.push_back(Velec+Vnuc);
-        fprintf(gridout, "%16.10f\n", Velec+Vnuc);
+        Vvals_[P] = Velec + Vnuc;
     }
+
+    print_farfield("ESP", nfar, npoints * static_cast<long int>(pairs.size()));
+
+    FILE *gridout = fopen("grid_esp.dat", "w");
+    if(!gridout)
+        throw PSIEXCEPTION("Unable to write to grid_esp.dat");
+    for (long int P = 0; P < npoints; P++)
+        fprintf(gridout, "%16.10f\n", Vvals_[P]);
     fclose(gridout);
 }
 
@@ -1080,8 +1390,6 @@ void OEProp::compute_field_over_grid()
 {
     boost::shared_ptr<Molecule> mol = basisset_->molecule();
 
-    boost::shared_ptr<ElectrostaticInt> epot(dynamic_cast<ElectrostaticInt*>(integral_->electrostatic()));
-
     outfile->Printf( "\n Field computed on the grid and written to grid_field.dat\n");
 
     SharedMatrix Dtot = wfn_->D_subset_helper(Da_so_, Ca_so_, "AO");
@@ -1090,40 +1398,80 @@ void OEProp::compute_field_over_grid()
     }else{
         Dtot->add(wfn_->D_subset_helper(Db_so_, Cb_so_, "AO"));
     }
+    double** Dp = Dtot->pointer();
 
-    boost::shared_ptr<ElectricFieldInt> field_ints(dynamic_cast<ElectricFieldInt*>(wfn_->integral()->electric_field()));
+    double tol = Process::environment.options.get_double("ESP_FARFIELD_TOLERANCE");
+    AtomPairMultipoles multipoles(basisset_, integral_, Dtot, tol);
+    const std::vector<AtomPairMultipoles::Pair>& pairs = multipoles.pairs();
 
-    int nbf = basisset_->nbf();
-    std::vector<SharedMatrix> intmats;
-    intmats.push_back(SharedMatrix(new Matrix("Ex integrals", nbf, nbf)));
-    intmats.push_back(SharedMatrix(new Matrix("Ey integrals", nbf, nbf)));
-    intmats.push_back(SharedMatrix(new Matrix("Ez integrals", nbf, nbf)));
+    int nthread = 1;
+#ifdef _OPENMP
+    nthread = omp_get_max_threads();
+#endif
+    std::vector<boost::shared_ptr<ElectricFieldInt> > field_ints;
+    for (int t = 0; t < nthread; t++)
+        field_ints.push_back(boost::shared_ptr<ElectricFieldInt>(dynamic_cast<ElectricFieldInt*>(wfn_->integral()->electric_field())));
+
+    std::vector<Vector3> points = read_grid(mol);
+    long int npoints = points.size();
+    Exvals_.assign(npoints, 0.0);
+    Eyvals_.assign(npoints, 0.0);
+    Ezvals_.assign(npoints, 0.0);
+
+    long int nfar = 0;
+    #pragma omp parallel for schedule(dynamic, 16) num_threads(nthread) reduction(+:nfar)
+    for (long int P = 0; P < npoints; P++) {
+        int thread = 0;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+#endif
+        const Vector3& origin = points[P];
+        field_ints[thread]->set_origin(origin);
+        const double* buffer = field_ints[thread]->buffer();
+
+        double E[3] = {0.0, 0.0, 0.0};
+        for (size_t AB = 0; AB < pairs.size(); AB++) {
+            const AtomPairMultipoles::Pair& pair = pairs[AB];
+            double R[3] = {origin[0] - pair.C[0], origin[1] - pair.C[1], origin[2] - pair.C[2]};
+            double R2 = R[0] * R[0] + R[1] * R[1] + R[2] * R[2];
+            if (multipoles.far_field(pair, R2)) {
+                double Epair[3];
+                AtomPairMultipoles::field(pair, R, R2, Epair);
+                for (int k = 0; k < 3; k++) E[k] += Epair[k];
+                nfar++;
+                continue;
+            }
+            for (size_t MN = 0; MN < pair.shells.size(); MN++) {
+                int M = pair.shells[MN].first;
+                int N = pair.shells[MN].second;
+                field_ints[thread]->compute_shell(M, N);
+                const GaussianShell& sM = basisset_->shell(M);
+                const GaussianShell& sN = basisset_->shell(N);
+                double perm = (M == N ? 1.0 : 2.0);
+                int oM = sM.function_index();
+                int oN = sN.function_index();
+                int nM = sM.nfunction();
+                int nN = sN.nfunction();
+                for (int k = 0; k < 3; k++)
+                    for (int m = 0; m < nM; m++)
+                        for (int n = 0; n < nN; n++)
+                            E[k] += perm * Dp[oM + m][oN + n] * buffer[(k * nM + m) * nN + n];
+            }
+        }
 
-    Exvals_.clear();
-    Eyvals_.clear();
-    Ezvals_.clear();
+        Vector3 nuc = ElectricFieldInt::nuclear_contribution(origin, mol);
+        Exvals_[P] = E[0] + nuc[0];
+        Eyvals_[P] = E[1] + nuc[1];
+        Ezvals_[P] = E[2] + nuc[2];
+    }
+
+    print_farfield("FIELD", nfar, npoints * static_cast<long int>(pairs.size()));
 
     FILE *gridout = fopen("grid_field.dat", "w");
     if(!gridout)
         throw PSIEXCEPTION("Unable to write to grid_field.dat");
-    GridIterator griditer("grid.dat");
-    for(griditer.first(); !griditer.last(); griditer.next()){
-        Vector3 origin(griditer.gridpoints());
-        if(mol->units() == Molecule::Angstrom)
-            origin /= pc_bohr2angstroms;
-        field_ints->set_origin(origin);
-        for (int m=0; m<3; ++m)
-            intmats[m]->zero();
-        field_ints->compute(intmats);
-        double Ex = Dtot->vector_dot(intmats[0]);
-        double Ey = Dtot->vector_dot(intmats[1]);
-        double Ez = Dtot->vector_dot(intmats[2]);
-        Vector3 nuc = field_ints->nuclear_contribution(origin, mol);
-        Exvals_.push_back(Ex+nuc[0]);
-        Eyvals_.push_back(Ey+nuc[1]);
-        Ezvals_.push_back(Ez+nuc[2]);
-        fprintf(gridout, "%16.10f %16.10f %16.10f\n", Ex+nuc[0], Ey+nuc[1], Ez+nuc[2]);
-    }
+    for (long int P = 0; P < npoints; P++)
+        fprintf(gridout, "%16.10f %16.10f %16.10f\n", Exvals_[P], Eyvals_[P], Ezvals_[P]);
     fclose(gridout);
 }
 
@@ -32,6 +32,9 @@
 
 #include "mints.h"
 #include <compiler.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace boost;
 using namespace psi;
@@ -276,31 +279,58 @@ void OneBodyAOInt::compute(SharedMatrix& result)
     int ns1 = bs1_->nshell();
     int ns2 = bs2_->nshell();
 
-    int i_offset=0;
-    double *location;
+    std::vector<int> i_offsets(ns1 + 1, 0);
+    std::vector<int> j_offsets(ns2 + 1, 0);
+    for (int i=0; i<ns1; ++i)
+        i_offsets[i+1] = i_offsets[i] + (force_cartesian_ ? bs1_->shell(i).ncartesian() : bs1_->shell(i).nfunction());
+    for (int j=0; j<ns2; ++j)
+        j_offsets[j+1] = j_offsets[j] + (force_cartesian_ ? bs2_->shell(j).ncartesian() : bs2_->shell(j).nfunction());
+
+    // Rows of shells go to threads; thread 0 uses this object, the others
+    // clones of it. Objects that cannot be cloned, or calls from inside a
+    // parallel region, stay on one thread.
+    int nthread = 1;
+#ifdef _OPENMP
+    if (!omp_in_parallel() && cloneable())
+        nthread = omp_get_max_threads();
+#endif
+    std::vector<boost::shared_ptr<OneBodyAOInt> > clones;
+    std::vector<OneBodyAOInt*> ints(1, this);
+    for (int t=1; t<nthread; ++t) {
+        clones.push_back(boost::shared_ptr<OneBodyAOInt>(clone()));
+        ints.push_back(clones.back().get());
+    }
+
+    double** Rp = result->pointer();
 
     // Leave as this full double for loop. We could be computing nonsymmetric integrals
+    #pragma omp parallel for schedule(dynamic) num_threads(nthread)
     for (int i=0; i<ns1; ++i) {
-        int ni = force_cartesian_ ? bs1_->shell(i).ncartesian() : bs1_->shell(i).nfunction();
-        int j_offset=0;
+
+        int thread = 0;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+#endif
+        OneBodyAOInt* engine = ints[thread];
+
+        int i_offset = i_offsets[i];
+        int ni = i_offsets[i+1] - i_offset;
         for (int j=0; j<ns2; ++j) {
-            int nj = force_cartesian_ ? bs2_->shell(j).ncartesian() : bs2_->shell(j).nfunction();
+            int j_offset = j_offsets[j];
+            int nj = j_offsets[j+1] - j_offset;
 
             // Compute the shell (automatically transforms to pure am in needed)
-            compute_shell(i, j);
+            engine->compute_shell(i, j);
 
             // For each integral that we got put in its contribution
-            location = buffer_;
+            const double* location = engine->buffer_;
             for (int p=0; p<ni; ++p) {
                 for (int q=0; q<nj; ++q) {
-                    result->add(0, i_offset+p, j_offset+q, *location);
+                    Rp[i_offset+p][j_offset+q] += *location;
                     location++;
                 }
             }
-
-            j_offset += nj;
         }
-        i_offset += ni;
     }
 }
 
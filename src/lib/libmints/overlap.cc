@@ -70,6 +70,13 @@ OverlapInt::~OverlapInt()
     delete[] buffer_;
 }
 
+OneBodyAOInt* OverlapInt::clone()
+{
+    OverlapInt* ints = new OverlapInt(spherical_transforms_, bs1_, bs2_, deriv_);
+    ints->set_force_cartesian(force_cartesian_);
+    return ints;
+}
+
 // The engine only supports segmented basis sets
 void OverlapInt::compute_pair(const GaussianShell& s1, const GaussianShell& s2)
 {
@@ -61,6 +61,10 @@ public:
     OverlapInt(std::vector<SphericalTransform>&, boost::shared_ptr<BasisSet>, boost::shared_ptr<BasisSet>, int deriv=0);
     virtual ~OverlapInt();
 
+    /// Clones share the basis sets and transforms, but own their buffers
+    virtual bool cloneable() { return true; }
+    virtual OneBodyAOInt* clone();
+
     /// Does the method provide first derivatives?
     bool has_deriv1() { return true; }
     /// Does the method provide second derivatives?
@@ -26,6 +26,7 @@
  */
 
 #include <libciomr/libciomr.h>
+#include <psi4-dec.h>
 
 #include "mints.h"
 #include "cdsalclist.h"
@@ -40,6 +41,35 @@
 using namespace boost;
 using namespace psi;
 
+namespace {
+
+/*
+ * Upper bound on |int x_A^l1 y_A^m1 z_A^n1 x_B^l2 y_B^m2 z_B^n2 exp(-gamma r_P^2) / |r - C| dr|
+ * over all C and all components with l1+m1+n1 = L1 and l2+m2+n2 = L2.  Each
+ * monomial is at most |r - A|^L1 |r - B|^L2 <= (s + PA)^L1 (s + PB)^L2, s = |r - P|,
+ * and the potential of a spherical density is largest at its centre, so the
+ * bound is 4 pi int_0^inf s (s + PA)^L1 (s + PB)^L2 exp(-gamma s^2) ds.  For
+ * L1 = L2 = 0 this is the exact 2 pi / gamma at C = P.
+ */
+double attraction_bound(double PA, double PB, int L1, int L2, double gamma)
+{
+    double bound = 0.0;
+    double bc1 = 1.0;
+    for (int i = 0; i <= L1; i++) {
+        double bc2 = 1.0;
+        for (int j = 0; j <= L2; j++) {
+            // int_0^inf s^(k+1) exp(-gamma s^2) ds = Gamma(k/2 + 1) / (2 gamma^(k/2 + 1))
+            double k1 = 0.5 * (i + j) + 1.0;
+            bound += bc1 * bc2 * pow(PA, L1 - i) * pow(PB, L2 - j) * tgamma(k1) / (2.0 * pow(gamma, k1));
+            bc2 = bc2 * (L2 - j) / (j + 1);
+        }
+        bc1 = bc1 * (L1 - i) / (i + 1);
+    }
+    return 4.0 * M_PI * bound;
+}
+
+}
+
 // Initialize potential_recur_ to +1 basis set angular momentum
 PotentialInt::PotentialInt(std::vector<SphericalTransform>& st, boost::shared_ptr<BasisSet> bs1, boost::shared_ptr<BasisSet> bs2, int deriv) :
     OneBodyAOInt(st, bs1, bs2, deriv)
@@ -85,6 +115,8 @@ PotentialInt::PotentialInt(std::vector<SphericalTransform>& st, boost::shared_pt
         Zxyzp[A][2] = bs1_->molecule()->y(A);
         Zxyzp[A][3] = bs1_->molecule()->z(A);
     }
+
+    screen_cutoff_ = Process::environment.options.get_double("POTENTIAL_INTS_TOLERANCE");
 }
 
 PotentialInt::~PotentialInt()
@@ -93,6 +125,15 @@ PotentialInt::~PotentialInt()
     delete potential_recur_;
 }
 
+OneBodyAOInt* PotentialInt::clone()
+{
+    PotentialInt* ints = new PotentialInt(spherical_transforms_, bs1_, bs2_, deriv_);
+    ints->set_force_cartesian(force_cartesian_);
+    ints->set_charge_field(Zxyz_);
+    ints->set_screening_threshold(screen_cutoff_);
+    return ints;
+}
+
 // The engine only supports segmented basis sets
 void PotentialInt::compute_pair(const GaussianShell& s1,
                                 const GaussianShell& s2)
@@ -130,6 +171,13 @@ void PotentialInt::compute_pair(const GaussianShell& s1,
     double** Zxyzp = Zxyz_->pointer();
     int ncharge = Zxyz_->rowspi()[0];
 
+    // Screening: the charge sum is at most sum_C |Z_C| times the bound of
+    // attraction_bound() on every component of one primitive product.
+    // Distant shell pairs then skip the O(ncharge) loop entirely.
+    double Zsum = 0.0;
+    for (int atom=0; atom<ncharge; ++atom)
+        Zsum += fabs(Zxyzp[atom][0]);
+
     for (int p1=0; p1<nprim1; ++p1) {
         double a1 = s1.exp(p1);
         double c1 = s1.coef(p1);
@@ -154,6 +202,14 @@ void PotentialInt::compute_pair(const GaussianShell& s1,
 
             double over_pf = exp(-a1*a2*AB2*oog) * sqrt(M_PI*oog) * M_PI * oog * c1 * c2;
 
+            if (screen_cutoff_ > 0.0) {
+                double PAn = sqrt(PA[0]*PA[0] + PA[1]*PA[1] + PA[2]*PA[2]);
+                double PBn = sqrt(PB[0]*PB[0] + PB[1]*PB[1] + PB[2]*PB[2]);
+                double K = fabs(c1 * c2) * exp(-a1*a2*AB2*oog);
+                if (K * Zsum * attraction_bound(PAn, PBn, am1, am2, gamma) < screen_cutoff_)
+                    continue;
+            }
+
             // Loop over atoms of basis set 1 (only works if bs1_ and bs2_ are on the same
             // molecule)
             for (int atom=0; atom<ncharge; ++atom) {
@@ -66,6 +66,9 @@ protected:
     /// Matrix of coordinates/charges of partial charges
     SharedMatrix Zxyz_;
 
+    /// Screening threshold for primitive pairs in compute_pair
+    double screen_cutoff_;
+
 public:
     /// Constructor. Assumes nuclear centers/charges as the potential
     PotentialInt(std::vector<SphericalTransform>&, boost::shared_ptr<BasisSet>, boost::shared_ptr<BasisSet>, int deriv=0);
@@ -89,6 +92,13 @@ public:
     /// Get the field of charges
     SharedMatrix charge_field() const { return Zxyz_; }
 
+    /// Primitive pairs whose bound on |V| falls below this are skipped, defaults to POTENTIAL_INTS_TOLERANCE
+    void set_screening_threshold(double cutoff) { screen_cutoff_ = cutoff; }
+
+    /// Clones share the basis sets, transforms and charge field
+    virtual bool cloneable() { return true; }
+    virtual OneBodyAOInt* clone();
+
     /// Does the method provide first derivatives?
     bool has_deriv1() { return true; }
 };
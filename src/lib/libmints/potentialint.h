@@ -60,6 +60,8 @@ class PCMPotentialInt : public PotentialInt
 {
 public:
     PCMPotentialInt(std::vector<SphericalTransform>&, boost::shared_ptr<BasisSet>, boost::shared_ptr<BasisSet>, int deriv=0);
+    /// PotentialInt::clone() would not reproduce this class
+    virtual bool cloneable() { return false; }
     /// Drives the loops over all shell pairs, to compute integrals
     template<typename PCMPotentialIntFunctor>
     void compute(PCMPotentialIntFunctor &functor);
@@ -332,6 +332,31 @@ bool ERISieve::shell_significant_qqr(int M, int N, int R, int S)
 }
 
 
+void ERISieve::set_density(const std::vector<boost::shared_ptr<Matrix> >& D)
+{
+    shell_pair_D_max_.assign(nshell_ * (unsigned long int) nshell_, 0.0);
+
+    for (size_t ind = 0; ind < D.size(); ind++) {
+        double** Dp = D[ind]->pointer();
+        for (int M = 0; M < nshell_; M++) {
+            int Msize = primary_->shell(M).nfunction();
+            int Moff = primary_->shell(M).function_index();
+            for (int N = 0; N <= M; N++) {
+                int Nsize = primary_->shell(N).nfunction();
+                int Noff = primary_->shell(N).function_index();
+                double val = shell_pair_D_max_[M * (unsigned long int) nshell_ + N];
+                for (int m = 0; m < Msize; m++) {
+                    for (int n = 0; n < Nsize; n++) {
+                        val = std::max(val, std::fabs(Dp[m + Moff][n + Noff]));
+                        val = std::max(val, std::fabs(Dp[n + Noff][m + Moff]));
+                    }
+                }
+                shell_pair_D_max_[M * (unsigned long int) nshell_ + N] = val;
+                shell_pair_D_max_[N * (unsigned long int) nshell_ + M] = val;
+            }
+        }
+    }
+}
 double ERISieve::shell_pair_value(int m, int n) const
 {
 
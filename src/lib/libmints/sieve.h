@@ -30,7 +30,9 @@
 
 // need this for erfc^{-1} in the QQR sieve
 #include <boost/math/special_functions/erf.hpp>
+#include <algorithm>
 #include <cfloat>
+#include <vector>
 
 namespace boost {
 template<class T> class shared_ptr;
@@ -39,6 +41,7 @@ template<class T> class shared_ptr;
 namespace psi {
 
 class BasisSet;
+class Matrix;
 class TwoBodyAOInt;
 
 /**
@@ -72,6 +75,13 @@ class TwoBodyAOInt;
  *     if (sieve->shell_ceiling2(M,N,R,S) * D_RS * D_RS >= sieve_cutoff * sieve_cutoff)
  *         eri->compute(M,N,R,S); 
  *
+ *     // Or let the sieve track the density shell-pair maxima itself.
+ *     // The bound uses the largest |D| over all six pairs of MNRS, so
+ *     // it is valid for both J and K contractions
+ *     sieve->set_density(D);
+ *     if (sieve->shell_significant_density(M,N,R,S)) eri->compute(M,N,R,S); 
+ *     sieve->clear_density();
+ *
  *     // Index the significant MN shell pairs (triangular M,N)
  *     const std::vector<std::pair<int,int> >& MN = sieve->shell_pairs();
  *     for (long int index = 0L; index < MN.size(); ++index) {
@@ -135,6 +145,9 @@ protected:
     std::vector<std::vector<int> > shell_to_shell_;
     /// Significant shell pairs, indexes by shell
     std::vector<std::vector<int> > function_to_function_;
+
+    /// max |D_mn| over the current densities, per shell pair (nshell * nshell), empty if none set
+    std::vector<double> shell_pair_D_max_;
   
   ///////////////////////////////////////
   // adding stuff for QQR sieves
@@ -212,6 +225,34 @@ public:
     
     // Implements the QQR sieve
     bool shell_significant_qqr(int M, int N, int R, int S);
+
+    // => Density-Weighted Significance Checks <= //
+
+    /**
+     * Set the densities used to weight the Schwarz bounds. Stores
+     * max |D_mn| over all D and over both mn and nm per shell pair.
+     * D must be in the AO basis of the primary basis (C1)
+     */
+    void set_density(const std::vector<boost::shared_ptr<Matrix> >& D);
+    /// Forget the densities, shell_significant_density reverts to pure Schwarz
+    void clear_density() { shell_pair_D_max_.clear(); }
+    /// Have densities been set?
+    bool has_density() const { return !shell_pair_D_max_.empty(); }
+    /// max |D_mn| of shell pair MN over the current densities
+    inline double shell_pair_D_max(int M, int N) const {
+        return shell_pair_D_max_[M * (unsigned long int) nshell_ + N]; }
+    /// Largest density element any contraction of (MN|RS) can pick up (J or K)
+    inline double shell_quartet_D_max(int M, int N, int R, int S) const {
+        return std::max(std::max(shell_pair_D_max(M,N), shell_pair_D_max(R,S)),
+               std::max(std::max(shell_pair_D_max(M,R), shell_pair_D_max(M,S)),
+                        std::max(shell_pair_D_max(N,R), shell_pair_D_max(N,S)))); }
+    /// Is the shell quartet (MN|RS) significant according to sieve, weighted by the density (if set)?
+    bool shell_significant_density(int M, int N, int R, int S) {
+        if (!shell_significant(M,N,R,S)) return false;
+        if (shell_pair_D_max_.empty()) return true;
+        double D = shell_quartet_D_max(M,N,R,S);
+        return shell_ceiling2(M,N,R,S) * D * D >= sieve2_;
+    }
   
     /// Is the integral (mn|rs) significant according to sieve? (no restriction on mnrs order)
     inline bool function_significant(int m, int n, int r, int s) { 
@@ -33,8 +33,11 @@
 // Handy mints timer macros, requires libqt to be included
 #ifdef MINTS_TIMER
 #   include <libqt/qt.h>
-#   define mints_timer_on(a) timer_on((a));
-#   define mints_timer_off(a) timer_off((a));
+// Each call site looks its timer up once, the first time through
+#   define mints_timer_on(a) do { static const int mints_timer_handle_ = timer_handle((a)); \
+                                  timer_on(mints_timer_handle_); } while(0)
+#   define mints_timer_off(a) do { static const int mints_timer_handle_ = timer_handle((a)); \
+                                   timer_off(mints_timer_handle_); } while(0)
 #else
 #   define mints_timer_on(a)
 #   define mints_timer_off(a)
@@ -31,8 +31,12 @@
  */
 
 #include <cstdio>
+#include <cstring>
+#include <functional>
 #include <unistd.h>
 #include <boost/shared_ptr.hpp>
+#include <boost/shared_array.hpp>
+#include <boost/bind.hpp>
 #include <boost/thread/thread.hpp>
 #include <libpsio/psio.h>
 #include <libpsio/psio.hpp>
@@ -44,454 +48,356 @@ using namespace boost;
 
 namespace psi {
 
-AIOHandler::AIOHandler(boost::shared_ptr<PSIO> psio)
-    : psio_(psio)
+AIOHandler::AIOHandler(boost::shared_ptr<PSIO> psio, int nthread)
+    : psio_(psio), nthread_(nthread < 1 ? 1 : nthread)
 {
     locked_ = new boost::mutex();
     uniqueID_ = 0;
+    staged_ = 0;
+    max_staged_ = 256L * 1024L * 1024L;
+    stop_ = false;
 }
 AIOHandler::~AIOHandler()
 {
+    {
+        boost::unique_lock<boost::mutex> lock(*locked_);
+        stop_ = true;
+        work_.notify_all();
+    }
+    for (size_t i = 0; i < threads_.size(); i++)
+        threads_[i]->join();
     delete locked_;
 }
-boost::shared_ptr<boost::thread> AIOHandler::get_thread()
+void AIOHandler::synchronize()
 {
-    return thread_;
+    boost::unique_lock<boost::mutex> lock(*locked_);
+    while (!unfinished_.empty())
+        done_.wait(lock);
+
+    if (!errors_.empty()) {
+        std::exception_ptr err = errors_.begin()->second;
+        errors_.clear();
+        std::rethrow_exception(err);
+    }
 }
-void AIOHandler::synchronize()
+void AIOHandler::wait_for_job(unsigned long jobid)
 {
-    // This join may be problematic in a multithreaded env.: while we wait for the
-    // thread to finish, other threads may add work to the queue. We'd probably need 
-    // a way to identify write jobs and check if they completed from external threads.
     boost::unique_lock<boost::mutex> lock(*locked_);
-    lock.unlock();
-    thread_->join();
+    while (unfinished_.count(jobid))
+        done_.wait(lock);
+
+    std::map<unsigned long int, std::exception_ptr>::iterator it = errors_.find(jobid);
+    if (it != errors_.end()) {
+        std::exception_ptr err = it->second;
+        errors_.erase(it);
+        std::rethrow_exception(err);
+    }
 }
-unsigned long int AIOHandler::read(unsigned int unit, const char *key, char *buffer, ULI size, psio_address start, psio_address *end)
+bool AIOHandler::job_done(unsigned long jobid)
 {
-  boost::unique_lock<boost::mutex> lock(*locked_);
+    boost::unique_lock<boost::mutex> lock(*locked_);
+    return unfinished_.count(jobid) == 0;
+}
+void AIOHandler::set_staging_memory(ULI bytes)
+{
+    boost::unique_lock<boost::mutex> lock(*locked_);
+    max_staged_ = bytes;
+}
+unsigned long int AIOHandler::submit(AIOJob *job)
+{
+    boost::unique_lock<boost::mutex> lock(*locked_);
 
-  ++uniqueID_;
-  job_.push(1);
-  unit_.push(unit);
-  key_.push(key);
-  buffer_.push(buffer);
-  size_.push(size);
-  start_.push(start);
-  end_.push(end);
-  jobID_.push_back(uniqueID_);
+    job->id = ++uniqueID_;
+    job->exclusive = true;
+    pending_.push_back(job);
+    unfinished_.insert(job->id);
 
-  if (job_.size() > 1) return uniqueID_;
+    // The pool is started lazily, so idle handlers cost no threads
+    if (threads_.empty()) {
+        for (int i = 0; i < nthread_; i++)
+            threads_.push_back(boost::shared_ptr<boost::thread>(
+                new boost::thread(boost::bind(&AIOHandler::call_aio, this))));
+    }
+    work_.notify_one();
 
-  //thread start
-  thread_ = boost::shared_ptr<boost::thread>(new boost::thread(boost::bind(&AIOHandler::call_aio,this)));
-  return uniqueID_;
+    return job->id;
 }
-unsigned long AIOHandler::write(unsigned int unit, const char *key, char *buffer, ULI size, psio_address start, psio_address *end)
+bool AIOHandler::exclusive(const AIOJob *job)
 {
-  boost::unique_lock<boost::mutex> lock(*locked_);
-
-  ++uniqueID_;
-  job_.push(2);
-  unit_.push(unit);
-  key_.push(key);
-  buffer_.push(buffer);
-  size_.push(size);
-  start_.push(start);
-  end_.push(end);
-  jobID_.push_back(uniqueID_);
+    if (job->toc) return true;
+    // Remapping a growing file would pull the memory from under other jobs
+    if (psio_->mapped(job->unit)) return true;
+    if (!job->write) return false;
+    // Writes inside the current extent of an entry leave the TOC alone
+    return !psio_->tocentry_contains(job->unit, job->key.c_str(), job->start, job->size);
+}
+bool AIOHandler::conflict(const AIOJob *a, const AIOJob *b) const
+{
+    if (a->unit != b->unit) return false;
+    if (a->exclusive || b->exclusive) return true;
+    if (!a->write && !b->write) return false;
+    if (a->key != b->key) return false;
+
+    ULI a0 = a->start.page * PSIO_PAGELEN + a->start.offset;
+    ULI b0 = b->start.page * PSIO_PAGELEN + b->start.offset;
+    return (a0 < b0 + b->size) && (b0 < a0 + a->size);
+}
+AIOHandler::AIOJob* AIOHandler::next_job()
+{
+    // Called with the lock held.  Scans the queue in order; a job may
+    // start if it conflicts with neither a running job nor an earlier
+    // pending one.
+    for (std::list<AIOJob*>::iterator it = pending_.begin(); it != pending_.end(); ++it) {
+        AIOJob *job = *it;
+        bool ok = true;
+
+        // Nothing on a unit is looked at while its TOC may be changing
+        for (std::list<AIOJob*>::iterator r = running_.begin(); ok && r != running_.end(); ++r)
+            if ((*r)->unit == job->unit && (*r)->exclusive) ok = false;
+        if (!ok) continue;
+
+        job->exclusive = exclusive(job);
+
+        for (std::list<AIOJob*>::iterator r = running_.begin(); ok && r != running_.end(); ++r)
+            if (conflict(job, *r)) ok = false;
+        for (std::list<AIOJob*>::iterator p = pending_.begin(); ok && p != it; ++p)
+            if (conflict(job, *p)) ok = false;
+
+        if (ok) {
+            pending_.erase(it);
+            return job;
+        }
+    }
+    return NULL;
+}
+void AIOHandler::call_aio()
+{
+    boost::unique_lock<boost::mutex> lock(*locked_);
 
-  //printf("Adding a write to the queue\n");
+    while (true) {
+        AIOJob *job = next_job();
+        if (job == NULL) {
+            if (stop_ && pending_.empty()) break;
+            work_.wait(lock);
+            continue;
+        }
+        running_.push_back(job);
+        lock.unlock();
 
-  // Ensures we do not already have a thread running jobs.
-  //if (thread_ == NULL) {
-  //    fprintf(stderr,"Thread is null\n");
-  //} else if (not thread_->timed_join(boost::chrono::milliseconds(0)) ) {
-  //    fprintf(stderr,"Thread is not joinable now, thus busy\n");
-  //    return;
-  //} else {
-  //    if(job_.size() > 1) {
-  //      fprintf(stderr,"%d jobs in the queue! Should NOT create thread!!\n", job_.size());
-  //    }
-  //    fprintf(stderr, "Thread is joined, need new thread\n");
-  //}
-  if (job_.size() > 1) return uniqueID_;
+        std::exception_ptr err;
+        try {
+            job->work();
+        } catch (...) {
+            err = std::current_exception();
+        }
 
-  //fprintf(stderr,"Starting a thread\n");
-  //thread start
-  thread_ = boost::shared_ptr<boost::thread>(new boost::thread(boost::bind(&AIOHandler::call_aio,this)));
-  return uniqueID_;
+        lock.lock();
+        running_.remove(job);
+        if (err) errors_[job->id] = err;
+        staged_ -= job->staged;
+        unfinished_.erase(job->id);
+        delete job;
+
+        // A finished job may unblock others on its unit, and its waiters
+        work_.notify_all();
+        done_.notify_all();
+    }
+}
+unsigned long int AIOHandler::read(unsigned int unit, const char *key, char *buffer, ULI size, psio_address start, psio_address *end)
+{
+    AIOJob *job = new AIOJob;
+    job->unit = unit;
+    job->key = key;
+    job->write = false;
+    job->toc = false;
+    job->start = start;
+    job->size = size;
+    job->staged = 0;
+    if (!end) end = &job->end;
+    job->work = boost::bind(&PSIO::read, psio_.get(), unit, job->key.c_str(), buffer, size, start, end);
+    return submit(job);
+}
+unsigned long AIOHandler::write(unsigned int unit, const char *key, char *buffer, ULI size, psio_address start, psio_address *end)
+{
+    AIOJob *job = new AIOJob;
+    job->unit = unit;
+    job->key = key;
+    job->write = true;
+    job->toc = false;
+    job->start = start;
+    job->size = size;
+    job->staged = 0;
+    if (!end) end = &job->end;
+    job->work = boost::bind(&PSIO::write, psio_.get(), unit, job->key.c_str(), buffer, size, start, end);
+    return submit(job);
 }
 unsigned long AIOHandler::read_entry(unsigned int unit, const char *key, char *buffer, ULI size)
 {
-  boost::unique_lock<boost::mutex> lock(*locked_);
-
-  ++uniqueID_;
-  job_.push(3);
-  unit_.push(unit);
-  key_.push(key);
-  buffer_.push(buffer);
-  size_.push(size);
-  jobID_.push_back(uniqueID_);
-
-  if (job_.size() > 1) return uniqueID_;
-
-  //thread start
-  thread_ = boost::shared_ptr<boost::thread>(new boost::thread(boost::bind(&AIOHandler::call_aio,this)));
-  return uniqueID_;
+    AIOJob *job = new AIOJob;
+    job->unit = unit;
+    job->key = key;
+    job->write = false;
+    job->toc = false;
+    job->start = PSIO_ZERO;
+    job->size = size;
+    job->staged = 0;
+    job->work = boost::bind(&PSIO::read_entry, psio_.get(), unit, job->key.c_str(), buffer, size);
+    return submit(job);
 }
 unsigned long AIOHandler::write_entry(unsigned int unit, const char *key, char *buffer, ULI size)
 {
-  boost::unique_lock<boost::mutex> lock(*locked_);
-
-  ++uniqueID_;
-  job_.push(4);
-  unit_.push(unit);
-  key_.push(key);
-  buffer_.push(buffer);
-  size_.push(size);
-  jobID_.push_back(uniqueID_);
-
-  if (job_.size() > 1) return uniqueID_;
+    AIOJob *job = new AIOJob;
+    job->unit = unit;
+    job->key = key;
+    job->write = true;
+    job->toc = false;
+    job->start = PSIO_ZERO;
+    job->size = size;
+    job->staged = 0;
+    job->work = boost::bind(&PSIO::write_entry, psio_.get(), unit, job->key.c_str(), buffer, size);
+    return submit(job);
+}
+unsigned long AIOHandler::write_behind(unsigned int unit, const char *key, const char *buffer,
+  ULI size, psio_address start, psio_address *end)
+{
+    {
+        // A single oversized request is let through once nothing else is staged
+        boost::unique_lock<boost::mutex> lock(*locked_);
+        while (staged_ && staged_ + size > max_staged_)
+            done_.wait(lock);
+        staged_ += size;
+    }
 
-  //thread start
-  thread_ = boost::shared_ptr<boost::thread>(new boost::thread(boost::bind(&AIOHandler::call_aio,this)));
-  return uniqueID_;
+    char *copy = new char[size];
+    ::memcpy(copy, buffer, size);
+
+    AIOJob *job = new AIOJob;
+    job->unit = unit;
+    job->key = key;
+    job->write = true;
+    job->toc = false;
+    job->start = start;
+    job->size = size;
+    job->staged = size;
+    if (!end) end = &job->end;
+    job->work = boost::bind(&AIOHandler::do_write_behind, this, unit, job->key.c_str(), copy, size, start, end);
+    return submit(job);
 }
 unsigned long AIOHandler::read_discont(unsigned int unit, const char *key,
   double **matrix, ULI row_length, ULI col_length, ULI col_skip,
   psio_address start)
 {
-  boost::unique_lock<boost::mutex> lock(*locked_);
-
-  ++uniqueID_;
-  job_.push(5);
-  unit_.push(unit);
-  key_.push(key);
-  matrix_.push(matrix);
-  row_length_.push(row_length);
-  col_length_.push(col_length);
-  col_skip_.push(col_skip);
-  start_.push(start);
-  jobID_.push_back(uniqueID_);
-
-  if (job_.size() > 1) return uniqueID_;
-
-  //thread start
-  thread_ = boost::shared_ptr<boost::thread>(new boost::thread(boost::bind(&AIOHandler::call_aio,this)));
-  return uniqueID_;
+    AIOJob *job = new AIOJob;
+    job->unit = unit;
+    job->key = key;
+    job->write = false;
+    job->toc = false;
+    job->start = start;
+    job->size = row_length ? sizeof(double)*(row_length*(col_length + col_skip) - col_skip) : 0;
+    job->staged = 0;
+    job->work = boost::bind(&AIOHandler::do_read_discont, this, unit, job->key.c_str(), matrix,
+        row_length, col_length, col_skip, start);
+    return submit(job);
 }
 unsigned long AIOHandler::write_discont(unsigned int unit, const char *key,
   double **matrix, ULI row_length, ULI col_length, ULI col_skip,
   psio_address start)
 {
-  boost::unique_lock<boost::mutex> lock(*locked_);
-
-  ++uniqueID_;
-  job_.push(6);
-  unit_.push(unit);
-  key_.push(key);
-  matrix_.push(matrix);
-  row_length_.push(row_length);
-  col_length_.push(col_length);
-  col_skip_.push(col_skip);
-  start_.push(start);
-  jobID_.push_back(uniqueID_);
-
-  if (job_.size() > 1) return uniqueID_;
-
-  //thread start
-  thread_ = boost::shared_ptr<boost::thread>(new boost::thread(boost::bind(&AIOHandler::call_aio,this)));
-  return uniqueID_;
+    AIOJob *job = new AIOJob;
+    job->unit = unit;
+    job->key = key;
+    job->write = true;
+    job->toc = false;
+    job->start = start;
+    job->size = row_length ? sizeof(double)*(row_length*(col_length + col_skip) - col_skip) : 0;
+    job->staged = 0;
+    job->work = boost::bind(&AIOHandler::do_write_discont, this, unit, job->key.c_str(), matrix,
+        row_length, col_length, col_skip, start);
+    return submit(job);
 }
 unsigned long AIOHandler::zero_disk(unsigned int unit, const char *key,
     ULI rows, ULI cols)
 {
-  boost::unique_lock<boost::mutex> lock(*locked_);
-
-  ++uniqueID_;
-  job_.push(7);
-  unit_.push(unit);
-  key_.push(key);
-  row_length_.push(rows);
-  col_length_.push(cols);
-  jobID_.push_back(uniqueID_);
-
-  if (job_.size() > 1) return uniqueID_;
-
-  //thread start
-  thread_ = boost::shared_ptr<boost::thread>(new boost::thread(boost::bind(&AIOHandler::call_aio,this)));
-  return uniqueID_;
+    AIOJob *job = new AIOJob;
+    job->unit = unit;
+    job->key = key;
+    job->write = true;
+    job->toc = true;
+    job->start = PSIO_ZERO;
+    job->size = rows * cols * sizeof(double);
+    job->staged = 0;
+    job->work = boost::bind(&AIOHandler::do_zero_disk, this, unit, job->key.c_str(), rows, cols);
+    return submit(job);
 }
-
 unsigned long AIOHandler::write_iwl(unsigned int unit, const char *key,
               size_t nints, int lastbuf, char *labels, char *values,
-              size_t labsize, size_t valsize, size_t *address) {
-  boost::unique_lock<boost::mutex> lock(*locked_);
-  ++uniqueID_;
-  job_.push(8);
-  unit_.push(unit);
-  key_.push(key);
-  buffer_.push(labels);
-  buffer_.push(values);
-  size_.push(labsize);
-  size_.push(valsize);
-  nints_.push(nints);
-  lastbuf_.push(lastbuf);
-  address_.push(address);
-  jobID_.push_back(uniqueID_);
-
-  if (job_.size() > 1) return uniqueID_;
-
-  //thread start
-  thread_ = boost::shared_ptr<boost::thread>(new boost::thread(boost::bind(&AIOHandler::call_aio,this)));
-  return uniqueID_;
-
+              size_t labsize, size_t valsize, size_t *address)
+{
+    // The file address is only known once the previous buffers are
+    // placed, so IWL writes are serialized on their unit
+    AIOJob *job = new AIOJob;
+    job->unit = unit;
+    job->key = key;
+    job->write = true;
+    job->toc = true;
+    job->start = PSIO_ZERO;
+    job->size = 0;
+    job->staged = 0;
+    // (more arguments than boost::bind takes)
+    job->work = std::bind(&AIOHandler::do_write_iwl, this, unit, job->key.c_str(), (int) nints,
+        lastbuf, labels, values, labsize, valsize, address);
+    return submit(job);
 }
-
-void AIOHandler::call_aio()
+void AIOHandler::do_read_discont(unsigned int unit, const char *key,
+  double **matrix, ULI row_length, ULI col_length, ULI col_skip,
+  psio_address start)
 {
-  boost::unique_lock<boost::mutex> lock(*locked_);
-
-  while (job_.size() > 0) {
-    int jobtype = job_.front();
-    lock.unlock();
-
-    if (jobtype == 1) {
-
-      lock.lock();
-
-      unsigned int unit = unit_.front();
-      const char* key = key_.front();
-      char* buffer = buffer_.front();
-      ULI size = size_.front();
-      psio_address start = start_.front();
-      psio_address* end = end_.front();
-
-      unit_.pop();
-      key_.pop();
-      buffer_.pop();
-      size_.pop();
-      start_.pop();
-      end_.pop();
-
-      lock.unlock();
-
-      psio_->read(unit,key,buffer,size,start,end);
-    }
-    else if (jobtype == 2) {
-
-      lock.lock();
-
-      unsigned int unit = unit_.front();
-      const char* key = key_.front();
-      char* buffer = buffer_.front();
-      ULI size = size_.front();
-      psio_address start = start_.front();
-      psio_address* end = end_.front();
-
-      unit_.pop();
-      key_.pop();
-      buffer_.pop();
-      size_.pop();
-      start_.pop();
-      end_.pop();
-
-      //printf("Actually doing the psio_write from thread\n");
-      //printf("Unit is %d, key is %s, size is %d\n", unit, key, size);
-      lock.unlock();
-
-      //printf("Printing number %d now\n", *((int *) buffer));
-      //std::stringstream ss;
-      //ss << thread_->get_id();
-      //fprintf(stderr,"Printing from thread %s\n", ss.str().c_str());
-      //fprintf(stderr,"Starting address is %lu, %lu\n",start.page, start.offset);
-      psio_->write(unit,key,buffer,size,start,end);
-      //fprintf(stderr,"End address is %lu, %lu\n",end->page, end->offset);
-    }
-    else if (jobtype == 3) {
-
-      lock.lock();
-
-      unsigned int unit = unit_.front();
-      const char* key = key_.front();
-      char* buffer = buffer_.front();
-      ULI size = size_.front();
-
-      unit_.pop();
-      key_.pop();
-      buffer_.pop();
-      size_.pop();
-
-      lock.unlock();
-
-      psio_->read_entry(unit,key,buffer,size);
-    }
-    else if (jobtype == 4) {
-
-      lock.lock();
-
-      unsigned int unit = unit_.front();
-      const char* key = key_.front();
-      char* buffer = buffer_.front();
-      ULI size = size_.front();
-
-      unit_.pop();
-      key_.pop();
-      buffer_.pop();
-      size_.pop();
-
-      lock.unlock();
-
-      psio_->write_entry(unit,key,buffer,size);
-    }
-    else if (jobtype == 5) {
-
-      lock.lock();
-
-      unsigned int unit = unit_.front();
-      const char* key = key_.front();
-      double** matrix = matrix_.front();
-      ULI row_length = row_length_.front();
-      ULI col_length = col_length_.front();
-      ULI col_skip = col_skip_.front();
-      psio_address start = start_.front();
-
-      unit_.pop();
-      key_.pop();
-      matrix_.pop();
-      row_length_.pop();
-      col_length_.pop();
-      col_skip_.pop();
-      start_.pop();
-
-      lock.unlock();
-
-      for (int i=0; i<row_length; i++) {
+    for (int i=0; i<row_length; i++) {
         psio_->read(unit,key,(char *) &(matrix[i][0]),
-          sizeof(double)*col_length,start,&start);
+            sizeof(double)*col_length,start,&start);
         start = psio_get_address(start,sizeof(double)*col_skip);
-      }
     }
-    else if (jobtype == 6) {
-
-      lock.lock();
-
-      unsigned int unit = unit_.front();
-      const char* key = key_.front();
-      double** matrix = matrix_.front();
-      ULI row_length = row_length_.front();
-      ULI col_length = col_length_.front();
-      ULI col_skip = col_skip_.front();
-      psio_address start = start_.front();
-
-      unit_.pop();
-      key_.pop();
-      matrix_.pop();
-      row_length_.pop();
-      col_length_.pop();
-      col_skip_.pop();
-      start_.pop();
-
-      lock.unlock();
-
-      for (int i=0; i<row_length; i++) {
+}
+void AIOHandler::do_write_discont(unsigned int unit, const char *key,
+  double **matrix, ULI row_length, ULI col_length, ULI col_skip,
+  psio_address start)
+{
+    for (int i=0; i<row_length; i++) {
         psio_->write(unit,key,(char *) &(matrix[i][0]),
-          sizeof(double)*col_length,start,&start);
+            sizeof(double)*col_length,start,&start);
         start = psio_get_address(start,sizeof(double)*col_skip);
-      }
-    }
-    else if (jobtype == 7) {
-
-      lock.lock();
-
-      unsigned int unit = unit_.front();
-      const char* key = key_.front();
-      ULI row_length = row_length_.front();
-      ULI col_length = col_length_.front();
-
-      unit_.pop();
-      key_.pop();
-      row_length_.pop();
-      col_length_.pop();
-
-      lock.unlock();
-
-      double* buf = new double[col_length];
-      memset(static_cast<void*>(buf),'\0',col_length*sizeof(double));
-
-      psio_address next_psio = PSIO_ZERO;
-      for (int i=0; i<row_length; i++) {
-        psio_->write(unit,key,(char *) (buf),sizeof(double)*col_length,
-          next_psio,&next_psio);
-      }
-
-      delete[] buf;
     }
-    else if (jobtype == 8) {
-
-        lock.lock();
-
-        unsigned int unit = unit_.front();
-        const char* key = key_.front();
-        char* labels = buffer_.front();
-        buffer_.pop();
-        char* values = buffer_.front();
-        ULI lab_size = size_.front();
-        size_.pop();
-        ULI val_size = size_.front();
-        int nints = nints_.front();
-        int lastbuf = lastbuf_.front();
-        size_t* address = address_.front();
-
-        psio_address start = psio_get_address(PSIO_ZERO, *address);
-        *address += val_size + lab_size + 2 * sizeof(int);
-
-        unit_.pop();
-        key_.pop();
-        buffer_.pop();
-        size_.pop();
-        nints_.pop();
-        lastbuf_.pop();
-        address_.pop();
-
-        lock.unlock();
-
-        psio_->write(unit,key,(char*) &(lastbuf), sizeof(int),start,&start);
-        psio_->write(unit,key,(char*) &(nints), sizeof(int), start, &start);
-        psio_->write(unit,key,labels,lab_size,start,&start);
-        psio_->write(unit,key,values,val_size,start,&start);
+}
+void AIOHandler::do_zero_disk(unsigned int unit, const char *key, ULI rows, ULI cols)
+{
+    double* buf = new double[cols];
+    memset(static_cast<void*>(buf),'\0',cols*sizeof(double));
 
-    }
-    else {
-      throw PsiException("Error in AIO: Unknown job type", __FILE__,__LINE__);
+    psio_address next_psio = PSIO_ZERO;
+    for (int i=0; i<rows; i++) {
+        psio_->write(unit,key,(char *) (buf),sizeof(double)*cols,
+            next_psio,&next_psio);
     }
 
-    lock.lock();
-    // Only pop the job once the work is actually done and we are gonna leave the loop.
-    // This way, job_.size() == 0 indicates there is no active thread.
-    job_.pop(); 
-    // We also pop the jobID so that external threads may check that the job completed
-    jobID_.pop_front();
-    // Once it is popped, notify waiting threads to check again for their jobid.
-    condition_.notify_all();
-  }
-  //printf("End of function call_aio\n");
+    delete[] buf;
 }
+void AIOHandler::do_write_iwl(unsigned int unit, const char *key, int nints,
+  int lastbuf, char *labels, char *values, size_t lab_size, size_t val_size,
+  size_t *address)
+{
+    psio_address start = psio_get_address(PSIO_ZERO, *address);
+    *address += val_size + lab_size + 2 * sizeof(int);
 
-void AIOHandler::wait_for_job(unsigned long jobid) {
-
-    std::deque<unsigned long int>::iterator it;
-
-    boost::unique_lock<boost::mutex> lock(*locked_);
-    it = std::find(jobID_.begin(),jobID_.end(),jobid);
-    bool found = it != jobID_.end();
-    while(found) {
-        condition_.wait(lock);
-        it = std::find(jobID_.begin(),jobID_.end(),jobid);
-        found = it != jobID_.end();
-    }
-    return;
+    psio_->write(unit,key,(char*) &(lastbuf), sizeof(int),start,&start);
+    psio_->write(unit,key,(char*) &(nints), sizeof(int), start, &start);
+    psio_->write(unit,key,labels,lab_size,start,&start);
+    psio_->write(unit,key,values,val_size,start,&start);
+}
+void AIOHandler::do_write_behind(unsigned int unit, const char *key, char *buffer,
+  ULI size, psio_address start, psio_address *end)
+{
+    boost::shared_array<char> owner(buffer);
+    psio_->write(unit,key,buffer,size,start,end);
 }
 
 } //Namespace psi
@@ -28,71 +28,141 @@
 #ifndef AIOHANDLER_H
 #define AIOHANDLER_H
 
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include <exception>
+#include <boost/function.hpp>
 #include <boost/thread/thread.hpp>
 
 namespace psi {
 
+/**
+   AIOHandler is the asynchronous I/O engine layered on a PSIO object.
+
+   Every request becomes a job with a unique (nonzero) ID.  The jobs are
+   run by a small pool of worker threads, which is started on the first
+   request.  wait_for_job() is the completion future of a job: it blocks
+   until the job has run and rethrows any exception it raised.
+
+   Jobs on different units run independently.  On one unit, reads and
+   writes that fall entirely inside existing TOC entries only move data
+   (PSIO::rw() uses positional I/O), so they may overlap each other as
+   long as no write overlaps another access to the same bytes.  Any job
+   that can change the TOC (new or growing entries, zero_disk, IWL
+   buffers), and every job on a memory-mapped unit, runs alone on its
+   unit.  Conflicting jobs always complete in submission order.
+
+   The caller still owns libpsio for any unit with jobs in flight: it
+   must not open, close, read or write that unit itself until it has
+   waited for them.
+   */
 class AIOHandler {
 private:
-    /// What is the job type?
-    std::queue<unsigned int> job_;
-    /// Unique job ID to check for job completion. Should NEVER be 0.
-    std::deque<unsigned long int> jobID_;
-    /// Unit number argument
-    std::queue<unsigned int> unit_;
-    /// Entry Key (80-char) argument
-    std::queue<const char*> key_;
-    /// Memory buffer argument
-    std::queue<char*> buffer_;
-    /// Size argument
-    std::queue<ULI> size_;
-    /// Start address argument
-    std::queue<psio_address> start_;
-    /// End address pointer argument
-    std::queue<psio_address*> end_;
-    /// Matrix pointer for discontinuous I/O
-    std::queue<double**> matrix_;
-    /// Size argument for discontinuous I/O
-    std::queue<ULI> row_length_;
-    /// Size argument for discontinuous I/O
-    std::queue<ULI> col_length_;
-    /// Size argument for discontinuous I/O
-    std::queue<ULI> col_skip_;
-    /// For IWL: number of ints in the buffer
-    std::queue<int> nints_;
-    /// For IWL: is this the last buffer ?
-    std::queue<int> lastbuf_;
-    /// For IWL: pointer to current position in file
-    std::queue<size_t*> address_;
-    /// PSIO object this AIO_Handler is built on
+    /// One asynchronous request
+    struct AIOJob {
+        /// Unique job ID. Should NEVER be 0.
+        unsigned long int id;
+        /// Unit number argument
+        unsigned int unit;
+        /// Entry key, copied so the caller's label may go away
+        std::string key;
+        /// Does the job write to the unit?
+        bool write;
+        /// Can the job change the TOC (whatever it touches)?
+        bool toc;
+        /// Must the job run alone on its unit? Decided when it is dispatched.
+        bool exclusive;
+        /// Entry-relative start address of the bytes touched
+        psio_address start;
+        /// Number of bytes spanned, from start
+        ULI size;
+        /// Bytes of staging memory held by the job (write_behind)
+        ULI staged;
+        /// End address of read/write/write_behind when the caller passes no end
+        psio_address end;
+        /// The work itself
+        boost::function<void ()> work;
+    };
+
+    /// PSIO object this AIOHandler is built on
     boost::shared_ptr<PSIO> psio_;
-    /// Thread this AIO_Handler is currently running on
-    boost::shared_ptr<boost::thread> thread_;
+    /// Worker threads, started on the first request
+    std::vector<boost::shared_ptr<boost::thread> > threads_;
+    /// Number of worker threads
+    int nthread_;
     /// Lock variable
     boost::mutex *locked_;
+    /// Signalled when a job is queued or a unit becomes free
+    boost::condition_variable work_;
+    /// Signalled when a job completes
+    boost::condition_variable done_;
+    /// Jobs not yet started, in submission order
+    std::list<AIOJob*> pending_;
+    /// Jobs currently running
+    std::list<AIOJob*> running_;
+    /// IDs of all jobs that have not completed
+    std::set<unsigned long int> unfinished_;
+    /// Exceptions thrown by completed jobs, not yet collected
+    std::map<unsigned long int, std::exception_ptr> errors_;
     /// Latest unique job ID
     unsigned long int uniqueID_;
-    /// condition variable to wait for a specific job to finish
-    boost::condition_variable condition_;
+    /// Staging memory held by write_behind() jobs, and its limit (bytes)
+    ULI staged_;
+    ULI max_staged_;
+    /// Set by the destructor to retire the workers
+    bool stop_;
+
+    /// Queue a job and return its ID
+    unsigned long int submit(AIOJob *job);
+    /// Worker thread body
+    void call_aio();
+    /// Next job that may start now, removed from pending_, or NULL
+    AIOJob* next_job();
+    /// Must job run alone on its unit?
+    bool exclusive(const AIOJob *job);
+    /// May jobs a and b not run at the same time?
+    bool conflict(const AIOJob *a, const AIOJob *b) const;
+
+    /// Job bodies that are more than a single PSIO call
+    void do_read_discont(unsigned int unit, const char *key, double **matrix,
+      ULI row_length, ULI col_length, ULI col_skip, psio_address start);
+    void do_write_discont(unsigned int unit, const char *key, double **matrix,
+      ULI row_length, ULI col_length, ULI col_skip, psio_address start);
+    void do_zero_disk(unsigned int unit, const char *key, ULI rows, ULI cols);
+    void do_write_iwl(unsigned int unit, const char *key, int nints, int lastbuf,
+      char *labels, char *values, size_t labsize, size_t valsize, size_t *address);
+    void do_write_behind(unsigned int unit, const char *key, char *buffer, ULI size,
+      psio_address start, psio_address *end);
 public:
-    /// AIO_Handlers are constructed around a synchronous PSIO object
-    AIOHandler(boost::shared_ptr<PSIO> psio);
-    /// Destructor
+    /// AIOHandlers are constructed around a synchronous PSIO object
+    AIOHandler(boost::shared_ptr<PSIO> psio, int nthread = 2);
+    /// Destructor: completes all queued jobs, then stops the workers
     ~AIOHandler();
-    /// Thread object this AIO_Handler is currently running on
-    boost::shared_ptr<boost::thread> get_thread();
-    /// When called, synchronize will not return until all requested data has been read or written
+    /// When called, synchronize will not return until all requested data has been read or written.
+    /// Rethrows the first exception raised by a job that nobody waited for.
     void synchronize();
-    /// Asynchronous read, same as PSIO::read, but nonblocking
+    /// Asynchronous read, same as PSIO::read, but nonblocking.
+    /// end may be NULL if the caller does not need the end address.
     unsigned long int read(unsigned int unit, const char *key, char *buffer, ULI size,
               psio_address start, psio_address *end);
-    /// Asynchronous write, same as PSIO::write, but nonblocking
+    /// Asynchronous write, same as PSIO::write, but nonblocking (end may be NULL)
     unsigned long int write(unsigned int unit, const char *key, char *buffer, ULI size,
                psio_address start, psio_address *end);
     /// Asynchronous read_entry, same as PSIO::read_entry, but nonblocking
     unsigned long int read_entry(unsigned int unit, const char *key, char *buffer, ULI size);
     /// Asynchronous read_entry, same as PSIO::write_entry, but nonblocking
     unsigned long int write_entry(unsigned int unit, const char *key, char *buffer, ULI size);
+    /// Write-behind: same as write (end may be NULL), but buffer is copied before returning,
+    /// so the caller may reuse it at once.  The copies held by queued jobs
+    /// are bounded by set_staging_memory(); past that the call blocks until
+    /// earlier write-behind jobs have drained.
+    unsigned long int write_behind(unsigned int unit, const char *key, const char *buffer, ULI size,
+               psio_address start, psio_address *end);
+    /// Set the bound (in bytes) on the staging memory of write_behind()
+    void set_staging_memory(ULI bytes);
     /// Asynchronous read for reading discontinuous disk space
     /// into a continuous chunk of memory, i.e.
     ///
@@ -129,12 +199,13 @@ public:
     unsigned long write_iwl(unsigned int unit, const char* key, size_t nints,
                             int lastbuf, char* labels, char* values, size_t labsize,
                             size_t valsize, size_t* address);
-    /// Generic function bound to thread internally
-    void call_aio();
 
     /// Function that checks if a job has been completed using the JobID.
-    /// The function only returns when the job is completed.
+    /// The function only returns when the job is completed, and rethrows
+    /// the exception the job raised, if any.
     void wait_for_job(unsigned long int jobid);
+    /// Nonblocking test: has the job with this JobID completed?
+    bool job_done(unsigned long int jobid);
 };
 
 }
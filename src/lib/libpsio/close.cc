@@ -56,6 +56,9 @@ void PSIO::close(unsigned int unit, int keep) {
   /* Dump the current TOC back out to disk */
   tocwrite(unit);
 
+  /* Release the memory mapping, if any, and trim the file */
+  mmap_close(unit);
+
   /* Free the TOC */
   this_entry = this_unit->toc;
   for (i=0; i < this_unit->toclen; i++) {
@@ -88,6 +91,7 @@ void PSIO::close(unsigned int unit, int keep) {
   this_unit->numvols = 0;
   this_unit->toclen = 0;
   this_unit->toc = NULL;
+  tocindex_rebuild(unit);
 }
 
 int psio_close(unsigned int unit, int keep) {
@@ -58,6 +58,7 @@ namespace psi {
 #define PSIO_ERROR_BLKEND    18
 #define PSIO_ERROR_IDENTVOLPATH 19
 #define PSIO_ERROR_MAXUNIT   20
+#define PSIO_ERROR_MMAP      21
 
 typedef unsigned long int ULI; /* For convenience */
 
@@ -123,6 +123,9 @@ namespace psi {
         fprintf(stderr, "Open failed because unit %d exceeds ", unit);
         fprintf(stderr, "PSIO_MAXUNIT = %d.\n", PSIO_MAXUNIT);
         break;
+      case PSIO_ERROR_MMAP:
+        fprintf(stderr, "PSIO_ERROR: %d (memory mapping of file failed)\n", PSIO_ERROR_MMAP);
+        break;
     }
     fflush(stderr);
     throw PSIEXCEPTION("PSIO Error");
@@ -101,6 +101,19 @@ bool PSIOManager::get_specific_retention(int fileno)
   return retaining;
 }
 
+void PSIOManager::set_specific_mmap(int fileno, bool use)
+{
+    if (use)
+        specific_mmaps_.insert(fileno);
+    else
+        specific_mmaps_.erase(fileno);
+}
+
+bool PSIOManager::get_specific_mmap(int fileno)
+{
+    return specific_mmaps_.count(fileno) != 0;
+}
+
 void PSIOManager::write_scratch_file(const std::string & full_path, const std::string &text)
 {
     files_[full_path] = true;
@@ -160,6 +173,14 @@ void PSIOManager::print(std::string out)
     }
     printer->Printf( "\n");
 
+    printer->Printf( "  Memory Mapped Files:\n\n");
+    printer->Printf( "  %-6s \n", "FileNo");
+    printer->Printf( "  -------\n");
+    for (std::set<int>::iterator it = specific_mmaps_.begin(); it != specific_mmaps_.end(); it++) {
+        printer->Printf( "  %-6d\n", (*it));
+    }
+    printer->Printf( "\n");
+
     printer->Printf( "  Current File Retention Rules:\n\n");
 
     printer->Printf( "  %-6s \n", "Filename");
@@ -56,6 +56,9 @@ PSIO::PSIO()
     int i, j;
 
     psio_unit = (psio_ud *) malloc(sizeof(psio_ud)*PSIO_MAXUNIT);
+    tocindex_.resize(PSIO_MAXUNIT);
+    toctail_.assign(PSIO_MAXUNIT, (psio_tocentry *) NULL);
+    maps_.resize(PSIO_MAXUNIT);
 #ifdef PSIO_STATS
     psio_readlen = (ULI *) malloc(sizeof(ULI) * PSIO_MAXUNIT);
     psio_writlen = (ULI *) malloc(sizeof(ULI) * PSIO_MAXUNIT);
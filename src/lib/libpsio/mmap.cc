@@ -0,0 +1,240 @@
+/*
+ * @BEGIN LICENSE
+ *
+ * Psi4: an open-source quantum chemistry software package
+ *
+ * Copyright (c) 2007-2016 The Psi4 Developers.
+ *
+ * The copyrights for code used from other parties are included in
+ * the corresponding files.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * @END LICENSE
+ */
+
+/*!
+ \file
+ \ingroup PSIO
+ \brief Memory-mapped access to single-volume PSIO units
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <libpsio/psio.h>
+#include <libpsio/psio.hpp>
+#include "psi4-dec.h"
+#include "../libparallel2/Communicator.h"
+#include "../libparallel2/ParallelEnvironment.h"
+namespace psi {
+
+namespace {
+
+/* Files are grown (and remapped) in multiples of this many bytes */
+const ULI psio_map_chunk = 256 * (ULI) PSIO_PAGELEN;
+
+}
+
+/*!
+ ** PSIO::mmap_open(): Maps the file behind unit into memory if the
+ ** PSIOManager has asked for it with set_specific_mmap().  Striped units
+ ** and parallel runs (where only the master process holds the file
+ ** descriptor) keep using the plain read/write path.
+ **
+ ** \ingroup PSIO
+ */
+void PSIO::mmap_open(unsigned int unit) {
+  psio_ud *this_unit = &(psio_unit[unit]);
+  psio_map *this_map = &(maps_[unit]);
+  struct stat st;
+
+  this_map->addr = NULL;
+  this_map->len = 0;
+  this_map->used = 0;
+  this_map->on = false;
+
+  if (!PSIOManager::shared_object()->get_specific_mmap(unit)) return;
+  if (this_unit->numvols != 1) return;
+  if (WorldComm->GetComm()->NProc() != 1) return;
+
+  if (fstat(this_unit->vol[0].stream, &st) == -1)
+    psio_error(unit, PSIO_ERROR_MMAP);
+
+  this_map->on = true;
+  this_map->used = (ULI) st.st_size;
+  if (st.st_size) mmap_extend(unit, (ULI) st.st_size, false);
+}
+
+/*!
+ ** PSIO::mmap_close(): Releases the mapping of unit and truncates the
+ ** file back to the last byte of data, dropping the slack left by
+ ** mmap_extend().  Must be called after the TOC has been written.
+ **
+ ** \ingroup PSIO
+ */
+void PSIO::mmap_close(unsigned int unit) {
+  psio_ud *this_unit = &(psio_unit[unit]);
+  psio_map *this_map = &(maps_[unit]);
+  psio_tocentry *last;
+  ULI stop;
+
+  if (!this_map->on) return;
+
+  stop = this_map->used;
+  last = toclast(unit);
+  if (last != NULL && last->eadd.page*PSIO_PAGELEN + last->eadd.offset > stop)
+    stop = last->eadd.page*PSIO_PAGELEN + last->eadd.offset;
+  if (stop < sizeof(ULI)) stop = sizeof(ULI);
+
+  if (this_map->addr != NULL && munmap(this_map->addr, this_map->len) == -1)
+    psio_error(unit, PSIO_ERROR_MMAP);
+  if (this_map->len > stop && ftruncate(this_unit->vol[0].stream, stop) == -1)
+    psio_error(unit, PSIO_ERROR_MMAP);
+
+  this_map->addr = NULL;
+  this_map->len = 0;
+  this_map->used = 0;
+  this_map->on = false;
+}
+
+/*!
+ ** PSIO::mmap_extend(): Remaps unit so that at least the first stop
+ ** bytes of the file are addressable.  If grow is set the file is
+ ** extended (sparsely) as needed, at least doubling it so that a series
+ ** of appends only remaps a logarithmic number of times; otherwise the
+ ** data must already be in the file.
+ **
+ ** Any pointer previously returned by mapped_pointer() is invalid
+ ** afterwards.
+ **
+ ** \ingroup PSIO
+ */
+void PSIO::mmap_extend(unsigned int unit, ULI stop, bool grow) {
+  psio_ud *this_unit = &(psio_unit[unit]);
+  psio_map *this_map = &(maps_[unit]);
+  int stream = this_unit->vol[0].stream;
+  struct stat st;
+  ULI len;
+  void *addr;
+
+  if (fstat(stream, &st) == -1)
+    psio_error(unit, PSIO_ERROR_MMAP);
+  len = (ULI) st.st_size;
+
+  if (len < stop) {
+    if (!grow) psio_error(unit, PSIO_ERROR_READ);
+    len = (2*len > stop ? 2*len : stop);
+    len = ((len + psio_map_chunk - 1) / psio_map_chunk) * psio_map_chunk;
+    if (ftruncate(stream, len) == -1)
+      psio_error(unit, PSIO_ERROR_WRITE);
+  }
+
+  if (this_map->addr != NULL && munmap(this_map->addr, this_map->len) == -1)
+    psio_error(unit, PSIO_ERROR_MMAP);
+
+  addr = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, stream, 0);
+  if (addr == MAP_FAILED) {
+    this_map->addr = NULL;
+    this_map->len = 0;
+    psio_error(unit, PSIO_ERROR_MMAP);
+  }
+  this_map->addr = (char *) addr;
+  this_map->len = len;
+}
+
+/*!
+ ** PSIO::mmap_rw(): The mapped counterpart of rw().  A single volume
+ ** holds every page, so the global address is simply a byte offset.
+ **
+ ** \returns false if unit is not mapped and rw() has to do the work.
+ **
+ ** \ingroup PSIO
+ */
+bool PSIO::mmap_rw(unsigned int unit, char *buffer, psio_address address,
+                   ULI size, int wrt) {
+  psio_map *this_map = &(maps_[unit]);
+  ULI start, stop;
+
+  if (!this_map->on) return false;
+
+  start = address.page*PSIO_PAGELEN + address.offset;
+  stop = start + size;
+  if (stop > this_map->len) mmap_extend(unit, stop, wrt ? true : false);
+
+  if (wrt) {
+    ::memcpy(&(this_map->addr[start]), buffer, size);
+    if (stop > this_map->used) this_map->used = stop;
+  }
+  else
+    ::memcpy(buffer, &(this_map->addr[start]), size);
+
+  return true;
+}
+
+bool PSIO::mapped(unsigned int unit) {
+  return (unit < PSIO_MAXUNIT) && maps_[unit].on;
+}
+
+/*!
+ ** PSIO::mapped_pointer(): Zero-copy variant of read().  Performs the
+ ** same TOC lookup and bounds checks, but instead of copying returns the
+ ** address of the requested bytes within the mapping of unit.
+ **
+ **  \param unit  = The PSI unit number.
+ **  \param key   = The TOC keyword identifying the desired entry.
+ **  \param start = The entry-relative starting page/offset of the desired data.
+ **  \param size  = The number of bytes that will be accessed.
+ **
+ ** \returns NULL if the unit is not memory mapped.  The data may be
+ ** modified in place; it is the file.
+ **
+ ** \ingroup PSIO
+ */
+char* PSIO::mapped_pointer(unsigned int unit, const char *key,
+                           psio_address start, ULI size) {
+  psio_tocentry *this_entry;
+  psio_address start_data, end_data;
+  ULI tocentry_size, offset;
+
+  if (!mapped(unit)) return NULL;
+
+  this_entry = tocscan(unit, key);
+  if (this_entry == NULL) {
+    fprintf(stderr, "PSIO_ERROR: Can't find TOC Entry %s\n", key);
+    psio_error(unit, PSIO_ERROR_NOTOCENT);
+  }
+
+  tocentry_size = sizeof(psio_tocentry) - 2*sizeof(psio_tocentry *);
+  start_data = psio_get_address(this_entry->sadd, tocentry_size);
+  start_data = psio_get_global_address(start_data, start);
+
+  end_data = psio_get_address(start_data, size);
+  if ((end_data.page > this_entry->eadd.page))
+    psio_error(unit, PSIO_ERROR_BLKEND);
+  else if ((end_data.page == this_entry->eadd.page) && (end_data.offset
+      > this_entry->eadd.offset))
+    psio_error(unit, PSIO_ERROR_BLKEND);
+
+  offset = start_data.page*PSIO_PAGELEN + start_data.offset;
+  if (offset + size > maps_[unit].len) mmap_extend(unit, offset + size, false);
+
+  return &(maps_[unit].addr[offset]);
+}
+
+}
@@ -132,11 +132,14 @@ void PSIO::open(unsigned int unit, int status) {
     free(path);
   }
 
+  mmap_open(unit);
+
   if (status == PSIO_OPEN_OLD) tocread(unit);
   else if (status == PSIO_OPEN_NEW) {
     /* Init the TOC stats and write them to disk */
     this_unit->toclen = 0;
     this_unit->toc = NULL;
+    tocindex_rebuild(unit);
     wt_toclen(unit, 0);
   }
   else psio_error(unit,PSIO_ERROR_OSTAT);
@@ -6,6 +6,8 @@
 #include <map>
 #include <set>
 #include <queue>
+#include <vector>
+#include <unordered_map>
 
 #include <libpsio/config.h>
 
@@ -41,6 +43,8 @@ private:
     std::map<int, std::string> specific_paths_;
     /// Default retained files
     std::set<int> specific_retains_;
+    /// File numbers to be accessed through a memory mapping
+    std::set<int> specific_mmaps_;
 
     /// Map of files, bool denotes open or closed
     std::map<std::string, bool> files_;
@@ -86,6 +90,18 @@ public:
             * \return keeping or not?
             */
     bool get_specific_retention(int fileno);
+    /**
+            * Set the specific file number to be memory mapped when opened
+            * \param fileno PSI4 file number
+            * \param use map or not? (Only honored for single-volume, single-process files)
+            */
+    void set_specific_mmap(int fileno, bool use);
+    /**
+            * Inquire whether a specific file number is set to be memory mapped
+            * \param fileno PSI4 file number
+            * \return mapping or not?
+            */
+    bool get_specific_mmap(int fileno);
 
     /**
             * Get the path for a specific file number
@@ -279,6 +295,9 @@ public:
     psio_tocentry* tocscan(unsigned int unit, const char *key);
     /// Checks the TOC to see if a particular keyword exists there or not
     bool tocentry_exists(unsigned int unit, const char *key);
+    /// Checks whether size bytes from the entry-relative address start lie within the current
+    /// extent of entry key of an open unit, i.e. whether writing them would leave the TOC untouched
+    bool tocentry_contains(unsigned int unit, const char *key, psio_address start, ULI size);
     ///  Write the table of contents for file number 'unit'. NB: This function should NOT call psio_error because the latter calls it!
     void tocwrite(unsigned int unit);
 
@@ -315,10 +334,39 @@ public:
     /// delete a specific TOC entry (only deletes entry, not data)
     bool tocdel(unsigned int unit, const char *key);
 
+    /// return true if unit is open and accessed through a memory mapping
+    bool mapped(unsigned int unit);
+    /** Returns a pointer directly into the memory mapping of a unit, in
+       ** place of a read().  The arguments are those of read().  NULL is
+       ** returned if the unit is not mapped (see PSIOManager::set_specific_mmap).
+       ** The pointer is invalidated by any write that extends the file and by
+       ** closing the unit.
+       */
+    char* mapped_pointer(unsigned int unit, const char *key, psio_address start, ULI size);
+
 private:
     /// vector of units
     psio_ud *psio_unit;
 
+    typedef std::unordered_map<std::string, psio_tocentry*> TOCIndex;
+    /// Hashed index into each unit's TOC list, keyed on the entry label
+    std::vector<TOCIndex> tocindex_;
+    /// Last entry of each unit's TOC list
+    std::vector<psio_tocentry*> toctail_;
+
+    /// Memory mapping of a unit opened with PSIOManager::set_specific_mmap
+    struct psio_map {
+        /// start of the mapping, NULL if nothing is mapped yet
+        char *addr;
+        /// length of the mapping in bytes
+        ULI len;
+        /// number of bytes of the file that hold data
+        ULI used;
+        /// is the unit accessed through the mapping?
+        bool on;
+    };
+    std::vector<psio_map> maps_;
+
     /// Process ID
     std::string pid_;
 
@@ -354,6 +402,16 @@ private:
     void wt_toclen(unsigned int unit, ULI toclen);
     /// Read the table of contents for file number 'unit'.
     void tocread(unsigned int unit);
+    /// Rebuild the hashed TOC index (and tail pointer) of 'unit' from its TOC list.
+    void tocindex_rebuild(unsigned int unit);
+    /// Map the (single) volume of 'unit' if PSIOManager asks for it.
+    void mmap_open(unsigned int unit);
+    /// Unmap 'unit' and trim the file back to its data.
+    void mmap_close(unsigned int unit);
+    /// Make sure the mapping of 'unit' covers 'stop' bytes, growing the file if 'grow' is set.
+    void mmap_extend(unsigned int unit, ULI stop, bool grow);
+    /// rw() through the mapping; returns false if 'unit' is not mapped.
+    bool mmap_rw(unsigned int unit, char *buffer, psio_address address, ULI size, int wrt);
 
     friend class AIO_Handler;
 
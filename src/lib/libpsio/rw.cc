@@ -31,6 +31,7 @@
  */
 
 #include <cstdio>
+#include <cerrno>
 #include <unistd.h>
 #include <libpsio/psio.h>
 #include <libpsio/psio.hpp>
@@ -39,121 +40,81 @@
 #include "../libparallel2/ParallelEnvironment.h"
 namespace psi {
 
+namespace {
+
+/* Largest single transfer (and broadcast, whose count is an int) */
+const ULI PSIO_MAX_TRANSFER = 1UL << 30;
+
+/* Transfers size bytes at byte offset of an open volume with positional
+   I/O, resuming short transfers.  Returns the number of bytes moved. */
+ULI psio_rw_volume(int stream, char *buffer, ULI size, ULI offset, int wrt) {
+  ULI done = 0;
+  while (done < size) {
+    ssize_t n;
+    if (wrt)
+      n = ::pwrite(stream, &(buffer[done]), size - done, (off_t) (offset + done));
+    else
+      n = ::pread(stream, &(buffer[done]), size - done, (off_t) (offset + done));
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    done += (ULI) n;
+  }
+  return done;
+}
+
+}
+
 void PSIO::rw(unsigned int unit, char *buffer, psio_address address, ULI size,
               int wrt) {
-  int errcod;
-  unsigned int i;
   ULI errcod_uli;
   ULI page, offset;
-  ULI buf_offset;
-  ULI this_page, this_page_max, this_page_total;
-  unsigned int first_vol, this_vol, numvols;
-  ULI bytes_left, num_full_pages;
+  ULI buf_offset, bytes_left;
+  ULI this_page_total;
+  unsigned int this_vol, numvols;
   psio_ud *this_unit;
   
+  /* Memory-mapped units bypass the read/write machinery entirely */
+  if (mmap_rw(unit, buffer, address, size, wrt))
+    return;
+
   this_unit = &(psio_unit[unit]);
   numvols = this_unit->numvols;
   page = address.page;
   offset = address.offset;
   
-  /* Seek all volumes to correct starting positions */
-  first_vol = page % numvols;
-  errcod = psio_volseek(&(this_unit->vol[first_vol]), page, offset, numvols);
-  if (errcod == -1)
-    psio_error(unit, PSIO_ERROR_LSEEK);
-  for (i=1, this_page=page+1; i < numvols; i++, this_page++) {
-    this_vol = this_page % numvols;
-    errcod = psio_volseek(&(this_unit->vol[this_vol]), this_page, (ULI) 0,
-                          numvols);
-    if (errcod == -1)
-      psio_error(unit, PSIO_ERROR_LSEEK);
-  }
-  
-  /* Number of bytes left on the first page */
-  this_page_max = PSIO_PAGELEN - offset;
-  
-  /* If we have enough room on this page, use it */
-  if (size <= this_page_max)
-    this_page_total = size;
-  else
-    this_page_total = this_page_max;
   boost::shared_ptr<const LibParallel::Communicator> Comm=
         WorldComm->GetComm();
-  buf_offset = 0;
-  if (wrt) {
-     if (Comm->Me() == 0) {
-      errcod_uli =:: write(this_unit->vol[first_vol].stream, &(buffer[buf_offset]),
-          this_page_total);
-	}
-        Comm->Bcast(&errcod_uli, 1, 0);
-    if(errcod_uli != this_page_total) psio_error(unit,PSIO_ERROR_WRITE);
-  }
-  else {
-	if (Comm->Me() == 0) {
-      errcod_uli = ::read(this_unit->vol[first_vol].stream, &(buffer[buf_offset]),
-          this_page_total);
-        }
-        Comm->Bcast(&errcod_uli, 1, 0);
-    if(errcod_uli != this_page_total)
-      psio_error(unit,PSIO_ERROR_READ);
-    else
-      Comm->Bcast(&(buffer[buf_offset]), this_page_total, 0);
-  }
 
-  /* Total number of bytes remaining to be read/written */
-  bytes_left = size - this_page_total;
+  /* Pages are striped round-robin over the volumes, so a request is
+     moved one page at a time, except that a single volume holds it all
+     contiguously and is moved in chunks of up to PSIO_MAX_TRANSFER
+     bytes.  Nothing here touches the file offsets, so distinct regions
+     of a unit may be read or written concurrently (see AIOHandler). */
+  buf_offset = 0;
+  bytes_left = size;
+  while (bytes_left) {
+    this_vol = page % numvols;
+    this_page_total = PSIO_PAGELEN - offset;
+    if (numvols == 1 || bytes_left < this_page_total)
+      this_page_total = bytes_left;
+    if (this_page_total > PSIO_MAX_TRANSFER)
+      this_page_total = PSIO_MAX_TRANSFER;
 
-  /* Read/Write all the full pages */
-  num_full_pages = bytes_left/PSIO_PAGELEN;
-  buf_offset += this_page_total;
-  for(i=0,this_page=page+1; i < num_full_pages; i++,this_page++) {
-    this_vol = this_page % numvols;
-    this_page_total = PSIO_PAGELEN;
-    if(wrt) {
-      if (Comm->Me() == 0) {
-        errcod_uli = ::write(this_unit->vol[this_vol].stream, &(buffer[buf_offset]),
-            this_page_total);
-      }
-      Comm->Bcast(&errcod_uli, 1, 0);
-      if(errcod_uli != this_page_total) psio_error(unit,PSIO_ERROR_WRITE);
-    }
-    else {
-      if (Comm->Me() == 0) {
-        errcod_uli = ::read(this_unit->vol[this_vol].stream, &(buffer[buf_offset]),
-            this_page_total);
-      }
-      Comm->Bcast(&errcod_uli, 1, 0);
-      if(errcod_uli != this_page_total)
-        psio_error(unit,PSIO_ERROR_READ);
-      else
-        Comm->Bcast(&(buffer[buf_offset]), this_page_total, 0);
+    if (Comm->Me() == 0) {
+      errcod_uli = psio_rw_volume(this_unit->vol[this_vol].stream, &(buffer[buf_offset]),
+          this_page_total, (page/numvols)*PSIO_PAGELEN + offset, wrt);
     }
-    buf_offset += this_page_total;
-  }
+    Comm->Bcast(&errcod_uli, 1, 0);
+    if (errcod_uli != this_page_total)
+      psio_error(unit, wrt ? PSIO_ERROR_WRITE : PSIO_ERROR_READ);
+    if (!wrt)
+      Comm->Bcast(&(buffer[buf_offset]), this_page_total, 0);
 
-  /* Read/Write the final partial page */
-  bytes_left -= num_full_pages * PSIO_PAGELEN;
-  this_vol = this_page % numvols;
-  if(bytes_left) {
-    if(wrt) {
-      if (Comm->Me() == 0) {
-        errcod_uli = ::write(this_unit->vol[this_vol].stream, &(buffer[buf_offset]),
-            bytes_left);
-      }
-      Comm->Bcast(&errcod_uli, 1, 0);
-      if(errcod_uli != bytes_left) psio_error(unit,PSIO_ERROR_WRITE);
-    }
-    else {
-      if (Comm->Me() == 0) {
-        errcod_uli = ::read(this_unit->vol[this_vol].stream, &(buffer[buf_offset]),
-            bytes_left);
-      }
-      Comm->Bcast(&errcod_uli, 1, 0);
-      if(errcod_uli != bytes_left)
-        psio_error(unit,PSIO_ERROR_READ);
-      else
-        Comm->Bcast(&(buffer[buf_offset]), bytes_left, 0);
-    }
+    buf_offset += this_page_total;
+    bytes_left -= this_page_total;
+    offset += this_page_total;
+    page += offset / PSIO_PAGELEN;
+    offset %= PSIO_PAGELEN;
   }
 }
 
@@ -64,6 +64,9 @@ void PSIO::tocclean(unsigned int unit, const char *key) {
     last_entry = prev_entry;
     this_unit->toclen--;
   }
+  if (this_unit->toclen == 0) this_unit->toc = NULL;
+  else if (last_entry != NULL) last_entry->next = NULL;
+  tocindex_rebuild(unit);
 
   /* Update on disk */
   wt_toclen(unit, this_unit->toclen);
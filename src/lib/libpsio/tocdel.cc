@@ -47,15 +47,15 @@ bool PSIO::tocdel(unsigned int unit, const char *key) {
 
   psio_tocentry *last_entry = this_entry->last;
   psio_tocentry *next_entry = this_entry->next;
+  psio_ud *this_unit = &(psio_unit[unit]);
   
-  if(next_entry == NULL) last_entry->next = NULL;
-  else {
-    last_entry->next = next_entry;
-    next_entry->last = last_entry;
-  }
+  if(last_entry == NULL) this_unit->toc = next_entry;
+  else last_entry->next = next_entry;
+  if(next_entry == NULL) toctail_[unit] = last_entry;
+  else next_entry->last = last_entry;
 
+  tocindex_[unit].erase(std::string(this_entry->key));
   free(this_entry);
-  psio_ud *this_unit = &(psio_unit[unit]);
   this_unit->toclen--;
   
   return true;
@@ -80,6 +80,8 @@ void PSIO::tocread(unsigned int unit) {
     address = this_entry->eadd;
     this_entry = this_entry->next;
   }
+
+  tocindex_rebuild(unit);
 }
 
 }
\ No newline at end of file
@@ -37,6 +37,26 @@
 
 namespace psi {
 
+/*
+ ** The TOC of each unit is kept as the linked list of psio_tocentry that
+ ** mirrors the on-disk layout, plus a hash of the same entries keyed on
+ ** their labels so that lookups by key do not walk the list.  Every
+ ** routine that links or unlinks entries keeps the two in sync; the ones
+ ** that rebuild or discard the whole list call tocindex_rebuild().
+ */
+void PSIO::tocindex_rebuild(unsigned int unit) {
+  psio_tocentry *this_entry;
+
+  tocindex_[unit].clear();
+  toctail_[unit] = NULL;
+
+  for (this_entry = psio_unit[unit].toc; this_entry != NULL; this_entry = this_entry->next) {
+    /* insert() keeps the first of any duplicate keys, as the list scan did */
+    tocindex_[unit].insert(std::make_pair(std::string(this_entry->key), this_entry));
+    toctail_[unit] = this_entry;
+  }
+}
+
 psio_tocentry*PSIO::tocscan(unsigned int unit, const char *key) {
   psio_tocentry *this_entry;
 
@@ -49,18 +69,11 @@ psio_tocentry*PSIO::tocscan(unsigned int unit, const char *key) {
   bool already_open = open_check(unit); 
   if(!already_open) open(unit, PSIO_OPEN_OLD);
 
-  this_entry = psio_unit[unit].toc;
-
-  while (this_entry != NULL) {
-    if (!strcmp(this_entry->key, key)) {
-      if(!already_open) close(unit, 1); // keep
-      return (this_entry);
-    }
-    this_entry = this_entry->next;
-  }
+  TOCIndex::const_iterator it = tocindex_[unit].find(key);
+  this_entry = (it == tocindex_[unit].end()) ? NULL : it->second;
 
   if(!already_open) close(unit, 1); // keep
-  return (NULL);
+  return (this_entry);
 }
 
   /*!
@@ -75,7 +88,7 @@ psio_tocentry*PSIO::tocscan(unsigned int unit, const char *key) {
   }
 
 bool PSIO::tocentry_exists(unsigned int unit, const char *key) {
-  psio_tocentry *this_entry;
+  bool found;
 
   if (key == NULL)
     return (true);
@@ -86,18 +99,33 @@ bool PSIO::tocentry_exists(unsigned int unit, const char *key) {
   bool already_open = open_check(unit); 
   if(!already_open) open(unit, PSIO_OPEN_OLD);
 
-  this_entry = psio_unit[unit].toc;
-
-  while (this_entry != NULL) {
-    if (!strcmp(this_entry->key, key)) {
-      if(!already_open) close(unit, 1); // keep
-      return (true);
-    }
-    this_entry = this_entry->next;
-  }
+  found = tocindex_[unit].count(key) != 0;
 
   if(!already_open) close(unit, 1); // keep
-  return (false);
+  return (found);
+}
+
+bool PSIO::tocentry_contains(unsigned int unit, const char *key,
+                             psio_address start, ULI size) {
+  psio_address start_data, end_data;
+  ULI tocentry_size;
+
+  if (key == NULL || !open_check(unit))
+    return (false);
+
+  TOCIndex::const_iterator it = tocindex_[unit].find(key);
+  if (it == tocindex_[unit].end())
+    return (false);
+  psio_tocentry *this_entry = it->second;
+
+  tocentry_size = sizeof(psio_tocentry) - 2*sizeof(psio_tocentry *);
+  start_data = psio_get_address(this_entry->sadd, tocentry_size);
+  start_data = psio_get_global_address(start_data, start);
+  end_data = psio_get_address(start_data, size);
+
+  return (end_data.page < this_entry->eadd.page) ||
+         ((end_data.page == this_entry->eadd.page) &&
+          (end_data.offset <= this_entry->eadd.offset));
 }
 
   /*!
@@ -76,6 +76,8 @@ void PSIO::write(unsigned int unit, const char *key, char *buffer, ULI size,
       last_entry->next = this_entry;
       this_entry->last = last_entry;
     }
+    tocindex_[unit].insert(std::make_pair(std::string(this_entry->key), this_entry));
+    toctail_[unit] = this_entry;
 
     /* compute important global addresses for the entry */
     start_toc = this_entry->sadd;
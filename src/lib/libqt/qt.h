@@ -94,6 +94,11 @@ void timer_init(void);
 void timer_done(void);
 void timer_on(const char *key);
 void timer_off(const char *key);
+int timer_handle(const char *key);
+void timer_on(int handle);
+void timer_off(int handle);
+void timer_count(double flops, double bytes = 0.0);
+void timer_trace(const char *filename);
 
 void filter(double *input, double *output, int *ioff, int norbs, int nfzc, 
       int nfzv);
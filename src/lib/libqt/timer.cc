@@ -27,42 +27,53 @@
 
 /*!
 ** \file
-** \brief Obtain user and system timings for blocks of code
+** \brief Obtain wall-clock timings for blocks of code
 ** \ingroup QT
 **
-** TIMER.CC: These functions allow one to obtain user and system
-** timings for arbitrary blocks of code.  If a code block is called
-** repeatedly during the course of program execution, the timer
-** functions will report the block's cumulative execution time and
-** the number of calls. In addition, one may time multiple code blocks
-** simultaneously, and even ``overlap'' timers.  Timing data is
-** written to the file "timer.dat" at the end of timer execution,
-** i.e., when timer_done() is called.
+** TIMER.CC: These functions allow one to obtain timings for arbitrary
+** blocks of code.  If a code block is called repeatedly during the
+** course of program execution, the timer functions will report the
+** block's cumulative execution time and the number of calls.  Timers
+** may be nested, and even ``overlapped''.  Timing data is written to
+** the file "timer.dat" when timer_done() is called.
 **
 ** To use the timer functions defined here:
 **
-** (1) Initialize the linked list of timers at the beginning of your
-** program: timer_init();
+** (1) Initialize the timers at the beginning of your program:
+** timer_init();
 **
 ** (2) Start a timer at the start of the block of code:
 ** timer_on("My Timer");
 **
 ** (3) Stop the timer at the end of the block: timer_off("My Timer");
 **
-** (4) When all timer calls are complete, dump the linked list of
-** timing data to the output file, "timer.dat": timer_done();
+** (4) When all timer calls are complete, write the timing data to the
+** output file, "timer.dat": timer_done();
 **
-** NB this code uses system functions ctime(), time(), and times(),
-** which may not quite be standard on all machines.
+** Each thread keeps its own call tree of timers, so timers may be used
+** inside parallel regions; a timer must be turned off by the thread
+** that turned it on.  timer_done() merges the trees of all threads and
+** reports calls, inclusive and self time of every node, together with
+** any FLOP and byte counts attributed with timer_count().
+**
+** Code that toggles a timer very often should look its name up once,
+**   static const int handle = timer_handle("My Timer");
+** and then call timer_on(handle) and timer_off(handle), which avoids
+** any string handling.
+**
+** If the environment variable PSI_PROFILE names a file (or after
+** timer_trace() has been called), every timer interval is recorded as
+** well, and timer_done() writes the intervals and the merged call tree
+** to that file as JSON in the Chrome trace-event format, which can be
+** loaded into chrome://tracing or any JSON reader.
 **
 ** T. Daniel Crawford, August 1999.
 **
-** Modified to use timeval structures for the module wall times, getting
-** nanosecond precision on cumulated wall time instead of second.
-** Useful to time integral computations where there can be millions
-** to billion calls to functions.
+** J. F. Gonthier, February 2016: nanosecond precision on cumulated
+** wall times.
 **
-** J. F. Gonthier, February 2016
+** Rewritten with interned handles and per-thread call trees timed by
+** the monotonic clock, 2016.
 */
 
 #include <cstdio>
@@ -70,53 +81,318 @@
 #include <unistd.h>
 #include <cstring>
 #include <ctime>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <chrono>
 #include <sys/param.h>
 #include <sys/times.h>
-#include <sys/time.h>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
 #include <libciomr/libciomr.h>
 #include <psifiles.h>
 #include <psi4-dec.h>
 #include "libparallel/ParallelPrinter.h"
+#include "qt.h"
 /* guess for HZ, if missing */
 #ifndef HZ
 #define HZ 60
 #endif
 
-#define TIMER_KEYLEN 128
-#define TIMER_OFF 0
-#define TIMER_ON 1
+/* Most intervals any one thread records for a trace */
+#define TIMER_MAX_EVENTS 2000000
 
 namespace psi {
 
-struct timer {
-    char key[TIMER_KEYLEN];
-    unsigned int status;
-    unsigned int calls;
-    double utime;
-    double stime;
-    double wtime;
-    struct tms ontime;
-    struct timeval wall_start;
-    struct timer *next;
-    struct timer *last;
+namespace {
+
+typedef long long timer_ticks;
+
+/* Nanoseconds on the monotonic clock */
+inline timer_ticks timer_now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* One node of a thread's call tree: a timer under a given parent */
+struct TimerNode {
+    int handle;
+    std::vector<int> children;
+    unsigned long calls;
+    timer_ticks ticks;
+    timer_ticks start;
+    double flops;
+    double bytes;
+
+    TimerNode(int h) : handle(h), calls(0), ticks(0), start(0), flops(0.0), bytes(0.0) {}
+};
+
+/* One closed timer interval, kept only when tracing */
+struct TimerEvent {
+    int handle;
+    timer_ticks start;
+    timer_ticks stop;
 };
 
-struct timer *global_timer;
+/* Everything one thread has timed */
+struct ThreadTimers {
+    int id;
+    std::vector<TimerNode> nodes;
+    std::vector<int> roots;
+    /// Open nodes, innermost last
+    std::vector<int> stack;
+    /// Handles of the string keys this thread has used, by address; the
+    /// copy of the key catches buffers that are reused for another name
+    std::unordered_map<const char *, std::pair<int, std::string> > keys;
+    std::vector<TimerEvent> events;
+    size_t dropped;
+
+    ThreadTimers(int i) : id(i), dropped(0) {}
+};
+
+/* A thread's pointer to its timers, valid for one timer_init() */
+struct ThreadSlot {
+    ThreadTimers *timers;
+    unsigned int generation;
+};
+
+/* The merged call tree of all threads */
+struct MergedNode {
+    int handle;
+    std::vector<int> children;
+    unsigned long calls;
+    timer_ticks ticks;
+    double flops;
+    double bytes;
+    int threads;
+
+    MergedNode(int h) : handle(h), calls(0), ticks(0), flops(0.0), bytes(0.0), threads(0) {}
+};
+
+/* Guards the names and the list of threads */
+boost::mutex timer_lock;
+std::vector<std::string> timer_names;
+std::unordered_map<std::string, int> timer_index;
+std::vector<ThreadTimers *> timer_threads;
+unsigned int timer_generation = 0;
+
+boost::thread_specific_ptr<ThreadSlot> timer_slot;
+
+bool timer_tracing = false;
+std::string timer_trace_file;
+
 time_t timer_start, timer_end;  /* Global wall-clock on and off times */
+timer_ticks timer_epoch;
+struct tms timer_tms_start;
+
+/* The calling thread's timers, registered on first use */
+ThreadTimers *local_timers()
+{
+    ThreadSlot *slot = timer_slot.get();
+    if(slot == NULL) {
+        slot = new ThreadSlot;
+        slot->timers = NULL;
+        slot->generation = 0;
+        timer_slot.reset(slot);
+    }
+    if(slot->timers == NULL || slot->generation != timer_generation) {
+        boost::mutex::scoped_lock lock(timer_lock);
+        slot->timers = new ThreadTimers(timer_threads.size());
+        slot->generation = timer_generation;
+        timer_threads.push_back(slot->timers);
+    }
+    return slot->timers;
+}
+
+std::string timer_name(int handle)
+{
+    boost::mutex::scoped_lock lock(timer_lock);
+    return (handle >= 0 && handle < (int) timer_names.size()) ? timer_names[handle] : "(bad handle)";
+}
+
+/* Handle of key, or -1 if no timer of that name exists */
+int timer_find(const char *key)
+{
+    boost::mutex::scoped_lock lock(timer_lock);
+    std::unordered_map<std::string, int>::const_iterator it = timer_index.find(key);
+    return it == timer_index.end() ? -1 : it->second;
+}
+
+/* Handle of key, through the thread's cache of keys */
+int local_handle(ThreadTimers *t, const char *key, bool create)
+{
+    std::unordered_map<const char *, std::pair<int, std::string> >::const_iterator it = t->keys.find(key);
+    if(it != t->keys.end() && it->second.second == key) return it->second.first;
+
+    int handle = create ? timer_handle(key) : timer_find(key);
+    if(handle >= 0) t->keys[key] = std::make_pair(handle, std::string(key));
+    return handle;
+}
+
+void close_node(ThreadTimers *t, int pos, timer_ticks now)
+{
+    TimerNode &node = t->nodes[t->stack[pos]];
+    node.ticks += now - node.start;
+    if(timer_tracing) {
+        if(t->events.size() < TIMER_MAX_EVENTS) {
+            TimerEvent event = {node.handle, node.start, now};
+            t->events.push_back(event);
+        }
+        else t->dropped++;
+    }
+    t->stack.erase(t->stack.begin() + pos);
+}
+
+/* Adds the subtree of thread node n to the children of merged node parent */
+void merge_node(std::vector<MergedNode> &merged, std::vector<int> &siblings,
+                const ThreadTimers *t, int n)
+{
+    const TimerNode &node = t->nodes[n];
+    int m = -1;
+    for(size_t i = 0; i < siblings.size(); ++i)
+        if(merged[siblings[i]].handle == node.handle) m = siblings[i];
+    if(m < 0) {
+        m = merged.size();
+        merged.push_back(MergedNode(node.handle));
+        siblings.push_back(m);
+    }
+    merged[m].calls += node.calls;
+    merged[m].ticks += node.ticks;
+    merged[m].flops += node.flops;
+    merged[m].bytes += node.bytes;
+    merged[m].threads++;
+
+    // merged may grow below, so the children are gathered by value
+    std::vector<int> children(merged[m].children);
+    for(size_t i = 0; i < node.children.size(); ++i)
+        merge_node(merged, children, t, node.children[i]);
+    merged[m].children = children;
+}
+
+double self_seconds(const std::vector<MergedNode> &merged, int m)
+{
+    timer_ticks self = merged[m].ticks;
+    for(size_t i = 0; i < merged[m].children.size(); ++i)
+        self -= merged[merged[m].children[i]].ticks;
+    return 1.0E-9 * std::max(self, (timer_ticks) 0);
+}
+
+void print_node(boost::shared_ptr<OutFile> printer, const std::vector<MergedNode> &merged,
+                int m, int depth)
+{
+    const MergedNode &node = merged[m];
+    double incl = 1.0E-9 * node.ticks;
+    std::string name = std::string(2 * depth, ' ') + timer_names[node.handle];
+    printer->Printf( "%-44s %10lu %12.6f %12.6f %4d", name.c_str(), node.calls,
+                     incl, self_seconds(merged, m), node.threads);
+    if(node.flops > 0.0 && incl > 0.0) printer->Printf( " %9.3f GFLOP/s", 1.0E-9 * node.flops / incl);
+    if(node.bytes > 0.0 && incl > 0.0) printer->Printf( " %9.3f GB/s", 1.0E-9 * node.bytes / incl);
+    printer->Printf( "\n");
+    for(size_t i = 0; i < node.children.size(); ++i)
+        print_node(printer, merged, node.children[i], depth + 1);
+}
+
+void json_string(FILE *fp, const std::string &s)
+{
+    fputc('"', fp);
+    for(size_t i = 0; i < s.size(); ++i) {
+        unsigned char c = s[i];
+        if(c == '"' || c == '\\') fprintf(fp, "\\%c", c);
+        else if(c < 0x20) fprintf(fp, "\\u%04x", c);
+        else fputc(c, fp);
+    }
+    fputc('"', fp);
+}
+
+void json_node(FILE *fp, const std::vector<MergedNode> &merged, int m)
+{
+    const MergedNode &node = merged[m];
+    fprintf(fp, "{\"name\":");
+    json_string(fp, timer_names[node.handle]);
+    fprintf(fp, ",\"calls\":%lu,\"inclusive\":%.9f,\"self\":%.9f,\"threads\":%d,\"flops\":%.17g,\"bytes\":%.17g,\"children\":[",
+            node.calls, 1.0E-9 * node.ticks, self_seconds(merged, m), node.threads, node.flops, node.bytes);
+    for(size_t i = 0; i < node.children.size(); ++i) {
+        if(i) fputc(',', fp);
+        json_node(fp, merged, node.children[i]);
+    }
+    fprintf(fp, "]}");
+}
+
+/* Writes the recorded intervals and the merged tree as a Chrome trace */
+void write_trace(const std::vector<MergedNode> &merged, const std::vector<int> &roots)
+{
+    FILE *fp = fopen(timer_trace_file.c_str(), "w");
+    if(fp == NULL) {
+        outfile->Printf( "\n  Warning: cannot open profile file %s.\n", timer_trace_file.c_str());
+        return;
+    }
+
+    size_t dropped = 0;
+    bool first = true;
+    fprintf(fp, "{\"traceEvents\":[\n");
+    for(size_t t = 0; t < timer_threads.size(); ++t) {
+        const ThreadTimers *thread = timer_threads[t];
+        dropped += thread->dropped;
+        fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,"
+                    "\"args\":{\"name\":\"thread %d\"}}", first ? "" : ",\n", thread->id, thread->id);
+        first = false;
+        for(size_t e = 0; e < thread->events.size(); ++e) {
+            const TimerEvent &event = thread->events[e];
+            fprintf(fp, ",\n{\"name\":");
+            json_string(fp, timer_names[event.handle]);
+            fprintf(fp, ",\"cat\":\"psi4\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    thread->id, 1.0E-3 * (event.start - timer_epoch), 1.0E-3 * (event.stop - event.start));
+        }
+    }
+    fprintf(fp, "\n],\n\"displayTimeUnit\":\"ms\",\n\"droppedEvents\":%lu,\n\"profile\":[", (unsigned long) dropped);
+    for(size_t i = 0; i < roots.size(); ++i) {
+        fprintf(fp, i ? ",\n" : "\n");
+        json_node(fp, merged, roots[i]);
+    }
+    fprintf(fp, "\n]}\n");
+    fclose(fp);
+}
+
+/* Frees the timers of all threads; their slots see a new generation */
+void clear_threads()
+{
+    for(size_t t = 0; t < timer_threads.size(); ++t)
+        delete timer_threads[t];
+    timer_threads.clear();
+    timer_generation++;
+}
+
+}
 
 /*!
-** timer_init(): Initialize the linked list of timers
+** timer_init(): Initialize the timers
 **
 ** \ingroup QT
 */
 void timer_init(void)
 {
-  extern struct timer *global_timer;
-  extern time_t timer_start;
+  clear_threads();
 
   timer_start = time(NULL);
+  times(&timer_tms_start);
+  timer_epoch = timer_now();
 
-  global_timer = NULL;
+  timer_trace_file = Process::environment("PSI_PROFILE");
+  timer_tracing = !timer_trace_file.empty();
+}
+
+/*!
+** timer_trace(): Record every timer interval from now on, and write them,
+** with the merged call tree, to the JSON file filename in timer_done().
+**
+** \ingroup QT
+*/
+void timer_trace(const char *filename)
+{
+  timer_trace_file = filename;
+  timer_tracing = !timer_trace_file.empty();
 }
 
 /*!
@@ -126,184 +402,165 @@ void timer_init(void)
 */
 void timer_done(void)
 {
-
-  char *host;
-  extern time_t timer_start, timer_end;
-  struct timer *this_timer, *next_timer;
-  extern struct timer *global_timer;
+  char host[40];
+  struct tms tms_end;
+  timer_ticks now = timer_now();
 
   timer_end = time(NULL);
-
-  host = (char *) malloc(40 * sizeof(char));
+  times(&tms_end);
   gethostname(host, 40);
+  host[39] = '\0';
+
+  /* Timers still on are closed now */
+  for(size_t t = 0; t < timer_threads.size(); ++t)
+      while(!timer_threads[t]->stack.empty())
+          close_node(timer_threads[t], timer_threads[t]->stack.size() - 1, now);
+
+  std::vector<MergedNode> merged;
+  std::vector<int> roots;
+  for(size_t t = 0; t < timer_threads.size(); ++t)
+      for(size_t i = 0; i < timer_threads[t]->roots.size(); ++i)
+          merge_node(merged, roots, timer_threads[t], timer_threads[t]->roots[i]);
+
+  /* Flat totals per timer, over all threads and parents */
+  std::vector<unsigned long> calls(timer_names.size(), 0);
+  std::vector<timer_ticks> ticks(timer_names.size(), 0);
+  std::vector<int> order;
+  for(size_t m = 0; m < merged.size(); ++m) {
+      if(!calls[merged[m].handle] && !ticks[merged[m].handle]) order.push_back(merged[m].handle);
+      calls[merged[m].handle] += merged[m].calls;
+      ticks[merged[m].handle] += merged[m].ticks;
+  }
 
-  /* Dump the timing data to timer.dat and free the timers */
+  /* Dump the timing data to timer.dat */
   boost::shared_ptr<OutFile> printer(new OutFile("timer.dat",APPEND));
   printer->Printf( "\n");
   printer->Printf( "Host: %s\n", host);
   printer->Printf( "\n");
   printer->Printf( "Timers On : %s", ctime(&timer_start));
   printer->Printf( "Timers Off: %s", ctime(&timer_end));
-  printer->Printf( "\nWall Time:  %10.2f seconds\n\n",
-          (double) timer_end - timer_start);
-
-  this_timer = global_timer;
-  while(this_timer != NULL) {
-      if(this_timer->calls > 1) {
-          if(this_timer->wtime < 10.0) {
-              printer->Printf( "%-12s: %10.2fu %10.2fs %10.6fw %6d calls\n",
-                      this_timer->key, this_timer->utime, this_timer->stime,
-                      this_timer->wtime, this_timer->calls);
-          } else {
-              printer->Printf( "%-12s: %10.2fu %10.2fs %10.2fw %6d calls\n",
-                      this_timer->key, this_timer->utime, this_timer->stime,
-                      this_timer->wtime, this_timer->calls);
-          }
-      }
-      else if(this_timer->calls == 1) {
-          if(this_timer->wtime < 10.0) {
-              printer->Printf( "%-12s: %10.2fu %10.2fs %10.8fw %6d call\n",
-                      this_timer->key, this_timer->utime, this_timer->stime,
-                      this_timer->wtime, this_timer->calls);
-          } else {
-              printer->Printf( "%-12s: %10.2fu %10.2fs %10.2fw %6d call\n",
-                      this_timer->key, this_timer->utime, this_timer->stime,
-                      this_timer->wtime, this_timer->calls);
-          }
-      }
-      next_timer = this_timer->next;
-      free(this_timer);
-      this_timer = next_timer;
-    }
+  printer->Printf( "\nWall Time:  %10.2f seconds\n", 1.0E-9 * (now - timer_epoch));
+  printer->Printf( "User Time:  %10.2f seconds\n",
+          ((double) (tms_end.tms_utime - timer_tms_start.tms_utime))/HZ);
+  printer->Printf( "Sys Time:   %10.2f seconds\n\n",
+          ((double) (tms_end.tms_stime - timer_tms_start.tms_stime))/HZ);
+
+  for(size_t i = 0; i < order.size(); ++i) {
+      int h = order[i];
+      printer->Printf( "%-12s: %14.6fw %8lu call%s\n", timer_names[h].c_str(),
+              1.0E-9 * ticks[h], calls[h], calls[h] == 1 ? "" : "s");
+  }
+
+  if(!merged.empty()) {
+      printer->Printf( "\nCall tree (times in seconds, summed over threads):\n\n");
+      printer->Printf( "%-44s %10s %12s %12s %4s\n", "Timer", "Calls", "Inclusive", "Self", "Thr");
+      for(size_t i = 0; i < roots.size(); ++i)
+          print_node(printer, merged, roots[i], 0);
+  }
 
   printer->Printf(
           "\n***********************************************************\n");
 
-  free(host);
+  if(timer_tracing) write_trace(merged, roots);
 
-  global_timer = NULL;
+  clear_threads();
 }
 
 /*!
-** timer_scan(): Return a timer structure whose name matches that given
-**   by supplied string
+** timer_handle(): Returns the handle of the timer with the given name,
+** creating it if need be.  Handles stay valid for the whole run.
 **
-** \param key = name of timer to search for
+** \param key = Name of timer
 **
-** Returns: the timer structure with the given name, else NULL
 ** \ingroup QT
 */
-struct timer *timer_scan(const char *key)
+int timer_handle(const char *key)
 {
-  extern struct timer *global_timer;
-  struct timer *this_timer;
-
-  this_timer = global_timer;
-
-  while(this_timer != NULL) {
-      if(!strcmp(this_timer->key,key)) return(this_timer);
-      this_timer = this_timer->next;
-    }
-
-  return(this_timer);
+  boost::mutex::scoped_lock lock(timer_lock);
+  std::unordered_map<std::string, int>::const_iterator it = timer_index.find(key);
+  if(it != timer_index.end()) return it->second;
+
+  int handle = timer_names.size();
+  timer_names.push_back(key);
+  timer_index[key] = handle;
+  return handle;
 }
 
-/*
-** timer_last(): Find the last timer in the list and return a pointer to it
+/*!
+** timer_on(): Turn on the timer with the given handle in the calling
+** thread.  Can be turned on and off, time will accumulate while on.
 **
-** Returns: pointer to last timer in list, else NULL
+** \param handle = Handle of timer, from timer_handle()
 **
 ** \ingroup QT
 */
-struct timer *timer_last(void)
+void timer_on(int handle)
 {
-  extern struct timer *global_timer;
-  struct timer *this_timer;
+  ThreadTimers *t = local_timers();
+
+  for(size_t i = 0; i < t->stack.size(); ++i) {
+      if(t->nodes[t->stack[i]].handle == handle) {
+          std::string str = "Timer ";
+          str += timer_name(handle);
+          str += " is already on.";
+          throw PsiException(str,__FILE__,__LINE__);
+      }
+  }
 
-  this_timer = global_timer;
+  int parent = t->stack.empty() ? -1 : t->stack.back();
+  std::vector<int> &siblings = parent < 0 ? t->roots : t->nodes[parent].children;
+  int n = -1;
+  for(size_t i = 0; i < siblings.size(); ++i)
+      if(t->nodes[siblings[i]].handle == handle) n = siblings[i];
+  if(n < 0) { /* New node */
+      n = t->nodes.size();
+      (parent < 0 ? t->roots : t->nodes[parent].children).push_back(n);
+      t->nodes.push_back(TimerNode(handle));
+  }
 
-  while(this_timer != NULL) {
-      if(this_timer->next == NULL) return(this_timer);
-      this_timer = this_timer->next;
-    }
-  return(NULL);
+  t->nodes[n].calls++;
+  t->stack.push_back(n);
+  t->nodes[n].start = timer_now();
 }
 
 /*!
-** timer_on(): Turn on the timer with the name given as an argument.  Can
-** be turned on and off, time will accumulate while on.
+** timer_off(): Turn off the timer with the given handle in the calling
+** thread.  Can be turned on and off, time will accumulate while on.
 **
-** \param key = Name of timer
+** \param handle = Handle of timer, from timer_handle()
 **
 ** \ingroup QT
 */
-void timer_on(const char *key)
+void timer_off(int handle)
 {
-  struct timer *this_timer;
-
-  this_timer = timer_scan(key);
-
-  if(this_timer == NULL) { /* New timer */
-      this_timer = (struct timer *) malloc(sizeof(struct timer));
-      strcpy(this_timer->key,key);
-      this_timer->calls = 0;
-      this_timer->utime = 0;
-      this_timer->stime = 0;
-      this_timer->wtime = 0;
-      this_timer->next = NULL;
-      this_timer->last = timer_last();
-      if(this_timer->last != NULL) this_timer->last->next = this_timer;
-      else global_timer = this_timer;
-    }
-  else {
-    if((this_timer->status == TIMER_ON) && (this_timer->calls)) {
-        std::string str = "Timer ";
-        str += key;
-        str += " is already on.";
-        throw PsiException(str,__FILE__,__LINE__);
-    }
-  }
+  timer_ticks now = timer_now();
+  ThreadTimers *t = local_timers();
 
-  this_timer->status = TIMER_ON;
-  this_timer->calls++;
+  int pos = t->stack.size() - 1;
+  while(pos >= 0 && t->nodes[t->stack[pos]].handle != handle) pos--;
+
+  if(pos < 0) {
+      std::string str = "Timer ";
+      str += timer_name(handle);
+      str += " is already off.";
+      throw PsiException(str,__FILE__,__LINE__);
+  }
 
-  times(&(this_timer->ontime));
-  gettimeofday(&(this_timer->wall_start), NULL);
+  close_node(t, pos, now);
 }
 
 /*!
-** timer_nsdiff(struct timeval endt, struct timeval begint): Returns
-** the time difference between two timeval values as a double, in seconds.
-** Takes into account the difference in nanoseconds accurately.
-** Taken from gnu.org, supposedly the best way to do that works even on
-** peculiar OS where tv_sec is unsigned.
-**
-** \param endt = Final timeval value as obtained through gettimeofday()
-**
-** \param begint = Initial timeval value as obtained through gettimeofday()
+** timer_on(): Turn on the timer with the name given as an argument.  Can
+** be turned on and off, time will accumulate while on.
 **
-** Returns: the time difference in seconds as a double.
+** \param key = Name of timer
 **
 ** \ingroup QT
 */
-
-double timer_nsdiff(struct timeval& endt, struct timeval& begint) {
-  /*Carry the difference in nanoseconds to the second if needed */
-  long int nsec;
-  long int million = 1000 * 1000;
-  if(endt.tv_usec < begint.tv_usec) {
-    nsec = (begint.tv_usec - endt.tv_usec) / million + 1;
-    begint.tv_usec -= million * nsec;
-    begint.tv_sec += nsec;
-  }
-  if(endt.tv_usec - begint.tv_usec > million) {
-    nsec = (endt.tv_usec - begint.tv_usec) / million;
-    begint.tv_usec += million * nsec;
-    begint.tv_sec -= nsec; 
-  }
-
-  return ( (double)(endt.tv_sec - begint.tv_sec) + ((endt.tv_usec - begint.tv_usec) / ((double)million)) );
-} 
+void timer_on(const char *key)
+{
+  timer_on(local_handle(local_timers(), key, true));
+}
 
 /*!
 ** timer_off(): Turn off the timer with the name given as an argument.  Can
@@ -315,36 +572,35 @@ double timer_nsdiff(struct timeval& endt, struct timeval& begint) {
 */
 void timer_off(const char *key)
 {
-  struct tms ontime, offtime;
-  struct timer *this_timer;
-  struct timeval wall_stop;
-
-  this_timer = timer_scan(key);
+  int handle = local_handle(local_timers(), key, false);
 
-  if(this_timer == NULL) {
+  if(handle < 0) {
       std::string str = "Bad timer key:";
       str += key;
       throw PsiException(str,__FILE__,__LINE__);
-    }
-
-  if(this_timer->status == TIMER_OFF) {
-     std::string str = "Timer ";
-     str += key;
-     str += " is already off.";
-     throw PsiException(str,__FILE__,__LINE__);
-    }
-
-  ontime = this_timer->ontime;
-
-  times(&offtime);
+  }
 
-  this_timer->utime += ((double) (offtime.tms_utime-ontime.tms_utime))/HZ;
-  this_timer->stime += ((double) (offtime.tms_stime-ontime.tms_stime))/HZ;
+  timer_off(handle);
+}
 
-  gettimeofday(&wall_stop, NULL);
-  this_timer->wtime += timer_nsdiff(wall_stop, this_timer->wall_start);
+/*!
+** timer_count(): Attribute floating-point operations and bytes moved to
+** the innermost timer that is on in the calling thread.  The report gives
+** them as rates over the timer's inclusive time.
+**
+** \param flops = Number of floating-point operations
+** \param bytes = Number of bytes read or written
+**
+** \ingroup QT
+*/
+void timer_count(double flops, double bytes)
+{
+  ThreadTimers *t = local_timers();
+  if(t->stack.empty()) return;
 
-  this_timer->status = TIMER_OFF;
+  TimerNode &node = t->nodes[t->stack.back()];
+  node.flops += flops;
+  node.bytes += bytes;
 }
 
-}
\ No newline at end of file
+}
@@ -31,6 +31,7 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <boost/function.hpp>
 #include <libmints/dimension.h>
 #include <libmints/typedefs.h>
 #include "mospace.h"
@@ -53,6 +54,8 @@ class Dimension;
 class Wavefunction;
 
 typedef std::vector<boost::shared_ptr< MOSpace> > SpaceVec;
+/// Called with each finished bucket of a two-electron transformation: (buffer, irrep, first row, rows, block)
+typedef boost::function<void (dpdbuf4 *, int, size_t, int, double **)> TeiBucketFunctor;
 
   /**
      The IntegralTransform class transforms one- and two-electron integrals
@@ -215,6 +218,14 @@ class IntegralTransform{
         /// Whether TPDM has already presorted
         void set_tpdm_already_presorted(bool val) {tpdmAlreadyPresorted_ = val;}
 
+        /// Set whether to compute the SO integrals directly into the presort buckets,
+        /// instead of reading them from the IWL file.  Requires the wavefunction constructor.
+        /// The IWL file is then neither read nor deleted, so only callers for which it was
+        /// never written should turn this on.
+        void set_direct_tei(bool val) {directTei_ = val;}
+        /// Whether the SO integrals are computed directly into the presort buckets
+        bool get_direct_tei() const {return directTei_;}
+
         /// Whether SO intergals are already presorted
         bool get_tei_already_presorted() {return alreadyPresorted_;}
         void set_tei_already_presorted(bool val) {alreadyPresorted_ = val;}
@@ -265,6 +276,9 @@ class IntegralTransform{
         void presort_mo_tpdm_unrestricted();
         void setup_tpdm_buffer(const dpdbuf4 *D);
         void sort_so_tpdm(const dpdbuf4 *B, int irrep, size_t first_row, size_t num_rows, bool first_run);
+        void transform_tei_buckets(dpdbuf4 *J, dpdbuf4 *K, SharedMatrix cr, int *orbsr,
+                                   SharedMatrix cs, int *orbss,
+                                   const TeiBucketFunctor &done = TeiBucketFunctor());
 
         void trans_one(int m, int n, double *input, double *output, double **C, int soOffset,
                        int *order, bool backtransform = false, double scale = 0.0);
@@ -312,6 +326,8 @@ class IntegralTransform{
         std::map<std::string, int> dpdLookup_;
         // Whether the SO integrals have already been presorted
         bool alreadyPresorted_;
+        // Whether to compute the SO integrals in the presort, rather than read them from IWL
+        bool directTei_;
         // Whether to also write DPD formatted SO TPDMs after density transformations
         bool write_dpd_so_tpdm_;
         // The file to which DPD formatted integrals are written
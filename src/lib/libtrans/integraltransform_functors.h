@@ -544,6 +544,34 @@ private:
     }
 };
 
+/*
+ * Hands each SO integral coming out of TwoBodySOInt to a DPD filler and,
+ * optionally, a Fock-like functor; this is the direct counterpart of
+ * iwl_integrals(), used when the integrals never go through an IWL file.
+ * The filler may be shared between threads, because every unique integral
+ * lands in distinct DPD elements, but each thread needs its own Fock functor.
+ */
+template <class FockFunctor>
+class DirectPresortFunctor {
+private:
+    DPDFillerFunctor *dpd_;
+    FockFunctor *fock_;
+public:
+    DirectPresortFunctor(DPDFillerFunctor *dpd, FockFunctor *fock)
+        : dpd_(dpd), fock_(fock)
+    {}
+
+    void operator()(int pabs, int qabs, int rabs, int sabs,
+                    int psym, int prel, int qsym, int qrel,
+                    int rsym, int rrel, int ssym, int srel, double value)
+    {
+        (*dpd_)(pabs, qabs, rabs, sabs, value);
+        if(fock_)
+            (*fock_)(pabs, qabs, rabs, sabs, psym, prel, qsym, qrel,
+                     rsym, rrel, ssym, srel, value);
+    }
+};
+
 class NullFunctor {
 public:
     /*
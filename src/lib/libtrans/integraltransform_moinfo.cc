@@ -55,6 +55,9 @@ void IntegralTransform::common_initialize()
 
     write_dpd_so_tpdm_ = false;
 
+    // Only callers that skipped writing the IWL file turn this on (see set_direct_tei)
+    directTei_ = false;
+
     int count = 0;
     for(int h = 0; h < nirreps_; ++h){
         for(int i = 0; i < sopi_[h]; ++i, ++count){
@@ -31,14 +31,110 @@
 #include <libqt/qt.h>
 #include <libiwl/iwl.hpp>
 #include <libmints/matrix.h>
+#include <libmints/mints.h>
+#include <libmints/sointegral_twobody.h>
 #include "psifiles.h"
 #include "integraltransform_functors.h"
 #include "mospace.h"
+#include <algorithm>
 #define EXTERN
 #include <libdpd/dpd.gbl>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace psi;
 
+namespace {
+
+/*
+ * For every (P,Q) pair of SO shells, the sorted list of presort buckets that
+ * hold at least one of its (pq) rows.  Stored as pairBuckets[P*nshell+Q].
+ */
+std::vector<std::vector<int> > so_pair_buckets(boost::shared_ptr<SOBasisSet> sobasis, int **bucketMap)
+{
+    int nshell = sobasis->nshell();
+    std::vector<int> absfunc;
+    for(int f = 0; f < sobasis->dimension().sum(); ++f)
+        absfunc.push_back(sobasis->function_offset_for_irrep(sobasis->irrep(f))
+                          + sobasis->function_within_irrep(f));
+
+    std::vector<std::vector<int> > pairBuckets(nshell * nshell);
+    for(int P = 0; P < nshell; ++P){
+        for(int Q = 0; Q <= P; ++Q){
+            std::vector<int> &buckets = pairBuckets[P * nshell + Q];
+            for(int p = 0; p < sobasis->nfunction(P); ++p){
+                int pabs = absfunc[sobasis->function(P) + p];
+                for(int q = 0; q < sobasis->nfunction(Q); ++q){
+                    int qabs = absfunc[sobasis->function(Q) + q];
+                    buckets.push_back(bucketMap[std::max(pabs, qabs)][std::min(pabs, qabs)]);
+                }
+            }
+            std::sort(buckets.begin(), buckets.end());
+            buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+            pairBuckets[Q * nshell + P] = buckets;
+        }
+    }
+    return pairBuckets;
+}
+
+/*
+ * Computes the unique SO integrals of wfn that land in presort bucket
+ * "bucket", one (P>=Q) shell pair per task, and hands them to the DPD
+ * filler.  A shell quartet is only computed on the passes whose bucket holds
+ * one of its (PQ) or (RS) rows, so each quartet is computed once per bucket
+ * it touches rather than once per pass.  Its Fock contribution goes to the
+ * functor of the computing thread on the first of those passes only.
+ */
+template <class FockFunctor>
+void direct_so_tei(boost::shared_ptr<Wavefunction> wfn, DPDFillerFunctor &dpdfiller,
+                   std::vector<FockFunctor> &focks, int nthread, int bucket,
+                   const std::vector<std::vector<int> > &pairBuckets)
+{
+    boost::shared_ptr<SOBasisSet> sobasis = wfn->sobasisset();
+    boost::shared_ptr<IntegralFactory> factory = wfn->integral();
+    std::vector<boost::shared_ptr<TwoBodyAOInt> > tb;
+    for(int thread = 0; thread < nthread; ++thread)
+        tb.push_back(boost::shared_ptr<TwoBodyAOInt>(factory->eri()));
+    boost::shared_ptr<TwoBodySOInt> eri(new TwoBodySOInt(tb, factory));
+    eri->set_cutoff(Process::environment.options.get_double("INTS_TOLERANCE"));
+
+    std::vector<std::pair<int,int> > PQ;
+    SO_PQ_Iterator PQIter(sobasis);
+    for(PQIter.first(); PQIter.is_done() == false; PQIter.next())
+        PQ.push_back(std::make_pair(PQIter.p(), PQIter.q()));
+
+    std::vector<DirectPresortFunctor<FockFunctor> > fillers, fockFillers;
+    for(int thread = 0; thread < nthread; ++thread){
+        fillers.push_back(DirectPresortFunctor<FockFunctor>(&dpdfiller, 0));
+        fockFillers.push_back(DirectPresortFunctor<FockFunctor>(&dpdfiller, &focks[thread]));
+    }
+
+    int nshell = sobasis->nshell();
+    long int npq = PQ.size();
+#pragma omp parallel for schedule(dynamic) num_threads(nthread)
+    for(long int pq = 0; pq < npq; ++pq){
+        int thread = 0;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+#endif
+        const std::vector<int> &pqBuckets = pairBuckets[PQ[pq].first * nshell + PQ[pq].second];
+        bool pqHere = std::binary_search(pqBuckets.begin(), pqBuckets.end(), bucket);
+        SO_RS_Iterator RSIter(PQ[pq].first, PQ[pq].second, sobasis, sobasis, sobasis, sobasis);
+        for(RSIter.first(); RSIter.is_done() == false; RSIter.next()){
+            const std::vector<int> &rsBuckets = pairBuckets[RSIter.r() * nshell + RSIter.s()];
+            if(!pqHere && !std::binary_search(rsBuckets.begin(), rsBuckets.end(), bucket))
+                continue;
+            if(std::min(pqBuckets.front(), rsBuckets.front()) == bucket)
+                eri->compute_shell(RSIter.p(), RSIter.q(), RSIter.r(), RSIter.s(), fockFillers[thread]);
+            else
+                eri->compute_shell(RSIter.p(), RSIter.q(), RSIter.r(), RSIter.s(), fillers[thread]);
+        }
+    }
+}
+
+}
+
 /**
  * @brief Computes Fock matrices, frozen core operators and other Fock-like quantities.  This shouldn't
  *        be needed because those quantities are computed during the SO integral presort.  However, in
@@ -185,6 +281,9 @@ IntegralTransform::presort_so_tei()
         return;
     }
 
+    if(directTei_ && !wfn_)
+        throw PSIEXCEPTION("IntegralTransform: direct SO integrals need the wavefunction constructor.");
+
     // Set aside some memory for the frozen core density and frozen core operator
     double *aFzcD  = init_array(nTriSo_);
     double *aFzcOp = init_array(nTriSo_);
@@ -245,7 +344,10 @@ IntegralTransform::presort_so_tei()
     dpd_set_default(myDPDNum_);
 
     if(print_){
-        outfile->Printf( "\tPresorting SO-basis two-electron integrals.\n");
+        if(directTei_)
+            outfile->Printf( "\tComputing SO-basis two-electron integrals directly into the presort buckets.\n");
+        else
+            outfile->Printf( "\tPresorting SO-basis two-electron integrals.\n");
         
     }
 
@@ -311,6 +413,16 @@ IntegralTransform::presort_so_tei()
         
     }
 
+    // Each thread accumulates its own Fock-like matrices, summed after the last pass
+    int nthread = Process::environment.get_n_threads();
+    int nmat = transformationType_ == Restricted ? 2 : 4;
+    double **Fthread = 0;
+    std::vector<std::vector<int> > pairBuckets;
+    if(directTei_){
+        Fthread = block_matrix(nthread * nmat, nTriSo_);
+        pairBuckets = so_pair_buckets(wfn_->sobasisset(), bucketMap);
+    }
+
     next = PSIO_ZERO;
     for(int n=0; n < nBuckets; ++n) { /* nbuckets = number of passes */
         /* Prepare target matrix */
@@ -319,25 +431,41 @@ IntegralTransform::presort_so_tei()
         }
 
         DPDFillerFunctor dpdfiller(&I,n,bucketMap,bucketOffset, false, true);
-        NullFunctor null;
-        IWL *iwl = new IWL(psio_.get(), soIntTEIFile_, tolerance_, 1, 1);
-        // In the functors below, we only want to build the Fock matrix on the first pass
-        if(transformationType_ == Restricted){
-            FrozenCoreAndFockRestrictedFunctor fock(aD, aFzcD,aFock,aFzcOp);
-            if(n)
-                iwl_integrals(iwl, dpdfiller, null);
-            else
-                iwl_integrals(iwl, dpdfiller, fock);
+        if(directTei_){
+            if(transformationType_ == Restricted){
+                std::vector<FrozenCoreAndFockRestrictedFunctor> focks;
+                for(int thread = 0; thread < nthread; ++thread)
+                    focks.push_back(FrozenCoreAndFockRestrictedFunctor(aD, aFzcD,
+                                    Fthread[nmat*thread], Fthread[nmat*thread+1]));
+                direct_so_tei(wfn_, dpdfiller, focks, nthread, n, pairBuckets);
+            }else{
+                std::vector<FrozenCoreAndFockUnrestrictedFunctor> focks;
+                for(int thread = 0; thread < nthread; ++thread)
+                    focks.push_back(FrozenCoreAndFockUnrestrictedFunctor(aD, bD, aFzcD, bFzcD,
+                                    Fthread[nmat*thread], Fthread[nmat*thread+1],
+                                    Fthread[nmat*thread+2], Fthread[nmat*thread+3]));
+                direct_so_tei(wfn_, dpdfiller, focks, nthread, n, pairBuckets);
+            }
         }else{
-            FrozenCoreAndFockUnrestrictedFunctor fock(aD, bD, aFzcD, bFzcD,
-                                                      aFock, bFock, aFzcOp, bFzcOp);
-            if(n)
-                iwl_integrals(iwl, dpdfiller, null);
-            else
-                iwl_integrals(iwl, dpdfiller, fock);
+            NullFunctor null;
+            IWL *iwl = new IWL(psio_.get(), soIntTEIFile_, tolerance_, 1, 1);
+            // In the functors below, we only want to build the Fock matrix on the first pass
+            if(transformationType_ == Restricted){
+                FrozenCoreAndFockRestrictedFunctor fock(aD, aFzcD,aFock,aFzcOp);
+                if(n)
+                    iwl_integrals(iwl, dpdfiller, null);
+                else
+                    iwl_integrals(iwl, dpdfiller, fock);
+            }else{
+                FrozenCoreAndFockUnrestrictedFunctor fock(aD, bD, aFzcD, bFzcD,
+                                                          aFock, bFock, aFzcOp, bFzcOp);
+                if(n)
+                    iwl_integrals(iwl, dpdfiller, null);
+                else
+                    iwl_integrals(iwl, dpdfiller, fock);
+            }
+            delete iwl;
         }
-        delete iwl;
-
 
         for(int h=0; h < nirreps_; ++h) {
             if(bucketSize[n][h])
@@ -347,9 +475,23 @@ IntegralTransform::presort_so_tei()
         }
     } /* end loop over buckets/passes */
 
+    if(directTei_){
+        for(int thread = 0; thread < nthread; ++thread){
+            C_DAXPY(nTriSo_, 1.0, Fthread[nmat*thread], 1, aFock, 1);
+            C_DAXPY(nTriSo_, 1.0, Fthread[nmat*thread+1], 1, aFzcOp, 1);
+            if(transformationType_ != Restricted){
+                C_DAXPY(nTriSo_, 1.0, Fthread[nmat*thread+2], 1, bFock, 1);
+                C_DAXPY(nTriSo_, 1.0, Fthread[nmat*thread+3], 1, bFzcOp, 1);
+            }
+        }
+        free_block(Fthread);
+    }
+
     /* Get rid of the input integral file */
-    psio_->open(soIntTEIFile_, PSIO_OPEN_OLD);
-    psio_->close(soIntTEIFile_, keepIwlSoInts_);
+    if(!directTei_){
+        psio_->open(soIntTEIFile_, PSIO_OPEN_OLD);
+        psio_->close(soIntTEIFile_, keepIwlSoInts_);
+    }
 
     free_int_matrix(bucketMap);
 
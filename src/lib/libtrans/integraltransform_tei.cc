@@ -29,14 +29,20 @@
 #include <libpsio/psio.hpp>
 #include <libciomr/libciomr.h>
 #include <libiwl/iwl.hpp>
+#include <libmints/matrix.h>
 #include <libqt/qt.h>
+#include <psi4-dec.h>
 #include <math.h>
+#include <algorithm>
 #include <ctype.h>
 #include <stdio.h>
 #include "psifiles.h"
 #include "mospace.h"
 #define EXTERN
 #include <libdpd/dpd.gbl>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace boost;
 using namespace psi;
@@ -65,4 +71,172 @@ IntegralTransform::transform_tei(const boost::shared_ptr<MOSpace> s1, const boos
         keepHtInts_ = true;
     }
     transform_tei_second_half(s1, s2, s3, s4);
-}
\ No newline at end of file
+}
+
+/**
+ * Transforms the ket of every row of J into the ket of K, one out-of-core bucket of rows
+ * at a time:  K[pq](r,s) = sum_mn Cr(m,r) J[pq](m,n) Cs(n,s).  The rows of a bucket are
+ * spread over the threads, each with its own scratch space.  Buckets are read and written
+ * in their on-disk layout; the kets are unpacked and packed row by row.  When the files
+ * allow it, the next bucket of J is read and the previous bucket of K is written while the
+ * current one is transformed.
+ *
+ * @param J     - the input buffer; its bra must be stored as it is laid out in core
+ * @param K     - the output buffer, with the same bra as J
+ * @param cr    - the coefficients for the first ket index
+ * @param orbsr - the number of orbitals per irrep in cr
+ * @param cs    - the coefficients for the second ket index
+ * @param orbss - the number of orbitals per irrep in cs
+ * @param done  - if set, called with each finished bucket of K, in on-disk layout,
+ *                before it is written
+ */
+void
+IntegralTransform::transform_tei_buckets(dpdbuf4 *J, dpdbuf4 *K, SharedMatrix cr, int *orbsr,
+                                         SharedMatrix cs, int *orbss, const TeiBucketFunctor &done)
+{
+    int nthread = Process::environment.get_n_threads();
+
+    dpdbuf4 Jd, Kd;
+    global_dpd_->buf4_init(&Jd, J->file.filenum, J->file.my_irrep, J->file.params->pqnum,
+                           J->file.params->rsnum, J->file.params->pqnum, J->file.params->rsnum,
+                           0, J->file.label);
+    global_dpd_->buf4_init(&Kd, K->file.filenum, K->file.my_irrep, K->file.params->pqnum,
+                           K->file.params->rsnum, K->file.params->pqnum, K->file.params->rsnum,
+                           0, K->file.label);
+    bool unpackJ = J->params->rsnum != Jd.params->rsnum;
+    bool packK = K->params->rsnum != Kd.params->rsnum;
+
+    for(int h=0; h < nirreps_; h++) {
+        size_t rowtot = static_cast<size_t>(Jd.params->rowtot[h]);
+        size_t jcols = static_cast<size_t>(Jd.params->coltot[h]);
+        size_t kcols = static_cast<size_t>(Kd.params->coltot[h]);
+        size_t jrow = static_cast<size_t>(J->params->coltot[h]);
+        size_t krow = static_cast<size_t>(K->params->coltot[h]);
+        size_t scratch = static_cast<size_t>(nso_) * nso_ + (unpackJ ? jrow : 0) + (packK ? krow : 0);
+
+        // Double buffering splits the core between two buckets of each
+        bool pipeline = global_dpd_->buf4_mat_irrep_async_ok(&Jd) && global_dpd_->buf4_mat_irrep_async_ok(&Kd);
+        // Each thread needs its own scratch; use fewer threads rather than fail when the
+        // scratch of all of them would leave no room for one row of J and K
+        long int memAvail = dpd_memfree();
+        long int rowCost = static_cast<long int>((pipeline ? 2 : 1) * (jcols + kcols));
+        int nthreadh = 1;
+        if(memAvail > rowCost)
+            nthreadh = static_cast<int>(std::max(1L, std::min(static_cast<long int>(nthread),
+                                                              (memAvail - rowCost) / static_cast<long int>(scratch))));
+        long int memFree = memAvail - static_cast<long int>(nthreadh * scratch);
+        size_t rowsPerBucket = 0, rowsLeft = 0;
+        int nBuckets = 0;
+        if(rowtot && jcols && kcols) {
+            if(memFree > 0)
+                rowsPerBucket = static_cast<size_t>(memFree)/((pipeline ? 2 : 1) * (jcols + kcols));
+            if(rowsPerBucket > rowtot) rowsPerBucket = rowtot;
+            if(!rowsPerBucket)
+                throw PSIEXCEPTION("IntegralTransform: not enough memory for one row of the two-electron transformation.");
+            nBuckets = static_cast<int>(ceil(static_cast<double>(rowtot)/static_cast<double>(rowsPerBucket)));
+            rowsLeft = rowtot % rowsPerBucket;
+        }
+        if(nBuckets < 2) pipeline = false;
+
+        if(print_ > 1) {
+            outfile->Printf( "\th = %d; memfree         = %ld\n", h, memFree);
+            outfile->Printf( "\th = %d; rows_per_bucket = %lu\n", h, rowsPerBucket);
+            outfile->Printf( "\th = %d; rows_left       = %lu\n", h, rowsLeft);
+            outfile->Printf( "\th = %d; nbuckets        = %d\n", h, nBuckets);
+            outfile->Printf( "\th = %d; overlapped I/O  = %s\n", h, pipeline ? "yes" : "no");
+            outfile->Printf( "\th = %d; threads         = %d\n", h, nthreadh);
+        }
+        if(!nBuckets) continue;
+
+        double **Jblock[2], **Kblock[2];
+        Jblock[0] = global_dpd_->dpd_block_matrix(rowsPerBucket, jcols);
+        Kblock[0] = global_dpd_->dpd_block_matrix(rowsPerBucket, kcols);
+        Jblock[1] = pipeline ? global_dpd_->dpd_block_matrix(rowsPerBucket, jcols) : Jblock[0];
+        Kblock[1] = pipeline ? global_dpd_->dpd_block_matrix(rowsPerBucket, kcols) : Kblock[0];
+        double **scratchBlock = block_matrix(nthreadh, scratch);
+
+        unsigned long int readJob = 0;
+        unsigned long int writeJob[2] = {0, 0};
+        for(int n=0; n < nBuckets; n++) {
+            int b = pipeline ? n % 2 : 0;
+            size_t firstRow = n * rowsPerBucket;
+            int thisBucketRows = static_cast<int>(std::min(rowsPerBucket, rowtot - firstRow));
+            double **Jb = Jblock[b];
+            double **Kb = Kblock[b];
+
+            if(n == 0 || !pipeline)
+                readJob = global_dpd_->buf4_mat_irrep_rd_block_async(&Jd, h, firstRow, thisBucketRows, Jb);
+            global_dpd_->buf4_mat_irrep_rd_block_wait(readJob);
+            if(pipeline && n < nBuckets-1) {
+                int nextRows = static_cast<int>(std::min(rowsPerBucket, rowtot - firstRow - rowsPerBucket));
+                readJob = global_dpd_->buf4_mat_irrep_rd_block_async(&Jd, h, firstRow + rowsPerBucket,
+                                                                     nextRows, Jblock[1-b]);
+            }
+            // Kb is still being written out two buckets back
+            global_dpd_->buf4_mat_irrep_wrt_block_wait(writeJob[b]);
+
+#pragma omp parallel for schedule(dynamic) num_threads(nthreadh)
+            for(int pq=0; pq < thisBucketRows; pq++) {
+                int thread = 0;
+#ifdef _OPENMP
+                thread = omp_get_thread_num();
+#endif
+                double *TMP = scratchBlock[thread];
+                double *Jrow = unpackJ ? TMP + nso_ * nso_ : Jb[pq];
+                double *Krow = packK ? TMP + nso_ * nso_ + (unpackJ ? jrow : 0) : Kb[pq];
+
+                if(unpackJ) {
+                    for(size_t rs=0; rs < jrow; rs++) {
+                        int r = J->params->colorb[h][rs][0];
+                        int s = J->params->colorb[h][rs][1];
+                        Jrow[rs] = Jb[pq][Jd.params->colidx[r][s]];
+                    }
+                }
+                for(int Gr=0; Gr < nirreps_; Gr++) {
+                    // Transform ( X X | n n ) -> ( X X | n s )
+                    int Gs = h^Gr;
+                    int nrows = sopi_[Gr];
+                    int ncols = orbss[Gs];
+                    int nlinks = sopi_[Gs];
+                    int rs = J->col_offset[h][Gr];
+                    double **pcs = cs->pointer(Gs);
+                    if(nrows && ncols && nlinks)
+                        C_DGEMM('n', 'n', nrows, ncols, nlinks, 1.0, &Jrow[rs],
+                                nlinks, pcs[0], ncols, 0.0, TMP, nso_);
+
+                    // Transform ( X X | n s ) -> ( X X | r s )
+                    nrows = orbsr[Gr];
+                    nlinks = sopi_[Gr];
+                    rs = K->col_offset[h][Gr];
+                    double **pcr = cr->pointer(Gr);
+                    if(nrows && ncols && nlinks)
+                        C_DGEMM('t', 'n', nrows, ncols, nlinks, 1.0, pcr[0], nrows,
+                                TMP, nso_, 0.0, &Krow[rs], ncols);
+                } /* Gr */
+                if(packK) {
+                    for(size_t rs=0; rs < kcols; rs++) {
+                        int r = Kd.params->colorb[h][rs][0];
+                        int s = Kd.params->colorb[h][rs][1];
+                        Kb[pq][rs] = Krow[K->params->colidx[r][s]];
+                    }
+                }
+            } /* pq */
+
+            if(!done.empty()) done(&Kd, h, firstRow, thisBucketRows, Kb);
+            writeJob[b] = global_dpd_->buf4_mat_irrep_wrt_block_async(&Kd, h, firstRow, thisBucketRows, Kb);
+        }
+        global_dpd_->buf4_mat_irrep_rd_block_wait(readJob);
+        global_dpd_->buf4_mat_irrep_wrt_block_wait(writeJob[0]);
+        global_dpd_->buf4_mat_irrep_wrt_block_wait(writeJob[1]);
+
+        free_block(scratchBlock);
+        if(pipeline) {
+            global_dpd_->free_dpd_block(Jblock[1], rowsPerBucket, jcols);
+            global_dpd_->free_dpd_block(Kblock[1], rowsPerBucket, kcols);
+        }
+        global_dpd_->free_dpd_block(Jblock[0], rowsPerBucket, jcols);
+        global_dpd_->free_dpd_block(Kblock[0], rowsPerBucket, kcols);
+    }
+    global_dpd_->buf4_close(&Kd);
+    global_dpd_->buf4_close(&Jd);
+}